@@ -32,3 +32,14 @@ CREATE TABLE IF NOT EXISTS logs (
   message TEXT NOT NULL,
   timestamp INTEGER NOT NULL
 );
+
+-- Outbox-Events der Firmware (deviceId + seq), damit nachgelieferte Heat-Cycles nur einmal gespeichert werden
+CREATE TABLE IF NOT EXISTS heat_cycle_events (
+  device_id TEXT NOT NULL,
+  seq INTEGER NOT NULL,
+  heat_cycle_id TEXT,
+  duration INTEGER,
+  cycle INTEGER,
+  received_at INTEGER NOT NULL,
+  PRIMARY KEY (device_id, seq)
+);
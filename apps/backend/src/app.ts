@@ -14,6 +14,7 @@ import sessionRoute from "./routes/session.js";
 import stashRoute from "./routes/stash.js";
 import stashWithdrawalsRoute from "./routes/stashWithdrawals.js";
 import logsRoute from "./routes/logs.js";
+import commandsRoute from "./routes/commands.js";
 import tempReadingsRoute from "./routes/tempReadings.js";
 
 // Lokaler Error-Handler (ohne Sentry - nur für den VPS-Betrieb)
@@ -45,6 +46,7 @@ export function createApp(env: Env) {
   app.route("/api/stash_withdrawals", stashWithdrawalsRoute);
   app.route("/api/logs", logsRoute);
   app.route("/api/temp_readings", tempReadingsRoute);
+  app.route("/api/commands", commandsRoute);
 
   app.get("/health", (c) => c.json({ ok: true, service: "heizbox-backend" }));
 
@@ -49,6 +49,15 @@ CREATE TABLE IF NOT EXISTS temp_readings (
   is_heating INTEGER DEFAULT 0
 );
 CREATE INDEX IF NOT EXISTS idx_temp_readings_ts ON temp_readings(timestamp);
+CREATE TABLE IF NOT EXISTS heat_cycle_events (
+  device_id TEXT NOT NULL,
+  seq INTEGER NOT NULL,
+  heat_cycle_id TEXT,
+  duration INTEGER,
+  cycle INTEGER,
+  received_at INTEGER NOT NULL,
+  PRIMARY KEY (device_id, seq)
+);
 `);
 
 // ---- D1-kompatibles Statement (prepare/bind/all/first/run) ----
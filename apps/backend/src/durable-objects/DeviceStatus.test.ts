@@ -193,12 +193,43 @@ describe('DeviceStatus Durable Object', () => {
             expect(deviceStatus.publish).toHaveBeenCalledWith(expect.objectContaining({ type: 'sessionData' }));
         });
 
+        it('should ack a replayed heatCycleCompleted with the same seq as success', async () => {
+            // Vor dem NTP-Sync gesendet: kein at, nur seq
+            const message = { type: 'heatCycleCompleted', duration: 15, cycle: 1, seq: 7 };
+            env.db.first.mockResolvedValue({ duration: 15, cycle: 1 }); // Event schon gespeichert
+            const ws = { send: vi.fn() };
+
+            await deviceStatus.processDeviceMessage(ws as any, message);
+
+            expect(env.db.run).not.toHaveBeenCalled();
+            expect(ws.send).toHaveBeenCalledWith(JSON.stringify({ success: true, seq: 7 }));
+        });
+
+        it('should answer an invalid heatCycleCompleted with a terminal reason', async () => {
+            const message = { type: 'heatCycleCompleted', duration: 0, cycle: 1, seq: 9 };
+            const ws = { send: vi.fn() };
+
+            await deviceStatus.processDeviceMessage(ws as any, message);
+
+            expect(env.db.run).not.toHaveBeenCalled();
+            expect(ws.send).toHaveBeenCalledWith(JSON.stringify({ success: false, reason: 'invalid', seq: 9 }));
+        });
+
         it('should process stashUpdated message and publish', async () => {
             const message = { type: 'stashUpdated', item: { id: '1' } };
             vi.spyOn(deviceStatus, 'publish');
             await deviceStatus.processDeviceMessage(new Request('http://do'), message);
             expect(deviceStatus.publish).toHaveBeenCalledWith(message);
         });
+
+        it('should publish cmdAck without acking it back to the device', async () => {
+            const message = { type: 'cmdAck', id: 'c1', ok: false, error: 'locked' };
+            const ws = { send: vi.fn() };
+            vi.spyOn(deviceStatus, 'publish');
+            await deviceStatus.processDeviceMessage(ws as any, message);
+            expect(deviceStatus.publish).toHaveBeenCalledWith(message);
+            expect(ws.send).not.toHaveBeenCalled();
+        });
     });
 
     describe('Alarm Handler', () => {
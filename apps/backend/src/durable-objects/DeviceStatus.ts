@@ -2,6 +2,8 @@ import { Hono } from 'hono'
 import { SessionService } from '../services/sessionService.js' // Import SessionService
 import type { SessionData } from '@heizbox/types'
 import { HeatCycleService } from '../services/heatCycleService.js'
+import { ValidationError } from '../utils/validation.js'
+import { decodeTelemetryFrame, TELEMETRY_VERSION } from '../utils/telemetry.js'
 
 export class DeviceStatus {
 	state: DurableObjectState
@@ -261,7 +263,14 @@ export class DeviceStatus {
 				}
 				server.addEventListener('message', async (event) => {
 					try {
-						const message = JSON.parse(event.data as string)
+						// Binär = ausgehandeltes Telemetrie-Format der Firmware, sonst JSON
+						if (typeof event.data !== 'string') {
+							for (const message of decodeTelemetryFrame(event.data as ArrayBuffer)) {
+								await this.processDeviceMessage(server, message)
+							}
+							return
+						}
+						const message = JSON.parse(event.data)
 						await this.processDeviceMessage(server, message)
 					} catch (err) {
 						console.error('MSG ERROR: >', err)
@@ -320,20 +329,28 @@ export class DeviceStatus {
 			}
 			case '/send-message': {
 				const message = (await request.json()) as ServerWebSocketMessage
+				// {"type":"cmd"} nur über /command (routes/commands.ts, mit Token)
+				if ((message as { type?: string }).type === 'cmd') {
+					return new Response('Use /api/commands', { status: 403 })
+				}
 				this.broadcast(message)
 				return new Response('OK')
 			}
+			case '/command': {
+				// Von routes/commands.ts (authentifiziert), Quittung kommt als cmdAck vom Gerät
+				this.publish(await request.json())
+				return new Response('OK')
+			}
 			default:
 				return new Response('Not found', { status: 404 })
 		}
 	}
 
 	// New method to store log data
-	async storeLog(data: any, deviceId: string): Promise<void> {
+	async storeLog(data: any, deviceId: string, timestamp = Date.now()): Promise<void> {
 		try {
 			const { t: logType, m: message } = data
 			const id = `${Date.now()}-${Math.random().toString(36).substring(2, 15)}` // Simple unique ID
-			const timestamp = Date.now()
 			const finalDeviceId = deviceId || 'unknown-device'
 
 			if (!message) {
@@ -359,6 +376,21 @@ export class DeviceStatus {
 		if (message.t != undefined) {
 			console.log('DeviceStatus: Processing log message.', message)
 			await this.storeLog(message, deviceId)
+		} else if (Array.isArray(message.logs)) {
+			// Log-Batch der Firmware: ts und now sind Millis seit Boot, now = Versandzeitpunkt
+			const receivedAt = Date.now()
+			for (const line of message.logs) {
+				const age = typeof message.now === 'number' && typeof line.ts === 'number' ? message.now - line.ts : 0
+				await this.storeLog(line, deviceId, receivedAt - age)
+			}
+		} else if (message.type === 'logRecords') {
+			// "<build>:<hex>" - logdecode.py --hex prüft damit die ELF
+			await this.storeLog({ t: 'bin', m: `${message.build}:${message.data}` }, deviceId)
+		} else if (message.type === 'hello') {
+			// Format-Aushandlung: Binär nur bei passender Version, sonst bleibt das Gerät bei JSON
+			const bin = message.bin === TELEMETRY_VERSION ? TELEMETRY_VERSION : 0
+			ws.send(JSON.stringify({ type: 'hello', bin }))
+			return
 		} else if (message.type === 'statusUpdate') {
 			let statusChanged = false
 
@@ -401,7 +433,19 @@ export class DeviceStatus {
 			// Schneller Cache-Check vor DB-Abfrage
 
 			const heatCycleService = new HeatCycleService(this.env.db)
-			const success = await heatCycleService.createHeatCycle(message.duration, message.cycle || 1)
+			// Aus der Geräte-Outbox nachgelieferte Events tragen ihre Entstehungszeit (at) mit
+			const createdAt = typeof message.at === 'number' && message.at > 0 ? message.at : undefined
+			// seq macht das Event eindeutig: ein Duplikat (auch vor dem NTP-Sync, at = 0) wird quittiert statt abgelehnt
+			const event = typeof message.seq === 'number' ? { deviceId, seq: message.seq } : undefined
+			let success: boolean
+			try {
+				success = await heatCycleService.createHeatCycle(message.duration, message.cycle || 1, createdAt, event)
+			} catch (error) {
+				if (!(error instanceof ValidationError)) throw error
+				// Endgültig: das Gerät verwirft das Event, statt es ewig neu zu senden
+				ws.send(JSON.stringify({ success: false, reason: 'invalid', seq: message.seq }))
+				return
+			}
 
 			if (success) {
 				// Füge zu Cache hinzu
@@ -411,18 +455,22 @@ export class DeviceStatus {
 
 				const newSessionData = await this._getLatestSessionData()
 				this.publish({ type: 'sessionData', ...newSessionData })
-				ws.send(JSON.stringify({ success: true })) // Send success response to the device
+				ws.send(JSON.stringify({ success: true, seq: message.seq })) // Send success response to the device
 				return
 			} else {
-				ws.send(JSON.stringify({ success: false, reason: 'db_error' })) // Send error response to the device
+				ws.send(JSON.stringify({ success: false, reason: 'db_error', seq: message.seq })) // Send error response to the device
 				return
 			}
+		} else if (message.type === 'cmdAck') {
+			// Quittung eines per /send-message gesendeten {"type":"cmd"} - an die Frontends, kein Ack ans Gerät
+			this.publish(message)
+			return
 		} else if (message.type === 'stashUpdated') {
 			console.log('DeviceStatus: Processing stashUpdated message.', message)
 			this.publish(message) // Broadcast to all subscribers
 		}
 
-		ws.send(JSON.stringify({ success: true })) // Default success response
+		ws.send(JSON.stringify({ success: true, seq: message.seq })) // Default success response (seq = Outbox-Ack)
 	}
 
 	async alarm() {
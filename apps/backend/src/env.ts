@@ -12,6 +12,7 @@ export function createRuntime(): Runtime {
     db,
     DEVICE_STATUS: new DeviceStatusNamespace(hub) as unknown as DurableObjectNamespace,
     CF_VERSION_METADATA: { id: "local" },
+    COMMAND_TOKEN: process.env.COMMAND_TOKEN,
   } as Env;
   return { env, hub };
 }
@@ -2,6 +2,8 @@ import type { ServerWebSocket } from "bun";
 import type { SessionData } from "@heizbox/types";
 import { SessionService } from "./services/sessionService.js";
 import { HeatCycleService } from "./services/heatCycleService.js";
+import { ValidationError } from "./utils/validation.js";
+import { decodeTelemetryFrame, TELEMETRY_VERSION } from "./utils/telemetry.js";
 import type { DB } from "./db.js";
 
 interface WsMeta {
@@ -44,14 +46,22 @@ export class DeviceStatusHub {
   }
 
   handleMessage(ws: ServerWebSocket<WsMeta>, raw: string | Buffer) {
-    let message: any;
+    let messages: any[];
     try {
-      message = JSON.parse(raw.toString());
+      // Binär = ausgehandeltes Telemetrie-Format der Firmware, sonst JSON
+      messages = typeof raw === "string" ? [JSON.parse(raw)] : decodeTelemetryFrame(raw);
     } catch (err) {
       console.error("MSG PARSE ERROR:", err);
       return;
     }
-    void this.processDeviceMessage(ws, message);
+    void this.processDeviceMessages(ws, messages);
+  }
+
+  // Records eines Frames der Reihe nach (Reihenfolge = Outbox-Reihenfolge)
+  private async processDeviceMessages(ws: ServerWebSocket<WsMeta>, messages: any[]): Promise<void> {
+    for (const message of messages) {
+      await this.processDeviceMessage(ws, message);
+    }
   }
 
   // ---- HTTP-Stub-Routen (wie DO fetch()) ----
@@ -76,9 +86,16 @@ export class DeviceStatusHub {
       }
       case "/send-message": {
         const message = (await request.json()) as Record<string, unknown>;
+        // {"type":"cmd"} nur über /command (routes/commands.ts, mit Token)
+        if (message.type === "cmd") return new Response("Use /api/commands", { status: 403 });
         this.publish(message);
         return new Response("OK");
       }
+      case "/command": {
+        // Von routes/commands.ts (authentifiziert), Quittung kommt als cmdAck vom Gerät
+        this.publish(await request.json());
+        return new Response("OK");
+      }
       default:
         return new Response("Not found", { status: 404 });
     }
@@ -102,12 +119,32 @@ export class DeviceStatusHub {
       await this.storeLog(message, deviceId);
       return;
     }
+    if (Array.isArray(message.logs)) {
+      // Log-Batch der Firmware: ts und now sind Millis seit Boot
+      const receivedAt = Date.now();
+      for (const line of message.logs) {
+        const age = typeof message.now === "number" && typeof line.ts === "number" ? message.now - line.ts : 0;
+        await this.storeLog(line, deviceId, receivedAt - age);
+      }
+      return;
+    }
+    if (message.type === "logRecords") {
+      // Deferred-Logs als "<build>:<hex>", dekodieren mit apps/esp32/scripts/logdecode.py --hex
+      await this.storeLog({ t: "bin", m: `${message.build}:${message.data}` }, deviceId);
+      return;
+    }
+    if (message.type === "hello") {
+      // Format-Aushandlung: Binär nur bei passender Version, sonst bleibt das Gerät bei JSON
+      const bin = message.bin === TELEMETRY_VERSION ? TELEMETRY_VERSION : 0;
+      ws.send(JSON.stringify({ type: "hello", bin }));
+      return;
+    }
     if (message.type === "statusUpdate") {
       let changed = false;
       if (typeof message.isOn === "boolean" && this.isOn !== message.isOn) { this.isOn = message.isOn; changed = true; }
       if (typeof message.isHeating === "boolean" && this.isHeating !== message.isHeating) { this.isHeating = message.isHeating; changed = true; }
       if (changed) this.publish(message);
-      ws.send(JSON.stringify({ success: true }));
+      this.ack(ws, message);
       return;
     }
     if (message.type === "heartbeat") {
@@ -116,40 +153,71 @@ export class DeviceStatusHub {
         this.isOn = true;
         this.publish({ type: "statusUpdate", isOn: this.isOn, isHeating: this.isHeating });
       }
-      ws.send(JSON.stringify({ success: true }));
+      this.ack(ws, message);
       return;
     }
     if (message.type === "heatCycleCompleted" && typeof message.duration === "number") {
       const service = new HeatCycleService(this.db);
-      const success = await service.createHeatCycle(message.duration, message.cycle || 1);
+      // Aus der Geräte-Outbox nachgelieferte Events tragen ihre Entstehungszeit (at) und seq mit.
+      // deviceId + seq macht das Event eindeutig: ein Duplikat wird quittiert, nicht nochmal gespeichert.
+      const createdAt = typeof message.at === "number" && message.at > 0 ? message.at : undefined;
+      const event = typeof message.seq === "number" ? { deviceId, seq: message.seq } : undefined;
+      let success: boolean;
+      try {
+        success = await service.createHeatCycle(message.duration, message.cycle || 1, createdAt, event);
+      } catch (error) {
+        if (!(error instanceof ValidationError)) throw error;
+        // Endgültig: das Gerät verwirft das Event, statt es ewig neu zu senden
+        ws.send(JSON.stringify({ success: false, reason: "invalid", seq: message.seq }));
+        return;
+      }
       if (success) {
         this.sessionDataCache = null;
         const newSessionData = await this._getLatestSessionData();
         this.publish({ type: "sessionData", ...newSessionData });
-        ws.send(JSON.stringify({ success: true }));
+        this.ack(ws, message);
       } else {
-        ws.send(JSON.stringify({ success: false, reason: "db_error" }));
+        ws.send(JSON.stringify({ success: false, reason: "db_error", seq: message.seq }));
       }
       return;
     }
+    if (message.type === "cmdAck") {
+      // Quittung eines {"type":"cmd"} - an die Frontends, kein Ack ans Gerät
+      this.publish(message);
+      return;
+    }
     if (message.type === "stashUpdated") {
       this.publish(message);
-      ws.send(JSON.stringify({ success: true }));
+      this.ack(ws, message);
       return;
     }
     if (message.type === "tempReading") {
       // RAW IR-Temp Logging
       await this.storeTempReading(ws.data.deviceId || "HeizboxESP32", message);
-      ws.send(JSON.stringify({ success: true }));
+      this.ack(ws, message);
       return;
     }
-    ws.send(JSON.stringify({ success: true }));
+    if (message.type === "tempBatch" && Array.isArray(message.samples)) {
+      // t ist relativ zum ersten Sample (ms), age = Alter des ersten Samples beim Versand
+      const first = Date.now() - (typeof message.age === "number" ? message.age : 0);
+      for (const sample of message.samples) {
+        const t = typeof sample.t === "number" ? sample.t : 0;
+        await this.storeTempReading(ws.data.deviceId || "HeizboxESP32", sample, first + t);
+      }
+      this.ack(ws, message);
+      return;
+    }
+    this.ack(ws, message);
+  }
+
+  // seq = Outbox-Ack der Firmware, bei jeder Antwort zurückgeben
+  private ack(ws: ServerWebSocket<WsMeta>, message: any) {
+    ws.send(JSON.stringify({ success: true, seq: message.seq }));
   }
 
-  private async storeLog(data: any, deviceId: string): Promise<void> {
+  private async storeLog(data: any, deviceId: string, timestamp = Date.now()): Promise<void> {
     const { t: logType, m: message } = data;
     const id = `${Date.now()}-${Math.random().toString(36).substring(2, 15)}`;
-    const timestamp = Date.now();
     if (!message) return;
     try {
       await this.db
@@ -161,7 +229,8 @@ export class DeviceStatusHub {
     }
   }
 
-  private async storeTempReading(deviceId: string, msg: any): Promise<void> {
+  // Felder wie von der Firmware gesendet (tempReading bzw. ein tempBatch-Sample)
+  private async storeTempReading(deviceId: string, msg: any, timestamp = Date.now()): Promise<void> {
     try {
       await this.db
         .prepare(
@@ -169,10 +238,10 @@ export class DeviceStatusHub {
         )
         .bind(
           deviceId,
-          Date.now(),
-          typeof msg.temp_raw === "number" ? msg.temp_raw : null,
-          typeof msg.temp_calibrated === "number" ? msg.temp_calibrated : null,
-          msg.is_heating ? 1 : 0
+          timestamp,
+          typeof msg.tempRaw === "number" ? msg.tempRaw : null,
+          typeof msg.tempCalibrated === "number" ? msg.tempCalibrated : null,
+          msg.isHeating ? 1 : 0
         )
         .run();
     } catch (err) {
@@ -15,6 +15,7 @@ import sessionRoute from "./routes/session.js";
 import stashRoute from "./routes/stash.js";
 import stashWithdrawalsRoute from "./routes/stashWithdrawals.js";
 import logsRoute from "./routes/logs.js";
+import commandsRoute from "./routes/commands.js";
 
 const app = new Hono<{ Bindings: Env }>();
 
@@ -35,6 +36,7 @@ app.route("/api/session", sessionRoute);
 app.route("/api/stash", stashRoute);
 app.route("/api/stash_withdrawals", stashWithdrawalsRoute);
 app.route("/api/logs", logsRoute);
+app.route("/api/commands", commandsRoute);
 
 export default Sentry.withSentry(
   (env: Env) => ({
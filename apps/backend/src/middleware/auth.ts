@@ -0,0 +1,25 @@
+import type { MiddlewareHandler } from 'hono';
+
+// Bearer-Token für schreibende Geräte-Befehle (COMMAND_TOKEN: Worker-Secret bzw. env im Container).
+// Ohne gesetztes Token sind die Routen gesperrt, nicht offen.
+export const requireCommandToken: MiddlewareHandler<{ Bindings: Env }> = async (c, next) => {
+  const expected = c.env.COMMAND_TOKEN;
+  if (!expected) {
+    return c.json({ error: 'Commands disabled (COMMAND_TOKEN not set)' }, 503);
+  }
+  const header = c.req.header('Authorization') || '';
+  const token = header.startsWith('Bearer ') ? header.slice(7) : '';
+  if (!timingSafeEqual(token, expected)) {
+    return c.json({ error: 'Unauthorized' }, 401);
+  }
+  await next();
+};
+
+// Vergleich ohne frühen Abbruch beim ersten falschen Zeichen
+function timingSafeEqual(a: string, b: string): boolean {
+  let diff = a.length ^ b.length;
+  for (let i = 0; i < b.length; i++) {
+    diff |= (a.charCodeAt(i) || 0) ^ b.charCodeAt(i);
+  }
+  return diff === 0;
+}
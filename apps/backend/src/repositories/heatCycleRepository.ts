@@ -47,7 +47,41 @@ export class HeatCycleRepository {
 		return count || 0
 	}
 
-	async create(id: string, duration: number, cycle: number): Promise<void> {
+	async existsAt(duration: number, cycle: number, createdAt: number): Promise<boolean> {
+		const row = await this.db
+			.prepare('SELECT COUNT(*) as count FROM heat_cycles WHERE duration = ?1 AND cycle = ?2 AND created_at = ?3')
+			.bind(duration, cycle, createdAt)
+			.first<{ count: number }>()
+
+		return (row?.count || 0) > 0
+	}
+
+	// Outbox-Event (deviceId + seq) der Firmware, falls schon einmal verarbeitet
+	async findEvent(deviceId: string, seq: number): Promise<{ duration: number; cycle: number } | null> {
+		return this.db
+			.prepare('SELECT duration, cycle FROM heat_cycle_events WHERE device_id = ?1 AND seq = ?2')
+			.bind(deviceId, seq)
+			.first<{ duration: number; cycle: number }>()
+	}
+
+	async recordEvent(deviceId: string, seq: number, heatCycleId: string, duration: number, cycle: number): Promise<void> {
+		await this.db
+			.prepare(
+				'INSERT OR REPLACE INTO heat_cycle_events (device_id, seq, heat_cycle_id, duration, cycle, received_at) ' +
+					'VALUES (?1, ?2, ?3, ?4, ?5, ?6)',
+			)
+			.bind(deviceId, seq, heatCycleId, duration, cycle, Math.floor(Date.now() / 1000))
+			.run()
+	}
+
+	async create(id: string, duration: number, cycle: number, createdAt?: number): Promise<void> {
+		if (createdAt !== undefined) {
+			await this.db
+				.prepare('INSERT INTO heat_cycles (id, duration, cycle, created_at) VALUES (?1, ?2, ?3, ?4)')
+				.bind(id, duration, cycle, createdAt)
+				.run()
+			return
+		}
 		await this.db
 			.prepare('INSERT INTO heat_cycles (id, duration, cycle) VALUES (?1, ?2, ?3)')
 			.bind(id, duration, cycle)
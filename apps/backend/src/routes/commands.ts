@@ -0,0 +1,50 @@
+import { Hono } from 'hono';
+import { requireCommandToken } from '../middleware/auth.js';
+import { generateUuid } from '../utils/index.js';
+import { ValidationError } from '../utils/validation.js';
+
+const commands = new Hono<{ Bindings: Env }>();
+
+// Befehle wie in apps/esp32/include/services/RemoteCommands.h, nur deren Parameter werden weitergereicht
+const COMMANDS: Record<string, string[]> = {
+  setTemp: ['temp'],
+  setPreset: ['preset'],
+  start: [],
+  stop: [],
+  calibrate: ['points'],
+  burst: ['ms'],
+};
+
+commands.use('*', requireCommandToken);
+
+// POST /api/commands/:deviceId  { cmd, ...params } -> {"type":"cmd"} an das Gerät.
+// Die Quittung ({"type":"cmdAck","id":..}) kommt über den WebSocket an die Frontends.
+commands.post('/:deviceId', async (c) => {
+  const body = (await c.req.json().catch(() => null)) as Record<string, unknown> | null;
+  const cmd = typeof body?.cmd === 'string' ? body.cmd : '';
+  const params = COMMANDS[cmd];
+  if (!body || !params) {
+    throw new ValidationError(`Unknown cmd: ${cmd || '(none)'}`);
+  }
+
+  const id = typeof body.id === 'string' && body.id ? body.id : generateUuid();
+  const message: Record<string, unknown> = { type: 'cmd', id, cmd };
+  for (const key of params) {
+    if (body[key] !== undefined) message[key] = body[key];
+  }
+
+  const stub = c.env.DEVICE_STATUS.get(c.env.DEVICE_STATUS.idFromName(c.req.param('deviceId')));
+  const res = await stub.fetch(
+    new Request('http://device-status/command', {
+      method: 'POST',
+      body: JSON.stringify(message),
+      headers: { 'Content-Type': 'application/json' },
+    }),
+  );
+  if (!res.ok) {
+    return c.json({ error: 'Failed to send command' }, 502);
+  }
+  return c.json({ success: true, id });
+});
+
+export default commands;
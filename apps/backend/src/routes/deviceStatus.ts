@@ -11,6 +11,11 @@ deviceStatus.all('/:deviceId/*', async (c) => {
   const url = new URL(c.req.url);
   url.pathname = url.pathname.replace(`/api/device-status/${deviceId}`, '');
 
+  // Gerätebefehle nur über die authentifizierte Route /api/commands
+  if (url.pathname === '/command') {
+    return c.json({ error: 'Use /api/commands' }, 403);
+  }
+
   // Forward the request to the Durable Object
   let requestBody = null;
   if (c.req.method === 'POST' || c.req.method === 'PUT') {
@@ -1,6 +1,7 @@
 import { Hono } from 'hono'
 import type { Context } from 'hono'
 import { HeatCycleService } from '../services/heatCycleService.js'
+import { ValidationError } from '../utils/validation.js'
 import { getBerlinTimeRange } from '../utils/time.js'
 import { groupSessions, calculateConsumption } from '../utils/session.js'
 
@@ -67,6 +68,7 @@ const handleCreateHeatCycle = async (c: Context<{ Bindings: Env }>) => {
 
 		return success ? c.text('OK') : c.text('Failed to create heat cycle', 500)
 	} catch (error) {
+		if (error instanceof ValidationError) return c.json({ error: error.message }, 400)
 		console.error('Error in handleCreateHeatCycle:', error)
 		const err = error as Error
 		return c.json({ error: 'Failed to create heat cycle', details: err.message }, 500)
@@ -1,6 +1,6 @@
 import type { D1Database } from "@cloudflare/workers-types";
 import { HeatCycleRepository } from "../repositories/heatCycleRepository.js";
-import { validateHeatCycle } from "../utils/validation.js";
+import { validateHeatCycle, ValidationError } from "../utils/validation.js";
 import { generateUuid } from "../utils/index.js";
 
 export class HeatCycleService {
@@ -10,30 +10,68 @@ export class HeatCycleService {
     this.repository = new HeatCycleRepository(db);
   }
 
-  async createHeatCycle(duration: number, cycle = 1): Promise<boolean> {
+  // createdAt (Unix-Sekunden) kommt bei nachgelieferten Events aus der Geräte-Outbox mit.
+  // Solche Replays sind idempotent: existiert der Eintrag schon, gilt das als Erfolg.
+  // event (deviceId + seq) identifiziert ein Outbox-Event eindeutig, auch ohne createdAt
+  // (vor dem NTP-Sync) - ein erneut gesendetes Event wird nur quittiert, nicht nochmal gespeichert.
+  // Ungültige Werte werfen ValidationError (endgültig, ein erneuter Versuch hilft nicht);
+  // false heißt DB-Fehler oder Debounce.
+  async createHeatCycle(
+    duration: number,
+    cycle = 1,
+    createdAt?: number,
+    event?: { deviceId: string; seq: number },
+  ): Promise<boolean> {
     try {
       validateHeatCycle(duration, cycle);
 
-      // Debounce: Check for recent identical entries
-      const duplicateCount = await this.repository.findDuplicates(
-        duration,
-        cycle,
-        30000, // 30 seconds
-      );
+      if (event) {
+        // Gleiche seq mit anderen Werten = Outbox-Zähler neu gestartet (Flash formatiert), kein Duplikat
+        const stored = await this.repository.findEvent(event.deviceId, event.seq);
+        if (stored && stored.duration === duration && stored.cycle === cycle) {
+          console.log(`Heat cycle event ${event.deviceId}#${event.seq} already stored, acking.`);
+          return true;
+        }
+      }
+
+      if (createdAt !== undefined) {
+        if (await this.repository.existsAt(duration, cycle, createdAt)) {
+          console.log("Replayed heat cycle already stored, acking.");
+          return true;
+        }
+        const id = generateUuid();
+        await this.repository.create(id, duration, cycle, createdAt);
+        if (event) await this.repository.recordEvent(event.deviceId, event.seq, id, duration, cycle);
+        console.log(
+          `Heat cycle created (replay): id=${id}, duration=${duration}, cycle=${cycle}, createdAt=${createdAt}`,
+        );
+        return true;
+      }
+
+      // Debounce: Check for recent identical entries (nur ohne seq - mit seq ist das Event eindeutig)
+      if (!event) {
+        const duplicateCount = await this.repository.findDuplicates(
+          duration,
+          cycle,
+          30000, // 30 seconds
+        );
 
-      if (duplicateCount > 0) {
-        console.log("Duplicate heat cycle within 30s, not inserted.");
-        return false;
+        if (duplicateCount > 0) {
+          console.log("Duplicate heat cycle within 30s, not inserted.");
+          return false;
+        }
       }
 
       const id = generateUuid();
       await this.repository.create(id, duration, cycle);
+      if (event) await this.repository.recordEvent(event.deviceId, event.seq, id, duration, cycle);
 
       console.log(
         `Heat cycle created: id=${id}, duration=${duration}, cycle=${cycle}`,
       );
       return true;
     } catch (error) {
+      if (error instanceof ValidationError) throw error;
       console.error("Error in createHeatCycle:", error);
       return false;
     }
@@ -0,0 +1,68 @@
+import { describe, it, expect, vi } from 'vitest';
+import app from '../../index.js';
+
+const createEnv = (token?: string) => {
+    const mockFetch = vi.fn(async (_request: Request) => new Response('OK'));
+    const mockDeviceStatus = {
+        idFromName: vi.fn(() => 'mock-id'),
+        get: vi.fn(() => ({ fetch: mockFetch })),
+    };
+    return { env: { DEVICE_STATUS: mockDeviceStatus, COMMAND_TOKEN: token } as any, mockFetch };
+};
+
+const post = (env: any, body: unknown, token?: string) =>
+    app.request('/api/commands/test-device', {
+        method: 'POST',
+        body: JSON.stringify(body),
+        headers: {
+            'Content-Type': 'application/json',
+            ...(token ? { Authorization: `Bearer ${token}` } : {}),
+        },
+    }, env);
+
+describe('Commands API [/api/commands]', () => {
+
+    it('should reject requests without a valid token', async () => {
+        const { env, mockFetch } = createEnv('secret');
+
+        expect((await post(env, { cmd: 'stop' })).status).toBe(401);
+        expect((await post(env, { cmd: 'stop' }, 'wrong')).status).toBe(401);
+        expect(mockFetch).not.toHaveBeenCalled();
+    });
+
+    it('should be disabled when no token is configured', async () => {
+        const { env } = createEnv();
+        expect((await post(env, { cmd: 'stop' }, 'anything')).status).toBe(503);
+    });
+
+    it('should broadcast a cmd message with only the known parameters', async () => {
+        const { env, mockFetch } = createEnv('secret');
+
+        const res = await post(env, { cmd: 'setTemp', temp: 190, extra: true }, 'secret');
+
+        expect(res.status).toBe(200);
+        const json = await res.json();
+        expect(json.success).toBe(true);
+        expect(typeof json.id).toBe('string');
+
+        const forwarded = mockFetch.mock.calls[0][0] as Request;
+        expect(new URL(forwarded.url).pathname).toBe('/command');
+        expect(await forwarded.json()).toEqual({ type: 'cmd', id: json.id, cmd: 'setTemp', temp: 190 });
+    });
+
+    it('should reject unknown commands', async () => {
+        const { env, mockFetch } = createEnv('secret');
+        expect((await post(env, { cmd: 'reboot' }, 'secret')).status).toBe(400);
+        expect(mockFetch).not.toHaveBeenCalled();
+    });
+
+    it('should not forward /command through the unauthenticated device-status proxy', async () => {
+        const { env, mockFetch } = createEnv('secret');
+        const res = await app.request('/api/device-status/test-device/command', {
+            method: 'POST',
+            body: JSON.stringify({ type: 'cmd', cmd: 'start' }),
+        }, env);
+        expect(res.status).toBe(403);
+        expect(mockFetch).not.toHaveBeenCalled();
+    });
+});
@@ -0,0 +1,60 @@
+import { describe, it, expect } from 'vitest';
+import { decodeTelemetryFrame } from '../../utils/telemetry.js';
+
+// Frames wie sie TelemetryCodec::encode() auf dem ESP32 erzeugt
+const frame = (...bytes: number[]) => new Uint8Array(bytes);
+
+describe('decodeTelemetryFrame', () => {
+
+    it('decodes every record type to the JSON message shape', () => {
+        expect(decodeTelemetryFrame(frame(1, 1))).toEqual([{ type: 'heartbeat', isOn: true }]);
+        expect(decodeTelemetryFrame(frame(1, 2, 1))).toEqual([{ type: 'statusUpdate', isOn: true, isHeating: false }]);
+        expect(decodeTelemetryFrame(frame(1, 3, 172, 2, 2))).toEqual([{ type: 'heatCycleCompleted', duration: 300, cycle: 2 }]);
+        expect(decodeTelemetryFrame(frame(1, 4, 9, 224, 197, 8))).toEqual([{ type: 'sessionUpdate', clicks: -5, caps: 70000 }]);
+        expect(decodeTelemetryFrame(frame(1, 5, 2, 164, 29, 125))).toEqual([
+            { type: 'tempReading', tempRaw: 187.4, tempCalibrated: 181.1, isHeating: true },
+        ]);
+    });
+
+    it('decodes several records from one frame', () => {
+        const messages = decodeTelemetryFrame(frame(1, 1, 2, 3));
+        expect(messages.map((m) => m.type)).toEqual(['heartbeat', 'statusUpdate']);
+        expect(messages[1]).toMatchObject({ isOn: true, isHeating: true });
+    });
+
+    it('decodes delta-encoded temperature batches', () => {
+        const [batch] = decodeTelemetryFrame(frame(1, 6, 3, 250, 1, 10, 100, 0, 144, 28, 100, 6, 100, 6, 100, 10, 60, 100, 7, 100));
+        expect(batch).toEqual({
+            type: 'tempBatch',
+            age: 250,
+            samples: [
+                { t: 0, tempRaw: 180, tempCalibrated: 185, power: 100, zvsOn: false, isHeating: true },
+                { t: 100, tempRaw: 180.3, tempCalibrated: 185.3, power: 100, zvsOn: true, isHeating: true },
+                { t: 200, tempRaw: 179.9, tempCalibrated: 184.9, power: 60, zvsOn: false, isHeating: true },
+            ],
+        });
+    });
+
+    it('attaches outbox seq/at to the following record', () => {
+        expect(decodeTelemetryFrame(frame(1, 7, 5, 0, 3, 172, 2, 2))).toEqual([
+            { type: 'heatCycleCompleted', duration: 300, cycle: 2, seq: 5 },
+        ]);
+        expect(decodeTelemetryFrame(frame(1, 7, 6, 128, 226, 207, 170, 6, 3, 172, 2, 1, 1))).toEqual([
+            { type: 'heatCycleCompleted', duration: 300, cycle: 1, seq: 6, at: 1700000000 },
+            { type: 'heartbeat', isOn: true },
+        ]);
+    });
+
+    it('passes deferred log records through as hex with the build id', () => {
+        expect(decodeTelemetryFrame(frame(1, 8, 1, 2, 3, 4, 5, 6, 7, 254, 3, 2, 171, 205, 1))).toEqual([
+            { type: 'logRecords', build: '01020304050607fe', data: '02abcd' },
+            { type: 'heartbeat', isOn: true },
+        ]);
+    });
+
+    it('rejects unknown versions and truncated frames', () => {
+        expect(() => decodeTelemetryFrame(frame(2, 1))).toThrow(/version/);
+        expect(() => decodeTelemetryFrame(frame(1, 3, 172))).toThrow(/end of frame/);
+        expect(() => decodeTelemetryFrame(frame(1, 99))).toThrow(/record type/);
+    });
+});
@@ -2,4 +2,5 @@ interface Env {
   CF_VERSION_METADATA: any;
   db: D1Database;
   DEVICE_STATUS: DurableObjectNamespace;
+  COMMAND_TOKEN?: string;
 }
@@ -0,0 +1,145 @@
+// Decoder für das binäre Telemetrie-Format der ESP32-Firmware
+// (apps/esp32/include/driver/net/TelemetryCodec.h). Liefert dieselben Objekte wie der JSON-Pfad.
+
+export const TELEMETRY_VERSION = 1
+
+const enum RecordType {
+	Heartbeat = 1,
+	StatusUpdate = 2,
+	HeatCycleCompleted = 3,
+	SessionUpdate = 4,
+	TempReading = 5,
+	TempBatch = 6,
+	EventMeta = 7,
+	LogRecords = 8,
+}
+
+const BUILD_ID_BYTES = 8
+
+const FLAG_ON = 0x01
+const FLAG_HEATING = 0x02
+const FLAG_ZVS = 0x04
+const FLAG_POWER = 0x08
+
+export type TelemetryMessage = { type: string } & Record<string, unknown>
+
+class Reader {
+	private pos = 0
+
+	constructor(private readonly data: Uint8Array) {}
+
+	get done(): boolean {
+		return this.pos >= this.data.length
+	}
+
+	u8(): number {
+		if (this.pos >= this.data.length) throw new Error('telemetry: unexpected end of frame')
+		return this.data[this.pos++]
+	}
+
+	varint(): number {
+		let value = 0
+		for (let shift = 0; shift < 35; shift += 7) {
+			const b = this.u8()
+			value += (b & 0x7f) * 2 ** shift
+			if (!(b & 0x80)) return value
+		}
+		throw new Error('telemetry: varint too long')
+	}
+
+	hex(length: number): string {
+		let out = ''
+		for (let i = 0; i < length; i++) out += this.u8().toString(16).padStart(2, '0')
+		return out
+	}
+
+	zigzag(): number {
+		const v = this.varint()
+		return v % 2 ? -(v + 1) / 2 : v / 2
+	}
+}
+
+const deci = (v: number) => v / 10
+
+function decodeRecord(r: Reader, type: number): TelemetryMessage {
+	switch (type) {
+		case RecordType.Heartbeat:
+			return { type: 'heartbeat', isOn: true }
+		case RecordType.StatusUpdate: {
+			const flags = r.u8()
+			return { type: 'statusUpdate', isOn: !!(flags & FLAG_ON), isHeating: !!(flags & FLAG_HEATING) }
+		}
+		case RecordType.HeatCycleCompleted:
+			return { type: 'heatCycleCompleted', duration: r.varint(), cycle: r.u8() }
+		case RecordType.SessionUpdate:
+			return { type: 'sessionUpdate', clicks: r.zigzag(), caps: r.zigzag() }
+		case RecordType.TempReading: {
+			const flags = r.u8()
+			const raw = r.zigzag()
+			const calibrated = raw + r.zigzag()
+			return {
+				type: 'tempReading',
+				tempRaw: deci(raw),
+				tempCalibrated: deci(calibrated),
+				isHeating: !!(flags & FLAG_HEATING),
+			}
+		}
+		case RecordType.TempBatch:
+			return decodeTempBatch(r)
+		case RecordType.LogRecords: {
+			// Deferred-Logs: nur mit der passenden firmware.elf lesbar (apps/esp32/scripts/logdecode.py),
+			// build = Präfix des ELF-SHA256, an dem logdecode.py die richtige ELF erkennt
+			const build = r.hex(BUILD_ID_BYTES)
+			return { type: 'logRecords', build, data: r.hex(r.varint()) }
+		}
+		default:
+			throw new Error(`telemetry: unknown record type ${type}`)
+	}
+}
+
+// Samples sind relativ zum ersten (t in ms), age = Alter des ersten Samples beim Versand
+function decodeTempBatch(r: Reader): TelemetryMessage {
+	const count = r.varint()
+	const age = r.varint()
+	const samples = []
+	let t = 0
+	let raw = 0
+	let power = 0
+	for (let i = 0; i < count; i++) {
+		const flags = r.u8()
+		if (flags & FLAG_POWER) power = r.u8()
+		t += r.varint()
+		raw += r.zigzag()
+		const calibrated = raw + r.zigzag()
+		samples.push({
+			t,
+			tempRaw: deci(raw),
+			tempCalibrated: deci(calibrated),
+			power,
+			zvsOn: !!(flags & FLAG_ZVS),
+			isHeating: !!(flags & FLAG_HEATING),
+		})
+	}
+	return { type: 'tempBatch', age, samples }
+}
+
+export function decodeTelemetryFrame(data: ArrayBuffer | Uint8Array): TelemetryMessage[] {
+	const r = new Reader(data instanceof Uint8Array ? data : new Uint8Array(data))
+	const version = r.u8()
+	if (version !== TELEMETRY_VERSION) throw new Error(`telemetry: unsupported version ${version}`)
+
+	const messages: TelemetryMessage[] = []
+	while (!r.done) {
+		const type = r.u8()
+		// seq/at (Outbox-Events) gehören zum direkt folgenden Record
+		if (type === RecordType.EventMeta) {
+			const seq = r.varint()
+			const at = r.varint()
+			const message = decodeRecord(r, r.u8())
+			messages.push(at ? { ...message, seq, at } : { ...message, seq })
+			continue
+		}
+		messages.push(decodeRecord(r, type))
+	}
+	return messages
+}
@@ -8,6 +8,7 @@ struct DebugFlags {
 
 struct InputConfig {
     struct PCF8574 {
+        static constexpr uint8_t ADDRESS = 0x20;
         static constexpr uint8_t SCL = 27;
         static constexpr uint8_t SDA = 26;
         static constexpr uint8_t INT_PIN = 25;
@@ -18,6 +19,13 @@ struct InputConfig {
         static constexpr uint8_t CLK = 21;
         static constexpr uint8_t SW = 22;
         static constexpr uint8_t DT = 19;
+        static constexpr uint8_t STEPS_PER_DETENT = 4;     // PCNT zählt x4
+        static constexpr uint32_t GLITCH_FILTER_NS = 10000;
+        // Beschleunigung: ab ACCEL_MIN_RATE Rastungen/s mehr als 1 pro Rastung,
+        // ab ACCEL_MAX_RATE ACCEL_MAX_STEP
+        static constexpr uint8_t ACCEL_MIN_RATE = 6;
+        static constexpr uint8_t ACCEL_MAX_RATE = 30;
+        static constexpr uint8_t ACCEL_MAX_STEP = 5;
     };
 
 
@@ -26,6 +34,13 @@ struct InputConfig {
     static constexpr uint32_t HOLD_THRESHOLD_MS = 300;
     static constexpr uint32_t HOLDING_INTERVAL_MS = 150;
     static constexpr uint32_t DEBOUNCE_MS = 50;
+
+    struct Gestures {
+        static constexpr uint16_t CHORD_MS = 150;           // < HOLD_THRESHOLD_MS
+        static constexpr uint16_t DOUBLE_CLICK_MS = 300;
+        static constexpr uint16_t LONG_PRESS_MS[] = {1000, 3000};
+    };
+    static constexpr uint8_t QUEUE_SIZE = 32;
 };
 
 
@@ -60,6 +75,13 @@ struct DisplayConfig {
     static constexpr uint8_t BRIGHTNESS_MIN = 20;
     static constexpr uint8_t BRIGHTNESS_MAX = 100;
     static constexpr uint8_t BRIGHTNESS_DEFAULT = 100;
+
+    // Glyph-Atlas: beim Boot vorgerasterte Zeichen der heißen Zahlenfelder
+    static constexpr const char* ATLAS_TIMER_CHARS = "0123456789";      // bxxl (Timer)
+    static constexpr const char* ATLAS_TEMP_CHARS = "0123456789-OF";    // bxl (IR/Limit, "OFF")
+
+    // Slide-Transitions: Hardware-Scroll um so viele Spalten pro Schritt, eingehender Screen wird nachgezogen
+    static constexpr uint16_t TRANSITION_STEP_PX = 40;
 };
 
 struct HeaterConfig {
@@ -85,8 +107,17 @@ struct HeaterConfig {
     static constexpr uint32_t TEMP_STALL_MIN_HEAT_MS = 3000; // erst nach 3s Heizen aktiv
 };
 
+// Temperatur-Telemetrie: Samples werden gesammelt und als ein WS-Frame verschickt
+struct TelemetryConfig {
+    static constexpr uint32_t SAMPLE_INTERVAL_HEATING_MS = 100;   // 10 Hz beim Heizen
+    static constexpr uint32_t SAMPLE_INTERVAL_IDLE_MS = 5000;     // Raumtemp-Baseline
+    static constexpr uint8_t BATCH_MAX_SAMPLES = 20;              // Flush nach N Samples ...
+    static constexpr uint32_t BATCH_MAX_AGE_MS = 2000;            // ... oder wenn das älteste so alt ist
+};
+
 struct NetworkConfig {
-    static constexpr const char *BACKEND_WS_URL = "ws://box.hzbx.de/ws";
+    // wss:// nur mit BACKEND_CA_PEM in credentials.h, sonst ws:// (driver/net/TlsProfile.h)
+    static constexpr const char *BACKEND_WS_URL = "wss://box.hzbx.de/ws";
     static constexpr const char *DEVICE_ID = "HeizboxESP32";
     static constexpr const char *NTP_SERVER = "pool.ntp.org";
     static constexpr const char *HOSTNAME = "Heizbox";
@@ -7,6 +7,7 @@
 #include "Types.h"
 #include "core/StateBinder.h"
 #include "driver/net/Network.h"
+#include "services/RemoteCommands.h"
 
 class HeaterController;
 class DeviceUI;
@@ -15,6 +16,7 @@ class Device {
     HeaterController heater;
     DeviceUI ui;
     Network network;
+    RemoteCommands commands;
 
     void initNVS();
 
@@ -12,6 +12,7 @@ enum class EventType {
     OTA_UPDATE_STARTED,
     OTA_UPDATE_FINISHED,
     OTA_UPDATE_FAILED,
+    OTA_UPDATE_PROGRESS,
     CHECK_FOR_UPDATES,
 
     SENSOR_TRIGGERED,
@@ -33,6 +34,12 @@ struct CycleFinishedData {
     uint32_t startedAt;
 };
 
+struct OtaProgressData {
+    uint32_t written;
+    uint32_t total;
+    uint8_t percent;
+};
+
 
 struct Event {
     EventType type;
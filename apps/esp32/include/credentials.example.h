@@ -6,4 +6,19 @@
 
 #define API_ENDPOINT "https://box.hzbx.de"
 
+// LAN-Steuerung (driver/net/LanLink.h), gleicher Schlüssel für scripts/lanlisten.py --key.
+// Weglassen = nur LAN-Telemetrie, keine Steuerung.
+#define LAN_KEY "change-me"
+
+// Root-CA des Backends für wss:// (driver/net/TlsProfile.h), z.B. aus
+//   openssl s_client -connect box.hzbx.de:443 -showcerts </dev/null
+// das letzte Zertifikat der Kette (bzw. die Root der ausstellenden CA).
+// Weglassen = WebSocket bleibt bei ws://, HTTPS ohne Server-Prüfung.
+/*
+#define BACKEND_CA_PEM \
+    "-----BEGIN CERTIFICATE-----\n" \
+    "...\n" \
+    "-----END CERTIFICATE-----\n"
+*/
+
 #endif
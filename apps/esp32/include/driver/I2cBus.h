@@ -0,0 +1,82 @@
+#pragma once
+
+#include <Arduino.h>
+#include <Wire.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+
+// Gemeinsamer I2C-Bus (MLX90614 + PCF8574 auf Wire, SDA 27 / SCL 26).
+//
+// Jede Transaktion läuft unter einem Lock mit Priorität:
+//   SENSOR  - MLX90614-Samples, wartet bis SENSOR_WAIT_MS auf den Bus
+//   INPUT   - PCF8574-Port, nur wenn frei und kein Sensor wartet, sonst nächster Loop
+//   CONFIG  - EEPROM-Writes (Emissivity), wartet, gibt aber jedem Sensor-Read den Vortritt
+// Langsame Abläufe (EEPROM-Write, Reinit) halten den Bus nur pro Schritt, nicht über die
+// Wartezeiten dazwischen. Takt: beide Chips sind laut Datenblatt 100-kHz-Teile (SMBus bzw.
+// Standard-Mode), deshalb kein Fast-Mode.
+class I2cBus {
+public:
+    enum class Priority : uint8_t { SENSOR, INPUT, CONFIG, COUNT };
+
+    struct Stats {
+        uint32_t transactions = 0;
+        uint32_t errors = 0;        // nach allen Wiederholungen fehlgeschlagen
+        uint32_t retries = 0;
+        uint32_t deferred = 0;      // Bus nicht bekommen (INPUT: verschoben, SENSOR: Timeout)
+        uint32_t busyUs = 0;        // Summe der Haltezeit
+        uint32_t maxHoldUs = 0;
+        uint32_t maxWaitUs = 0;
+    };
+
+    // RAII: hält den Bus bis zum Ende des Scopes. if (!tx) -> Bus nicht bekommen.
+    class Transaction {
+    public:
+        Transaction(Priority prio);
+        ~Transaction();
+        Transaction(const Transaction&) = delete;
+        Transaction& operator=(const Transaction&) = delete;
+
+        explicit operator bool() const { return held; }
+        void retry();
+        void fail();
+
+    private:
+        Priority prio;
+        bool held = false;
+        uint32_t start = 0;
+    };
+
+    static I2cBus& instance();
+
+    // Ersetzt Wire.begin() in Device::setup
+    void begin(uint8_t sda, uint8_t scl);
+
+    const Stats& stats(Priority prio) const { return stats_[(uint8_t)prio]; }
+    // Busauslastung im letzten vollen Fenster, Promille
+    uint16_t utilisation() const;
+    uint32_t clock() const { return CLOCK_HZ; }
+
+    static const char* priorityName(Priority prio);
+
+    static constexpr uint32_t CLOCK_HZ = 100000;
+    static constexpr uint16_t TIMEOUT_MS = 10;      // Wire-Timeout, hängender Slave blockiert nicht 50 ms
+    static constexpr uint32_t SENSOR_WAIT_MS = 5;   // PCF-Byte / MLX-Read < 1 ms; nur der EEPROM-Write ist länger
+    static constexpr uint32_t CONFIG_WAIT_MS = 200;
+    static constexpr uint32_t WINDOW_MS = 1000;
+
+private:
+    I2cBus() = default;
+
+    bool acquire(Priority prio);
+    void release(Priority prio, uint32_t heldUs);
+    void count(Priority prio, uint32_t Stats::*field);
+
+    SemaphoreHandle_t mutex = nullptr;
+    volatile uint8_t sensorWaiting = 0;
+    mutable portMUX_TYPE mux = portMUX_INITIALIZER_UNLOCKED;
+
+    Stats stats_[(uint8_t)Priority::COUNT];
+    uint32_t windowStart = 0;
+    uint32_t windowBusyUs = 0;
+    uint16_t utilPermille = 0;
+};
@@ -2,6 +2,7 @@
 
 #include <Arduino.h>
 #include <functional>
+#include <vector>
 #include "Interfaces.h"
 
 class ZVSDriver: public IDriver {
@@ -68,6 +69,10 @@ public:
      */
     void onTempMeasure(TempMeasureCallback callback);
 
+    /**
+     * @brief Register listener for phase transitions
+     * Multiple listeners are supported (HeaterController, oscilloscope, ...)
+     */
     void onPhaseChange(PhaseChangeCallback callback);
     
     /**
@@ -123,8 +128,8 @@ private:
     Phase currentPhase;
     uint32_t phaseStartTime;
     
-    // Callback
-    PhaseChangeCallback phaseChangeCallback;
+    // Callbacks
+    std::vector<PhaseChangeCallback> phaseChangeCallbacks;
     TempMeasureCallback tempMeasureCallback;
     bool tempMeasureCalled;     // Flag to call callback only once per cycle
     
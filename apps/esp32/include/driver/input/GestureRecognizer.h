@@ -0,0 +1,53 @@
+#pragma once
+
+#include <functional>
+#include "Config.h"
+#include "driver/input/InputEvent.h"
+
+// Gesten aus den Roh-Events von InputManager (Zeitstempel in InputEvent::us):
+//   CHORD        - zweiter Button innerhalb chordMs nach dem ersten gedrückt. value = Button-Maske.
+//                  Beide Buttons sind bis zum Loslassen "verbraucht": kein PRESSED/HOLD/RELEASE
+//                  mehr, die Gesten-Buttons lösen also nicht nebenbei ihre Einzelaktion aus.
+//                  chordMs < HOLD_THRESHOLD_MS, sonst wäre HOLD_ONCE schon raus.
+//   DOUBLE_CLICK - zweites PRESSED innerhalb doubleClickMs. Zusätzlich zum PRESSED, der erste
+//                  Klick wird nicht zurückgehalten (keine Extra-Latenz für Einzelklicks).
+//   LONG_PRESS   - Halten über longPressMs[i], value = Stufe (1..LONG_PRESS_TIERS)
+class GestureRecognizer {
+public:
+    static constexpr uint8_t LONG_PRESS_TIERS = 2;
+
+    struct Timing {
+        uint16_t chordMs = InputConfig::Gestures::CHORD_MS;
+        uint16_t doubleClickMs = InputConfig::Gestures::DOUBLE_CLICK_MS;
+        uint16_t longPressMs[LONG_PRESS_TIERS] = {
+            InputConfig::Gestures::LONG_PRESS_MS[0],
+            InputConfig::Gestures::LONG_PRESS_MS[1],
+        };
+    };
+
+    using Emit = std::function<void(const InputEvent&)>;
+
+    void setTiming(const Timing& t) { timing = t; }
+    const Timing& getTiming() const { return timing; }
+
+    // Roh-Event rein, 0..n Events (roh und/oder Geste) raus
+    void feed(const InputEvent& event, const Emit& emit);
+    // Zeitgesteuerte Gesten (Long-Press-Stufen), jedes update()
+    void tick(uint32_t nowUs, const Emit& emit);
+
+    static uint8_t mask(InputButton button) { return 1 << button; }
+
+private:
+    struct Button {
+        bool down = false;
+        bool consumed = false;  // Teil eines Chords
+        uint8_t tier = 0;
+        uint32_t downUs = 0;
+        uint32_t lastClickUs = 0;
+    };
+
+    Timing timing;
+    Button buttons[ROTARY_ENCODER + 1];
+
+    void press(const InputEvent& event, const Emit& emit);
+};
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <Arduino.h>
+
+enum InputEventType {
+    PRESS,
+    PRESSED,
+    RELEASE,
+    HOLD,
+    HOLD_ONCE,
+    ROTARY_CW,
+    ROTARY_CCW,
+    // Gesten (driver/input/GestureRecognizer.h)
+    CHORD,          // value = Button-Maske (1 << InputButton)
+    DOUBLE_CLICK,
+    LONG_PRESS,     // value = Stufe
+};
+
+enum InputButton {
+    UP,
+    DOWN,
+    LEFT,
+    RIGHT,
+    CENTER,
+    FIRE,
+    ROTARY_ENCODER
+};
+
+inline const char* inputEventTypeName(InputEventType type) {
+    switch (type) {
+        case PRESS: return "PRESS";
+        case PRESSED: return "PRESSED";
+        case RELEASE: return "RELEASE";
+        case HOLD: return "HOLD";
+        case HOLD_ONCE: return "HOLD_ONCE";
+        case ROTARY_CW: return "ROTARY_CW";
+        case ROTARY_CCW: return "ROTARY_CCW";
+        case CHORD: return "CHORD";
+        case DOUBLE_CLICK: return "DOUBLE_CLICK";
+        case LONG_PRESS: return "LONG_PRESS";
+    }
+    return "UNKNOWN";
+}
+
+struct InputEvent {
+    InputEventType type;
+    InputButton button;
+    int value = 0;  // Für Rotary Encoder: Delta-Wert oder absolute Position
+    uint32_t us = 0;  // micros() beim Ereignis (INT-Flanke, Poll, Encoder) - nicht bei der Zustellung
+};
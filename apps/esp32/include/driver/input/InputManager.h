@@ -5,37 +5,22 @@
 #include <Wire.h>
 #include "Config.h"
 #include "driver/input/ButtonSource.h"
-#include <ESP32RotaryEncoder.h>
+#include "driver/input/InputEvent.h"
+#include "driver/input/GestureRecognizer.h"
+#include "input/RotaryEncoder.h"
 #define PCF8574_LOW_MEMORY
 #include "PCF8574.h"
 
-enum InputEventType {
-    PRESS,
-    PRESSED,
-    RELEASE,
-    HOLD,
-    HOLD_ONCE,
-    ROTARY_CW,
-    ROTARY_CCW,
+struct InputStats {
+    uint32_t events = 0;        // zugestellt (roh + Gesten)
+    uint32_t gestures = 0;
+    uint32_t dropped = 0;       // Queue voll
+    uint32_t latencyLastUs = 0; // Ereignis -> Aufruf des Handlers
+    uint32_t latencyMaxUs = 0;
+    uint64_t latencySumUs = 0;
+    uint32_t handlerMaxUs = 0;  // Dauer des Handlers selbst
 };
 
-enum InputButton {
-    UP,
-    DOWN,
-    LEFT,
-    RIGHT,
-    CENTER,
-    FIRE,
-    ROTARY_ENCODER
-};
-
-struct InputEvent {
-    InputEventType type;
-    InputButton button;
-    int value = 0;  // Für Rotary Encoder: Delta-Wert oder absolute Position
-};
-
-
 class InputManager {
 public:
     using EventCallback = std::function<void(InputEvent)>;
@@ -45,10 +30,15 @@ public:
     void update();
     void setCallback(EventCallback cb);
 
+    // Port beim nächsten update() neu lesen (sonst nur nach INT oder Fallback-Poll)
     void pcfInterrupt();
 
     uint32_t getLastInputMs() const { return millis() - lastInputMs; }
 
+    GestureRecognizer& gestures() { return recognizer; }
+    // Eine Instanz (DeviceUI), Statistik für /api/status ohne Zugriff auf die UI
+    static const InputStats& stats() { return stats_; }
+
     static constexpr uint8_t NUM_BUTTONS = 7;
 
     struct ButtonConfig {
@@ -63,8 +53,32 @@ private:
     PCF8574* pcf8574;
     RotaryEncoder* rotaryEncoder;
 
+    // PCF8574: ganzer Port in einer I2C-Transaktion, nur nach INT oder als Fallback alle
+    // InputConfig::PCF8574::UPDATE_MS - dazwischen wird aus dem gemerkten Byte dekodiert
+    volatile bool pcfDirty = true;
+    uint8_t pcfPort = 0xFF;         // active LOW, Bit = PCF-Pin
+    uint32_t lastPcfRead = 0;
+    void readPcf(uint32_t now);
+    static void IRAM_ATTR onPcfInterrupt(void* arg);
+
     EventCallback callback = nullptr;
 
+    // Roh-Events mit Zeitstempel, gefüllt und geleert in update() -> Handler laufen im Loop.
+    // push() bleibt task-sicher, falls eine Quelle ausserhalb des Loops dazukommt
+    InputEvent queue[InputConfig::QUEUE_SIZE];
+    uint8_t queueHead = 0;
+    uint8_t queueCount = 0;
+    portMUX_TYPE queueMux = portMUX_INITIALIZER_UNLOCKED;
+    void push(const InputEvent& event);
+    bool pop(InputEvent& event);
+    void dispatch(const InputEvent& event);
+
+    GestureRecognizer recognizer;
+    static InputStats stats_;
+
+    volatile uint32_t pcfEdgeUs = 0;  // INT-Flanke, Zeitstempel für die Events aus dem Port
+    uint32_t pcfPortUs = 0;
+
     uint32_t lastInputMs = 0;
 
     uint8_t pressedMask = 0;
@@ -73,8 +87,6 @@ private:
     uint32_t lastDebounce[NUM_BUTTONS] = {0};
     uint32_t lastHoldStep[NUM_BUTTONS] = {0};
 
-    void onTurn(long value);
-
     // --- Inline helper functions for bitmask manipulation ---
     inline bool isPressed(uint8_t idx) const { return pressedMask & (1 << idx); }
     inline void setPressed(uint8_t idx, bool val) {
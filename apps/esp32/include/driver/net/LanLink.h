@@ -0,0 +1,115 @@
+#pragma once
+
+#include <Arduino.h>
+#include <WiFiUdp.h>
+#include <ArduinoJson.h>
+#include <functional>
+#include "utils/JsonArena.h"
+
+// Live-Daten und Steuerung im LAN, ohne Umweg über das Backend.
+//
+// Discovery: mDNS-Service _heizbox._tcp (Port = DebugServer), TXT: mcast, port, ctl, fmt, auth
+// Telemetrie: UDP-Multicast an MCAST_GROUP:TELEMETRY_PORT, ein LanPacket pro Sample,
+//             TELEMETRY_HZ beim Heizen, IDLE_HZ sonst (Rate-Cap, kein Abo nötig)
+// Steuerung:  UDP an CONTROL_PORT, Kopf + HMAC-SHA256 (LAN_KEY aus credentials.h) + JSON
+//             im Schema von services/RemoteCommands.h. Antwort per Unicast an den Absender:
+//             {"type":"cmdAck","id":..,"ok":..[,"error":..]}. "ping" wird direkt quittiert
+//             (Latenzmessung). Ohne LAN_KEY ist die Steuerung aus.
+//
+// Replay-Schutz: bootId (zufällig pro Boot, steht in jedem LanPacket) muss passen und
+// counter strikt steigen. Host-Gegenstück: scripts/lanlisten.py
+//
+// Little-endian, gepackt - Layout nur mit neuer FORMAT-Version ändern
+struct __attribute__((packed)) LanPacket {
+    char magic[2];          // "HB"
+    uint8_t version;
+    uint8_t flags;          // FLAG_*
+    uint32_t bootId;
+    uint32_t seq;
+    uint32_t ms;            // millis() beim Senden
+    int16_t tempDeci;       // kalibriert, 0.1 °C
+    int16_t tempRawDeci;    // IR roh, 0.1 °C
+    uint16_t tempLimit;     // °C
+    uint8_t power;          // %
+    uint8_t cycle;
+    uint16_t timerSec;      // laufender Heizzyklus
+};
+static_assert(sizeof(LanPacket) == 26, "LanPacket layout");
+
+struct __attribute__((packed)) LanControlHeader {
+    char magic[2];          // "HC"
+    uint8_t version;
+    uint8_t reserved;
+    uint32_t bootId;
+    uint32_t counter;
+    uint8_t tag[16];        // HMAC-SHA256(key, Kopf ohne tag + JSON), gekürzt
+};
+static_assert(sizeof(LanControlHeader) == 28, "LanControlHeader layout");
+
+struct LanStats {
+    uint32_t sent = 0;
+    uint32_t sendErrors = 0;
+    uint32_t control = 0;       // angenommene Steuerpakete
+    uint32_t authFailed = 0;    // falsches Tag, bootId oder Format
+    uint32_t replayed = 0;      // counter nicht gestiegen
+    uint32_t rateLimited = 0;
+};
+
+class LanLink {
+public:
+    // nullptr = ok, sonst Fehlertext fürs Ack
+    using CommandHandler = std::function<const char*(const JsonDocument& doc)>;
+
+    static LanLink& instance();
+
+    // Nach ArduinoOTA.begin() (startet mDNS), nur mit WiFi
+    void begin(uint16_t httpPort);
+    // Loop-Kontext: Steuerpakete abholen, Telemetrie senden
+    void update();
+    void onCommand(CommandHandler handler);
+
+    bool isRunning() const { return running; }
+    bool controlEnabled() const { return keyLen > 0; }
+    uint32_t bootId() const { return bootId_; }
+    const LanStats& stats() const { return stats_; }
+
+    static constexpr uint8_t FORMAT = 1;
+    static constexpr uint8_t FLAG_HEATING = 0x01;
+    static constexpr uint8_t FLAG_ZVS = 0x02;
+    static constexpr uint8_t FLAG_LOCKED = 0x04;
+    static constexpr uint8_t FLAG_CONTROL = 0x08;   // Steuerung aktiv (LAN_KEY gesetzt)
+
+    static constexpr uint8_t MCAST_GROUP[4] = {239, 72, 66, 1};
+    static constexpr uint16_t TELEMETRY_PORT = 47411;
+    static constexpr uint16_t CONTROL_PORT = 47412;
+
+private:
+    LanLink() = default;
+
+    void sendTelemetry(uint32_t now);
+    void pollControl(uint32_t now);
+    bool authenticate(const LanControlHeader& hdr, const uint8_t* body, size_t len);
+    void reply(JsonVariantConst id, const char* error, bool withMs);
+
+    static constexpr uint8_t TELEMETRY_HZ = 10;
+    static constexpr uint8_t IDLE_HZ = 1;
+    static constexpr uint8_t CONTROL_PER_SEC = 10;  // HMAC kostet CPU, Flut begrenzen
+    static constexpr size_t CONTROL_MAX = 256;      // Kopf + JSON
+
+    WiFiUDP udp;            // gebunden an CONTROL_PORT, sendet auch die Telemetrie
+    CommandHandler commandHandler;
+    bool running = false;
+
+    const char* key = "";
+    size_t keyLen = 0;
+    uint32_t bootId_ = 0;
+    uint32_t seq = 0;
+    uint32_t lastCounter = 0;
+    uint32_t lastSent = 0;
+    uint32_t controlWindow = 0;
+    uint8_t controlInWindow = 0;
+
+    uint8_t rx[CONTROL_MAX];
+    JsonArena<2 * JSON_ARENA_POOL_BYTES + 1024> arena;  // Befehl + Ack-Dokument, je ein Pool
+    LanStats stats_;
+};
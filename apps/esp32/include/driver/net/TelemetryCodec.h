@@ -0,0 +1,85 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+struct WsPendingMsg;
+struct WsTempSample;
+
+// Kompaktes Binärformat für ausgehende WS-Messages (statt JsonDocument + sendTXT).
+// Wird nur benutzt, wenn der Server beim Verbinden {"type":"hello","bin":VERSION} bestätigt,
+// sonst bleibt es beim JSON-Pfad. Decoder: apps/backend/src/utils/telemetry.ts
+//
+// Frame:  [VERSION u8] [Record]...          (Länge = WS-Frame, kein Zähler)
+// Record: [WsMsgType u8] [Payload]
+//   HEARTBEAT             -
+//   STATUS_UPDATE         flags (bit0 isOn, bit1 isHeating)
+//   HEAT_CYCLE_COMPLETED  varint durationSec, u8 cycle
+//   SESSION_UPDATE        zigzag clicks, zigzag caps
+//   TEMP_READING          flags, zigzag tempRaw, zigzag (tempCalibrated - tempRaw)
+//   TEMP_BATCH            varint count, varint ageMs (erstes Sample bis Versand), dann pro Sample:
+//                         flags (+ FLAG_POWER: u8 power folgt), varint dtMs zum Vorgänger,
+//                         zigzag (tempRaw - tempRaw Vorgänger), zigzag (tempCalibrated - tempRaw)
+//   EVENT_META            varint seq, varint at - gilt für den direkt folgenden Record
+//   LOG_RECORDS           8 Byte Build-ID (logBuildId), varint byteLen, dann [u8 len][Log-Record]...
+//                         (Format: utils/Logger.h)
+//
+// varint = LEB128 (7 Bit pro Byte, LSB zuerst), zigzag = vorzeichenbehaftet als varint.
+// Temperaturen in 0.1 °C.
+namespace TelemetryCodec {
+
+static constexpr uint8_t VERSION = 1;
+
+static constexpr uint8_t FLAG_ON = 0x01;
+static constexpr uint8_t FLAG_HEATING = 0x02;
+static constexpr uint8_t FLAG_ZVS = 0x04;      // TEMP_BATCH: MOSFET-Phase an
+static constexpr uint8_t FLAG_POWER = 0x08;    // TEMP_BATCH: Leistung geändert, u8 folgt
+
+// Länge eines varint für Werte bis max
+static constexpr size_t varintBytes(uint32_t max) { return max < 0x80 ? 1 : 1 + varintBytes(max >> 7); }
+
+// Exakte Obergrenze eines TEMP_BATCH-Records (test_telemetry_codec erreicht sie):
+// Kopf = Typ, count, ageMs (u32); je Sample flags, power, dtMs (u32) und zwei Deltas zwischen
+// int16-Werten (|d| <= 65535, zigzag 3 Byte), nur dtMs des ersten Samples ist immer 0.
+// Breitere Sample-Felder -> hier anpassen (static_assert in TelemetryCodec.cpp).
+static constexpr size_t BATCH_SAMPLE_MAX = 2 + varintBytes(UINT32_MAX) + 2 * varintBytes(2 * 65535u);
+static constexpr size_t batchBytesMax(uint8_t samples) {
+    return samples ? 1 + varintBytes(samples) + varintBytes(UINT32_MAX) + samples * BATCH_SAMPLE_MAX -
+                         (varintBytes(UINT32_MAX) - 1)
+                   : 0;
+}
+
+// Schreibt sequentiell in einen festen Puffer; bei Überlauf bleibt ok() false
+class Writer {
+public:
+    Writer(uint8_t* buf, size_t cap) : _buf(buf), _cap(cap) {}
+
+    void u8(uint8_t v);
+    void varint(uint32_t v);
+    void zigzag(int32_t v) { varint(((uint32_t)v << 1) ^ (uint32_t)(v >> 31)); }
+
+    bool ok() const { return _ok; }
+    size_t size() const { return _len; }
+
+private:
+    uint8_t* _buf;
+    size_t _cap;
+    size_t _len = 0;
+    bool _ok = true;
+};
+
+int32_t toDeci(float celsius);
+
+// Ein Record ohne Frame-Header; false bei unbekanntem Typ
+bool encodeRecord(Writer& w, const WsPendingMsg& msg);
+
+// TEMP_BATCH-Record; now = millis() beim Versand
+bool encodeTempBatch(Writer& w, const WsTempSample* samples, uint8_t count, uint32_t now);
+
+// LOG_RECORDS-Record um bereits kodierte Deferred-Logs, buildId = LOG_BUILD_ID_BYTES Bytes
+bool encodeLogRecords(Writer& w, const uint8_t* buildId, const uint8_t* records, size_t len);
+
+// Kompletter Frame mit einem Record; 0 bei Überlauf oder unbekanntem Typ
+size_t encode(const WsPendingMsg& msg, uint8_t* buf, size_t cap);
+
+}  // namespace TelemetryCodec
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <Arduino.h>
+#include <WiFiClientSecure.h>
+
+// Gemeinsames TLS-Profil für die Backend-Verbindungen (wss, /api/nettest). Die gepinnte CA gilt
+// nur für den Backend-Host, der Firmware-Check gegen API_ENDPOINT bleibt bei setInsecure().
+//
+// Eine gepinnte Root-CA (BACKEND_CA_PEM in credentials.h) statt des CA-Bundles, und ein
+// Handshake wird nur versucht, wenn der größte freie Heap-Block MIN_FREE_BLOCK hergibt -
+// sonst fällt der WebSocket auf ws:// Port 80 zurück und versucht TLS bei einem späteren
+// Reconnect wieder. Record-Puffer und Max-Fragment-Length
+// legt das vorkompilierte mbedTLS der Arduino-Libs fest (sdkconfig), nicht dieser Code;
+// gemessen wird, was eine Session tatsächlich kostet.
+namespace TlsProfile {
+
+// Record-Puffer (je ~16 KB rein, ~4 KB raus) + Zertifikatskette + Kontexte, mit Reserve
+static constexpr uint32_t MIN_FREE_BLOCK = 48 * 1024;
+
+struct Stats {
+    uint32_t handshakes = 0;       // erfolgreiche TLS-Verbindungen
+    uint32_t heapFallbacks = 0;    // wegen zu wenig Heap bei ws:// geblieben
+    uint32_t lastCost = 0;         // Heap-Verbrauch der letzten Session (Bytes)
+    uint32_t peakCost = 0;
+};
+
+// nullptr, wenn keine CA konfiguriert ist
+const char* pinnedCA();
+
+// Größter freier Block reicht für einen Handshake
+bool heapAllows();
+
+// CA setzen; ohne CA wie bisher setInsecure() (verschlüsselt, Server ungeprüft)
+void configure(WiFiClientSecure& client);
+
+// Kosten der Session verbuchen: freier Heap vor dem Verbindungsaufbau (pro Verbindung beim
+// Aufrufer gemerkt) gegen jetzt
+void recordConnected(uint32_t heapBefore);
+void recordHeapFallback();
+
+const Stats& stats();
+
+}  // namespace TlsProfile
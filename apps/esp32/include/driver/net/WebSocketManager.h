@@ -3,39 +3,51 @@
 #include <WebSocketsClient.h>
 #include <ArduinoJson.h>
 #include <functional>
+#include "Config.h"
+#include "utils/JsonArena.h"
+#include "driver/net/WsMessages.h"
+
+// Prioritätsklassen der Pending-Queue: gesendet wird immer zuerst die höchste Klasse,
+// eine volle Telemetrie-Klasse kann keine kritischen Events verdrängen
+enum class WsPriority : uint8_t {
+    CRITICAL,       // heatCycleCompleted (falls ohne Outbox)
+    STATE,          // statusUpdate, sessionUpdate
+    TELEMETRY,      // tempReading, heartbeat
+    COUNT
+};
+
+// Eingehende Text-Frames: Parse gegen Filter in eine feste Arena (utils/JsonArena.h)
+struct WsInboundStats {
+    uint32_t frames = 0;
+    uint32_t rejected = 0;     // Parse-Fehler oder Arena-Budget überschritten
+    uint32_t arenaPeak = 0;    // höchster Arena-Verbrauch eines Frames (Bytes)
+};
 
-// Pending message types (gepuffert, damit im Event-Callback-Kontext
-// kein JSON gebaut/gesendet wird - Stack-Overflow vermeiden)
-enum class WsMsgType : uint8_t {
-    NONE = 0,
-    HEARTBEAT,
-    STATUS_UPDATE,
-    HEAT_CYCLE_COMPLETED,
-    SESSION_UPDATE,
-    TEMP_READING
+struct WsQueueStats {
+    uint32_t queued = 0;
+    uint32_t sent = 0;
+    uint32_t coalesced = 0;    // durch neuere Message gleichen Typs ersetzt
+    uint32_t dropped = 0;
 };
 
-struct WsPendingMsg {
-    WsMsgType type = WsMsgType::NONE;
-    bool isOn = false;
-    bool isHeating = false;
-    uint32_t durationSec = 0;
-    uint8_t cycle = 0;
-    int clicks = 0;
-    int caps = 0;
-    float tempRaw = 0;
-    float tempCalibrated = 0;
+// Ausgehende Binär-Frames (TelemetryCodec); failed = Encode fehlgeschlagen, Frame verworfen
+struct WsEncodeStats {
+    uint32_t frames = 0;
+    uint32_t failed = 0;
 };
 
 class WebSocketManager {
 public:
     using MessageCallback = std::function<void(const char* type, const JsonDocument& doc)>;
     using ConnectionCallback = std::function<void(bool connected)>;
+    using CommandCallback = std::function<void(const JsonDocument& doc)>;
 
     void init(const char* url, const char* deviceId, const char* clientType = "device");
     void update();
 
     bool isConnected() const { return state.connected; }
+    bool isBinary() const { return state.binary; }
+    bool isTls() const { return state.tls; }
 
     // Send methods - puffern NUR in die Queue (kein JSON im Aufrufer-Kontext!)
     bool sendHeartbeat();
@@ -44,14 +56,45 @@ public:
     bool sendSessionUpdate(int clicks, int caps);
     bool sendTempReading(float tempRaw, float tempCalibrated, bool isHeating);
 
+    // Batching: Samples sammeln, ein Frame pro maxSamples oder wenn das älteste maxAgeMs alt ist
+    struct BatchPolicy {
+        uint8_t maxSamples = TelemetryConfig::BATCH_MAX_SAMPLES;
+        uint32_t maxAgeMs = TelemetryConfig::BATCH_MAX_AGE_MS;
+    };
+    bool sendTempSample(const WsTempSample& sample);
+    void setBatchPolicy(const BatchPolicy& policy);
+    const BatchPolicy& getBatchPolicy() const { return batchPolicy; }
+
     // Callbacks
     void onMessage(MessageCallback callback);
     void onConnectionChange(ConnectionCallback callback);
+    void onCommand(CommandCallback callback);
+
+    // Quittung für {"type":"cmd"} - sendet direkt, NUR aus dem CommandCallback aufrufen
+    // (läuft in webSocket.loop(), also im Loop-Kontext). id wird unverändert zurückgegeben.
+    void sendCommandAck(JsonVariantConst id, const char* error);
 
     WebSocketsClient webSocket;
 
     static WebSocketManager& instance();
 
+    // Encode-Vergleich JSON vs. Binär über alle Message-Typen (Debug-API /api/bench/telemetry)
+    struct EncodeBench {
+        uint16_t iterations = 0;
+        uint8_t messages = 0;          // Message-Typen pro Durchlauf
+        uint32_t jsonUs = 0;           // Gesamtzeit JsonDocument + serializeJson
+        uint32_t jsonBytes = 0;        // Bytes eines Durchlaufs
+        uint32_t binaryUs = 0;
+        uint32_t binaryBytes = 0;
+    };
+    static EncodeBench benchmarkEncoding(uint16_t iterations);
+
+    const WsQueueStats& queueStats(WsPriority prio) const { return pendingQueues[(uint8_t)prio].stats; }
+    static const char* priorityName(WsPriority prio);
+    const WsInboundStats& inboundStats() const { return inbound; }
+    const WsEncodeStats& encodeStats() const { return encoded; }
+    static constexpr size_t inboundBudget() { return INBOUND_BUDGET; }
+
 private:
     WebSocketManager() = default;
 
@@ -61,29 +104,76 @@ private:
         uint32_t lastHeartbeat = 0;
         uint32_t reconnectAttempts = 0;
         uint32_t lastReconnectAttempt = 0;
+        bool helloPending = false;     // Format-Angebot nach Connect noch senden
+        bool binary = false;           // Server hat Binärformat bestätigt
+        bool tls = false;              // wss:// mit gepinnter CA (driver/net/TlsProfile.h)
+        bool wantTls = false;          // URL ist wss://, tls = false heißt dann Heap-Fallback
+        uint32_t tlsSwitchMs = 0;      // letzter Wechsel wss <-> ws
+        uint32_t heapBeforeConnect = 0;  // freier Heap beim Verbindungsaufbau (TLS-Kosten)
     } state;
 
-    const char* host;
-    const char* path;
+    char host[96] = "";
+    char path[160] = "";
+    void begin();
 
     MessageCallback messageCallback;
     ConnectionCallback connectionCallback;
+    CommandCallback commandCallback;
 
     static constexpr uint32_t HEARTBEAT_INTERVAL_MS = 30000;
-    static constexpr uint8_t PENDING_MAX = 8;
-
-    // Ringbuffer fuer gepufferte Messages (kein Heap, keine STL-Allocs)
-    WsPendingMsg pending[PENDING_MAX];
-    uint8_t pendingHead = 0;
-    uint8_t pendingCount = 0;
-
+    static constexpr uint32_t RECONNECT_MS = 5000;
+    // TLS: jeder Reconnect ist ein voller Handshake (~1-2 s CPU) - seltener versuchen,
+    // tote Sessions per WS-Ping erkennen statt erst am TCP-Timeout
+    static constexpr uint32_t TLS_RECONNECT_MS = 15000;
+    static constexpr uint32_t TLS_PING_MS = 20000;
+    static constexpr uint32_t TLS_PONG_TIMEOUT_MS = 5000;
+    // Nach einem Heap-Fallback frühestens so spät wieder wss:// versuchen (kein Hin und Her)
+    static constexpr uint32_t TLS_RETRY_MS = 60000;
+    static constexpr uint8_t PENDING_PER_CLASS = 8;
+
+    // Ein Ringbuffer pro Prioritätsklasse (kein Heap, keine STL-Allocs)
+    struct PendingQueue {
+        WsPendingMsg msgs[PENDING_PER_CLASS];
+        uint8_t head = 0;
+        uint8_t count = 0;
+        WsQueueStats stats;
+    };
+    PendingQueue pendingQueues[(uint8_t)WsPriority::COUNT];
+
+    static WsPriority priorityOf(WsMsgType type);
+    static bool coalesces(WsMsgType type);
     bool queuePush(const WsPendingMsg& msg);
     bool queuePop(WsPendingMsg& msg);
+    void queueClear();
+
+    static constexpr uint8_t BATCH_CAPACITY = 32;
+    WsTempSample batch[BATCH_CAPACITY];
+    uint8_t batchCount = 0;
+    BatchPolicy batchPolicy;
+
+    bool batchDue(uint32_t now) const;
+    bool flushBatch(uint32_t now);
+    void flushLogRecords(uint32_t now);
+    // len = 0: Encode fehlgeschlagen - zählen und loggen statt still verwerfen
+    bool sendFrame(uint8_t* buf, size_t len, const char* what);
+    WsEncodeStats encoded;
 
     // Send helper - NUR aus update() (Loop-Kontext, grosser Stack) aufrufen!
+    static bool buildJson(const WsPendingMsg& msg, JsonDocument& doc);
     bool sendJson(const JsonDocument& doc);
+    bool sendBinary(const WsPendingMsg& msg);
+    bool send(const WsPendingMsg& msg);
     bool flushQueue();
 
+    // Inbound: nur gefilterte Felder, max. INBOUND_BUDGET Bytes pro Frame, kein Heap.
+    // Erster Variant-Pool + 2 KB für Strings und Folge-Pools
+    static constexpr size_t INBOUND_BUDGET = JSON_ARENA_POOL_BYTES + 2048;
+    static constexpr uint8_t INBOUND_NESTING = 3;     // root -> points -> {ir,temp}
+    JsonArena<INBOUND_BUDGET> inboundArena;
+    WsInboundStats inbound;
+    static const JsonDocument& inboundFilter();
+    void handleText(const uint8_t* payload, size_t length);
+
     // Event handler
     void handleEvent(WStype_t type, uint8_t* payload, size_t length);
 
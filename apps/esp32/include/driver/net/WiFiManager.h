@@ -2,6 +2,31 @@
 #include <Arduino.h>
 #include <WiFi.h>
 
+enum class WiFiLinkState : uint8_t {
+    CONNECTING,     // begin()/reconnect() läuft, wartet auf IP
+    CONNECTED,
+    BACKOFF,        // getrennt, nächster Versuch nach backoffMs
+};
+
+struct WiFiStats {
+    uint32_t connects = 0;
+    uint32_t disconnects = 0;
+    uint32_t attempts = 0;          // Reconnect-Versuche gesamt
+    uint8_t lastReason = 0;         // wifi_err_reason_t des letzten Disconnects
+    int8_t rssi = 0;                // letzter Wert, dBm
+    int8_t rssiMin = 0;
+    int8_t rssiMax = -128;
+    float rssiAvg = 0;              // EWMA über die aktuelle Verbindung
+    uint32_t connectedSinceMs = 0;  // 0 = nicht verbunden
+    uint32_t longestUpMs = 0;
+    uint32_t totalDownMs = 0;       // Summe der Ausfälle nach Disconnects
+    uint32_t backoffMs = 0;         // aktueller Backoff
+};
+
+// WiFi-Verbindung mit Reconnect-Zustandsautomat. Der WiFi-Event-Task setzt nur Flags;
+// Callbacks, Reconnects und Statistik laufen ausschließlich in update() (Loop-Kontext).
+// SSID/Passwort liegen in festen Puffern, reconnect() nutzt die gespeicherte Config -
+// ein flatternder Link erzeugt so keine neuen Heap-Allokationen.
 class WiFiManager {
 public:
     using ConnectionCallback = std::function<void(bool)>;
@@ -12,25 +37,45 @@ public:
     void onConnectionChange(ConnectionCallback callback);
     bool isConnected() const;
 
+    WiFiLinkState linkState() const { return state.link; }
+    const WiFiStats& stats() const { return stats_; }
+    static const char* linkStateName(WiFiLinkState s);
+    // Aktive Instanz (für /api/status), nullptr vor init()
+    static WiFiManager* active() { return instance; }
+
 private:
-    static void onWiFiEvent(WiFiEvent_t event);
-    void checkStatus();
-    void handleDisconnection();
+    static void onWiFiEvent(WiFiEvent_t event, WiFiEventInfo_t info);
+    void checkStatus(uint32_t now);
+    void onConnected(uint32_t now);
+    void onDisconnected(uint32_t now);
+    void scheduleRetry(uint32_t now);
+    void sampleRssi();
 
     ConnectionCallback connectionCallback;
     uint32_t lastStatusCheck;
-    
+
     static constexpr uint32_t STATUS_CHECK_INTERVAL_MS = 1000;
-    static constexpr uint32_t RECONNECT_INTERVAL_MS = 5000;  // 5s zwischen Reconnects
-    static constexpr uint32_t MAX_RECONNECT_RETRIES = 3;     // Max 3 Versuche
+    static constexpr uint32_t CONNECT_TIMEOUT_MS = 15000;    // ohne IP -> nächster Versuch
+    static constexpr uint32_t BACKOFF_BASE_MS = 1000;
+    static constexpr uint32_t BACKOFF_MAX_MS = 60000;        // danach jede Minute, unbegrenzt
+    static constexpr uint8_t BACKOFF_JITTER_PCT = 25;        // +-25%, damit nicht alle Boxen gleichzeitig
+    static constexpr float RSSI_ALPHA = 0.1f;
 
     struct {
-        wl_status_t lastStatus;
-        uint32_t lastReconnectAttempt;
-        uint32_t reconnectCount;
+        WiFiLinkState link;
+        uint32_t since;             // Eintritt in den aktuellen Zustand
+        uint8_t retry;              // Versuche seit der letzten erfolgreichen Verbindung
+        uint32_t downSince;         // 0 = nicht nach einem Disconnect
         bool notifiedConnected;
-        bool reconnectEnabled;  // false = Reconnect-Loop gestoppt
     } state;
 
+    // Vom WiFi-Event-Task gesetzt, in update() abgeholt
+    volatile bool eventDisconnected = false;
+    volatile uint8_t eventReason = 0;
+
+    char ssid_[33] = {};
+    char password_[65] = {};
+    WiFiStats stats_;
+
     static WiFiManager* instance;
 };
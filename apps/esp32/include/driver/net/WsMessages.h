@@ -0,0 +1,45 @@
+#pragma once
+
+#include <stdint.h>
+
+// Message-Typen der WebSocket-Telemetrie ohne WebSocketsClient/ArduinoJson,
+// damit TelemetryCodec auch im native-Test baut
+
+// Pending message types (gepuffert, damit im Event-Callback-Kontext
+// kein JSON gebaut/gesendet wird - Stack-Overflow vermeiden).
+// Die Werte sind zugleich Record-Typen im Binärformat (TelemetryCodec) - nicht umnummerieren!
+enum class WsMsgType : uint8_t {
+    NONE = 0,
+    HEARTBEAT,
+    STATUS_UPDATE,
+    HEAT_CYCLE_COMPLETED,
+    SESSION_UPDATE,
+    TEMP_READING,
+    TEMP_BATCH,         // nur intern/Binär: gesammelte WsTempSamples, nie in der Pending-Queue
+    EVENT_META,         // nur Binär: seq/at für den folgenden Record (Outbox-Events)
+    LOG_RECORDS         // nur Binär: Deferred-Log-Records (utils/Logger.h)
+};
+
+struct WsPendingMsg {
+    WsMsgType type = WsMsgType::NONE;
+    bool isOn = false;
+    bool isHeating = false;
+    uint32_t durationSec = 0;
+    uint8_t cycle = 0;
+    int clicks = 0;
+    int caps = 0;
+    float tempRaw = 0;
+    float tempCalibrated = 0;
+    uint32_t seq = 0;   // Outbox: > 0 = Server muss mit {"success":true,"seq":n} bestätigen
+    uint32_t at = 0;    // Outbox: Unix-Zeit der Entstehung (0 = unbekannt)
+};
+
+// Ein Telemetrie-Sample (Temperaturen in 0.1 °C), landet im Batch statt in der Queue
+struct WsTempSample {
+    uint32_t ms = 0;
+    int16_t rawDeci = 0;
+    int16_t calDeci = 0;
+    uint8_t power = 0;
+    bool zvsOn = false;
+    bool isHeating = false;
+};
@@ -0,0 +1,94 @@
+#pragma once
+
+#include <Arduino.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/queue.h>
+#include "driver/net/WebSocketManager.h"
+
+// Store-and-forward für kritische WS-Events (heatCycleCompleted): erst ins Flash, dann senden,
+// gelöscht wird erst nach Server-Ack ({"success":true,"seq":n}). Überlebt WLAN-Ausfall und Reboot.
+//
+// Append-only Log auf der "spiffs"-Partition (LittleFS). Alle Flash-Zugriffe laufen auf einem
+// eigenen Task: enqueue() legt nur in eine RTOS-Queue, der Task schreibt gesammelt alle
+// FLUSH_INTERVAL_MS - der Heater-Loop wartet nie auf Flash.
+//
+// Replay: genau ein Event in flight, frühestens alle REPLAY_INTERVAL_MS, ohne Ack nach
+// ACK_TIMEOUT_MS erneut. Reihenfolge bleibt erhalten, der Server wird nicht geflutet.
+class WsOutbox {
+public:
+    static constexpr uint32_t FLUSH_INTERVAL_MS = 500;
+    static constexpr uint32_t REPLAY_INTERVAL_MS = 250;
+    static constexpr uint32_t ACK_TIMEOUT_MS = 5000;
+    static constexpr size_t MAX_LOG_BYTES = 32 * 1024;   // ~900 Events
+    static constexpr uint8_t QUEUE_LEN = 16;
+
+    struct Stats {
+        uint32_t stored = 0;       // ins Flash geschrieben
+        uint32_t acked = 0;
+        uint32_t dropped = 0;      // Queue oder Log voll
+        uint32_t resent = 0;       // Ack-Timeout, erneut gesendet
+        uint32_t pending = 0;      // geschrieben, noch nicht bestätigt
+        bool mounted = false;
+    };
+
+    static WsOutbox& instance();
+
+    // Startet den Writer-Task (mountet dort LittleFS, formatiert beim ersten Mal)
+    void begin();
+    bool isAvailable() const { return !failed; }
+
+    // Loop-Kontext, blockiert nie. Setzt msg.at (Unix-Zeit, falls NTP da), seq vergibt der Task.
+    bool enqueue(WsPendingMsg msg);
+
+    // Nächstes unbestätigtes Event, falls Rate-Limit und Ack-Timeout es erlauben
+    bool nextForSend(WsPendingMsg& out, uint32_t now);
+    void ack(uint32_t seq);
+    void onConnected();
+
+    Stats stats() const;
+
+private:
+    WsOutbox() = default;
+
+    struct FlashRecord {
+        uint32_t seq;
+        uint32_t at;
+        uint32_t durationSec;
+        int32_t clicks;
+        int32_t caps;
+        uint8_t type;
+        uint8_t cycle;
+        uint8_t flags;
+        uint8_t reserved;
+        uint32_t crc;   // über alle Felder davor
+    };
+
+    static void taskEntry(void* arg);
+    void run();
+    bool mount();
+    void appendQueued();
+    void persistAck();
+    void loadNext();
+
+    static FlashRecord toFlash(const WsPendingMsg& msg);
+    static bool fromFlash(const FlashRecord& r, WsPendingMsg& out);
+
+    QueueHandle_t queue = nullptr;
+    TaskHandle_t task = nullptr;
+    mutable portMUX_TYPE mux = portMUX_INITIALIZER_UNLOCKED;
+    volatile bool failed = false;
+
+    // Geteilt Loop <-> Task (mux)
+    WsPendingMsg next;
+    bool hasNext = false;
+    uint32_t sentAt = 0;
+    uint32_t lastSend = 0;
+    uint32_t ackedSeq = 0;
+    Stats stats_;
+
+    // Nur Task
+    uint32_t nextSeq = 1;
+    uint32_t persistedAck = 0;
+    size_t readOffset = 0;      // erstes unbestätigtes Record
+    size_t nextOffset = 0;      // hinter dem geladenen next
+};
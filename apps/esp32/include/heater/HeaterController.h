@@ -57,6 +57,11 @@ struct HeaterController: public dh::BaseClass {
 
     bool isHeating() const { return state == State::HEATING; }
     bool isPaused() const { return state == State::PAUSED; }
+
+    // Ferngesteuerter Start (services/RemoteCommands): nullptr = frei, sonst Grund der Sperre
+    const char* startInterlock() const;
+    // Telemetrie für ms mit der Heiz-Rate senden, auch im Leerlauf
+    void requestTelemetryBurst(uint32_t ms);
     
     void setAutoStopTime(uint32_t time);
     uint32_t getAutoStopTime() const;
@@ -86,4 +91,5 @@ private:
 
     // Temp-Readings (RAW + kalibriert) ans Backend loggen
     uint32_t lastTempReadingSent = 0;
+    uint32_t telemetryBurstUntil = 0;
 };
\ No newline at end of file
@@ -1,34 +1,92 @@
 #pragma once
 
 #include <WebServer.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
 #include <functional>
 
+class JsonStream;
+
+// HTTP-Debug-Schnittstelle auf eigenem Task (PRO_CPU, niedrige Priorität): handleClient(),
+// OTA-Upload und Diagnose blockieren nie den Heater-Loop. Handler, die UI oder State anfassen,
+// laufen per runInLoop() im nächsten update() des Loops, der Server-Task wartet so lange.
 class DebugServer {
 public:
+    static constexpr uint32_t TASK_STACK = 8192;
+    static constexpr UBaseType_t TASK_PRIORITY = 1;
+    static constexpr uint32_t LOOP_CALL_TIMEOUT_MS = 5000;
+    // Render-Bench: Frames pro Loop-Durchlauf, dazwischen laufen Heater und Input weiter
+    static constexpr uint16_t BENCH_FRAMES_PER_LOOP = 2;
+
     static DebugServer& instance() {
         static DebugServer s;
         return s;
     }
 
     void init();
+    // Loop-Seite: führt ausstehende runInLoop()-Aufrufe aus
     void update();
     using UpdateCallback = std::function<bool()>;
     void setUpdateCallback(UpdateCallback cb) { updateCb_ = std::move(cb); }
 
 private:
+    enum class JobState : uint8_t {
+        IDLE,
+        RUNNING,
+        DONE
+    };
+
+    struct NetTestResult {
+        bool dns = false;
+        bool tcp443 = false;
+        bool tls = false;
+        char ip[16] = "";
+        char tlsErr[64] = "";
+        bool pinned = false;           // mit gepinnter CA statt setInsecure()
+        uint32_t tlsMs = 0;            // Dauer des Handshakes
+        uint32_t tlsHeap = 0;          // Heap einer offenen Session (Bytes)
+        char http[64] = "";
+        uint32_t durationMs = 0;
+    };
+
     WebServer server{80};
     UpdateCallback updateCb_;
     bool otaTooBig_ = false;
+    bool otaBusy_ = false;             // FirmwareUpdater hält den Flash, Upload verworfen
+    bool otaClaimed_ = false;
     size_t otaReceived_ = 0;
 
+    TaskHandle_t task_ = nullptr;
+    SemaphoreHandle_t loopDone_ = nullptr;
+    portMUX_TYPE mux_ = portMUX_INITIALIZER_UNLOCKED;
+    const std::function<void()>* loopCall_ = nullptr;
+
+    volatile JobState netTestState_ = JobState::IDLE;
+    NetTestResult netTest_;
+
+    static void taskEntry(void* arg);
+    static void netTestEntry(void* arg);
+    bool runInLoop(const std::function<void()>& fn);
+    void onLoop(const char* uri, HTTPMethod method, void (DebugServer::*handler)());
+
+    void sendJson(const std::function<void(JsonStream&)>& fill);
     void handleRoot();
     void handleApiStatus();
     void handleApiLog();
+    void handleApiStream();
+    void handleApiLogLevel();
+    void handleApiLogBin();
     void handleApiNetTest();
+    void handleApiNetTestStart();
     void handleApiSettingsGet();
     void handleApiSettingsPost();
     void handleApiUpdate();
     void handleApiOtaDone();
     void handleApiOtaUpload();
+    void releaseOtaClaim();
+    void handleApiBench();
+    void handleApiBenchTelemetry();
+    void handleApiScreenshot();
+    void handleApiLatency();
     void handleNotFound();
 };
@@ -0,0 +1,67 @@
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+
+struct mbedtls_sha256_context;
+
+// Ein GET auf das Firmware-Image ab einem Offset (FirmwareUpdater: HTTPClient, Tests: Attrappe)
+class IFirmwareSource {
+public:
+    virtual ~IFirmwareSource() = default;
+    // offset > 0 = mit Range-Header; liefert den HTTP-Status, <= 0 bei Verbindungsfehler
+    virtual int open(size_t offset) = 0;
+    // Blockiert bis Daten da sind; <= 0 = Verbindung zu oder Stall, der Request ist vorbei
+    virtual int read(uint8_t* buf, size_t len) = 0;
+    virtual void close() = 0;
+    // Pause vor dem nächsten Versuch (attempt = Versuche ohne Fortschritt in Folge)
+    virtual void backoff(uint8_t attempt) = 0;
+};
+
+// Ziel der Bytes (FirmwareUpdater: Update.write() in die OTA-Partition)
+class IFirmwareTarget {
+public:
+    virtual ~IFirmwareTarget() = default;
+    virtual bool write(const uint8_t* buf, size_t len) = 0;
+    virtual void progress(size_t written, size_t total) { (void)written; (void)total; }
+};
+
+// Resume/Verify-Zustandsautomat des Firmware-Downloads, ohne HTTP und ohne Update:
+// Abbrüche setzen per Range ab dem geschriebenen Offset fort, ein Server, der Range ignoriert
+// (200 statt 206), bekommt die schon geschriebenen Bytes verworfen. SHA-256 läuft über genau
+// die geschriebenen Bytes mit; aufgegeben wird nach MAX_RETRIES Versuchen ohne neues Byte.
+class FirmwareDownload {
+public:
+    enum class Result : uint8_t {
+        OK,
+        DOWNLOAD,      // MAX_RETRIES ohne Fortschritt
+        HTTP,          // 4xx, kommt beim nächsten Versuch wieder
+        WRITE,         // Target::write() fehlgeschlagen
+        SHA_MISMATCH,
+    };
+
+    static constexpr uint8_t MAX_RETRIES = 5;
+
+    FirmwareDownload(IFirmwareSource& source, IFirmwareTarget& target, uint8_t* buf, size_t bufSize)
+        : source_(source), target_(target), buf_(buf), bufSize_(bufSize) {}
+
+    // sha256 = nullptr: ohne Hashprüfung (firmware.json ohne sha256)
+    Result run(size_t size, const uint8_t* sha256);
+
+    size_t written() const { return written_; }
+    uint16_t retries() const { return retries_; }
+
+    static const char* resultName(Result r);
+
+private:
+    enum class Fetch : uint8_t { DONE, RETRY, FATAL };
+
+    Fetch fetch(size_t size, mbedtls_sha256_context* sha);
+
+    IFirmwareSource& source_;
+    IFirmwareTarget& target_;
+    uint8_t* buf_;
+    size_t bufSize_;
+    size_t written_ = 0;
+    uint16_t retries_ = 0;
+    Result fatal_ = Result::OK;
+};
@@ -1,24 +1,77 @@
 #pragma once
 #include <Arduino.h>
+#include <atomic>
+#include <memory>
 
+class WiFiClient;
+
+enum class OtaState : uint8_t {
+    IDLE,
+    CHECKING,
+    DOWNLOADING,
+    VERIFYING,
+    DONE,       // Neustart folgt
+    FAILED,
+};
+
+// Firmware-Update als Hintergrund-Task: firmware.json prüfen, Image per HTTP laden
+// (bei Abbruch Fortsetzen per Range-Request), direkt in die OTA-Partition schreiben und
+// dabei SHA-256 mitrechnen. Erst wenn der Hash zu firmware.json passt, wird die Partition
+// aktiviert. Der Loop sieht davon nur checkNow()/update() - kein HTTP im Loop-Kontext.
+// Resume und Hashprüfung stecken in FirmwareDownload (Host-Test: test_firmware_updater).
 class FirmwareUpdater {
 public:
     FirmwareUpdater();
 
-    // Einmaliger Check (z.B. nach WiFi-Connect); force = Rate-Limit ueberspringen
+    // Check anstoßen (z.B. nach WiFi-Connect); force = Rate-Limit überspringen.
+    // Kehrt sofort zurück, false wenn schon ein Check/Download läuft oder rate-limited.
     bool checkNow(bool force = false);
     // Im Loop aufrufen, prüft Intervall
     void update();
     // Aktuell laufendes Update?
-    bool isUpdating() const { return updating; }
+    bool isUpdating() const { return state_ != OtaState::IDLE && state_ != OtaState::FAILED; }
+    OtaState state() const { return state_; }
+    static const char* stateName(OtaState s);
+
+    // Update (Arduino) ist global: dieses Update und der /api/ota-Upload (DebugServer-Task)
+    // schließen sich aus. Wer Update.begin() aufruft, hält vorher den Claim.
+    static bool claimFlash();
+    static void releaseFlash();
+    static bool flashClaimed() { return flashClaimed_; }
+
+    // Für die HTTP-Quelle und das Update-Ziel des Downloads
+    static std::unique_ptr<WiFiClient> makeClient(const String& url);
+    void progress(size_t written, size_t total);
 
 private:
-    bool checkVersion();
-    bool downloadAndFlash(const char* url, size_t size);
+    struct Manifest {
+        String version;
+        String url;
+        size_t size = 0;
+        uint8_t sha256[32];
+        bool hasSha = false;
+    };
+
+    static void taskEntry(void* arg);
+    void run();
+    bool checkVersion(Manifest& m);
+    bool download(const Manifest& m);
+    void fail(const char* reason);
+    static bool parseHex(const char* hex, uint8_t* out, size_t len);
     static int parseVersionPart(const String& v, int index);
 
-    uint32_t lastCheck = 0;
     static constexpr uint32_t CHECK_INTERVAL_MS = 30UL * 60 * 1000; // Fallback: alle 30min
     static constexpr uint32_t MIN_CHECK_GAP_MS = 60 * 1000; // max 1x pro Minute
-    bool updating = false;
+    static constexpr uint32_t TASK_STACK = 8192;            // TLS-Handshake braucht Platz
+    static constexpr size_t CHUNK_SIZE = 1024;
+    static constexpr uint32_t STALL_TIMEOUT_MS = 10000;     // keine Daten -> Verbindung neu, ab Offset weiter
+    static constexpr uint32_t RETRY_BACKOFF_MS = 2000;      // * Versuch
+    static constexpr uint8_t PROGRESS_STEP = 5;             // Prozent pro Event
+
+    static std::atomic<bool> flashClaimed_;
+
+    TaskHandle_t task_ = nullptr;
+    uint32_t lastCheck = 0;
+    volatile OtaState state_ = OtaState::IDLE;
+    uint8_t lastPercent_ = 0;
 };
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+
+class HeaterController;
+
+// Befehle vom Backend über den WebSocket: {"type":"cmd","id":..,"cmd":"setTemp",...}
+// oder authentifiziert aus dem LAN (driver/net/LanLink.h, gleiches Schema).
+// Jeder Befehl wird mit {"type":"cmdAck","id":..,"ok":bool[,"error":".."]} quittiert.
+// Ein wiederholter Befehl (gleiche id, z.B. Retry nach Reconnect) wird erneut
+// quittiert, aber nicht noch einmal ausgeführt.
+//
+//   setTemp   {"temp":200}                  Limit setzen (1..MAX_TEMPERATURE)
+//   setPreset {"preset":2}                  Preset 0..3 wählen
+//   start                                   Heizen starten, nur wenn startInterlock() frei
+//   stop                                    Heizen pausieren (wie FIRE loslassen)
+//   calibrate {"points":[{"ir":111,"temp":150},{"ir":173,"temp":200}]}
+//   burst     {"ms":5000}                   Telemetrie mit Heiz-Rate für ms
+//
+// Läuft im Loop-Kontext (webSocket.loop() bzw. LanLink::update()).
+class RemoteCommands {
+public:
+    explicit RemoteCommands(HeaterController& heater);
+    void init();
+
+    // Führt einen Befehl aus (mit Duplikat-Check), nullptr = ok, sonst Fehlertext fürs Ack
+    const char* run(const JsonDocument& doc);
+
+    struct Stats {
+        uint32_t received = 0;
+        uint32_t executed = 0;
+        uint32_t rejected = 0;
+        uint32_t duplicates = 0;
+    };
+    const Stats& stats() const { return stats_; }
+
+private:
+    const char* execute(const char* cmd, const JsonDocument& doc);
+    const char* calibrate(JsonArrayConst points);
+
+    // Letzte ids mit Ergebnis (Fehlertexte sind Literale, der Zeiger bleibt gültig)
+    struct Recent {
+        char id[24];
+        const char* error;
+    };
+    const Recent* find(const char* id) const;
+    void remember(const char* id, const char* error);
+
+    HeaterController& heater;
+    Stats stats_;
+
+    static constexpr uint8_t RECENT_IDS = 8;
+    static constexpr uint32_t BURST_MAX_MS = 10000;
+    Recent recent[RECENT_IDS] = {};
+    uint8_t recentNext = 0;
+};
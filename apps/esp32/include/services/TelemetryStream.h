@@ -0,0 +1,84 @@
+#pragma once
+
+#include <Arduino.h>
+#include <WiFiClient.h>
+
+// Live-Telemetrie für den LAN-Debug (Server-Sent Events auf /api/stream?hz=N).
+//
+// Loop-Seite: onLoop() misst die Loop-Dauer und nimmt höchstens MAX_HZ Snapshots aus dem
+// HeaterState - nur solange ein Client verbunden ist. Server-Task-Seite: pump() formatiert
+// je Client im eigenen Takt (Rate-Limit) in einen festen Sendepuffer; passt ein Event nicht
+// mehr hinein, wird es verworfen, nach DROP_LIMIT verworfenen Events in Folge fliegt der Client.
+class TelemetryStream {
+public:
+    static constexpr uint8_t MAX_CLIENTS = 3;
+    static constexpr uint8_t MAX_HZ = 20;
+    static constexpr size_t CLIENT_BUFFER = 768;
+    static constexpr uint8_t DROP_LIMIT = 40;       // ~2 s bei 20 Hz
+
+    struct Snapshot {
+        uint32_t seq = 0;
+        uint32_t ms = 0;
+        float tempRaw = 0;          // °C, IR unkalibriert
+        float temp = 0;             // °C, kalibriert
+        float dTdt = 0;             // °C/s, geglättet
+        uint8_t power = 0;
+        bool zvsOn = false;
+        bool heating = false;
+        uint32_t loopAvgUs = 0;     // seit dem letzten Snapshot
+        uint32_t loopMaxUs = 0;
+    };
+
+    struct Stats {
+        uint32_t connects = 0;
+        uint32_t events = 0;
+        uint32_t dropped = 0;       // Sendepuffer voll (langsamer Client)
+    };
+
+    static TelemetryStream& instance();
+
+    // Loop-Kontext, einmal pro Device::loop()
+    void onLoop(uint32_t loopUs);
+
+    // Server-Task
+    bool addClient(WiFiClient client, uint8_t hz);
+    void pump();
+    uint8_t clientCount() const { return clients_; }
+    const Stats& stats() const { return stats_; }
+
+private:
+    TelemetryStream() = default;
+
+    struct Client {
+        WiFiClient conn;
+        uint32_t intervalMs = 0;
+        uint32_t lastSent = 0;
+        uint32_t lastSeq = 0;
+        uint32_t sent = 0;
+        uint8_t dropsInRow = 0;
+        size_t len = 0;
+        char buf[CLIENT_BUFFER];
+        bool active = false;
+    };
+
+    void sample(uint32_t now);
+    static size_t formatEvent(const Snapshot& s, char* out, size_t cap);
+    static bool flush(Client& c);
+
+    Client slots_[MAX_CLIENTS];
+    volatile uint8_t clients_ = 0;
+    Stats stats_;
+
+    // Loop <-> Server-Task (mux)
+    portMUX_TYPE mux_ = portMUX_INITIALIZER_UNLOCKED;
+    Snapshot latest_;
+
+    // Nur Loop
+    uint32_t lastSample_ = 0;
+    uint32_t loopSumUs_ = 0;
+    uint32_t loopCount_ = 0;
+    uint32_t loopMaxUs_ = 0;
+    float prevTemp_ = 0;
+    uint32_t prevMs_ = 0;
+    float dTdt_ = 0;
+};
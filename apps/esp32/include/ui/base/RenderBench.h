@@ -0,0 +1,78 @@
+#pragma once
+
+#include <Arduino.h>
+#include <memory>
+#include "FramebufferSink.h"
+
+class ScreenManager;
+
+// Render-Benchmark: fährt FireScreen (idle + heizend/HeatUI), Hauptmenü und StatusBar
+// mit skriptierten Zuständen durch und misst Frames/s sowie SPI-Bytes pro Frame.
+//
+// Jeder Frame wird kalt gerendert (State-Caches invalidiert), damit die Läufe vergleichbar sind.
+// headless = true lenkt alle Pushes in einen FramebufferSink (ohne SPI-Anteil).
+// Der Lauf ist in step()-Scheiben geteilt, damit der Loop (Heater) dazwischen weiterläuft;
+// HeaterState und Sink werden pro Scheibe gesetzt und wieder hergestellt.
+class RenderBench {
+public:
+    static RenderBench& instance() {
+        static RenderBench bench;
+        return bench;
+    }
+
+    void attach(ScreenManager* sm) { manager = sm; }
+
+    struct Result {
+        const char* name = "";
+        uint32_t frames = 0;
+        uint32_t totalUs = 0;
+        uint32_t maxUs = 0;
+        uint32_t pushes = 0;
+        uint32_t bytes = 0;
+
+        float fps() const { return totalUs ? frames * 1000000.0f / totalUs : 0.0f; }
+        uint32_t avgUs() const { return frames ? totalUs / frames : 0; }
+        uint32_t bytesPerFrame() const { return frames ? bytes / frames : 0; }
+    };
+
+    static constexpr uint8_t SCENARIO_COUNT = 4;
+
+    struct Report {
+        Result results[SCENARIO_COUNT];
+        uint8_t count = 0;
+        bool headless = false;
+        bool aborted = false;   // Heizen während des Laufs gestartet
+        uint32_t checksum = 0;  // CRC32 des letzten Headless-Frames (0 = kein Framebuffer)
+    };
+
+    // begin/step/cancel im UI-Kontext aufrufen (loop) und nicht während des Heizens: die Szenarien
+    // überschreiben HeaterState, step() bricht ab, sobald zwischen zwei Scheiben geheizt wird.
+    bool begin(uint16_t frames = 30, bool headless = false);
+    // Rendert höchstens maxFrames Frames; true, sobald der Lauf fertig (oder abgebrochen) ist
+    bool step(uint16_t maxFrames);
+    void cancel();
+    bool active() const { return running; }
+    // Gültig, sobald step() true geliefert hat
+    const Report& report() const { return current; }
+
+    static String toJson(const Report& report);
+
+    // Aktuellen Screen headless in einen Framebuffer rendern (im Loop, braucht Heap dafür).
+    // Das PNG-Encoding kann danach außerhalb des Loops laufen; nullptr ohne Screen oder Speicher.
+    std::unique_ptr<FramebufferSink> capture();
+
+private:
+    RenderBench() = default;
+
+    void drawFrame(uint8_t scenario, uint16_t i);
+    void finish();
+    void restorePanel();
+
+    ScreenManager* manager = nullptr;
+
+    Report current;
+    std::unique_ptr<FramebufferSink> fb;
+    uint16_t framesPerScenario = 0;
+    uint16_t frame = 0;
+    bool running = false;
+};
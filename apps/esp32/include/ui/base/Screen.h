@@ -65,6 +65,8 @@ protected:
     bool input(InputEvent event,
             std::initializer_list<InputButton> buttons,
             std::initializer_list<InputEventType> types);
+    // CHORD aus genau diesen Buttons
+    bool chord(InputEvent event, std::initializer_list<InputButton> buttons);
 private:
 };
 
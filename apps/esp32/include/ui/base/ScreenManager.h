@@ -18,23 +18,40 @@ public:
     void handleInput(InputEvent event);
 
     // Screen management
-    void setScreen(Screen* newScreen);
+    void setScreen(Screen* newScreen, ScreenTransition transition = ScreenTransition::NONE);
     Screen* getCurrentScreen() const { return currentScreen; }
     ScreenType getCurrentScreenType() const { return currentScreenType; }
     void registerScreen(ScreenType type, Screen* screen);
     Screen* getScreen(ScreenType type);
-    void switchScreen(ScreenType screenType);
+    void switchScreen(ScreenType screenType, ScreenTransition transition = ScreenTransition::NONE);
 
     // Dirty flag für Re-Rendering
     void setDirty() { dirty = true; }
     bool isDirty() const { return dirty; }
 
     UI* getUI() const { return ui; }
+    StatusBar* getStatusBar() const { return statusBar; }
 
     void setStatusbarVisible(bool visible) { statusbarVisible = visible; }
     bool isStatusbarVisible() const { return statusbarVisible; }
 
+    // Renderzeit pro Frame (Screen + StatusBar inkl. Push)
+    struct FrameStats {
+        uint32_t lastUs = 0;
+        uint32_t avgUs = 0;  // gleitender Mittelwert (1/16)
+        uint32_t maxUs = 0;
+        uint32_t frames = 0;
+        // Slide-Transitions (slideIn) laufen am Frame-Zähler vorbei
+        uint32_t lastSlideUs = 0;
+        uint32_t maxSlideUs = 0;
+        uint32_t slides = 0;
+    };
+    const FrameStats& getFrameStats() const { return frameStats; }
+    void resetFrameStats() { frameStats = FrameStats(); }
+
 private:
+    void slideIn(bool fromRight);
+
     // Core components
     DisplayDriver& display;
     InputManager& input;
@@ -49,4 +66,5 @@ private:
     // Rendering state
     bool dirty;
     bool statusbarVisible = false;
+    FrameStats frameStats;
 };
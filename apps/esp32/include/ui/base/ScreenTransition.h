@@ -16,12 +16,28 @@ enum class ScreenType : uint8_t {
     DEBUG_MENU,
 };
 
+inline const char* screenTypeName(ScreenType type) {
+    switch (type) {
+        case ScreenType::STARTUP: return "startup";
+        case ScreenType::FIRE: return "fire";
+        case ScreenType::STATS: return "stats";
+        case ScreenType::TIMEZONE: return "timezone";
+        case ScreenType::SCREENSAVER: return "screensaver";
+        case ScreenType::OTA_UPDATE: return "otaUpdate";
+        case ScreenType::HIDDEN_MODE: return "hiddenMode";
+        case ScreenType::MAIN_MENU: return "mainMenu";
+        case ScreenType::HEAT_MENU: return "heatMenu";
+        case ScreenType::DEBUG_MENU: return "debugMenu";
+    }
+    return "?";
+}
+
 // Transition-Effekte für Screen-Wechsel
 enum class ScreenTransition : uint8_t {
     NONE,           // Direkt wechseln
-    FADE,           // Fade out/in (falls genug RAM)
-    SLIDE_LEFT,     // Slide-Animation (zukünftig)
-    SLIDE_RIGHT
+    FADE,           // Fade out/in (falls genug RAM) - noch nicht umgesetzt, wie NONE
+    SLIDE_LEFT,     // Hardware-Scroll, neuer Screen kommt von rechts
+    SLIDE_RIGHT     // Hardware-Scroll, neuer Screen kommt von links
 };
 
 
@@ -2,6 +2,7 @@
 
 #include "ui/ColorPalette.h"
 #include <RenderSurface.h>
+#include <SurfaceSink.h>
 #include <TFT_eSPI.h>
 #include <vector>
 #include <functional>
@@ -45,12 +46,28 @@ public:
 
   void setDarkMode(bool dark);
 
+  // Hintergrundfarbe direkt aufs Panel (am Sink vorbei), ohne Sprite - für Vollbild-Flächen,
+  // die sonst eine 280x240-Surface (33.6 kB) dauerhaft im Pool halten würden
+  void fillBackground(int16_t x, int16_t y, int16_t w, int16_t h);
+
+  // Alternative Ausgabe (z.B. FramebufferSink); nullptr = direkt aufs Panel
+  void setSink(ISurfaceSink* sink) { _sink = sink; }
+  ISurfaceSink* getSink() const { return _sink; }
+
+  // Was seit dem letzten Reset Richtung Panel gepusht wurde
+  const PushStats& stats() const { return _stats; }
+  void resetStats() { _stats = PushStats(); }
+
 
 private:
+  void push(RenderSurface& s, int16_t x, int16_t y);
+
   TFT_eSPI* _tft;
+  ISurfaceSink* _sink = nullptr;
+  PushStats _stats;
   bool _usePsram;
   bool _forceRedraw;
-  bool _darkMode;
+  bool _darkMode = false;
 
 
   struct PoolEntry { 
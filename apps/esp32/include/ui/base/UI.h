@@ -18,6 +18,7 @@ public:
                      SurfaceCallback cb, bool clear = true);
 
     void clear();
+    void fillBackground(int16_t x, int16_t y, int16_t w, int16_t h) { _surfaceFactory.fillBackground(x, y, w, h); }
     
     // Force all surfaces to redraw on next render cycle
     void forceRedraw();
@@ -25,6 +26,12 @@ public:
     // Invalidate all cached surface states
     void invalidateAll();
 
+    // Ausgabe umleiten (Headless/Benchmark) und Push-Statistik
+    void setSink(ISurfaceSink* sink) { _surfaceFactory.setSink(sink); }
+    ISurfaceSink* getSink() const { return _surfaceFactory.getSink(); }
+    const PushStats& pushStats() const { return _surfaceFactory.stats(); }
+    void resetPushStats() { _surfaceFactory.resetStats(); }
+
 private:
     DisplayDriver* _driver;
     SurfaceFactory _surfaceFactory;
@@ -1,49 +1,77 @@
 #pragma once
 
+#include <atomic>
 
+#include "Config.h"
 #include "driver/ZVSDriver.h"
 #include "ui/ColorPalette.h"
 #include "ui/base/Screen.h"
 
+// Zeigt die echten MOSFET-Flanken der letzten windowMs an.
+// Die Flanken kommen mit Zeitstempel aus ZVSDriver::onPhaseChange in einen festen Ring,
+// gezeichnet wird lauflängenkodiert: pro Pegelabschnitt eine H-Linie, pro Flanke eine V-Linie.
 class ZVSOscilloscope {
 public:
-    ZVSOscilloscope(ZVSDriver* zvs, int displayWidth = 280)
-        : zvs(zvs), width(displayWidth) {
-        buffer.reserve(width);
-    }
-    
-    void update() {
-        // Sample current state
-        uint8_t value = zvs->isPhysicallyOn() ? 255 : 0;
-        buffer.push_back(value);
-        
-        // Keep only last N samples
-        if (buffer.size() > width) {
-            buffer.erase(buffer.begin());
-        }
+    static constexpr size_t CAPACITY = 64;  // >> Flanken pro Fenster (2 pro Duty-Periode)
+
+    ZVSOscilloscope(ZVSDriver* zvs, uint32_t windowMs = 3 * HeaterConfig::ZVS::DUTY_CYCLE_PERIOD_MS)
+        : zvs(zvs), windowMs(windowMs) {
+        reset();
+        zvs->onPhaseChange([this](ZVSDriver::Phase phase) {
+            record(phase == ZVSDriver::Phase::ON_PHASE, millis());
+        });
     }
-    
-    void draw(RenderSurface& s, int x, int y, int h) {
-        // Draw waveform
-        for (size_t i = 1; i < buffer.size(); i++) {
-            int x1 = x + i - 1;
-            int x2 = x + i;
-            int y1 = y + h - (buffer[i-1] * h / 255);
-            int y2 = y + h - (buffer[i] * h / 255);
-            
-            s.sprite->drawLine(x1, y1, x2, y2, COLOR_SUCCESS);
+
+    void draw(RenderSurface& s, int x, int y, int w, int h) {
+        if (!s.sprite || w <= 0) return;
+
+        const uint32_t now = millis();
+        const int yHigh = y;
+        const int yLow = y + h;
+
+        // Von rechts (jetzt) nach links durch die Flanken; level = Pegel rechts der Flanke
+        const uint32_t end = head.load(std::memory_order_acquire);
+        const uint32_t begin = end > CAPACITY ? end - CAPACITY : 0;
+        bool level = end ? edges[(end - 1) % CAPACITY].on : zvs->isPhysicallyOn();
+        int right = x + w;
+
+        for (uint32_t i = end; i > begin; i--) {
+            const Edge& e = edges[(i - 1) % CAPACITY];
+            const uint32_t age = now - e.t;
+            if (age >= windowMs) break;
+
+            const int ex = x + w - (int)((uint64_t)age * w / windowMs);
+            if (right > ex) s.sprite->drawFastHLine(ex, e.on ? yHigh : yLow, right - ex, COLOR_SUCCESS);
+            s.sprite->drawFastVLine(ex, yHigh, h + 1, COLOR_SUCCESS);
+            right = ex;
+            level = !e.on;
         }
-        
-        // Draw baseline
-        s.sprite->drawLine(x, y + h, x + width, y + h, COLOR_TEXT_SECONDARY);
+        if (right > x) s.sprite->drawFastHLine(x, level ? yHigh : yLow, right - x, COLOR_SUCCESS);
+
+        // Baseline
+        s.sprite->drawFastHLine(x, yLow + 1, w, COLOR_TEXT_SECONDARY);
     }
-    
+
     void reset() {
-        buffer.clear();
+        head.store(0, std::memory_order_release);
     }
 
 private:
+    struct Edge {
+        uint32_t t;
+        bool on;
+    };
+
+    void record(bool on, uint32_t t) {
+        const uint32_t n = head.load(std::memory_order_relaxed);
+        // OFF_PHASE -> SENSOR_WINDOW ist keine Flanke
+        if (n && edges[(n - 1) % CAPACITY].on == on) return;
+        edges[n % CAPACITY] = {t, on};
+        head.store(n + 1, std::memory_order_release);
+    }
+
     ZVSDriver* zvs;
-    std::vector<uint8_t> buffer;
-    int width;
+    uint32_t windowMs;
+    Edge edges[CAPACITY];
+    std::atomic<uint32_t> head{0};  // Anzahl geschriebener Flanken, Index = head % CAPACITY
 };
@@ -14,5 +14,6 @@ public:
 
 private:
     bool hasFailed = false;
+    uint8_t percent = 0;
 
 };
\ No newline at end of file
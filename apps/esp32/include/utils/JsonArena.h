@@ -0,0 +1,96 @@
+#pragma once
+
+#include <ArduinoJson.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+// Bump-Allocator für ArduinoJson mit festem Budget: kein Heap, reset() vor jeder Nachricht.
+// Reicht das Budget nicht, liefert allocate() nullptr und deserializeJson() meldet NoMemory -
+// eine zu große oder bösartige Nachricht wird verworfen statt den Heap zu fragmentieren.
+//
+//   static JsonArena<JSON_ARENA_POOL_BYTES + 2048> arena;
+//   arena.reset();
+//   JsonDocument doc(&arena);
+//
+// ArduinoJson holt den ersten Variant-Pool eines Dokuments in einem Block (ARDUINOJSON_POOL_CAPACITY
+// Slots, auf dem ESP32 128) und schrumpft ihn erst nach dem Parsen. N muss diesen Block pro
+// gleichzeitig lebendem Dokument enthalten, sonst scheitert schon das erste Feld mit NoMemory.
+// Slots sind ab ArduinoJson 7.3 8 Byte, davor 16 - gerechnet wird mit 16, das passt für jede 7.x.
+// Die Pool-Größe bleibt global der Default, ausgehende Dokumente auf dem Heap sind davon unberührt.
+static constexpr size_t JSON_ARENA_POOL_BYTES = ARDUINOJSON_POOL_CAPACITY * 16 + 8;
+
+template <size_t N>
+class JsonArena : public ArduinoJson::Allocator {
+public:
+    void* allocate(size_t size) override {
+        const size_t need = HEADER + align(size);
+        if (used_ + need > N) {
+            overflow_ = true;
+            return nullptr;
+        }
+        uint8_t* block = buf_ + used_;
+        *reinterpret_cast<size_t*>(block) = size;
+        last_ = used_;
+        used_ += need;
+        if (used_ > peak_) peak_ = used_;
+        return block + HEADER;
+    }
+
+    void deallocate(void* ptr) override {
+        // Nur der letzte Block gibt seinen Platz sofort zurück, alles andere reset()
+        if (ptr && isLast(ptr)) used_ = last_;
+    }
+
+    void* reallocate(void* ptr, size_t size) override {
+        if (!ptr) return allocate(size);
+        size_t& current = *reinterpret_cast<size_t*>(static_cast<uint8_t*>(ptr) - HEADER);
+
+        if (isLast(ptr)) {
+            // Letzter Block wächst/schrumpft an Ort und Stelle (String-Builder)
+            const size_t need = HEADER + align(size);
+            if (last_ + need > N) {
+                overflow_ = true;
+                return nullptr;
+            }
+            current = size;
+            used_ = last_ + need;
+            if (used_ > peak_) peak_ = used_;
+            return ptr;
+        }
+        if (size <= current) {
+            // shrinkToFit() der Pools: nicht kopieren, Rest bleibt bis reset() belegt
+            current = size;
+            return ptr;
+        }
+        const size_t old = current;
+        void* grown = allocate(size);
+        if (grown) memcpy(grown, ptr, old);
+        return grown;
+    }
+
+    void reset() {
+        used_ = 0;
+        last_ = 0;
+        overflow_ = false;
+    }
+
+    size_t used() const { return used_; }
+    size_t peak() const { return peak_; }
+    bool overflowed() const { return overflow_; }
+    static constexpr size_t capacity() { return N; }
+
+private:
+    static constexpr size_t HEADER = 8;   // Blockgröße, hält die Nutzdaten 8-Byte-aligned
+    static constexpr size_t align(size_t n) { return (n + 7) & ~size_t(7); }
+
+    bool isLast(const void* ptr) const {
+        return used_ > last_ && static_cast<const uint8_t*>(ptr) == buf_ + last_ + HEADER;
+    }
+
+    alignas(8) uint8_t buf_[N];
+    size_t used_ = 0;
+    size_t last_ = 0;
+    size_t peak_ = 0;
+    bool overflow_ = false;
+};
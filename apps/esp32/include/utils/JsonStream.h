@@ -0,0 +1,68 @@
+#pragma once
+
+#include <Arduino.h>
+#include <functional>
+#include <type_traits>
+
+// Streaming-JSON ohne Zwischen-String: schreibt in einen kleinen festen Puffer und gibt ihn
+// chunkweise an die Sink (z.B. WebServer::sendContent bei Chunked Transfer) weiter.
+// Kommas und Escaping übernimmt der Writer, Schachtelung bis MAX_DEPTH.
+//
+//   JsonStream json([&](const char* d, size_t n) { server.sendContent(d, n); });
+//   json.beginObject().field("heap", ESP.getFreeHeap()).beginArray("lines")...endArray().endObject();
+//   json.flush();
+class JsonStream {
+public:
+    using Sink = std::function<void(const char*, size_t)>;
+    static constexpr size_t BUFFER_SIZE = 512;
+    static constexpr uint8_t MAX_DEPTH = 16;
+
+    explicit JsonStream(Sink sink) : sink(std::move(sink)) {}
+    ~JsonStream() { flush(); }
+
+    JsonStream(const JsonStream&) = delete;
+    JsonStream& operator=(const JsonStream&) = delete;
+
+    // key == nullptr: als Array-Element bzw. Wurzel
+    JsonStream& beginObject(const char* key = nullptr);
+    JsonStream& endObject();
+    JsonStream& beginArray(const char* key = nullptr);
+    JsonStream& endArray();
+
+    JsonStream& field(const char* key, const char* v);
+    JsonStream& field(const char* key, const String& v) { return field(key, v.c_str()); }
+    JsonStream& field(const char* key, bool v);
+    JsonStream& field(const char* key, float v, uint8_t decimals = 2);
+    JsonStream& field(const char* key, double v, uint8_t decimals = 2) { return field(key, (float)v, decimals); }
+
+    template <typename T, std::enable_if_t<std::is_integral_v<T> && !std::is_same_v<T, bool>, int> = 0>
+    JsonStream& field(const char* key, T v) {
+        name(key);
+        if constexpr (std::is_signed_v<T>) number((int32_t)v);
+        else number((uint32_t)v);
+        return *this;
+    }
+
+    // Array-Elemente
+    template <typename T>
+    JsonStream& value(T v) { return field(nullptr, v); }
+    JsonStream& value(float v, uint8_t decimals) { return field(nullptr, v, decimals); }
+
+    void flush();
+
+private:
+    Sink sink;
+    char buf[BUFFER_SIZE];
+    size_t len = 0;
+    uint8_t depth = 0;
+    uint16_t hasItems = 0;      // Bit pro Ebene: schon ein Element geschrieben -> Komma
+
+    void name(const char* key);
+    void open(const char* key, char bracket);
+    void close(char bracket);
+    void number(int32_t v);
+    void number(uint32_t v);
+    void write(char c);
+    void write(const char* s, size_t n);
+    void writeEscaped(const char* s);
+};
@@ -3,12 +3,52 @@
 
 #include <Arduino.h>
 #include "driver/net/WebSocketManager.h"
+#include "driver/net/TelemetryCodec.h"
 #include <stdarg.h>
+#include <type_traits>
 
 // Ringbuffer-Größe für Debug-Server
 #define LOG_RING_SIZE 64
 #define LOG_LINE_MAX 160
 
+// Log-Pipeline: logPrint() formatiert einmal direkt in einen Slot der lock-freien MPSC-Queue
+// (aus jedem Task aufrufbar, kein Heap, blockiert nie - voll = verworfen). Ein Drain-Task
+// verteilt an Serial, Debug-Ring und WebSocket; der WS-Batch wird im Loop von
+// WebSocketManager::update() gesendet, nie aus dem Logger heraus.
+#define LOG_QUEUE_SLOTS 64              // Zweierpotenz
+#define LOG_DRAIN_INTERVAL_MS 20
+#define LOG_WS_BATCH_BYTES 1024
+#define LOG_WS_FLUSH_MS 1000
+#define LOG_BIN_RING_BYTES 4096         // Deferred-Records für /api/log/bin
+#define LOG_WS_BIN_BYTES 512
+#define LOG_BUILD_ID_BYTES 8            // Präfix von esp_app_desc_t::app_elf_sha256
+#define LOG_BIN_DUMP_HEADER (3 + LOG_BUILD_ID_BYTES)
+
+enum class LogLevel : uint8_t {
+    DEBUG,
+    INFO,
+    WARN,
+    ERROR,
+};
+
+enum class LogSink : uint8_t {
+    CONSOLE,        // Serial
+    RING,           // Debug-Server /api/log
+    WEBSOCKET,      // Backend
+    COUNT
+};
+
+struct LogStats {
+    uint32_t calls = 0;
+    uint32_t dropped = 0;       // Queue voll
+    uint32_t wsDropped = 0;     // WS-Batch voll
+    uint32_t avgCycles = 0;     // Kosten am Aufrufer
+    uint32_t maxCycles = 0;
+};
+
+// Startet den Drain-Task. Bis dahin geloggte Zeilen warten in der Queue.
+void logBegin();
+
 // Helper function for variadic arguments
 void vlogPrint(const char* type, const char* format, va_list args);
 
@@ -18,13 +58,111 @@ void logPrint(const char* type, const char* format, ...) __attribute__((format(p
 // Function to log messages to Serial and WebSocket with default type "log"
 void logPrint(const char* format, ...);
 
+// ---- Deferred-Format-Logs ----
+// LOG_DEFERRED("heat", "temp %u -> %u", a, b) speichert statt Text nur die Adressen von Typ- und
+// Format-Literal (.rodata) plus die Rohargumente - kein vsnprintf am Aufrufer. Serial bekommt
+// weiterhin Text (formatiert im Drain-Task), Debug-Ring (/api/log/bin) und WebSocket (Binärmodus)
+// den Record; gerendert wird auf dem Host mit scripts/logdecode.py und der firmware.elf.
+//
+// Record: [varint ts][u32 fmt][u32 type][Arg]...        (Adressen little endian)
+// Arg:    [LogArgTag u8][varint]                        INT als zigzag, FLOAT als IEEE-Bits
+// Erlaubt: Ganzzahlen bis 32 Bit, bool, enum, float/double, Zeiger. %s nur mit String-Literalen.
+enum LogArgTag : uint8_t {
+    LOG_ARG_UINT,
+    LOG_ARG_INT,
+    LOG_ARG_FLOAT,
+    LOG_ARG_PTR,
+};
+
+struct LogDeferredSlot {
+    uint8_t* buf;
+    size_t cap;
+    uint32_t pos;
+    uint32_t start;
+};
+
+bool logDeferredBegin(const char* type, const char* format, LogDeferredSlot& slot);
+void logDeferredEnd(const LogDeferredSlot& slot, const TelemetryCodec::Writer& w);
+
+template <typename T>
+inline void logArg(TelemetryCodec::Writer& w, T v) {
+    if constexpr (std::is_enum_v<T>) {
+        logArg(w, static_cast<std::underlying_type_t<T>>(v));
+    } else if constexpr (std::is_floating_point_v<T>) {
+        const float f = v;
+        uint32_t bits;
+        memcpy(&bits, &f, sizeof(bits));
+        w.u8(LOG_ARG_FLOAT);
+        w.varint(bits);
+    } else if constexpr (std::is_pointer_v<T>) {
+        w.u8(LOG_ARG_PTR);
+        w.varint((uint32_t)(uintptr_t)v);
+    } else {
+        static_assert(std::is_integral_v<T> && sizeof(T) <= 4, "LOG_DEFERRED: nur 32-Bit-Ganzzahlen, float und Zeiger");
+        if constexpr (std::is_signed_v<T>) {
+            w.u8(LOG_ARG_INT);
+            w.zigzag(v);
+        } else {
+            w.u8(LOG_ARG_UINT);
+            w.varint(v);
+        }
+    }
+}
+
+template <typename... Args>
+void logDeferred(const char* type, const char* format, Args... args) {
+    LogDeferredSlot slot;
+    if (!logDeferredBegin(type, format, slot)) return;
+    TelemetryCodec::Writer w(slot.buf, slot.cap);
+    (logArg(w, args), ...);
+    logDeferredEnd(slot, w);
+}
+
+// Nur für die printf-Prüfung des Compilers, wird nie aufgerufen
+inline void __attribute__((format(printf, 1, 2))) logFormatCheck(const char*, ...) {}
+
+// "" fmt "" erzwingt Literale - nur deren Adresse ist auf dem Host auflösbar
+#define LOG_DEFERRED(type, fmt, ...) \
+    do { \
+        if (false) logFormatCheck(fmt, ##__VA_ARGS__); \
+        logDeferred("" type "", "" fmt "", ##__VA_ARGS__); \
+    } while (0)
+
+// Level ergibt sich aus dem Typ: "error" / "warn", "lib" = DEBUG, sonst INFO
+LogLevel logLevelOf(const char* type);
+void logSetSinkLevel(LogSink sink, LogLevel level);
+LogLevel logSinkLevel(LogSink sink);
+const char* logLevelName(LogLevel level);
+const char* logSinkName(LogSink sink);
+LogStats logStats();
+
+// Bereits auf Serial ausgegebene Zeile (RingStream) nur in den Debug-Ring
 void logRingPush(const char* type, const char* line);
 
+// Loop-Seite: fertiger WS-Frame {"logs":[{"ts","t","m"},...],"now":<ms>} falls fällig.
+// out == nullptr verwirft den Batch (offline).
+size_t logTakeWsBatch(char* out, size_t cap, uint32_t now);
+
+// Loop-Seite, nur im Binärmodus: gesammelte Deferred-Records ([u8 len][Record]...) falls fällig
+size_t logTakeWsRecords(uint8_t* out, size_t cap, uint32_t now);
+
+// Build-ID der laufenden Firmware: die ersten LOG_BUILD_ID_BYTES des SHA256 der firmware.elf.
+// Deferred-Records sind nur mit genau dieser ELF lesbar, logdecode.py vergleicht die ID.
+const uint8_t* logBuildId();
+
+// Kopie des Deferred-Rings, älteste zuerst:
+// "HL" [u8 Version=2] [Build-ID, LOG_BUILD_ID_BYTES] [u8 len][Record]...
+size_t logBinRingDump(uint8_t* out, size_t cap);
+
 #include "utils/RingStream.h"
 
-// Ringbuffer: speichert die letzten Log-Zeilen für den Debug-Server.
-// Gibt die Zeilen als JSON-Array zurück: {"since":<ts>,"lines":[{"ts":<ms>,"t":"type","m":"msg"}]}
-// since = Millis-Timestamp des zuletzt gelieferten Logs (0 = alle).
-String logRingJson(uint32_t since);
+class JsonStream;
+
+// Ringbuffer: speichert die letzten Log-Zeilen für den Debug-Server, jede mit fortlaufender seq.
+// Schreibt ab seq (höchstens limit Zeilen) die Felder eines offenen JSON-Objekts:
+//   "first":<älteste noch vorhandene seq>,"next":<seq für den nächsten Aufruf>,
+//   "lines":[{"seq":n,"ts":<ms>,"t":"type","m":"msg"}]
+// seq < first heißt: dazwischen wurden Zeilen überschrieben.
+void logRingWrite(JsonStream& json, uint32_t seq, uint16_t limit);
 
 #endif // LOGGER_H
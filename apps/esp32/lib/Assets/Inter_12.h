@@ -1,234 +0,0 @@
-// Inter Font - 12px SemiBold
-// Generated: 18.1.2026, 17:57:04
-// Charset: 95 characters
-
-#ifndef INTER_12_H
-#define INTER_12_H
-
-const uint8_t Inter_12Bitmaps[] PROGMEM = {
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xC3, 0x0C,
-    0x30, 0xC0, 0x0C, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6C, 0x6C, 0x2C, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x0F, 0x1F, 0xC6, 0xC3,
-    0x63, 0xF8, 0xF0, 0x58, 0x6C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C,
-    0x1F, 0x1E, 0x07, 0x03, 0xE0, 0x70, 0x38, 0xFC, 0x3C, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x39, 0x83, 0x48, 0x1A, 0xC0, 0xD4, 0x03, 0xEC, 0x02, 0xF0, 0x37, 0x81, 0x3C,
-    0x18, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E,
-    0x06, 0xC0, 0xF8, 0x0F, 0x03, 0xC0, 0x7F, 0x19, 0xE1, 0xBC, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x10, 0xC3, 0x0C, 0x61, 0x86, 0x0C, 0x30, 0xC1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
-    0xC3, 0x0C, 0x18, 0x61, 0x8C, 0x30, 0xC2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xF0, 0xC3, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x30,
-    0x7F, 0x03, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x30, 0xC2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0C, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x41, 0x0C, 0x20, 0x82, 0x18, 0x60, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x1B, 0x19, 0x8C, 0xC6, 0x63, 0x31, 0x98, 0x6C, 0x1C, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x0E, 0x0F, 0x05, 0x80, 0xC0, 0x60,
-    0x30, 0x18, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x1B, 0x01,
-    0x80, 0xC0, 0xE0, 0xE0, 0xE0, 0x60, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3C, 0x1B, 0x01, 0x81, 0x80, 0x60, 0x30, 0x18, 0xEC, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x07, 0x07, 0x83, 0xC3, 0xE3, 0x71, 0xFC, 0x1C, 0x0E, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x18, 0x0C, 0x07, 0x83, 0x60, 0x30,
-    0x18, 0xEC, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x1B, 0x08,
-    0x0F, 0x87, 0x63, 0x31, 0x98, 0x6C, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7E, 0x03, 0x03, 0x01, 0x81, 0x80, 0xC0, 0x60, 0x70, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x1B, 0x0D, 0x86, 0xC1, 0xC1, 0xB1, 0x98, 0xEC, 0x3C, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x1B, 0x19, 0x8C, 0xC3, 0x61, 0xF0,
-    0x18, 0x6C, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x0C,
-    0x00, 0x00, 0x0C, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x0C, 0x00, 0x00, 0x0C,
-    0x30, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xF0, 0xF0, 0x60, 0x0F, 0x00, 0xF0,
-    0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0xFC, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x18, 0x07, 0x80, 0x78, 0x07, 0x07, 0x87, 0x81, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x0C, 0xC0, 0x30, 0x1C, 0x0C, 0x03,
-    0x00, 0x00, 0x30, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xC0, 0x61, 0x83, 0x7F, 0x0B, 0xF4, 0x6C, 0xD1, 0xE2, 0x47, 0x9B, 0x1B, 0xEC, 0x2F, 0xC0, 0xC0,
-    0x61, 0x87, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x01, 0xC0,
-    0x78, 0x0F, 0x83, 0xB0, 0x66, 0x0F, 0xE3, 0x8C, 0x61, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x06, 0x30, 0xC6, 0x18, 0xC3, 0xF0, 0x63, 0x0C, 0x61, 0x8C,
-    0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x06, 0x30,
-    0xC0, 0x30, 0x06, 0x00, 0xC0, 0x0C, 0x01, 0x8C, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x06, 0x30, 0xC6, 0x18, 0xC3, 0x18, 0x63, 0x0C, 0x61, 0x8C,
-    0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x06, 0x00,
-    0xC0, 0x18, 0x03, 0xF0, 0x60, 0x0C, 0x01, 0x80, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x0C, 0x03, 0x00, 0xC0, 0x3E, 0x0C, 0x03, 0x00, 0xC0, 0x30,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x03, 0x18, 0x30, 0x06,
-    0x00, 0x63, 0xC6, 0x0C, 0x30, 0xC3, 0x1C, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x86, 0x30, 0xC6, 0x18, 0xC3, 0xF8, 0x63, 0x0C, 0x61, 0x8C,
-    0x31, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xC3, 0x0C,
-    0x30, 0xC3, 0x0C, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x03, 0x01, 0x80, 0xC0, 0x60,
-    0x31, 0x98, 0xCC, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x86,
-    0x60, 0xD8, 0x1E, 0x03, 0xE0, 0x7E, 0x0C, 0xC1, 0x9C, 0x31, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC0,
-    0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0xE1, 0xCF, 0x0E,
-    0x78, 0x7B, 0xC3, 0xFE, 0x1F, 0xF0, 0xFF, 0x86, 0xDC, 0x36, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x87, 0x30, 0xE6, 0x1E, 0xC3, 0xD8, 0x6F,
-    0x0D, 0xE1, 0x9C, 0x33, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0x03, 0x18, 0x30, 0xC6, 0x0C, 0x60, 0xC6, 0x0C, 0x30, 0xC3, 0x18, 0x1F, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x06, 0x60, 0xC6, 0x18, 0xC3,
-    0x30, 0x7E, 0x0C, 0x01, 0x80, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0x03, 0x18, 0x30, 0xC6, 0x0C, 0x60, 0xC6, 0x0C, 0x36, 0xC3, 0x38, 0x1F, 0x80,
-    0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x06, 0x30, 0xC6,
-    0x18, 0xC3, 0xF0, 0x6E, 0x0C, 0xC1, 0x9C, 0x31, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1E, 0x03, 0x60, 0x60, 0x0E, 0x01, 0xF0, 0x0E, 0x00, 0xE1, 0xD8, 0x1F,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x03, 0x00, 0xC0,
-    0x30, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x31, 0x86, 0x30, 0xC6, 0x18, 0xC3, 0x18, 0x63, 0x0C, 0x61, 0x9C, 0x1F, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x8E, 0x30, 0xCC, 0x19, 0x83,
-    0x30, 0x3C, 0x07, 0x80, 0xF0, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x67, 0x31, 0x9C, 0xC6, 0x7B, 0x0D, 0xEC, 0x3D, 0xE0, 0xF7, 0x83, 0xCE, 0x0E, 0x38,
-    0x18, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x73, 0x86, 0x60, 0x78, 0x0F, 0x00, 0xC0, 0x3C, 0x0F, 0xC1, 0x98, 0x73, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x86, 0x60, 0xFC, 0x0F, 0x00, 0xC0, 0x18,
-    0x03, 0x00, 0x60, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x7F, 0x01, 0xC0, 0xE0, 0x30, 0x18, 0x0E, 0x07, 0x01, 0x80, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0xC3, 0x0C, 0x30, 0xC3, 0x0C, 0x30, 0xC3, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x61, 0x82, 0x08, 0x20, 0xC1, 0x04, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x70, 0xC3, 0x0C, 0x30, 0xC3, 0x0C, 0x30, 0xC7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x07, 0x01,
-    0xC0, 0xD8, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x04, 0xC1, 0xE1, 0xB1, 0x98, 0xCC, 0x3E, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x0C, 0x03, 0xE0, 0xCC, 0x33, 0x0C, 0xC3,
-    0x30, 0xCC, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0x06, 0xC6, 0x03, 0x01, 0x80, 0x6C, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0x01, 0xC3, 0xF0, 0xDC, 0x67, 0x19, 0xC6, 0x70, 0xDC, 0x3F, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x06, 0xC6, 0x63, 0xF1, 0x80,
-    0x6C, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0xC7, 0x8C, 0x30,
-    0xC3, 0x0C, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0xDC, 0x67, 0x19,
-    0xC6, 0x70, 0xDC, 0x3E, 0x0D, 0x83, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30,
-    0x0C, 0x03, 0xE0, 0xD8, 0x36, 0x0D, 0xC3, 0x70, 0xDC, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x03, 0x0C, 0x30, 0xC3, 0x0C, 0x30, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x30, 0x03, 0x0C, 0x30, 0xC3, 0x0C, 0x30, 0xCE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30,
-    0x18, 0x0D, 0x87, 0x83, 0xC1, 0xE0, 0xF0, 0x6C, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x30, 0xC3, 0x0C, 0x30, 0xC3, 0x0C, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xF0, 0xEE, 0xC7, 0x66, 0x3B, 0x31, 0xD9, 0x8E, 0xCC, 0x76, 0x60, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0,
-    0xD8, 0x36, 0x0D, 0xC3, 0x70, 0xDC, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xE0, 0xDC, 0x63, 0x18, 0xC6, 0x30, 0xDC, 0x1E, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0xCC, 0x33, 0x0C, 0xC3,
-    0x30, 0xCC, 0x3E, 0x0C, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xF0, 0xDC, 0x73, 0x18, 0xC7, 0x30, 0xDC, 0x1F, 0x00, 0xC0, 0x30, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0x83, 0x06, 0x0C, 0x18, 0x30, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x06, 0xC3, 0x81, 0xF0, 0x38, 0xEC, 0x3C, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xC7, 0x8C, 0x30, 0xC3, 0x0C, 0x38, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x70, 0xDC, 0x37, 0x0D, 0xC3, 0x70, 0xDC, 0x3F, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x8C, 0xC3, 0x61,
-    0xE0, 0xF0, 0x38, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x66, 0x66, 0xEC, 0x3E, 0xC3, 0xFC, 0x3F, 0xC3, 0xB8, 0x19, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x87, 0xC1, 0xC0, 0xE0, 0xF0,
-    0x6C, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x8C,
-    0xC3, 0x61, 0xE0, 0xF0, 0x38, 0x18, 0x0C, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0x81, 0x81, 0xC0, 0xC0, 0xE0, 0x60, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1C, 0x60, 0xC1, 0x83, 0x0C, 0x0C, 0x18, 0x30, 0x60, 0x70, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x30, 0xC3, 0x0C, 0x30, 0xC3, 0x0C, 0x30, 0xC3, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x70, 0x60, 0xC1, 0x81, 0x83, 0x86, 0x18, 0x30, 0x61, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x39, 0x13, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00
-};
-
-const GFXglyph Inter_12Glyphs[] PROGMEM = {
-    { 0, 6, 17, 6, 0, 0 },  // 'space' (32)
-    { 13, 6, 17, 6, 0, 0 },  // '!' (33)
-    { 26, 8, 17, 8, 0, 0 },  // '"' (34)
-    { 43, 9, 17, 9, 0, 0 },  // '#' (35)
-    { 63, 9, 17, 9, 0, 0 },  // '$' (36)
-    { 83, 13, 17, 13, 0, 0 },  // '%' (37)
-    { 111, 11, 17, 11, 0, 0 },  // '&' (38)
-    { 135, 5, 17, 5, 0, 0 },  // ''' (39)
-    { 146, 6, 17, 6, 0, 0 },  // '(' (40)
-    { 159, 6, 17, 6, 0, 0 },  // ')' (41)
-    { 172, 7, 17, 7, 0, 0 },  // '*' (42)
-    { 187, 10, 17, 10, 0, 0 },  // '+' (43)
-    { 209, 6, 17, 6, 0, 0 },  // ',' (44)
-    { 222, 6, 17, 6, 0, 0 },  // '-' (45)
-    { 235, 6, 17, 6, 0, 0 },  // '.' (46)
-    { 248, 6, 17, 6, 0, 0 },  // '/' (47)
-    { 261, 9, 17, 9, 0, 0 },  // '0' (48)
-    { 281, 9, 17, 9, 0, 0 },  // '1' (49)
-    { 301, 9, 17, 9, 0, 0 },  // '2' (50)
-    { 321, 9, 17, 9, 0, 0 },  // '3' (51)
-    { 341, 9, 17, 9, 0, 0 },  // '4' (52)
-    { 361, 9, 17, 9, 0, 0 },  // '5' (53)
-    { 381, 9, 17, 9, 0, 0 },  // '6' (54)
-    { 401, 9, 17, 9, 0, 0 },  // '7' (55)
-    { 421, 9, 17, 9, 0, 0 },  // '8' (56)
-    { 441, 9, 17, 9, 0, 0 },  // '9' (57)
-    { 461, 6, 17, 6, 0, 0 },  // ':' (58)
-    { 474, 6, 17, 6, 0, 0 },  // ';' (59)
-    { 487, 10, 17, 10, 0, 0 },  // '<' (60)
-    { 509, 10, 17, 10, 0, 0 },  // '=' (61)
-    { 531, 10, 17, 10, 0, 0 },  // '>' (62)
-    { 553, 10, 17, 10, 0, 0 },  // '?' (63)
-    { 575, 14, 17, 14, 0, 0 },  // '@' (64)
-    { 605, 11, 17, 11, 0, 0 },  // 'A' (65)
-    { 629, 11, 17, 11, 0, 0 },  // 'B' (66)
-    { 653, 11, 17, 11, 0, 0 },  // 'C' (67)
-    { 677, 11, 17, 11, 0, 0 },  // 'D' (68)
-    { 701, 11, 17, 11, 0, 0 },  // 'E' (69)
-    { 725, 10, 17, 10, 0, 0 },  // 'F' (70)
-    { 747, 12, 17, 12, 0, 0 },  // 'G' (71)
-    { 773, 11, 17, 11, 0, 0 },  // 'H' (72)
-    { 797, 6, 17, 6, 0, 0 },  // 'I' (73)
-    { 810, 9, 17, 9, 0, 0 },  // 'J' (74)
-    { 830, 11, 17, 11, 0, 0 },  // 'K' (75)
-    { 854, 10, 17, 10, 0, 0 },  // 'L' (76)
-    { 876, 13, 17, 13, 0, 0 },  // 'M' (77)
-    { 904, 11, 17, 11, 0, 0 },  // 'N' (78)
-    { 928, 12, 17, 12, 0, 0 },  // 'O' (79)
-    { 954, 11, 17, 11, 0, 0 },  // 'P' (80)
-    { 978, 12, 17, 12, 0, 0 },  // 'Q' (81)
-    { 1004, 11, 17, 11, 0, 0 },  // 'R' (82)
-    { 1028, 11, 17, 11, 0, 0 },  // 'S' (83)
-    { 1052, 10, 17, 10, 0, 0 },  // 'T' (84)
-    { 1074, 11, 17, 11, 0, 0 },  // 'U' (85)
-    { 1098, 11, 17, 11, 0, 0 },  // 'V' (86)
-    { 1122, 14, 17, 14, 0, 0 },  // 'W' (87)
-    { 1152, 11, 17, 11, 0, 0 },  // 'X' (88)
-    { 1176, 11, 17, 11, 0, 0 },  // 'Y' (89)
-    { 1200, 10, 17, 10, 0, 0 },  // 'Z' (90)
-    { 1222, 6, 17, 6, 0, 0 },  // '[' (91)
-    { 1235, 6, 17, 6, 0, 0 },  // '\' (92)
-    { 1248, 6, 17, 6, 0, 0 },  // ']' (93)
-    { 1261, 10, 17, 10, 0, 0 },  // '^' (94)
-    { 1283, 9, 17, 9, 0, 0 },  // '_' (95)
-    { 1303, 6, 17, 6, 0, 0 },  // '`' (96)
-    { 1316, 9, 17, 9, 0, 0 },  // 'a' (97)
-    { 1336, 10, 17, 10, 0, 0 },  // 'b' (98)
-    { 1358, 9, 17, 9, 0, 0 },  // 'c' (99)
-    { 1378, 10, 17, 10, 0, 0 },  // 'd' (100)
-    { 1400, 9, 17, 9, 0, 0 },  // 'e' (101)
-    { 1420, 6, 17, 6, 0, 0 },  // 'f' (102)
-    { 1433, 10, 17, 10, 0, 0 },  // 'g' (103)
-    { 1455, 10, 17, 10, 0, 0 },  // 'h' (104)
-    { 1477, 6, 17, 6, 0, 0 },  // 'i' (105)
-    { 1490, 6, 17, 6, 0, 0 },  // 'j' (106)
-    { 1503, 9, 17, 9, 0, 0 },  // 'k' (107)
-    { 1523, 6, 17, 6, 0, 0 },  // 'l' (108)
-    { 1536, 13, 17, 13, 0, 0 },  // 'm' (109)
-    { 1564, 10, 17, 10, 0, 0 },  // 'n' (110)
-    { 1586, 10, 17, 10, 0, 0 },  // 'o' (111)
-    { 1608, 10, 17, 10, 0, 0 },  // 'p' (112)
-    { 1630, 10, 17, 10, 0, 0 },  // 'q' (113)
-    { 1652, 7, 17, 7, 0, 0 },  // 'r' (114)
-    { 1667, 9, 17, 9, 0, 0 },  // 's' (115)
-    { 1687, 6, 17, 6, 0, 0 },  // 't' (116)
-    { 1700, 10, 17, 10, 0, 0 },  // 'u' (117)
-    { 1722, 9, 17, 9, 0, 0 },  // 'v' (118)
-    { 1742, 12, 17, 12, 0, 0 },  // 'w' (119)
-    { 1768, 9, 17, 9, 0, 0 },  // 'x' (120)
-    { 1788, 9, 17, 9, 0, 0 },  // 'y' (121)
-    { 1808, 9, 17, 9, 0, 0 },  // 'z' (122)
-    { 1828, 7, 17, 7, 0, 0 },  // '{' (123)
-    { 1843, 6, 17, 6, 0, 0 },  // '|' (124)
-    { 1856, 7, 17, 7, 0, 0 },  // '}' (125)
-    { 1871, 10, 17, 10, 0, 0 }  // '~' (126)
-};
-
-const GFXfont Inter_12 PROGMEM = {
-    (uint8_t*)Inter_12Bitmaps,
-    (GFXglyph*)Inter_12Glyphs,
-    32, 126, 17
-};
-
-#endif // INTER_12_H
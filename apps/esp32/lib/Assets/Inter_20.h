@@ -1,388 +0,0 @@
-// Inter Font - 20px Regular (Weight 400)
-// Generated: 18.1.2026, 18:46:57
-// Charset: 95 characters
-
-#ifndef INTER_20_H
-#define INTER_20_H
-
-const uint8_t Inter_20Bitmaps[] PROGMEM = {
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x18,
-    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x83, 0x60, 0xD8, 0x36, 0x0D, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x80, 0xC6,
-    0x03, 0x18, 0x0C, 0x41, 0xFF, 0xC7, 0xFF, 0x06, 0x30, 0x18, 0xC0, 0x62, 0x07, 0xFF, 0x1F, 0xFC,
-    0x31, 0x80, 0xC6, 0x03, 0x10, 0x0C, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x3E, 0x01,
-    0xFC, 0x0C, 0xB8, 0x32, 0x60, 0xC8, 0x03, 0xA0, 0x07, 0xE0, 0x0F, 0xC0, 0x0F, 0x80, 0x26, 0x0C,
-    0x98, 0x32, 0x60, 0xE9, 0x81, 0xFC, 0x03, 0xE0, 0x02, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xE0, 0x40, 0x1F, 0x0C, 0x03, 0x30, 0x80, 0x31, 0x18, 0x03, 0x11, 0x00, 0x33, 0x30, 0x01, 0xF6,
-    0x00, 0x1E, 0x67, 0x00, 0x0C, 0xD8, 0x00, 0xD8, 0xC0, 0x19, 0x8C, 0x01, 0x98, 0xC0, 0x31, 0x8C,
-    0x03, 0x0D, 0x80, 0x60, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0x0F, 0xC0, 0x0C, 0xE0, 0x0C, 0x60, 0x0C, 0xC0, 0x0F,
-    0xC0, 0x07, 0x00, 0x1F, 0x80, 0x39, 0x98, 0x31, 0xF8, 0x30, 0xF0, 0x30, 0x70, 0x38, 0xF8, 0x1F,
-    0xFC, 0x0F, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC3, 0x0C, 0x30, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0x03, 0x01, 0x81, 0x80, 0xC0, 0x60, 0x60, 0x30, 0x18, 0x0C, 0x06, 0x03, 0x01, 0xC0,
-    0x60, 0x30, 0x18, 0x06, 0x03, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x18, 0x06, 0x03, 0x00, 0xC0, 0x60, 0x38, 0x0C, 0x06, 0x03, 0x01, 0x80, 0xC0, 0x60, 0x30,
-    0x38, 0x18, 0x0C, 0x0C, 0x06, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0x00, 0xC0, 0xFC, 0x1E, 0x07, 0x81, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x0C, 0x00, 0x30, 0x00,
-    0xC0, 0x3F, 0xF0, 0xFF, 0xC0, 0x30, 0x00, 0xC0, 0x03, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x18, 0x18, 0x08, 0x18, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x87, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x04, 0x0C,
-    0x0C, 0x0C, 0x18, 0x18, 0x18, 0x10, 0x30, 0x30, 0x30, 0x60, 0x60, 0x60, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x01, 0xFC, 0x0E, 0x30, 0x30,
-    0x60, 0xC1, 0x83, 0x06, 0x0C, 0x18, 0x30, 0x60, 0xC1, 0x83, 0x06, 0x0C, 0x18, 0x30, 0x60, 0xE3,
-    0x81, 0xFC, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x38, 0x01, 0xE0,
-    0x0F, 0x80, 0x76, 0x01, 0x18, 0x00, 0x60, 0x01, 0x80, 0x06, 0x00, 0x18, 0x00, 0x60, 0x01, 0x80,
-    0x06, 0x00, 0x18, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x01, 0xFC, 0x0C,
-    0x38, 0x30, 0x60, 0x01, 0x80, 0x06, 0x00, 0x38, 0x01, 0xC0, 0x0E, 0x00, 0x70, 0x03, 0x80, 0x1C,
-    0x00, 0xE0, 0x03, 0xFE, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x01, 0xFC,
-    0x0E, 0x38, 0x30, 0x60, 0x03, 0x80, 0x1C, 0x01, 0xE0, 0x07, 0xC0, 0x03, 0x80, 0x06, 0x00, 0x18,
-    0x30, 0x60, 0xC3, 0x81, 0xFC, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00,
-    0x18, 0x00, 0xE0, 0x07, 0x80, 0x1E, 0x00, 0xD8, 0x06, 0x60, 0x19, 0x80, 0xC6, 0x07, 0x18, 0x1F,
-    0xF8, 0x7F, 0xE0, 0x06, 0x00, 0x18, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0x81, 0xFE, 0x06, 0x00, 0x18, 0x00, 0x60, 0x03, 0xF8, 0x0F, 0xF0, 0x30, 0xE0, 0x01, 0x80, 0x06,
-    0x00, 0x18, 0x30, 0x60, 0xE3, 0x81, 0xFC, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3E, 0x01, 0xFC, 0x06, 0x38, 0x30, 0x60, 0xC0, 0x03, 0x78, 0x0F, 0xF0, 0x38, 0xE0, 0xC1, 0x83,
-    0x06, 0x0C, 0x18, 0x30, 0x60, 0xE3, 0x81, 0xFC, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0x83, 0xFE, 0x00, 0x38, 0x01, 0xC0, 0x06, 0x00, 0x38, 0x00, 0xC0, 0x07, 0x00, 0x18,
-    0x00, 0x60, 0x03, 0x80, 0x0C, 0x00, 0x30, 0x00, 0xC0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x3E, 0x01, 0xFC, 0x0E, 0x38, 0x30, 0x60, 0xE3, 0x81, 0x8C, 0x03, 0xE0, 0x1F, 0xC0,
-    0xE3, 0x83, 0x06, 0x0C, 0x18, 0x30, 0x60, 0xE1, 0x81, 0xFC, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3E, 0x01, 0xFC, 0x0E, 0x38, 0x30, 0x60, 0xC1, 0x83, 0x06, 0x0C, 0x18, 0x38,
-    0xE0, 0x7F, 0x80, 0xF6, 0x00, 0x18, 0x30, 0x60, 0xC3, 0x01, 0xFC, 0x03, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x08, 0x18,
-    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x30, 0x03, 0xC0, 0x7E, 0x07, 0xC0, 0x3C, 0x00, 0xF0, 0x01, 0xF0, 0x01, 0xF8, 0x00,
-    0xF0, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x0F, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x30, 0x00, 0xF0, 0x01, 0xF8, 0x01, 0xF8, 0x00, 0xF0, 0x03, 0xC0, 0x7E, 0x07,
-    0xE0, 0x3C, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E,
-    0x01, 0xFC, 0x0E, 0x38, 0x30, 0x60, 0x01, 0x80, 0x0E, 0x00, 0x70, 0x03, 0x80, 0x0C, 0x00, 0x70,
-    0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x70, 0x01, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xFC, 0x00, 0x0F, 0xFE, 0x00, 0x38, 0x0E, 0x00, 0xC0, 0x06, 0x03, 0x0F, 0x66, 0x06,
-    0x3F, 0xCC, 0x18, 0xC3, 0x98, 0x33, 0x86, 0x30, 0x66, 0x0C, 0x60, 0xCC, 0x18, 0xC1, 0x98, 0x31,
-    0x83, 0x30, 0xE6, 0x06, 0x63, 0x9C, 0x0C, 0xFF, 0xF0, 0x0C, 0xF7, 0xC0, 0x1C, 0x00, 0x30, 0x1E,
-    0x01, 0xE0, 0x0F, 0xFF, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0x80, 0x03, 0x80, 0x07, 0xC0, 0x06, 0xC0, 0x06, 0xE0, 0x0E, 0xE0, 0x0C, 0x60, 0x1C,
-    0x70, 0x1C, 0x30, 0x1F, 0xF0, 0x3F, 0xF8, 0x30, 0x18, 0x30, 0x1C, 0x70, 0x1C, 0x60, 0x0C, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x3F, 0xF0, 0x30, 0x38, 0x30,
-    0x38, 0x30, 0x38, 0x30, 0x30, 0x3F, 0xE0, 0x3F, 0xF0, 0x30, 0x38, 0x30, 0x18, 0x30, 0x18, 0x30,
-    0x18, 0x30, 0x38, 0x3F, 0xF0, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xF8, 0x03, 0xFE, 0x03, 0x83, 0x81, 0x80, 0xC1, 0xC0, 0x60, 0xC0, 0x00, 0x60, 0x00,
-    0x30, 0x00, 0x18, 0x00, 0x0C, 0x00, 0x07, 0x01, 0xC1, 0x80, 0xE0, 0xE0, 0xE0, 0x3F, 0xE0, 0x0F,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x0F,
-    0xFE, 0x07, 0x07, 0x03, 0x81, 0xC1, 0xC0, 0x60, 0xE0, 0x30, 0x70, 0x18, 0x38, 0x0C, 0x1C, 0x06,
-    0x0E, 0x03, 0x07, 0x01, 0x83, 0x81, 0xC1, 0xC1, 0xC0, 0xFF, 0xE0, 0x7F, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x3F, 0xF8, 0x38, 0x00, 0x38,
-    0x00, 0x38, 0x00, 0x38, 0x00, 0x3F, 0xF8, 0x3F, 0xF8, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38,
-    0x00, 0x38, 0x00, 0x3F, 0xF8, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xE0, 0x7F, 0xC0, 0xC0, 0x01, 0x80, 0x03, 0x00, 0x06, 0x00, 0x0F, 0xF0, 0x1F, 0xE0,
-    0x30, 0x00, 0x60, 0x00, 0xC0, 0x01, 0x80, 0x03, 0x00, 0x06, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0xFF, 0xC0, 0x70, 0x38, 0x18, 0x06, 0x0E,
-    0x01, 0x83, 0x00, 0x00, 0xC0, 0x00, 0x30, 0x7E, 0x0C, 0x1F, 0x83, 0x00, 0x60, 0xE0, 0x18, 0x18,
-    0x06, 0x07, 0x03, 0x80, 0xFF, 0xE0, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x06, 0x0E, 0x03, 0x07, 0x01, 0x83, 0x80, 0xC1, 0xC0, 0x60,
-    0xE0, 0x30, 0x7F, 0xF8, 0x3F, 0xFC, 0x1C, 0x06, 0x0E, 0x03, 0x07, 0x01, 0x83, 0x80, 0xC1, 0xC0,
-    0x60, 0xE0, 0x30, 0x70, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x01, 0xC0,
-    0x1C, 0x01, 0xC0, 0x1C, 0x01, 0xC0, 0x1C, 0x01, 0xC0, 0x1C, 0x01, 0xC6, 0x1C, 0x71, 0xC3, 0x18,
-    0x3F, 0x81, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x1C, 0x30, 0x38, 0x30, 0x70, 0x30, 0xE0, 0x31,
-    0xC0, 0x33, 0x80, 0x37, 0x00, 0x3F, 0x80, 0x3D, 0xC0, 0x38, 0xE0, 0x30, 0x60, 0x30, 0x70, 0x30,
-    0x38, 0x30, 0x18, 0x30, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0,
-    0x03, 0x00, 0x0C, 0x00, 0x30, 0x00, 0xC0, 0x03, 0x00, 0x0C, 0x00, 0x30, 0x00, 0xC0, 0x03, 0x00,
-    0x0C, 0x00, 0x30, 0x00, 0xC0, 0x03, 0xFF, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0x80, 0xE0, 0xF0, 0x1C, 0x1E, 0x03, 0x83, 0xE0, 0xF0, 0x6C, 0x1E, 0x0D, 0x83, 0xC1, 0xB8,
-    0xD8, 0x33, 0x1B, 0x06, 0x63, 0x60, 0xCE, 0xCC, 0x18, 0xD9, 0x83, 0x1B, 0x30, 0x63, 0xC6, 0x0C,
-    0x38, 0xC1, 0x87, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1C, 0x06, 0x0F, 0x03, 0x07, 0x81, 0x83, 0xE0, 0xC1, 0xB8, 0x60, 0xCC, 0x30,
-    0x67, 0x18, 0x31, 0x8C, 0x18, 0x66, 0x0C, 0x3B, 0x06, 0x0D, 0x83, 0x07, 0xC1, 0x81, 0xE0, 0xC0,
-    0x70, 0x60, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0xFF, 0x80, 0x70, 0x70, 0x18, 0x0E, 0x0E, 0x01, 0x83, 0x00, 0x70, 0xC0, 0x1C, 0x30,
-    0x03, 0x0C, 0x01, 0xC3, 0x00, 0x70, 0xE0, 0x18, 0x18, 0x0E, 0x07, 0x07, 0x00, 0xFF, 0x80, 0x0F,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0,
-    0x3F, 0xF8, 0x38, 0x18, 0x38, 0x1C, 0x38, 0x1C, 0x38, 0x1C, 0x38, 0x38, 0x3F, 0xF0, 0x3F, 0xE0,
-    0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0xFF, 0x80, 0x70, 0x70, 0x18, 0x0E, 0x0E,
-    0x01, 0x83, 0x00, 0x70, 0xC0, 0x1C, 0x30, 0x07, 0x0C, 0x01, 0xC3, 0x00, 0x70, 0xE0, 0x18, 0x18,
-    0x6E, 0x07, 0x1F, 0x00, 0xFF, 0xC0, 0x0F, 0xF8, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x0F, 0xFE, 0x07, 0x03, 0x83, 0x80, 0xC1, 0xC0, 0x60,
-    0xE0, 0x30, 0x70, 0x78, 0x3F, 0xF8, 0x1F, 0xF0, 0x0E, 0x1C, 0x07, 0x07, 0x03, 0x83, 0x81, 0xC0,
-    0xE0, 0xE0, 0x30, 0x70, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0F, 0xE0, 0x1F, 0xF0, 0x18, 0x38, 0x38, 0x18, 0x38, 0x00, 0x1C, 0x00, 0x1F, 0xC0, 0x07,
-    0xF0, 0x00, 0xF8, 0x00, 0x18, 0x30, 0x18, 0x30, 0x18, 0x38, 0x38, 0x1F, 0xF0, 0x07, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF1, 0xFF, 0xE0, 0x18, 0x00, 0x30,
-    0x00, 0x60, 0x00, 0xC0, 0x01, 0x80, 0x03, 0x00, 0x06, 0x00, 0x0C, 0x00, 0x18, 0x00, 0x30, 0x00,
-    0x60, 0x00, 0xC0, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x06,
-    0x0E, 0x03, 0x07, 0x01, 0x83, 0x80, 0xC1, 0xC0, 0x60, 0xE0, 0x30, 0x70, 0x18, 0x38, 0x0C, 0x1C,
-    0x06, 0x0E, 0x03, 0x03, 0x01, 0x81, 0x81, 0xC0, 0xE0, 0xC0, 0x3F, 0xE0, 0x0F, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x0C, 0x70, 0x1C, 0x30, 0x18,
-    0x38, 0x18, 0x18, 0x38, 0x18, 0x30, 0x1C, 0x30, 0x0C, 0x70, 0x0C, 0x60, 0x0E, 0x60, 0x06, 0xC0,
-    0x06, 0xC0, 0x07, 0xC0, 0x03, 0x80, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0x83, 0x83, 0x9C, 0x1C, 0x18, 0x61, 0xF0, 0xC3, 0x0D, 0x86, 0x18, 0x6C, 0x70,
-    0xE3, 0x63, 0x03, 0x33, 0x98, 0x19, 0x8C, 0xC0, 0xCC, 0x66, 0x06, 0x63, 0x60, 0x1E, 0x0F, 0x00,
-    0xF0, 0x78, 0x07, 0x83, 0xC0, 0x3C, 0x1C, 0x00, 0xC0, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x1C, 0x18, 0x38,
-    0x1C, 0x30, 0x0E, 0x70, 0x06, 0xE0, 0x07, 0xC0, 0x03, 0x80, 0x03, 0x80, 0x07, 0xC0, 0x07, 0xE0,
-    0x0E, 0xE0, 0x1C, 0x70, 0x18, 0x38, 0x38, 0x18, 0x70, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x70, 0x1C, 0x30, 0x18, 0x38, 0x38, 0x1C, 0x30, 0x0C, 0x70, 0x0E, 0x60,
-    0x06, 0xC0, 0x07, 0xC0, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80,
-    0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0xFF, 0xE0,
-    0x03, 0x80, 0x06, 0x00, 0x1C, 0x00, 0x70, 0x01, 0xC0, 0x07, 0x00, 0x0E, 0x00, 0x38, 0x00, 0xE0,
-    0x03, 0x80, 0x06, 0x00, 0x1F, 0xFE, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3C, 0x3C, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
-    0x30, 0x3C, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x60, 0x60, 0x30,
-    0x30, 0x30, 0x10, 0x18, 0x18, 0x18, 0x0C, 0x0C, 0x0C, 0x04, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x78, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
-    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x78, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x0E, 0x00, 0xF0, 0x1B, 0x01, 0xB8, 0x39, 0x83, 0x18, 0x30,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0E, 0x03, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x03, 0xFE, 0x0C, 0x18, 0x00, 0x60, 0x0F, 0x81,
-    0xFE, 0x0E, 0x18, 0x30, 0x60, 0xC3, 0x83, 0xFE, 0x07, 0xD8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xC0, 0x03, 0x00, 0x0C, 0x00, 0x30, 0x00, 0xDE, 0x03, 0xFC, 0x0E, 0x38, 0x30, 0x60, 0xC1,
-    0x83, 0x06, 0x0C, 0x18, 0x30, 0x60, 0xE3, 0x83, 0xFC, 0x0D, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x1F, 0xC3, 0x8E, 0x30, 0x63, 0x00, 0x30,
-    0x03, 0x00, 0x30, 0x63, 0x8E, 0x1F, 0xC0, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x06, 0x00,
-    0x18, 0x00, 0x60, 0x3D, 0x81, 0xFE, 0x0C, 0x38, 0x30, 0x60, 0xC1, 0x83, 0x06, 0x0C, 0x18, 0x30,
-    0x60, 0xE3, 0x81, 0xFE, 0x03, 0xD8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3E, 0x01, 0xFC, 0x0E, 0x18, 0x30, 0x60, 0xFF, 0x83, 0xFE, 0x0C, 0x00,
-    0x30, 0x60, 0xE3, 0x81, 0xFC, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x18,
-    0x18, 0x7E, 0x7C, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3D, 0x81, 0xFE, 0x0E, 0x38, 0x30, 0x60, 0xC1, 0x83, 0x06, 0x0C, 0x18, 0x30, 0x60, 0xC3,
-    0x81, 0xFE, 0x03, 0xD8, 0x00, 0x60, 0xC3, 0x83, 0xFC, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x00, 0x0C, 0x00,
-    0x30, 0x00, 0xDF, 0x03, 0xFC, 0x0E, 0x38, 0x30, 0x60, 0xC1, 0x83, 0x06, 0x0C, 0x18, 0x30, 0x60,
-    0xC1, 0x83, 0x06, 0x0C, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xC0, 0x00, 0x06, 0x0C,
-    0x18, 0x30, 0x60, 0xC1, 0x83, 0x06, 0x0C, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x60, 0xC0, 0x00, 0x06, 0x0C, 0x18, 0x30, 0x60, 0xC1, 0x83, 0x06, 0x0C,
-    0x18, 0x30, 0x63, 0xC7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x30,
-    0x03, 0x00, 0x30, 0x03, 0x0C, 0x31, 0x83, 0x30, 0x36, 0x03, 0xE0, 0x3F, 0x03, 0x30, 0x33, 0x83,
-    0x1C, 0x30, 0xC3, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xC1, 0x83, 0x06, 0x0C, 0x18, 0x30, 0x60, 0xC1,
-    0x83, 0x06, 0x0C, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x3C, 0x0F, 0xFF, 0xC1,
-    0xC7, 0x18, 0x30, 0xE3, 0x86, 0x18, 0x70, 0xC3, 0x0E, 0x18, 0x61, 0xC3, 0x0C, 0x38, 0x61, 0x87,
-    0x0C, 0x30, 0xE1, 0x86, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0x03, 0xFC, 0x0E, 0x38,
-    0x30, 0x60, 0xC1, 0x83, 0x06, 0x0C, 0x18, 0x30, 0x60, 0xC1, 0x83, 0x06, 0x0C, 0x18, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x01, 0xFC, 0x0E,
-    0x38, 0x30, 0x60, 0xC1, 0x83, 0x06, 0x0C, 0x18, 0x30, 0x60, 0xE3, 0x81, 0xFC, 0x03, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDE, 0x03, 0xFC,
-    0x0E, 0x38, 0x30, 0x60, 0xC1, 0x83, 0x06, 0x0C, 0x18, 0x30, 0x60, 0xE3, 0x83, 0xFC, 0x0D, 0xE0,
-    0x30, 0x00, 0xC0, 0x03, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x81,
-    0xFE, 0x0E, 0x38, 0x30, 0x60, 0xC1, 0x83, 0x06, 0x0C, 0x18, 0x30, 0x60, 0xE3, 0x81, 0xFE, 0x03,
-    0xD8, 0x00, 0x60, 0x01, 0x80, 0x06, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0xFC, 0x70, 0x30,
-    0x18, 0x0C, 0x06, 0x03, 0x01, 0x80, 0xC0, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x3F,
-    0xC3, 0x0C, 0x30, 0x03, 0xE0, 0x1F, 0x80, 0x3C, 0x30, 0xC3, 0x0C, 0x3F, 0xC1, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x18, 0x18, 0x18, 0x18, 0x7C, 0x7C, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x1C, 0x1E,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xC1, 0x83, 0x06, 0x0C, 0x18, 0x30, 0x60, 0xC1, 0x83, 0x06, 0x0C,
-    0x18, 0x30, 0x60, 0xE3, 0x81, 0xFE, 0x03, 0xD8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0x06, 0x30, 0xC3, 0x0C, 0x38, 0xC1, 0x98, 0x19, 0x81, 0xD8, 0x0F,
-    0x00, 0xF0, 0x0F, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0x0C, 0x31, 0x87, 0x18, 0x67, 0x8C, 0x33, 0xCC, 0x19, 0xE6, 0x0C, 0xDB, 0x03, 0xCF,
-    0x81, 0xE7, 0x80, 0xF3, 0xC0, 0x38, 0xE0, 0x18, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x0C, 0x39, 0xC1, 0x98, 0x0F,
-    0x00, 0xF0, 0x06, 0x00, 0xF0, 0x1F, 0x81, 0x98, 0x30, 0xC7, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0x06, 0x30, 0xE3, 0x0C, 0x38, 0xC1, 0x98, 0x19, 0x81, 0xD8, 0x0F,
-    0x00, 0xF0, 0x0F, 0x00, 0x60, 0x06, 0x00, 0xC0, 0x3C, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC,
-    0x3F, 0xC0, 0x18, 0x03, 0x80, 0x70, 0x0E, 0x00, 0xC0, 0x18, 0x03, 0x80, 0x7F, 0xC7, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0x03, 0x83, 0x81, 0x80, 0xC0, 0x60, 0x30, 0x18, 0x38, 0x1C, 0x03, 0x01, 0x80,
-    0xC0, 0x60, 0x30, 0x18, 0x06, 0x03, 0x81, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
-    0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x1E,
-    0x03, 0x01, 0x80, 0xC0, 0x60, 0x30, 0x0C, 0x07, 0x03, 0x81, 0x81, 0xC0, 0xC0, 0x60, 0x30, 0x18,
-    0x0C, 0x1E, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC4, 0x3F, 0xF0, 0x8F, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-};
-
-const GFXglyph Inter_20Glyphs[] PROGMEM = {
-    { 0, 8, 28, 8, 0, 0 },  // 'space' (32)
-    { 28, 8, 28, 8, 0, 0 },  // '!' (33)
-    { 56, 10, 28, 10, 0, 0 },  // '"' (34)
-    { 91, 14, 28, 14, 0, 0 },  // '#' (35)
-    { 140, 14, 28, 14, 0, 0 },  // '$' (36)
-    { 189, 20, 28, 20, 0, 0 },  // '%' (37)
-    { 259, 16, 28, 16, 0, 0 },  // '&' (38)
-    { 315, 6, 28, 6, 0, 0 },  // ''' (39)
-    { 336, 9, 28, 9, 0, 0 },  // '(' (40)
-    { 368, 9, 28, 9, 0, 0 },  // ')' (41)
-    { 400, 10, 28, 10, 0, 0 },  // '*' (42)
-    { 435, 14, 28, 14, 0, 0 },  // '+' (43)
-    { 484, 8, 28, 8, 0, 0 },  // ',' (44)
-    { 512, 9, 28, 9, 0, 0 },  // '-' (45)
-    { 544, 8, 28, 8, 0, 0 },  // '.' (46)
-    { 572, 8, 28, 8, 0, 0 },  // '/' (47)
-    { 600, 14, 28, 14, 0, 0 },  // '0' (48)
-    { 649, 14, 28, 14, 0, 0 },  // '1' (49)
-    { 698, 14, 28, 14, 0, 0 },  // '2' (50)
-    { 747, 14, 28, 14, 0, 0 },  // '3' (51)
-    { 796, 14, 28, 14, 0, 0 },  // '4' (52)
-    { 845, 14, 28, 14, 0, 0 },  // '5' (53)
-    { 894, 14, 28, 14, 0, 0 },  // '6' (54)
-    { 943, 14, 28, 14, 0, 0 },  // '7' (55)
-    { 992, 14, 28, 14, 0, 0 },  // '8' (56)
-    { 1041, 14, 28, 14, 0, 0 },  // '9' (57)
-    { 1090, 8, 28, 8, 0, 0 },  // ':' (58)
-    { 1118, 8, 28, 8, 0, 0 },  // ';' (59)
-    { 1146, 14, 28, 14, 0, 0 },  // '<' (60)
-    { 1195, 14, 28, 14, 0, 0 },  // '=' (61)
-    { 1244, 14, 28, 14, 0, 0 },  // '>' (62)
-    { 1293, 14, 28, 14, 0, 0 },  // '?' (63)
-    { 1342, 23, 28, 23, 0, 0 },  // '@' (64)
-    { 1423, 16, 28, 16, 0, 0 },  // 'A' (65)
-    { 1479, 16, 28, 16, 0, 0 },  // 'B' (66)
-    { 1535, 17, 28, 17, 0, 0 },  // 'C' (67)
-    { 1595, 17, 28, 17, 0, 0 },  // 'D' (68)
-    { 1655, 16, 28, 16, 0, 0 },  // 'E' (69)
-    { 1711, 15, 28, 15, 0, 0 },  // 'F' (70)
-    { 1764, 18, 28, 18, 0, 0 },  // 'G' (71)
-    { 1827, 17, 28, 17, 0, 0 },  // 'H' (72)
-    { 1887, 8, 28, 8, 0, 0 },  // 'I' (73)
-    { 1915, 12, 28, 12, 0, 0 },  // 'J' (74)
-    { 1957, 16, 28, 16, 0, 0 },  // 'K' (75)
-    { 2013, 14, 28, 14, 0, 0 },  // 'L' (76)
-    { 2062, 19, 28, 19, 0, 0 },  // 'M' (77)
-    { 2129, 17, 28, 17, 0, 0 },  // 'N' (78)
-    { 2189, 18, 28, 18, 0, 0 },  // 'O' (79)
-    { 2252, 16, 28, 16, 0, 0 },  // 'P' (80)
-    { 2308, 18, 28, 18, 0, 0 },  // 'Q' (81)
-    { 2371, 17, 28, 17, 0, 0 },  // 'R' (82)
-    { 2431, 16, 28, 16, 0, 0 },  // 'S' (83)
-    { 2487, 15, 28, 15, 0, 0 },  // 'T' (84)
-    { 2540, 17, 28, 17, 0, 0 },  // 'U' (85)
-    { 2600, 16, 28, 16, 0, 0 },  // 'V' (86)
-    { 2656, 21, 28, 21, 0, 0 },  // 'W' (87)
-    { 2730, 16, 28, 16, 0, 0 },  // 'X' (88)
-    { 2786, 16, 28, 16, 0, 0 },  // 'Y' (89)
-    { 2842, 15, 28, 15, 0, 0 },  // 'Z' (90)
-    { 2895, 8, 28, 8, 0, 0 },  // '[' (91)
-    { 2923, 8, 28, 8, 0, 0 },  // '\' (92)
-    { 2951, 8, 28, 8, 0, 0 },  // ']' (93)
-    { 2979, 12, 28, 12, 0, 0 },  // '^' (94)
-    { 3021, 14, 28, 14, 0, 0 },  // '_' (95)
-    { 3070, 9, 28, 9, 0, 0 },  // '`' (96)
-    { 3102, 14, 28, 14, 0, 0 },  // 'a' (97)
-    { 3151, 14, 28, 14, 0, 0 },  // 'b' (98)
-    { 3200, 12, 28, 12, 0, 0 },  // 'c' (99)
-    { 3242, 14, 28, 14, 0, 0 },  // 'd' (100)
-    { 3291, 14, 28, 14, 0, 0 },  // 'e' (101)
-    { 3340, 8, 28, 8, 0, 0 },  // 'f' (102)
-    { 3368, 14, 28, 14, 0, 0 },  // 'g' (103)
-    { 3417, 14, 28, 14, 0, 0 },  // 'h' (104)
-    { 3466, 7, 28, 7, 0, 0 },  // 'i' (105)
-    { 3491, 7, 28, 7, 0, 0 },  // 'j' (106)
-    { 3516, 12, 28, 12, 0, 0 },  // 'k' (107)
-    { 3558, 7, 28, 7, 0, 0 },  // 'l' (108)
-    { 3583, 19, 28, 19, 0, 0 },  // 'm' (109)
-    { 3650, 14, 28, 14, 0, 0 },  // 'n' (110)
-    { 3699, 14, 28, 14, 0, 0 },  // 'o' (111)
-    { 3748, 14, 28, 14, 0, 0 },  // 'p' (112)
-    { 3797, 14, 28, 14, 0, 0 },  // 'q' (113)
-    { 3846, 9, 28, 9, 0, 0 },  // 'r' (114)
-    { 3878, 12, 28, 12, 0, 0 },  // 's' (115)
-    { 3920, 8, 28, 8, 0, 0 },  // 't' (116)
-    { 3948, 14, 28, 14, 0, 0 },  // 'u' (117)
-    { 3997, 12, 28, 12, 0, 0 },  // 'v' (118)
-    { 4039, 17, 28, 17, 0, 0 },  // 'w' (119)
-    { 4099, 12, 28, 12, 0, 0 },  // 'x' (120)
-    { 4141, 12, 28, 12, 0, 0 },  // 'y' (121)
-    { 4183, 12, 28, 12, 0, 0 },  // 'z' (122)
-    { 4225, 9, 28, 9, 0, 0 },  // '{' (123)
-    { 4257, 8, 28, 8, 0, 0 },  // '|' (124)
-    { 4285, 9, 28, 9, 0, 0 },  // '}' (125)
-    { 4317, 14, 28, 14, 0, 0 }  // '~' (126)
-};
-
-const GFXfont Inter_20 PROGMEM = {
-    (uint8_t*)Inter_20Bitmaps,
-    (GFXglyph*)Inter_20Glyphs,
-    32, 126, 28
-};
-
-#endif // INTER_20_H
@@ -1,399 +0,0 @@
-// Inter Font - 20px Bold (Weight 700)
-// Generated: 18.1.2026, 18:47:12
-// Charset: 95 characters
-
-#ifndef INTER_20B_H
-#define INTER_20B_H
-
-const uint8_t Inter_20BBitmaps[] PROGMEM = {
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x07, 0x03,
-    0x81, 0xC0, 0xE0, 0x70, 0x30, 0x18, 0x0C, 0x06, 0x03, 0x00, 0x00, 0xE0, 0x70, 0x38, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xBC, 0x3B,
-    0xC3, 0xB8, 0x39, 0x83, 0x98, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x80, 0xE6, 0x03, 0x98, 0x0C, 0xE1, 0xFF,
-    0xC7, 0xFF, 0x07, 0x30, 0x1D, 0xC0, 0x67, 0x07, 0xFF, 0x1F, 0xFC, 0x39, 0x80, 0xEE, 0x03, 0x38,
-    0x0C, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x3E, 0x01, 0xFC, 0x0E, 0xF8, 0x3B, 0xE0,
-    0xEC, 0x03, 0xF0, 0x0F, 0xE0, 0x1F, 0xC0, 0x1F, 0x80, 0x3E, 0x00, 0xD8, 0x3B, 0x60, 0xFF, 0x81,
-    0xFC, 0x03, 0xE0, 0x03, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE0, 0xC0, 0x3F, 0x0C, 0x03,
-    0x71, 0x80, 0x33, 0x18, 0x03, 0x33, 0x80, 0x37, 0x30, 0x03, 0xF7, 0x00, 0x1E, 0x60, 0x00, 0x0E,
-    0xF0, 0x00, 0xCF, 0x80, 0x1D, 0xDC, 0x01, 0x9D, 0xC0, 0x39, 0xDC, 0x03, 0x1D, 0xC0, 0x70, 0xF8,
-    0x06, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xE0, 0x03, 0xF8, 0x03, 0xCE, 0x01, 0xE7, 0x00, 0x77, 0x80, 0x3F, 0x80, 0x0F, 0x80, 0x1F,
-    0xC0, 0x1F, 0xEE, 0x0E, 0x7F, 0x07, 0x1F, 0x83, 0x87, 0x81, 0xC7, 0xE0, 0x7F, 0xF8, 0x1F, 0x98,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xE1, 0xC3, 0x87, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0x03, 0x03, 0x81, 0xC1, 0xE0, 0xE0, 0x70, 0x38, 0x1C, 0x0E, 0x07,
-    0x03, 0x81, 0xC0, 0xE0, 0x30, 0x1C, 0x0E, 0x03, 0x01, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x18, 0x0E, 0x03, 0x01, 0xC0, 0xE0, 0x70, 0x1C, 0x0E, 0x07, 0x03, 0x81,
-    0xC0, 0xE0, 0x70, 0x70, 0x38, 0x1C, 0x0C, 0x0E, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0xC1, 0xBC, 0x7F, 0x07, 0x01, 0xE0, 0xDC, 0x12, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xC0, 0x07, 0x00, 0x1C,
-    0x00, 0x70, 0x0F, 0xFC, 0x3F, 0xF0, 0xFF, 0xC0, 0x70, 0x01, 0xC0, 0x07, 0x00, 0x1C, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x38, 0x38, 0x38, 0x08, 0x18, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x8F, 0xC7,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x38, 0x38, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0E, 0x0C, 0x0C, 0x1C, 0x1C, 0x18, 0x18, 0x18, 0x38, 0x38, 0x30, 0x30, 0x70, 0x70, 0x60, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x01, 0xFC,
-    0x0F, 0x78, 0x38, 0xE0, 0xE3, 0x83, 0x8E, 0x0E, 0x38, 0x38, 0xE0, 0xE3, 0x83, 0x8E, 0x0E, 0x38,
-    0x38, 0xE0, 0xF7, 0x81, 0xFC, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00,
-    0x38, 0x01, 0xE0, 0x1F, 0x80, 0xFE, 0x03, 0xB8, 0x0C, 0xE0, 0x03, 0x80, 0x0E, 0x00, 0x38, 0x00,
-    0xE0, 0x03, 0x80, 0x0E, 0x00, 0x38, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E,
-    0x03, 0xFC, 0x0E, 0x38, 0x38, 0xE0, 0x03, 0x80, 0x0E, 0x00, 0x78, 0x03, 0xE0, 0x1F, 0x00, 0xF8,
-    0x07, 0xC0, 0x1E, 0x00, 0xF0, 0x03, 0xFE, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3E, 0x01, 0xFC, 0x0E, 0x70, 0x38, 0xE0, 0x07, 0x80, 0x1C, 0x01, 0xE0, 0x07, 0xC0, 0x03, 0x80,
-    0x0E, 0x00, 0x38, 0x38, 0xE0, 0xE7, 0x81, 0xFC, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0x00, 0x3C, 0x00, 0xF0, 0x07, 0xC0, 0x1F, 0x00, 0xDC, 0x07, 0x70, 0x19, 0xC0, 0xE7,
-    0x07, 0x1C, 0x1F, 0xFC, 0x7F, 0xF0, 0x07, 0x00, 0x1C, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0x81, 0xFE, 0x07, 0x00, 0x1C, 0x00, 0x70, 0x03, 0xF8, 0x0F, 0xF0, 0x38, 0xE0,
-    0x03, 0x80, 0x0F, 0x00, 0x3C, 0x38, 0xE0, 0xF3, 0x81, 0xFC, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1E, 0x01, 0xFC, 0x07, 0x78, 0x38, 0xC0, 0xE0, 0x03, 0xF8, 0x0F, 0xF0, 0x3C,
-    0xE0, 0xE3, 0x83, 0x8E, 0x0E, 0x38, 0x38, 0xE0, 0x73, 0x81, 0xFC, 0x03, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0x83, 0xFE, 0x00, 0x38, 0x01, 0xC0, 0x0F, 0x00, 0x38, 0x01, 0xE0,
-    0x07, 0x00, 0x1C, 0x00, 0xE0, 0x03, 0x80, 0x0E, 0x00, 0x38, 0x01, 0xE0, 0x07, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x01, 0xFC, 0x0F, 0x78, 0x38, 0xE0, 0xE3, 0x83, 0xDE, 0x07,
-    0xF0, 0x1F, 0xC0, 0xE3, 0x83, 0x8E, 0x0E, 0x38, 0x38, 0xE0, 0xF3, 0x81, 0xFC, 0x03, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x01, 0xFC, 0x0E, 0x70, 0x38, 0xE0, 0xE3, 0x83, 0x8E,
-    0x0E, 0x38, 0x3D, 0xE0, 0x7F, 0x80, 0xFE, 0x00, 0x38, 0x38, 0xE0, 0xF7, 0x01, 0xFC, 0x03, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x70, 0x38, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xE0, 0x70, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x70, 0x38, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xE0, 0x70, 0x38, 0x0C, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0xF0, 0x0F, 0xC1,
-    0xFC, 0x0F, 0x80, 0x38, 0x00, 0xFC, 0x01, 0xFC, 0x00, 0xFC, 0x00, 0xF0, 0x00, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xC3, 0xFF, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x0F, 0xFC, 0x3F, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x38, 0x00,
-    0xFC, 0x01, 0xFC, 0x00, 0xFC, 0x00, 0x70, 0x0F, 0xC1, 0xFC, 0x0F, 0xC0, 0x38, 0x00, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x7F, 0x81, 0xE3, 0x83,
-    0x87, 0x00, 0x0F, 0x00, 0x1C, 0x00, 0x78, 0x01, 0xE0, 0x07, 0x80, 0x0E, 0x00, 0x1C, 0x00, 0x00,
-    0x00, 0x70, 0x00, 0xE0, 0x01, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xF8, 0x00, 0x3F, 0xF8, 0x01, 0xE0, 0xF0, 0x0E, 0x00, 0xE0, 0x73, 0xDD, 0x81, 0x9F, 0xF7,
-    0x0C, 0xFF, 0xCC, 0x33, 0x8E, 0x30, 0xDE, 0x38, 0xC7, 0x70, 0xE3, 0x1D, 0xC3, 0x9C, 0x77, 0x9E,
-    0x60, 0xDF, 0xF3, 0x03, 0x3F, 0xF8, 0x0E, 0x7B, 0xC0, 0x18, 0x00, 0x30, 0x70, 0x01, 0xC0, 0xF0,
-    0x1E, 0x01, 0xFF, 0xF0, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x00, 0xF0,
-    0x00, 0xFC, 0x00, 0x7E, 0x00, 0x7F, 0x00, 0x39, 0xC0, 0x1C, 0xE0, 0x1E, 0x78, 0x0E, 0x1C, 0x07,
-    0xFE, 0x07, 0xFF, 0x83, 0xFF, 0xC1, 0xC0, 0xE1, 0xE0, 0x78, 0xE0, 0x1C, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x0F, 0xFE, 0x07, 0xFF, 0x83, 0xC1,
-    0xC1, 0xE0, 0xE0, 0xF0, 0x70, 0x7F, 0xF0, 0x3F, 0xF8, 0x1F, 0xFE, 0x0F, 0x07, 0x87, 0x81, 0xC3,
-    0xC1, 0xE1, 0xFF, 0xE0, 0xFF, 0xF0, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x03, 0xFE, 0x03, 0xFF, 0x81, 0xE3, 0xC1, 0xE0, 0xC0, 0xE0,
-    0x00, 0x70, 0x00, 0x38, 0x00, 0x1C, 0x00, 0x0E, 0x00, 0x07, 0x83, 0x03, 0xE3, 0xC0, 0xFF, 0xE0,
-    0x3F, 0xE0, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xF0, 0x0F, 0xFE, 0x07, 0xFF, 0x83, 0x83, 0xC1, 0xC0, 0xE0, 0xE0, 0x78, 0x70, 0x1C, 0x38,
-    0x0E, 0x1C, 0x07, 0x0E, 0x07, 0x87, 0x03, 0x83, 0x83, 0xC1, 0xFF, 0xE0, 0xFF, 0xE0, 0x7F, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x3F, 0xF8,
-    0x3F, 0xF8, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x3F, 0xF8, 0x3F, 0xF8, 0x3F, 0xF8, 0x38, 0x00,
-    0x38, 0x00, 0x38, 0x00, 0x3F, 0xFC, 0x3F, 0xFC, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0xFF, 0xC1, 0xFF, 0x83, 0xC0, 0x07, 0x80, 0x0F, 0x00, 0x1F,
-    0xF8, 0x3F, 0xF0, 0x7F, 0xE0, 0xF0, 0x01, 0xE0, 0x03, 0xC0, 0x07, 0x80, 0x0F, 0x00, 0x1E, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0xFF, 0xC0, 0x7F, 0xF8,
-    0x1E, 0x1E, 0x0F, 0x03, 0x03, 0x80, 0x00, 0xE0, 0x00, 0x38, 0x7E, 0x0E, 0x1F, 0x83, 0x87, 0xE0,
-    0xF0, 0x38, 0x1E, 0x0E, 0x07, 0xFF, 0x80, 0xFF, 0xC0, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x0E, 0x0F, 0x07, 0x07, 0x83, 0x83, 0xC1,
-    0xC1, 0xE0, 0xE0, 0xF0, 0x70, 0x7F, 0xF8, 0x3F, 0xFC, 0x1F, 0xFE, 0x0F, 0x07, 0x07, 0x83, 0x83,
-    0xC1, 0xC1, 0xE0, 0xE0, 0xF0, 0x70, 0x78, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
-    0x38, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0x80, 0x1E, 0x00, 0x78, 0x01, 0xE0, 0x07, 0x80, 0x1E, 0x00, 0x78, 0x01, 0xE0, 0x07, 0x87,
-    0x1E, 0x1E, 0x78, 0x79, 0xE0, 0xFF, 0x03, 0xFC, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1E, 0x0F, 0x0F, 0x0F, 0x07, 0x8F, 0x03, 0xCF, 0x01, 0xEF, 0x00, 0xFF, 0x00, 0x7F, 0x80,
-    0x3F, 0xE0, 0x1F, 0x78, 0x0F, 0x1C, 0x07, 0x8F, 0x03, 0xC3, 0x81, 0xE1, 0xE0, 0xF0, 0x78, 0x78,
-    0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0xF0,
-    0x01, 0xE0, 0x03, 0xC0, 0x07, 0x80, 0x0F, 0x00, 0x1E, 0x00, 0x3C, 0x00, 0x78, 0x00, 0xF0, 0x01,
-    0xE0, 0x03, 0xC0, 0x07, 0xFF, 0x0F, 0xFE, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xC1, 0xF0, 0xF8, 0x3E, 0x1F, 0x0F, 0xC3, 0xF1, 0xF8, 0x7E, 0x3F, 0x0F, 0xCF,
-    0xE1, 0xFD, 0xFC, 0x3F, 0xB7, 0x87, 0xB6, 0xF0, 0xE7, 0xDE, 0x1C, 0xFB, 0xC3, 0x9F, 0x78, 0x73,
-    0xCF, 0x0E, 0x39, 0xE1, 0xC7, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x0E, 0x0F, 0x07, 0x07, 0xC3, 0x83, 0xF1, 0xC1, 0xF8, 0xE0,
-    0xFE, 0x70, 0x7F, 0x38, 0x3F, 0xDC, 0x1E, 0xEE, 0x0F, 0x3F, 0x07, 0x9F, 0x83, 0xC7, 0xC1, 0xE3,
-    0xE0, 0xF0, 0xF0, 0x78, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFC, 0x00, 0xFF, 0x80, 0x7F, 0xF0, 0x1E, 0x1E, 0x0F, 0x03, 0x83, 0x80, 0xF0, 0xE0,
-    0x1C, 0x38, 0x07, 0x0E, 0x01, 0xC3, 0x80, 0xF0, 0xF0, 0x38, 0x1E, 0x1E, 0x07, 0xFF, 0x00, 0xFF,
-    0x80, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xF0, 0x3F, 0xF8, 0x3F, 0xF8, 0x38, 0x3C, 0x38, 0x3C, 0x38, 0x3C, 0x3F, 0xF8, 0x3F, 0xF8,
-    0x3F, 0xE0, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0xFF, 0xC0, 0x7F, 0xF0, 0x1E,
-    0x1E, 0x0F, 0x03, 0x83, 0x80, 0xF0, 0xE0, 0x1C, 0x38, 0x07, 0x0E, 0x01, 0xC3, 0x8C, 0xF0, 0xF3,
-    0xF8, 0x3E, 0x7E, 0x07, 0xFF, 0x00, 0xFF, 0xE0, 0x0F, 0xFC, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x0F, 0xFE, 0x07, 0xFF, 0x83, 0xC1, 0xC1,
-    0xE0, 0xE0, 0xF0, 0x70, 0x7F, 0xF8, 0x3F, 0xF8, 0x1F, 0xF0, 0x0F, 0x3C, 0x07, 0x8F, 0x03, 0xC7,
-    0x81, 0xE1, 0xE0, 0xF0, 0x78, 0x78, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xC0, 0x1F, 0xF0, 0x3F, 0xF0, 0x3C, 0x78, 0x38, 0x38, 0x3C, 0x00, 0x1F,
-    0xC0, 0x0F, 0xF0, 0x03, 0xF8, 0x00, 0x38, 0x38, 0x3C, 0x3C, 0x38, 0x3F, 0xF8, 0x1F, 0xF0, 0x07,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0xFF, 0xF1, 0xFF,
-    0xE0, 0x3C, 0x00, 0x78, 0x00, 0xF0, 0x01, 0xE0, 0x03, 0xC0, 0x07, 0x80, 0x0F, 0x00, 0x1E, 0x00,
-    0x3C, 0x00, 0x78, 0x00, 0xF0, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1C, 0x0E, 0x0E, 0x07, 0x07, 0x03, 0x83, 0x81, 0xC1, 0xC0, 0xE0, 0xE0, 0x70, 0x70, 0x38, 0x38,
-    0x1C, 0x1C, 0x0E, 0x0E, 0x07, 0x07, 0x83, 0x81, 0xE3, 0xC0, 0xFF, 0xC0, 0x3F, 0xE0, 0x0F, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x1C, 0x78, 0x1C,
-    0x38, 0x3C, 0x38, 0x38, 0x3C, 0x38, 0x1C, 0x78, 0x1C, 0x70, 0x1E, 0x70, 0x0E, 0xE0, 0x0E, 0xE0,
-    0x0F, 0xE0, 0x07, 0xC0, 0x07, 0xC0, 0x07, 0xC0, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0x83, 0xC3, 0x9C, 0x3E, 0x1C, 0xF1, 0xF1, 0xE3, 0x8F, 0x8E, 0x1C,
-    0xFE, 0x70, 0xE7, 0x73, 0x87, 0x3B, 0xBC, 0x3D, 0xDD, 0xC0, 0xFC, 0x7E, 0x07, 0xE3, 0xF0, 0x3F,
-    0x1F, 0x81, 0xF8, 0xF8, 0x07, 0x83, 0xC0, 0x3C, 0x1E, 0x01, 0xE0, 0xF0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x3C,
-    0x3C, 0x78, 0x1E, 0x70, 0x0E, 0xF0, 0x0F, 0xE0, 0x07, 0xE0, 0x07, 0xC0, 0x03, 0xC0, 0x07, 0xC0,
-    0x0F, 0xE0, 0x0E, 0xF0, 0x1E, 0x70, 0x3C, 0x78, 0x3C, 0x3C, 0x78, 0x3C, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x1C, 0x38, 0x3C, 0x3C, 0x78, 0x1C, 0x70, 0x0E, 0xF0,
-    0x0F, 0xE0, 0x07, 0xE0, 0x07, 0xC0, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80,
-    0x03, 0x80, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0,
-    0xFF, 0xE1, 0xFF, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0x78, 0x01, 0xE0, 0x07, 0x80, 0x1E, 0x00, 0x78,
-    0x01, 0xE0, 0x07, 0xC0, 0x0F, 0xFF, 0x1F, 0xFE, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0x8F, 0xC7, 0xE3, 0x81, 0xC0, 0xE0, 0x70, 0x38, 0x1C, 0x0E, 0x07, 0x03, 0x81,
-    0xC0, 0xE0, 0x70, 0x38, 0x1F, 0x8F, 0xC7, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x60, 0x70, 0x70, 0x30, 0x30, 0x38, 0x38, 0x18, 0x18, 0x18, 0x1C, 0x1C, 0x0C, 0x0C,
-    0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x1F,
-    0x0F, 0x81, 0xC0, 0xE0, 0x70, 0x38, 0x1C, 0x0E, 0x07, 0x03, 0x81, 0xC0, 0xE0, 0x70, 0x38, 0x1C,
-    0x3E, 0x1F, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C,
-    0x00, 0x78, 0x03, 0xE0, 0x0F, 0xC0, 0x77, 0x01, 0xDE, 0x07, 0x38, 0x38, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x1F,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1C, 0x06, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x03, 0xFE, 0x0E, 0x78, 0x00, 0xE0, 0x0F,
-    0x81, 0xFE, 0x0F, 0x38, 0x78, 0xE1, 0xE7, 0x83, 0xFE, 0x07, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x70, 0x00, 0xE0, 0x01, 0xC0, 0x03, 0x80, 0x07, 0x78, 0x0F, 0xF8, 0x1E, 0x78, 0x3C,
-    0x70, 0x70, 0xE0, 0xE1, 0xC1, 0xC3, 0x83, 0xC7, 0x07, 0x9E, 0x0F, 0xF8, 0x1D, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x01,
-    0xFE, 0x0F, 0x38, 0x38, 0xC0, 0xE0, 0x03, 0x80, 0x0E, 0x00, 0x38, 0x40, 0xF3, 0xC1, 0xFE, 0x03,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x01, 0xC0, 0x03, 0x80, 0x07, 0x01,
-    0xEE, 0x07, 0xFC, 0x1E, 0x78, 0x38, 0x70, 0x70, 0xE0, 0xE1, 0xC1, 0xC3, 0x83, 0x87, 0x07, 0x9E,
-    0x07, 0xFC, 0x07, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3E, 0x01, 0xFC, 0x0E, 0x38, 0x38, 0xE1, 0xFF, 0x87, 0xFE, 0x1E, 0x00,
-    0x38, 0x00, 0xE3, 0x81, 0xFC, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x87, 0xC3,
-    0x81, 0xC3, 0xF9, 0xFC, 0x38, 0x1C, 0x0E, 0x07, 0x03, 0x81, 0xC0, 0xE0, 0x70, 0x38, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xEE, 0x07, 0xFC, 0x1E, 0x78, 0x38, 0x70, 0x70, 0xE0, 0xE1,
-    0xC1, 0xC3, 0x83, 0x87, 0x07, 0x9E, 0x07, 0xFC, 0x07, 0xB8, 0x00, 0x70, 0x78, 0xE0, 0x7F, 0x80,
-    0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x70, 0x00, 0xE0, 0x01, 0xC0, 0x03, 0x80, 0x07, 0x7C, 0x0F, 0xFC, 0x1E, 0x78,
-    0x3C, 0x70, 0x70, 0xE0, 0xE1, 0xC1, 0xC3, 0x83, 0x87, 0x07, 0x0E, 0x0E, 0x1C, 0x1C, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x38, 0x00, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38,
-    0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x38, 0x38, 0x00, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
-    0x38, 0x38, 0x38, 0x38, 0xF8, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xE0, 0x03, 0x80, 0x0E, 0x00, 0x38, 0x00, 0xE3, 0x83, 0x9E, 0x0E, 0xF0, 0x3F, 0x80, 0xFE, 0x03,
-    0xF8, 0x0F, 0xF0, 0x39, 0xC0, 0xE3, 0x83, 0x8E, 0x0E, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xBC, 0xF0, 0x3F, 0xFF, 0x83, 0xCF, 0x3C, 0x38,
-    0xF3, 0xC3, 0x8E, 0x3C, 0x38, 0xE3, 0xC3, 0x8E, 0x3C, 0x38, 0xE3, 0xC3, 0x8E, 0x3C, 0x38, 0xE3,
-    0xC3, 0x8E, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x7C, 0x0F, 0xFC, 0x1E, 0x78,
-    0x3C, 0x70, 0x70, 0xE0, 0xE1, 0xC1, 0xC3, 0x83, 0x87, 0x07, 0x0E, 0x0E, 0x1C, 0x1C, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xF8, 0x07, 0xF8, 0x0E, 0x78, 0x38, 0x70, 0x70, 0xF0, 0xE1, 0xE1, 0xC3, 0xC3, 0x87, 0x03, 0x9E,
-    0x07, 0xF8, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0x78, 0x0F, 0xFC, 0x1E, 0x38, 0x3C, 0x70, 0x70, 0xF0, 0xE1, 0xE1,
-    0xC3, 0xC3, 0xC7, 0x07, 0x8E, 0x0F, 0xF8, 0x1D, 0xE0, 0x38, 0x00, 0x70, 0x00, 0xE0, 0x01, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x07, 0xFC, 0x1E, 0x78, 0x38,
-    0x70, 0x70, 0xE0, 0xE1, 0xC1, 0xC3, 0x83, 0x87, 0x07, 0x9E, 0x07, 0xFC, 0x07, 0xB8, 0x00, 0x70,
-    0x00, 0xE0, 0x01, 0xC0, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xE3, 0xF8, 0xF0, 0x3C,
-    0x0E, 0x03, 0x80, 0xE0, 0x38, 0x0E, 0x03, 0x80, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7E, 0x03, 0xFC, 0x0E, 0x78, 0x38, 0x00, 0xFE, 0x01, 0xFE, 0x01, 0xF8, 0x00, 0xE1, 0xE3,
-    0x83, 0xFE, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x07, 0x07, 0x83, 0xC3, 0xF9,
-    0xFC, 0x78, 0x3C, 0x1E, 0x0F, 0x07, 0x83, 0xC1, 0xE0, 0x7C, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0x0E, 0x0E, 0x1C, 0x1C, 0x38, 0x38, 0x70, 0x70, 0xE0, 0xE1, 0xC1, 0xC3, 0x83,
-    0x87, 0x07, 0x9E, 0x07, 0xFC, 0x07, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xC3, 0xC3, 0x8E, 0x0E, 0x38, 0x39, 0xE0, 0x77, 0x01,
-    0xDC, 0x07, 0xE0, 0x0F, 0x80, 0x3E, 0x00, 0xF0, 0x01, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x78, 0xE7, 0x1E, 0x38, 0xE7,
-    0x9C, 0x39, 0xF7, 0x0E, 0xFD, 0xC1, 0xFF, 0x70, 0x7E, 0xF8, 0x1F, 0x3E, 0x03, 0xCF, 0x80, 0xF3,
-    0xC0, 0x3C, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE3, 0x83, 0xDE, 0x07, 0xF0, 0x0F, 0x80, 0x3E, 0x00,
-    0x70, 0x03, 0xE0, 0x1F, 0xC0, 0x77, 0x03, 0x8E, 0x1E, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xC1, 0xC7, 0x0E, 0x0E, 0x38, 0x38, 0xE0, 0xE7,
-    0x01, 0xDC, 0x07, 0x70, 0x1F, 0x80, 0x3E, 0x00, 0xF0, 0x01, 0xC0, 0x07, 0x00, 0x38, 0x03, 0xE0,
-    0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x3F, 0xC0, 0x3C, 0x07, 0x80, 0x78, 0x0F,
-    0x01, 0xE0, 0x3C, 0x03, 0xC0, 0x7F, 0xE7, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xC0, 0xF0, 0x3C, 0x1E,
-    0x07, 0x01, 0xC0, 0x70, 0x1C, 0x07, 0x07, 0x81, 0xE0, 0x1C, 0x07, 0x01, 0xC0, 0x70, 0x1C, 0x03,
-    0xC0, 0xF0, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18,
-    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
-    0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x07, 0xC1, 0xF0, 0x1C, 0x07,
-    0x01, 0xC0, 0x70, 0x0E, 0x03, 0x80, 0x70, 0x3C, 0x0E, 0x07, 0x81, 0xC0, 0x70, 0x1C, 0x1F, 0x07,
-    0xC1, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x84, 0x7F, 0xF1, 0xFF, 0xC6, 0x3E, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-};
-
-const GFXglyph Inter_20BGlyphs[] PROGMEM = {
-    { 0, 8, 28, 8, 0, 0 },  // 'space' (32)
-    { 28, 9, 28, 9, 0, 0 },  // '!' (33)
-    { 60, 12, 28, 12, 0, 0 },  // '"' (34)
-    { 102, 14, 28, 14, 0, 0 },  // '#' (35)
-    { 151, 14, 28, 14, 0, 0 },  // '$' (36)
-    { 200, 20, 28, 20, 0, 0 },  // '%' (37)
-    { 270, 17, 28, 17, 0, 0 },  // '&' (38)
-    { 330, 7, 28, 7, 0, 0 },  // ''' (39)
-    { 355, 9, 28, 9, 0, 0 },  // '(' (40)
-    { 387, 9, 28, 9, 0, 0 },  // ')' (41)
-    { 419, 10, 28, 10, 0, 0 },  // '*' (42)
-    { 454, 14, 28, 14, 0, 0 },  // '+' (43)
-    { 503, 8, 28, 8, 0, 0 },  // ',' (44)
-    { 531, 9, 28, 9, 0, 0 },  // '-' (45)
-    { 563, 8, 28, 8, 0, 0 },  // '.' (46)
-    { 591, 8, 28, 8, 0, 0 },  // '/' (47)
-    { 619, 14, 28, 14, 0, 0 },  // '0' (48)
-    { 668, 14, 28, 14, 0, 0 },  // '1' (49)
-    { 717, 14, 28, 14, 0, 0 },  // '2' (50)
-    { 766, 14, 28, 14, 0, 0 },  // '3' (51)
-    { 815, 14, 28, 14, 0, 0 },  // '4' (52)
-    { 864, 14, 28, 14, 0, 0 },  // '5' (53)
-    { 913, 14, 28, 14, 0, 0 },  // '6' (54)
-    { 962, 14, 28, 14, 0, 0 },  // '7' (55)
-    { 1011, 14, 28, 14, 0, 0 },  // '8' (56)
-    { 1060, 14, 28, 14, 0, 0 },  // '9' (57)
-    { 1109, 9, 28, 9, 0, 0 },  // ':' (58)
-    { 1141, 9, 28, 9, 0, 0 },  // ';' (59)
-    { 1173, 14, 28, 14, 0, 0 },  // '<' (60)
-    { 1222, 14, 28, 14, 0, 0 },  // '=' (61)
-    { 1271, 14, 28, 14, 0, 0 },  // '>' (62)
-    { 1320, 15, 28, 15, 0, 0 },  // '?' (63)
-    { 1373, 22, 28, 22, 0, 0 },  // '@' (64)
-    { 1450, 17, 28, 17, 0, 0 },  // 'A' (65)
-    { 1510, 17, 28, 17, 0, 0 },  // 'B' (66)
-    { 1570, 17, 28, 17, 0, 0 },  // 'C' (67)
-    { 1630, 17, 28, 17, 0, 0 },  // 'D' (68)
-    { 1690, 16, 28, 16, 0, 0 },  // 'E' (69)
-    { 1746, 15, 28, 15, 0, 0 },  // 'F' (70)
-    { 1799, 18, 28, 18, 0, 0 },  // 'G' (71)
-    { 1862, 17, 28, 17, 0, 0 },  // 'H' (72)
-    { 1922, 8, 28, 8, 0, 0 },  // 'I' (73)
-    { 1950, 14, 28, 14, 0, 0 },  // 'J' (74)
-    { 1999, 17, 28, 17, 0, 0 },  // 'K' (75)
-    { 2059, 15, 28, 15, 0, 0 },  // 'L' (76)
-    { 2112, 19, 28, 19, 0, 0 },  // 'M' (77)
-    { 2179, 17, 28, 17, 0, 0 },  // 'N' (78)
-    { 2239, 18, 28, 18, 0, 0 },  // 'O' (79)
-    { 2302, 16, 28, 16, 0, 0 },  // 'P' (80)
-    { 2358, 18, 28, 18, 0, 0 },  // 'Q' (81)
-    { 2421, 17, 28, 17, 0, 0 },  // 'R' (82)
-    { 2481, 16, 28, 16, 0, 0 },  // 'S' (83)
-    { 2537, 15, 28, 15, 0, 0 },  // 'T' (84)
-    { 2590, 17, 28, 17, 0, 0 },  // 'U' (85)
-    { 2650, 16, 28, 16, 0, 0 },  // 'V' (86)
-    { 2706, 21, 28, 21, 0, 0 },  // 'W' (87)
-    { 2780, 16, 28, 16, 0, 0 },  // 'X' (88)
-    { 2836, 16, 28, 16, 0, 0 },  // 'Y' (89)
-    { 2892, 15, 28, 15, 0, 0 },  // 'Z' (90)
-    { 2945, 9, 28, 9, 0, 0 },  // '[' (91)
-    { 2977, 8, 28, 8, 0, 0 },  // '\' (92)
-    { 3005, 9, 28, 9, 0, 0 },  // ']' (93)
-    { 3037, 14, 28, 14, 0, 0 },  // '^' (94)
-    { 3086, 14, 28, 14, 0, 0 },  // '_' (95)
-    { 3135, 9, 28, 9, 0, 0 },  // '`' (96)
-    { 3167, 14, 28, 14, 0, 0 },  // 'a' (97)
-    { 3216, 15, 28, 15, 0, 0 },  // 'b' (98)
-    { 3269, 14, 28, 14, 0, 0 },  // 'c' (99)
-    { 3318, 15, 28, 15, 0, 0 },  // 'd' (100)
-    { 3371, 14, 28, 14, 0, 0 },  // 'e' (101)
-    { 3420, 9, 28, 9, 0, 0 },  // 'f' (102)
-    { 3452, 15, 28, 15, 0, 0 },  // 'g' (103)
-    { 3505, 15, 28, 15, 0, 0 },  // 'h' (104)
-    { 3558, 8, 28, 8, 0, 0 },  // 'i' (105)
-    { 3586, 8, 28, 8, 0, 0 },  // 'j' (106)
-    { 3614, 14, 28, 14, 0, 0 },  // 'k' (107)
-    { 3663, 8, 28, 8, 0, 0 },  // 'l' (108)
-    { 3691, 20, 28, 20, 0, 0 },  // 'm' (109)
-    { 3761, 15, 28, 15, 0, 0 },  // 'n' (110)
-    { 3814, 15, 28, 15, 0, 0 },  // 'o' (111)
-    { 3867, 15, 28, 15, 0, 0 },  // 'p' (112)
-    { 3920, 15, 28, 15, 0, 0 },  // 'q' (113)
-    { 3973, 10, 28, 10, 0, 0 },  // 'r' (114)
-    { 4008, 14, 28, 14, 0, 0 },  // 's' (115)
-    { 4057, 9, 28, 9, 0, 0 },  // 't' (116)
-    { 4089, 15, 28, 15, 0, 0 },  // 'u' (117)
-    { 4142, 14, 28, 14, 0, 0 },  // 'v' (118)
-    { 4191, 18, 28, 18, 0, 0 },  // 'w' (119)
-    { 4254, 14, 28, 14, 0, 0 },  // 'x' (120)
-    { 4303, 14, 28, 14, 0, 0 },  // 'y' (121)
-    { 4352, 12, 28, 12, 0, 0 },  // 'z' (122)
-    { 4394, 10, 28, 10, 0, 0 },  // '{' (123)
-    { 4429, 8, 28, 8, 0, 0 },  // '|' (124)
-    { 4457, 10, 28, 10, 0, 0 },  // '}' (125)
-    { 4492, 14, 28, 14, 0, 0 }  // '~' (126)
-};
-
-const GFXfont Inter_20B PROGMEM = {
-    (uint8_t*)Inter_20BBitmaps,
-    (GFXglyph*)Inter_20BGlyphs,
-    32, 126, 28
-};
-
-#endif // INTER_20B_H
@@ -1,416 +0,0 @@
-// Inter Font - 21px Regular (Weight 400)
-// Generated: 18.1.2026, 21:12:15
-// Charset: 95 characters
-
-#ifndef INTER_21_H
-#define INTER_21_H
-
-const uint8_t Inter_21Bitmaps[] PROGMEM = {
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x18, 0x18, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x70,
-    0xDC, 0x37, 0x0D, 0x83, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x01, 0x98, 0x0C, 0x60, 0x31, 0x87, 0xFF, 0x9F, 0xFC,
-    0x0C, 0xC0, 0x63, 0x01, 0x8C, 0x1F, 0xFE, 0x7F, 0xF0, 0x46, 0x03, 0x18, 0x0C, 0x60, 0x31, 0x80,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0xFC, 0x07, 0xF8, 0x3A, 0x60,
-    0xC9, 0x83, 0x20, 0x0E, 0x80, 0x1F, 0x80, 0x3F, 0x80, 0x3E, 0x00, 0x9C, 0x32, 0x30, 0xC9, 0xC3,
-    0xA6, 0x07, 0xF8, 0x0F, 0xC0, 0x08, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0x81, 0x80, 0x36, 0x0C, 0x03, 0x18, 0xC0, 0x18, 0xC4, 0x00, 0xC6, 0x60, 0x06, 0x36,
-    0x00, 0x1B, 0x30, 0x00, 0xF3, 0x3C, 0x00, 0x1B, 0xF0, 0x01, 0x99, 0x80, 0x0C, 0xC4, 0x00, 0xC6,
-    0x20, 0x06, 0x33, 0x00, 0x61, 0xF8, 0x02, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xC0, 0x0F, 0xE0, 0x0C, 0x60, 0x0C, 0x60, 0x0E, 0xE0, 0x0F, 0xC0, 0x07, 0x80, 0x1F, 0x80, 0x39,
-    0xDC, 0x30, 0xF8, 0x30, 0x78, 0x30, 0x78, 0x38, 0x78, 0x1F, 0xFC, 0x0F, 0x8C, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x0C, 0x30, 0xC3, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x80, 0xC0, 0xC0, 0x60, 0x60, 0x30, 0x38, 0x18, 0x0C, 0x06, 0x03, 0x01, 0x80, 0xE0, 0x30,
-    0x18, 0x06, 0x03, 0x00, 0xC0, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0C, 0x03, 0x00, 0x80, 0x60, 0x30, 0x0C, 0x06, 0x03, 0x01, 0x80, 0xC0, 0x60, 0x30,
-    0x18, 0x0C, 0x0C, 0x06, 0x06, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x1E, 0x83, 0xF0, 0x1C, 0x07, 0x80, 0x90, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0xC0, 0x01, 0x80, 0x03, 0x00, 0x7F, 0xE0, 0xFF,
-    0xC0, 0x18, 0x00, 0x30, 0x00, 0x60, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x08, 0x18, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xC3, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x06, 0x0C, 0x0C, 0x0C, 0x08, 0x18, 0x18, 0x18, 0x30, 0x30,
-    0x30, 0x60, 0x60, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x07, 0xF0, 0x18, 0x60, 0xE1, 0x83, 0x07, 0x0C, 0x0C, 0x30,
-    0x30, 0xC0, 0xC3, 0x03, 0x0C, 0x0C, 0x30, 0x70, 0xC1, 0x81, 0x86, 0x07, 0xF0, 0x0F, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0xE0, 0x07, 0x80, 0x3E,
-    0x01, 0xD8, 0x06, 0x60, 0x01, 0x80, 0x06, 0x00, 0x18, 0x00, 0x60, 0x01, 0x80, 0x06, 0x00, 0x18,
-    0x00, 0x60, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC,
-    0x07, 0xF8, 0x38, 0x60, 0xC1, 0xC0, 0x07, 0x00, 0x1C, 0x00, 0xE0, 0x07, 0x00, 0x38, 0x01, 0xC0,
-    0x0E, 0x00, 0x70, 0x03, 0x80, 0x0F, 0xFC, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xF8, 0x07, 0xF0, 0x38, 0x60, 0xC1, 0x80, 0x06, 0x00, 0x78, 0x07, 0xC0,
-    0x1F, 0x80, 0x07, 0x00, 0x1C, 0x00, 0x30, 0xC1, 0xC3, 0x86, 0x07, 0xF8, 0x0F, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x70, 0x03, 0xC0, 0x0F, 0x00,
-    0x6C, 0x03, 0x30, 0x1C, 0xC0, 0x63, 0x03, 0x0C, 0x1C, 0x30, 0x7F, 0xF1, 0xFF, 0xC0, 0x0C, 0x00,
-    0x30, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x07,
-    0xF8, 0x18, 0x00, 0x60, 0x01, 0x80, 0x0F, 0xF0, 0x3F, 0xE0, 0xE1, 0xC0, 0x07, 0x00, 0x0C, 0x00,
-    0x30, 0xC1, 0xC3, 0x86, 0x07, 0xF8, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7C, 0x07, 0xF8, 0x18, 0x60, 0xC1, 0xC3, 0x00, 0x0D, 0xF0, 0x3F, 0xE0, 0xE1,
-    0x83, 0x07, 0x0C, 0x0C, 0x30, 0x30, 0xC1, 0xC3, 0x86, 0x07, 0xF8, 0x0F, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x0F, 0xFC, 0x00, 0x60, 0x03, 0x00, 0x1C,
-    0x00, 0x60, 0x03, 0x80, 0x0C, 0x00, 0x70, 0x01, 0x80, 0x06, 0x00, 0x38, 0x00, 0xE0, 0x03, 0x00,
-    0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x07, 0xF8,
-    0x38, 0x60, 0xE1, 0x83, 0x86, 0x07, 0x38, 0x0F, 0xC0, 0x7F, 0x83, 0x86, 0x0C, 0x1C, 0x30, 0x30,
-    0xC1, 0xC3, 0x86, 0x07, 0xF8, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xF8, 0x07, 0xF0, 0x38, 0x60, 0xC1, 0xC3, 0x03, 0x0C, 0x0C, 0x30, 0x70, 0xE1, 0xC1,
-    0xFF, 0x03, 0xEC, 0x00, 0x70, 0xC1, 0x83, 0x8E, 0x07, 0xF0, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x18, 0x18, 0x08, 0x18, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x1E, 0x01, 0xF8, 0x0F, 0xC0, 0x3C, 0x00,
-    0x78, 0x00, 0x7E, 0x00, 0x3F, 0x00, 0x0F, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xFC, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x83, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x07, 0x80, 0x07, 0xE0, 0x03, 0xF0,
-    0x00, 0xF0, 0x01, 0xE0, 0x1F, 0x80, 0xFC, 0x03, 0xC0, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x07,
-    0xF8, 0x38, 0x70, 0xC1, 0xC0, 0x07, 0x00, 0x18, 0x00, 0xE0, 0x07, 0x00, 0x38, 0x00, 0xC0, 0x03,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x07, 0x00, 0xE0, 0x0E, 0x00,
-    0x70, 0x0C, 0x79, 0xB0, 0x18, 0xFF, 0x98, 0x19, 0xC7, 0x18, 0x31, 0x83, 0x18, 0x33, 0x83, 0x18,
-    0x33, 0x03, 0x18, 0x33, 0x06, 0x18, 0x33, 0x06, 0x30, 0x33, 0x8E, 0x70, 0x19, 0xFF, 0xE0, 0x18,
-    0xF7, 0x80, 0x0C, 0x00, 0x18, 0x07, 0x00, 0x78, 0x03, 0xFF, 0xE0, 0x00, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03,
-    0xC0, 0x03, 0xC0, 0x07, 0xE0, 0x06, 0xE0, 0x0E, 0x60, 0x0C, 0x70, 0x0C, 0x30, 0x1C, 0x38, 0x1F,
-    0xF8, 0x3F, 0xF8, 0x38, 0x1C, 0x30, 0x0C, 0x70, 0x0E, 0x70, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x3F, 0xF8, 0x38, 0x38, 0x38,
-    0x18, 0x38, 0x18, 0x38, 0x38, 0x3F, 0xF0, 0x3F, 0xF8, 0x38, 0x1C, 0x38, 0x1C, 0x38, 0x0C, 0x38,
-    0x1C, 0x38, 0x1C, 0x3F, 0xF8, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x3F, 0xF0, 0x1C, 0x0C, 0x06, 0x03, 0x83, 0x80,
-    0x60, 0xE0, 0x00, 0x30, 0x00, 0x0C, 0x00, 0x03, 0x00, 0x00, 0xE0, 0x00, 0x38, 0x06, 0x06, 0x01,
-    0x81, 0xC0, 0xE0, 0x3F, 0xF0, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0xFF, 0xE0, 0x38, 0x1C,
-    0x0E, 0x03, 0x83, 0x80, 0xE0, 0xE0, 0x18, 0x38, 0x06, 0x0E, 0x01, 0x83, 0x80, 0x60, 0xE0, 0x18,
-    0x38, 0x0E, 0x0E, 0x03, 0x03, 0x81, 0xC0, 0xFF, 0xE0, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x1F,
-    0xFC, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x1F, 0xF8, 0x1F, 0xF8, 0x18, 0x00, 0x18,
-    0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x1F, 0xFC, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0xFF, 0xC1, 0x80, 0x03, 0x00,
-    0x06, 0x00, 0x0C, 0x00, 0x1F, 0xF0, 0x3F, 0xE0, 0x60, 0x00, 0xC0, 0x01, 0x80, 0x03, 0x00, 0x06,
-    0x00, 0x0C, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xE0, 0x07, 0xFE, 0x00, 0xE0, 0xE0, 0x38, 0x0E, 0x0E, 0x00, 0xC1, 0xC0,
-    0x00, 0x30, 0x00, 0x06, 0x07, 0xE0, 0xC0, 0xFC, 0x1C, 0x01, 0x83, 0x80, 0x30, 0x30, 0x06, 0x03,
-    0x81, 0xC0, 0x3F, 0xF8, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0xE0, 0x60, 0x38, 0x18,
-    0x0E, 0x06, 0x03, 0x81, 0x80, 0xE0, 0x60, 0x38, 0x1F, 0xFE, 0x07, 0xFF, 0x81, 0x80, 0xE0, 0x60,
-    0x38, 0x18, 0x0E, 0x06, 0x03, 0x81, 0x80, 0xE0, 0x60, 0x38, 0x18, 0x0E, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x18, 0x18,
-    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x01, 0x80, 0x0C,
-    0x00, 0x60, 0x03, 0x00, 0x18, 0x00, 0xC0, 0x06, 0x00, 0x30, 0x01, 0x87, 0x0C, 0x18, 0x60, 0xC7,
-    0x07, 0xF0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x1C, 0x38,
-    0x38, 0x38, 0x70, 0x38, 0xE0, 0x39, 0xC0, 0x3B, 0x80, 0x3F, 0x80, 0x3F, 0xC0, 0x3D, 0xC0, 0x38,
-    0xE0, 0x38, 0x70, 0x38, 0x38, 0x38, 0x38, 0x38, 0x1C, 0x38, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x0E, 0x00, 0x38, 0x00, 0xE0, 0x03,
-    0x80, 0x0E, 0x00, 0x38, 0x00, 0xE0, 0x03, 0x80, 0x0E, 0x00, 0x38, 0x00, 0xE0, 0x03, 0x80, 0x0F,
-    0xFC, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C,
-    0x03, 0x83, 0xC0, 0x78, 0x3E, 0x07, 0x83, 0xE0, 0x78, 0x3E, 0x0F, 0x83, 0xF0, 0xD8, 0x3B, 0x0D,
-    0x83, 0xB1, 0x98, 0x3B, 0x99, 0x83, 0x99, 0x98, 0x39, 0xB1, 0x83, 0x9F, 0x18, 0x38, 0xF1, 0x83,
-    0x8E, 0x18, 0x38, 0xE1, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0xE0, 0xF0, 0x38, 0x3E, 0x0E,
-    0x0F, 0x83, 0x83, 0xF0, 0xE0, 0xEE, 0x38, 0x3B, 0x8E, 0x0E, 0x73, 0x83, 0x8E, 0xE0, 0xE1, 0xB8,
-    0x38, 0x7E, 0x0E, 0x0F, 0x83, 0x81, 0xE0, 0xE0, 0x78, 0x38, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0,
-    0x07, 0xFE, 0x01, 0xC0, 0xE0, 0x30, 0x0E, 0x0E, 0x00, 0xC1, 0x80, 0x18, 0x30, 0x03, 0x06, 0x00,
-    0x70, 0xC0, 0x0C, 0x18, 0x01, 0x83, 0x80, 0x30, 0x30, 0x0E, 0x07, 0x03, 0x80, 0x7F, 0xE0, 0x03,
-    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x3F, 0xF8, 0x38, 0x1C, 0x38, 0x0C, 0x38, 0x0C, 0x38,
-    0x0C, 0x38, 0x3C, 0x3F, 0xF8, 0x3F, 0xF0, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38,
-    0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xC0, 0x07, 0xFE, 0x01, 0xC0, 0xE0, 0x30, 0x0E, 0x0E, 0x01, 0xC1, 0x80, 0x18,
-    0x30, 0x03, 0x06, 0x00, 0x60, 0xC0, 0x0C, 0x18, 0x01, 0x83, 0x80, 0x70, 0x30, 0xEE, 0x07, 0x0F,
-    0x80, 0x7F, 0xF0, 0x03, 0xFF, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x7F, 0xF0, 0x18, 0x0E,
-    0x06, 0x03, 0x81, 0x80, 0xE0, 0x60, 0x38, 0x18, 0x1C, 0x07, 0xFE, 0x01, 0xFE, 0x00, 0x61, 0xC0,
-    0x18, 0x38, 0x06, 0x07, 0x01, 0x80, 0xC0, 0x60, 0x38, 0x18, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x1F,
-    0xF8, 0x18, 0x38, 0x38, 0x1C, 0x38, 0x00, 0x1C, 0x00, 0x1F, 0xC0, 0x07, 0xF0, 0x00, 0x78, 0x00,
-    0x1C, 0x30, 0x0C, 0x30, 0x0C, 0x3C, 0x1C, 0x1F, 0xF8, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF3, 0xFF, 0xE0, 0x38, 0x00, 0x70,
-    0x00, 0xE0, 0x01, 0xC0, 0x03, 0x80, 0x07, 0x00, 0x0E, 0x00, 0x1C, 0x00, 0x38, 0x00, 0x70, 0x00,
-    0xE0, 0x01, 0xC0, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x80, 0xE0, 0x60, 0x38, 0x18, 0x0E, 0x06, 0x03, 0x81, 0x80, 0xE0, 0x60, 0x38,
-    0x18, 0x0E, 0x06, 0x03, 0x81, 0x80, 0xE0, 0x60, 0x38, 0x18, 0x0E, 0x06, 0x03, 0x01, 0xC1, 0xC0,
-    0x3F, 0xE0, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x0E, 0x70, 0x0C, 0x30, 0x0C, 0x38, 0x1C, 0x18, 0x18,
-    0x18, 0x18, 0x1C, 0x38, 0x0C, 0x30, 0x0E, 0x70, 0x06, 0x60, 0x06, 0x60, 0x07, 0xE0, 0x03, 0xC0,
-    0x03, 0xC0, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0x07, 0x83, 0x9C, 0x1E, 0x0C, 0x30, 0x78, 0x30, 0xC1, 0xE0, 0xC3, 0x8D,
-    0xC7, 0x0E, 0x33, 0x18, 0x18, 0xCC, 0x60, 0x67, 0x39, 0x81, 0x98, 0x6C, 0x03, 0x61, 0xB0, 0x0D,
-    0x86, 0xC0, 0x3C, 0x1F, 0x00, 0xF0, 0x38, 0x01, 0xC0, 0xE0, 0x07, 0x03, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x0C, 0x18, 0x1C, 0x1C, 0x38, 0x0E, 0x70, 0x07, 0x60, 0x07,
-    0xE0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x07, 0xE0, 0x0E, 0x70, 0x1C, 0x38, 0x18, 0x38, 0x38,
-    0x1C, 0x70, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x70, 0x0E, 0x38, 0x1C, 0x38, 0x18, 0x1C, 0x38, 0x0C, 0x30, 0x0E, 0x60, 0x07, 0xE0, 0x03,
-    0xC0, 0x03, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE1, 0xFF,
-    0xC0, 0x03, 0x80, 0x0E, 0x00, 0x38, 0x00, 0xE0, 0x01, 0x80, 0x07, 0x00, 0x1C, 0x00, 0x70, 0x01,
-    0xC0, 0x03, 0x00, 0x0E, 0x00, 0x3F, 0xFC, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3E, 0x3C, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
-    0x30, 0x30, 0x30, 0x30, 0x30, 0x3C, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x60, 0x60, 0x60, 0x30, 0x30, 0x30, 0x18, 0x18, 0x18, 0x08, 0x0C, 0x0C, 0x0C, 0x06,
-    0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x7C, 0x3C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C,
-    0x1C, 0x3C, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
-    0x00, 0xF0, 0x0F, 0x01, 0xF0, 0x19, 0x83, 0x98, 0x30, 0xC3, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0E, 0x03, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x07, 0xF8, 0x38, 0x60,
-    0xC1, 0x80, 0x3E, 0x07, 0xF8, 0x3C, 0x60, 0xC1, 0x83, 0x0E, 0x0F, 0xF8, 0x1F, 0x70, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x0C, 0x00, 0x30, 0x00, 0xC0, 0x03,
-    0xFC, 0x0F, 0xF8, 0x38, 0x60, 0xE1, 0xC3, 0x03, 0x0C, 0x0C, 0x30, 0x30, 0xE1, 0xC3, 0x86, 0x0F,
-    0xF8, 0x37, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3E, 0x03, 0xF8, 0x38, 0x61, 0x83, 0x0C, 0x00, 0x60, 0x03, 0x00, 0x18,
-    0x30, 0xE1, 0x83, 0xFC, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
-    0x00, 0x18, 0x00, 0x60, 0x01, 0x80, 0xFE, 0x07, 0xF8, 0x38, 0xE0, 0xC1, 0x83, 0x06, 0x0C, 0x18,
-    0x30, 0x60, 0xC1, 0x83, 0x8E, 0x07, 0xF8, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x07, 0xF8, 0x38, 0x60,
-    0xC1, 0xC3, 0xFF, 0x0F, 0xFC, 0x30, 0x00, 0xC1, 0xC3, 0x86, 0x07, 0xF8, 0x0F, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x1E, 0x18, 0x18, 0x7E, 0x7E, 0x18, 0x18, 0x18,
-    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x07,
-    0xF8, 0x38, 0xE0, 0xC1, 0x83, 0x06, 0x0C, 0x18, 0x30, 0x60, 0xC1, 0x83, 0x8E, 0x07, 0xF8, 0x0F,
-    0xE0, 0x01, 0x83, 0x06, 0x0F, 0xF0, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x0C, 0x00, 0x30,
-    0x00, 0xC0, 0x03, 0xFC, 0x0F, 0xF8, 0x38, 0x60, 0xE1, 0x83, 0x06, 0x0C, 0x18, 0x30, 0x60, 0xC1,
-    0x83, 0x06, 0x0C, 0x18, 0x30, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC1,
-    0x80, 0x00, 0x0C, 0x18, 0x30, 0x60, 0xC1, 0x83, 0x06, 0x0C, 0x18, 0x30, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC1, 0x80, 0x00, 0x0C, 0x18, 0x30,
-    0x60, 0xC1, 0x83, 0x06, 0x0C, 0x18, 0x30, 0x60, 0xC7, 0x8E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x60, 0x03, 0x00, 0x18, 0x00, 0xC3, 0x86, 0x38,
-    0x33, 0x81, 0xF8, 0x0F, 0x80, 0x7E, 0x03, 0xB8, 0x18, 0xC0, 0xC7, 0x06, 0x1C, 0x30, 0x60, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC1, 0x83, 0x06, 0x0C, 0x18, 0x30, 0x60, 0xC1, 0x83, 0x06,
-    0x0C, 0x18, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0xDF,
-    0x03, 0xFF, 0xF8, 0x38, 0xE1, 0x83, 0x86, 0x18, 0x30, 0x61, 0x83, 0x06, 0x18, 0x30, 0x61, 0x83,
-    0x06, 0x18, 0x30, 0x61, 0x83, 0x06, 0x18, 0x30, 0x61, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0x7C, 0x0F, 0xF8, 0x38, 0x60, 0xE1, 0x83, 0x06, 0x0C, 0x18, 0x30,
-    0x60, 0xC1, 0x83, 0x06, 0x0C, 0x18, 0x30, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x07, 0xF8, 0x38, 0x60, 0xC1,
-    0xC3, 0x03, 0x0C, 0x0C, 0x30, 0x30, 0xC1, 0xC3, 0x86, 0x07, 0xF8, 0x0F, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x7C,
-    0x0F, 0xF8, 0x38, 0x60, 0xE1, 0xC3, 0x03, 0x0C, 0x0C, 0x30, 0x30, 0xE1, 0xC3, 0x86, 0x0F, 0xF8,
-    0x3F, 0xC0, 0xC0, 0x03, 0x00, 0x0C, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFE, 0x07, 0xF8, 0x38, 0xE0, 0xC1, 0x83, 0x06, 0x0C, 0x18, 0x30, 0x60,
-    0xC1, 0x83, 0x8E, 0x07, 0xF8, 0x0F, 0xE0, 0x01, 0x80, 0x06, 0x00, 0x18, 0x00, 0x60, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xDC, 0x7E, 0x38, 0x1C, 0x0C, 0x06, 0x03, 0x01, 0x80, 0xC0, 0x60,
-    0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x07, 0xF8, 0x30, 0xC1, 0x80,
-    0x0F, 0xC0, 0x3F, 0x80, 0x3E, 0x18, 0x70, 0xC3, 0x87, 0xF8, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x18, 0x18, 0x18, 0x18, 0x7E, 0x7C, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
-    0x1C, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x06, 0x0C, 0x18, 0x30, 0x60, 0xC1,
-    0x83, 0x06, 0x0C, 0x18, 0x30, 0x60, 0xC1, 0x83, 0x8E, 0x07, 0xF8, 0x0F, 0x60, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xC1, 0x86,
-    0x0C, 0x30, 0xE1, 0xC6, 0x06, 0x30, 0x33, 0x01, 0xD8, 0x07, 0xC0, 0x3C, 0x00, 0xE0, 0x07, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x06, 0x1C, 0x31, 0xC7, 0x0C, 0x31, 0xC6, 0x0C, 0xF9, 0x83, 0x36, 0x60, 0xED, 0xB8,
-    0x1B, 0x6C, 0x07, 0x8F, 0x01, 0xE3, 0xC0, 0x38, 0xE0, 0x0E, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xC3, 0x87, 0x18, 0x1D, 0x80, 0x7C, 0x03, 0xC0, 0x0E, 0x00, 0xF0, 0x0E, 0xC0,
-    0x67, 0x07, 0x1C, 0x70, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xC1, 0x86, 0x0C, 0x30, 0xE1, 0xC6, 0x06, 0x30, 0x3B, 0x00, 0xD8, 0x06,
-    0xC0, 0x3C, 0x00, 0xE0, 0x07, 0x00, 0x30, 0x01, 0x80, 0x78, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x87, 0xFC, 0x01, 0xC0, 0x1C, 0x00, 0xC0, 0x0C, 0x00, 0xE0,
-    0x0E, 0x00, 0xE0, 0x0F, 0xFC, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC1,
-    0xE0, 0xC0, 0x60, 0x30, 0x18, 0x1C, 0x0C, 0x1E, 0x0E, 0x01, 0x80, 0xC0, 0x30, 0x18, 0x0C, 0x06,
-    0x03, 0x01, 0xE0, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
-    0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x0F,
-    0x01, 0x80, 0xC0, 0x60, 0x30, 0x1C, 0x06, 0x03, 0xC0, 0xE0, 0xC0, 0x60, 0x70, 0x30, 0x18, 0x0C,
-    0x06, 0x0F, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x18, 0x7F,
-    0xF0, 0x8F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-};
-
-const GFXglyph Inter_21Glyphs[] PROGMEM = {
-    { 0, 8, 30, 8, 0, 0 },  // 'space' (32)
-    { 30, 8, 30, 8, 0, 0 },  // '!' (33)
-    { 60, 10, 30, 10, 0, 0 },  // '"' (34)
-    { 98, 14, 30, 14, 0, 0 },  // '#' (35)
-    { 151, 14, 30, 14, 0, 0 },  // '$' (36)
-    { 204, 21, 30, 21, 0, 0 },  // '%' (37)
-    { 283, 16, 30, 16, 0, 0 },  // '&' (38)
-    { 343, 6, 30, 6, 0, 0 },  // ''' (39)
-    { 366, 9, 30, 9, 0, 0 },  // '(' (40)
-    { 400, 9, 30, 9, 0, 0 },  // ')' (41)
-    { 434, 11, 30, 11, 0, 0 },  // '*' (42)
-    { 476, 15, 30, 15, 0, 0 },  // '+' (43)
-    { 533, 8, 30, 8, 0, 0 },  // ',' (44)
-    { 563, 9, 30, 9, 0, 0 },  // '-' (45)
-    { 597, 8, 30, 8, 0, 0 },  // '.' (46)
-    { 627, 8, 30, 8, 0, 0 },  // '/' (47)
-    { 657, 14, 30, 14, 0, 0 },  // '0' (48)
-    { 710, 14, 30, 14, 0, 0 },  // '1' (49)
-    { 763, 14, 30, 14, 0, 0 },  // '2' (50)
-    { 816, 14, 30, 14, 0, 0 },  // '3' (51)
-    { 869, 14, 30, 14, 0, 0 },  // '4' (52)
-    { 922, 14, 30, 14, 0, 0 },  // '5' (53)
-    { 975, 14, 30, 14, 0, 0 },  // '6' (54)
-    { 1028, 14, 30, 14, 0, 0 },  // '7' (55)
-    { 1081, 14, 30, 14, 0, 0 },  // '8' (56)
-    { 1134, 14, 30, 14, 0, 0 },  // '9' (57)
-    { 1187, 8, 30, 8, 0, 0 },  // ':' (58)
-    { 1217, 8, 30, 8, 0, 0 },  // ';' (59)
-    { 1247, 15, 30, 15, 0, 0 },  // '<' (60)
-    { 1304, 15, 30, 15, 0, 0 },  // '=' (61)
-    { 1361, 15, 30, 15, 0, 0 },  // '>' (62)
-    { 1418, 14, 30, 14, 0, 0 },  // '?' (63)
-    { 1471, 24, 30, 24, 0, 0 },  // '@' (64)
-    { 1561, 16, 30, 16, 0, 0 },  // 'A' (65)
-    { 1621, 16, 30, 16, 0, 0 },  // 'B' (66)
-    { 1681, 18, 30, 18, 0, 0 },  // 'C' (67)
-    { 1749, 18, 30, 18, 0, 0 },  // 'D' (68)
-    { 1817, 16, 30, 16, 0, 0 },  // 'E' (69)
-    { 1877, 15, 30, 15, 0, 0 },  // 'F' (70)
-    { 1934, 19, 30, 19, 0, 0 },  // 'G' (71)
-    { 2006, 18, 30, 18, 0, 0 },  // 'H' (72)
-    { 2074, 8, 30, 8, 0, 0 },  // 'I' (73)
-    { 2104, 13, 30, 13, 0, 0 },  // 'J' (74)
-    { 2153, 16, 30, 16, 0, 0 },  // 'K' (75)
-    { 2213, 14, 30, 14, 0, 0 },  // 'L' (76)
-    { 2266, 20, 30, 20, 0, 0 },  // 'M' (77)
-    { 2341, 18, 30, 18, 0, 0 },  // 'N' (78)
-    { 2409, 19, 30, 19, 0, 0 },  // 'O' (79)
-    { 2481, 16, 30, 16, 0, 0 },  // 'P' (80)
-    { 2541, 19, 30, 19, 0, 0 },  // 'Q' (81)
-    { 2613, 18, 30, 18, 0, 0 },  // 'R' (82)
-    { 2681, 16, 30, 16, 0, 0 },  // 'S' (83)
-    { 2741, 15, 30, 15, 0, 0 },  // 'T' (84)
-    { 2798, 18, 30, 18, 0, 0 },  // 'U' (85)
-    { 2866, 16, 30, 16, 0, 0 },  // 'V' (86)
-    { 2926, 22, 30, 22, 0, 0 },  // 'W' (87)
-    { 3009, 16, 30, 16, 0, 0 },  // 'X' (88)
-    { 3069, 16, 30, 16, 0, 0 },  // 'Y' (89)
-    { 3129, 15, 30, 15, 0, 0 },  // 'Z' (90)
-    { 3186, 8, 30, 8, 0, 0 },  // '[' (91)
-    { 3216, 8, 30, 8, 0, 0 },  // '\' (92)
-    { 3246, 8, 30, 8, 0, 0 },  // ']' (93)
-    { 3276, 12, 30, 12, 0, 0 },  // '^' (94)
-    { 3321, 14, 30, 14, 0, 0 },  // '_' (95)
-    { 3374, 9, 30, 9, 0, 0 },  // '`' (96)
-    { 3408, 14, 30, 14, 0, 0 },  // 'a' (97)
-    { 3461, 14, 30, 14, 0, 0 },  // 'b' (98)
-    { 3514, 13, 30, 13, 0, 0 },  // 'c' (99)
-    { 3563, 14, 30, 14, 0, 0 },  // 'd' (100)
-    { 3616, 14, 30, 14, 0, 0 },  // 'e' (101)
-    { 3669, 8, 30, 8, 0, 0 },  // 'f' (102)
-    { 3699, 14, 30, 14, 0, 0 },  // 'g' (103)
-    { 3752, 14, 30, 14, 0, 0 },  // 'h' (104)
-    { 3805, 7, 30, 7, 0, 0 },  // 'i' (105)
-    { 3832, 7, 30, 7, 0, 0 },  // 'j' (106)
-    { 3859, 13, 30, 13, 0, 0 },  // 'k' (107)
-    { 3908, 7, 30, 7, 0, 0 },  // 'l' (108)
-    { 3935, 20, 30, 20, 0, 0 },  // 'm' (109)
-    { 4010, 14, 30, 14, 0, 0 },  // 'n' (110)
-    { 4063, 14, 30, 14, 0, 0 },  // 'o' (111)
-    { 4116, 14, 30, 14, 0, 0 },  // 'p' (112)
-    { 4169, 14, 30, 14, 0, 0 },  // 'q' (113)
-    { 4222, 9, 30, 9, 0, 0 },  // 'r' (114)
-    { 4256, 13, 30, 13, 0, 0 },  // 's' (115)
-    { 4305, 8, 30, 8, 0, 0 },  // 't' (116)
-    { 4335, 14, 30, 14, 0, 0 },  // 'u' (117)
-    { 4388, 13, 30, 13, 0, 0 },  // 'v' (118)
-    { 4437, 18, 30, 18, 0, 0 },  // 'w' (119)
-    { 4505, 13, 30, 13, 0, 0 },  // 'x' (120)
-    { 4554, 13, 30, 13, 0, 0 },  // 'y' (121)
-    { 4603, 13, 30, 13, 0, 0 },  // 'z' (122)
-    { 4652, 9, 30, 9, 0, 0 },  // '{' (123)
-    { 4686, 8, 30, 8, 0, 0 },  // '|' (124)
-    { 4716, 9, 30, 9, 0, 0 },  // '}' (125)
-    { 4750, 15, 30, 15, 0, 0 }  // '~' (126)
-};
-
-const GFXfont Inter_21 PROGMEM = {
-    (uint8_t*)Inter_21Bitmaps,
-    (GFXglyph*)Inter_21Glyphs,
-    32, 126, 30
-};
-
-#endif // INTER_21_H
@@ -1,504 +0,0 @@
-// Inter Font - 24px Regular (Weight 400)
-// Generated: 18.1.2026, 18:11:09
-// Charset: 95 characters
-
-#ifndef INTER_24_H
-#define INTER_24_H
-
-const uint8_t Inter_24Bitmaps[] PROGMEM = {
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x81, 0xC0, 0xE0, 0x70, 0x38,
-    0x1C, 0x0E, 0x07, 0x03, 0x81, 0x80, 0xC0, 0x60, 0x10, 0x00, 0x00, 0x07, 0x03, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1D, 0xC3, 0xB8, 0x77, 0x0E, 0xC1, 0x98, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0x18, 0x06, 0x18, 0x06, 0x18, 0x06, 0x38, 0x06, 0x30, 0x7F, 0xFC, 0x7F,
-    0xFC, 0x0C, 0x30, 0x0C, 0x70, 0x0C, 0x60, 0x1C, 0x60, 0x7F, 0xFC, 0x7F, 0xFC, 0x18, 0xC0, 0x18,
-    0xC0, 0x38, 0xC0, 0x30, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0F, 0xC0, 0x1F, 0xF0, 0x39, 0x70, 0x39, 0x38, 0x39,
-    0x38, 0x39, 0x00, 0x1D, 0x00, 0x1F, 0xC0, 0x07, 0xF0, 0x01, 0xF8, 0x01, 0x38, 0x31, 0x18, 0x39,
-    0x18, 0x39, 0x18, 0x1D, 0x38, 0x1F, 0xF0, 0x07, 0xE0, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x01,
-    0x80, 0x1F, 0x83, 0x80, 0x39, 0xC3, 0x00, 0x30, 0xC6, 0x00, 0x30, 0xC6, 0x00, 0x30, 0xCC, 0x00,
-    0x39, 0xCC, 0x00, 0x1F, 0x98, 0x00, 0x0F, 0x19, 0xE0, 0x00, 0x33, 0xF0, 0x00, 0x73, 0x38, 0x00,
-    0x67, 0x18, 0x00, 0xC6, 0x18, 0x00, 0xC7, 0x18, 0x01, 0x83, 0x38, 0x01, 0x83, 0xF0, 0x03, 0x01,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xF0, 0x00, 0x7F, 0x00, 0x1C, 0x70, 0x03, 0x8E, 0x00, 0x71, 0x80, 0x07, 0x70,
-    0x00, 0xFC, 0x00, 0x1F, 0x00, 0x07, 0xE0, 0x01, 0xCE, 0x60, 0x70, 0xFC, 0x0E, 0x1F, 0x81, 0xC1,
-    0xE0, 0x38, 0x3E, 0x07, 0x8F, 0xE0, 0x7F, 0xDC, 0x03, 0xE1, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xC3,
-    0x87, 0x0E, 0x18, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80,
-    0x60, 0x0C, 0x03, 0x00, 0x60, 0x1C, 0x03, 0x00, 0x60, 0x1C, 0x03, 0x80, 0x70, 0x0E, 0x01, 0xC0,
-    0x38, 0x03, 0x00, 0x60, 0x0E, 0x00, 0xC0, 0x18, 0x01, 0x80, 0x30, 0x03, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x01, 0x80,
-    0x18, 0x03, 0x00, 0x30, 0x06, 0x00, 0xE0, 0x1C, 0x01, 0x80, 0x30, 0x06, 0x00, 0xC0, 0x18, 0x03,
-    0x00, 0xE0, 0x1C, 0x03, 0x00, 0xE0, 0x18, 0x03, 0x00, 0xC0, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x36, 0x83,
-    0xFC, 0x3F, 0x80, 0xE0, 0x1B, 0x01, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x03, 0x00, 0x01, 0x80, 0x00, 0xC0,
-    0x00, 0x60, 0x07, 0xFF, 0x83, 0xFF, 0xC0, 0x0C, 0x00, 0x06, 0x00, 0x03, 0x00, 0x01, 0x80, 0x00,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x03, 0x80, 0xC0, 0x40, 0x60, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x0F, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x03,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x60, 0x30, 0x18, 0x1C, 0x0C, 0x06, 0x03, 0x03, 0x01, 0x80,
-    0xC0, 0xE0, 0x60, 0x30, 0x38, 0x18, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0,
-    0x0F, 0xF0, 0x1C, 0x70, 0x38, 0x38, 0x38, 0x38, 0x38, 0x18, 0x30, 0x18, 0x30, 0x18, 0x30, 0x18,
-    0x30, 0x18, 0x30, 0x18, 0x38, 0x18, 0x38, 0x38, 0x38, 0x38, 0x1C, 0x70, 0x0F, 0xF0, 0x07, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xC0, 0x01, 0xC0, 0x03, 0xC0, 0x0F, 0xC0, 0x1F, 0xC0, 0x18, 0xC0, 0x00, 0xC0,
-    0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0,
-    0x00, 0xC0, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x1F, 0xF0, 0x1C, 0x38, 0x38, 0x38, 0x38, 0x18,
-    0x00, 0x18, 0x00, 0x38, 0x00, 0x70, 0x00, 0xF0, 0x01, 0xE0, 0x03, 0xC0, 0x07, 0x80, 0x0E, 0x00,
-    0x1C, 0x00, 0x38, 0x00, 0x3F, 0xF8, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x1F, 0xE0, 0x1C, 0x70,
-    0x38, 0x38, 0x38, 0x38, 0x00, 0x30, 0x00, 0xF0, 0x03, 0xE0, 0x03, 0xF0, 0x00, 0x38, 0x00, 0x38,
-    0x00, 0x18, 0x30, 0x18, 0x38, 0x38, 0x1C, 0x78, 0x1F, 0xF0, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60,
-    0x00, 0xE0, 0x01, 0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x06, 0x60, 0x0E, 0x60, 0x0C, 0x60, 0x18, 0x60,
-    0x38, 0x60, 0x70, 0x60, 0x7F, 0xF8, 0x7F, 0xF8, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xF8, 0x0F, 0xF8, 0x1C, 0x00, 0x1C, 0x00, 0x18, 0x00, 0x1F, 0xE0, 0x3F, 0xF0,
-    0x38, 0x78, 0x00, 0x38, 0x00, 0x18, 0x00, 0x1C, 0x00, 0x1C, 0x38, 0x18, 0x38, 0x38, 0x1C, 0x70,
-    0x1F, 0xF0, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x0F, 0xF0, 0x1C, 0x38, 0x18, 0x38, 0x38, 0x00,
-    0x30, 0x00, 0x33, 0xE0, 0x3F, 0xF0, 0x3C, 0x38, 0x38, 0x38, 0x38, 0x18, 0x30, 0x18, 0x38, 0x18,
-    0x38, 0x38, 0x1C, 0x38, 0x0F, 0xF0, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x3F, 0xF8, 0x00, 0x38,
-    0x00, 0x70, 0x00, 0xE0, 0x00, 0xE0, 0x01, 0xC0, 0x01, 0xC0, 0x03, 0x80, 0x03, 0x80, 0x03, 0x00,
-    0x07, 0x00, 0x07, 0x00, 0x06, 0x00, 0x06, 0x00, 0x0E, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0,
-    0x0F, 0xF0, 0x1C, 0x70, 0x18, 0x38, 0x18, 0x38, 0x18, 0x38, 0x1C, 0x70, 0x0F, 0xE0, 0x1F, 0xF0,
-    0x3C, 0x38, 0x38, 0x18, 0x30, 0x18, 0x30, 0x18, 0x38, 0x18, 0x3C, 0x38, 0x1F, 0xF0, 0x07, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xC0, 0x1F, 0xF0, 0x1C, 0x70, 0x38, 0x38, 0x38, 0x18, 0x30, 0x18, 0x30, 0x18,
-    0x38, 0x38, 0x1C, 0x78, 0x1F, 0xF8, 0x0F, 0xD8, 0x00, 0x18, 0x00, 0x38, 0x38, 0x38, 0x18, 0x70,
-    0x1F, 0xE0, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1C, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x03, 0x80, 0xC0, 0x40,
-    0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x78, 0x00,
-    0xF8, 0x03, 0xF0, 0x07, 0xE0, 0x07, 0x80, 0x03, 0xC0, 0x00, 0xFC, 0x00, 0x1F, 0x80, 0x01, 0xF0,
-    0x00, 0x3C, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xFF, 0xE0, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x78,
-    0x00, 0x1F, 0x00, 0x03, 0xF0, 0x00, 0x7E, 0x00, 0x07, 0x80, 0x03, 0xC0, 0x0F, 0xC0, 0x1F, 0x80,
-    0x3E, 0x00, 0x3C, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xE0, 0x1F, 0xF0, 0x1C, 0x38, 0x38, 0x38, 0x38, 0x18, 0x00, 0x18, 0x00, 0x38, 0x00, 0x70, 0x00,
-    0xE0, 0x01, 0xC0, 0x01, 0x80, 0x03, 0x80, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x1F, 0xFF, 0x00, 0x07, 0x80,
-    0xF0, 0x01, 0xC0, 0x07, 0x00, 0x70, 0x00, 0x70, 0x0C, 0x3E, 0xE6, 0x03, 0x0F, 0xFC, 0x60, 0x63,
-    0x87, 0x8C, 0x1C, 0x60, 0xE1, 0x83, 0x1C, 0x0C, 0x30, 0x63, 0x03, 0x86, 0x0C, 0x60, 0x71, 0xC1,
-    0x8C, 0x0C, 0x30, 0x31, 0x83, 0x8E, 0x07, 0x38, 0xF3, 0x80, 0x63, 0xFF, 0xE0, 0x0E, 0x3C, 0xF8,
-    0x00, 0xC0, 0x00, 0x30, 0x1E, 0x00, 0x1E, 0x01, 0xF0, 0x0F, 0x80, 0x0F, 0xFF, 0xC0, 0x00, 0x7F,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x1E, 0x00, 0x07, 0xC0, 0x00, 0xFC,
-    0x00, 0x1B, 0x80, 0x07, 0x38, 0x00, 0xC7, 0x00, 0x38, 0x60, 0x07, 0x0E, 0x00, 0xC1, 0xC0, 0x3F,
-    0xFC, 0x07, 0xFF, 0x81, 0xC0, 0x70, 0x38, 0x07, 0x07, 0x00, 0xE1, 0xC0, 0x0E, 0x38, 0x01, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x01, 0xFF, 0xC0, 0x30, 0x3C, 0x06,
-    0x03, 0x80, 0xC0, 0x30, 0x18, 0x0E, 0x03, 0x03, 0x80, 0x7F, 0xE0, 0x0F, 0xFE, 0x01, 0x81, 0xE0,
-    0x30, 0x0E, 0x06, 0x01, 0xC0, 0xC0, 0x38, 0x18, 0x07, 0x03, 0x03, 0xC0, 0x7F, 0xF8, 0x0F, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x07, 0xFE, 0x00, 0xF0,
-    0x70, 0x1C, 0x03, 0x81, 0xC0, 0x38, 0x38, 0x00, 0x03, 0x80, 0x00, 0x38, 0x00, 0x03, 0x80, 0x00,
-    0x38, 0x00, 0x03, 0x80, 0x00, 0x38, 0x01, 0x81, 0xC0, 0x38, 0x1C, 0x03, 0x80, 0xF0, 0x70, 0x07,
-    0xFE, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF,
-    0x80, 0x1F, 0xFE, 0x01, 0x81, 0xF0, 0x18, 0x07, 0x01, 0x80, 0x38, 0x18, 0x03, 0x81, 0x80, 0x38,
-    0x18, 0x01, 0x81, 0x80, 0x18, 0x18, 0x01, 0x81, 0x80, 0x38, 0x18, 0x03, 0x81, 0x80, 0x38, 0x18,
-    0x07, 0x01, 0x81, 0xF0, 0x1F, 0xFE, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0xFF, 0x01, 0xFF, 0xE0, 0x30, 0x00, 0x06, 0x00, 0x00, 0xC0, 0x00, 0x18,
-    0x00, 0x03, 0x00, 0x00, 0x7F, 0xF8, 0x0F, 0xFF, 0x01, 0x80, 0x00, 0x30, 0x00, 0x06, 0x00, 0x00,
-    0xC0, 0x00, 0x18, 0x00, 0x03, 0x00, 0x00, 0x7F, 0xFC, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0xC1, 0xFF, 0xE0, 0xC0, 0x00, 0x60, 0x00, 0x30, 0x00, 0x18, 0x00,
-    0x0C, 0x00, 0x07, 0xFE, 0x03, 0xFF, 0x01, 0x80, 0x00, 0xC0, 0x00, 0x60, 0x00, 0x30, 0x00, 0x18,
-    0x00, 0x0C, 0x00, 0x06, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC,
-    0x00, 0x7F, 0xF0, 0x07, 0x81, 0xC0, 0x78, 0x07, 0x03, 0x80, 0x38, 0x18, 0x00, 0x01, 0xC0, 0x00,
-    0x0E, 0x00, 0x00, 0x70, 0x3F, 0x83, 0x81, 0xFC, 0x1C, 0x00, 0x60, 0xE0, 0x03, 0x03, 0x80, 0x18,
-    0x1E, 0x00, 0xC0, 0x78, 0x1E, 0x01, 0xFF, 0xF0, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x38, 0x18, 0x03, 0x81, 0x80, 0x38, 0x18,
-    0x03, 0x81, 0x80, 0x38, 0x18, 0x03, 0x81, 0x80, 0x38, 0x1F, 0xFF, 0x81, 0xFF, 0xF8, 0x18, 0x03,
-    0x81, 0x80, 0x38, 0x18, 0x03, 0x81, 0x80, 0x38, 0x18, 0x03, 0x81, 0x80, 0x38, 0x18, 0x03, 0x81,
-    0x80, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x81, 0xC0, 0xE0, 0x70, 0x38, 0x1C, 0x0E,
-    0x07, 0x03, 0x81, 0xC0, 0xE0, 0x70, 0x38, 0x1C, 0x0E, 0x07, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0x00, 0x06, 0x00, 0x0C, 0x00, 0x18, 0x00, 0x30, 0x00, 0x60, 0x00, 0xC0, 0x01,
-    0x80, 0x03, 0x00, 0x06, 0x00, 0x0C, 0x00, 0x18, 0x18, 0x30, 0x30, 0xE0, 0x71, 0xC0, 0xFF, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0C, 0x03, 0x81, 0x80, 0xE0, 0x30, 0x38, 0x06, 0x0E, 0x00, 0xC3, 0x80, 0x18,
-    0xE0, 0x03, 0x38, 0x00, 0x6F, 0x00, 0x0F, 0xF0, 0x01, 0xEF, 0x00, 0x38, 0xE0, 0x06, 0x0E, 0x00,
-    0xC0, 0xE0, 0x18, 0x1E, 0x03, 0x01, 0xC0, 0x60, 0x1C, 0x0C, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18,
-    0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18,
-    0x00, 0x1F, 0xFC, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x07, 0x01, 0xE0, 0x1E, 0x03,
-    0xC0, 0x3C, 0x07, 0xC0, 0x78, 0x0F, 0x81, 0xF0, 0x1B, 0x03, 0x60, 0x37, 0x06, 0xC0, 0x6E, 0x1D,
-    0x80, 0xCC, 0x33, 0x01, 0x9C, 0x66, 0x03, 0x39, 0xCC, 0x06, 0x33, 0x18, 0x0C, 0x76, 0x30, 0x18,
-    0xF8, 0x60, 0x30, 0xF0, 0xC0, 0x61, 0xE1, 0x80, 0xC1, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xC0, 0x30, 0x1C, 0x03, 0x01,
-    0xE0, 0x30, 0x1F, 0x03, 0x01, 0xF0, 0x30, 0x1B, 0x83, 0x01, 0x9C, 0x30, 0x19, 0xC3, 0x01, 0x8E,
-    0x30, 0x18, 0x73, 0x01, 0x87, 0x30, 0x18, 0x3B, 0x01, 0x81, 0xF0, 0x18, 0x1F, 0x01, 0x80, 0xF0,
-    0x18, 0x07, 0x01, 0x80, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xF8, 0x00, 0x7F, 0xF0, 0x07, 0x83, 0xC0, 0x70, 0x0E, 0x03, 0x80, 0x38, 0x38, 0x00, 0xC1,
-    0xC0, 0x07, 0x0E, 0x00, 0x38, 0x70, 0x01, 0xC3, 0x80, 0x0E, 0x1C, 0x00, 0x70, 0xE0, 0x03, 0x03,
-    0x80, 0x38, 0x1C, 0x03, 0x80, 0x78, 0x3C, 0x01, 0xFF, 0xC0, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x01, 0xFF, 0xE0, 0x30, 0x1E,
-    0x06, 0x01, 0xC0, 0xC0, 0x38, 0x18, 0x07, 0x03, 0x00, 0xE0, 0x60, 0x3C, 0x0F, 0xFF, 0x01, 0xFF,
-    0x80, 0x30, 0x00, 0x06, 0x00, 0x00, 0xC0, 0x00, 0x18, 0x00, 0x03, 0x00, 0x00, 0x60, 0x00, 0x0C,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x7F, 0xF0,
-    0x07, 0x83, 0xC0, 0x70, 0x0E, 0x03, 0x00, 0x38, 0x38, 0x01, 0xC1, 0xC0, 0x06, 0x0E, 0x00, 0x38,
-    0x70, 0x01, 0xC3, 0x80, 0x0E, 0x1C, 0x00, 0x60, 0xE0, 0x07, 0x03, 0x03, 0x38, 0x1C, 0x3F, 0x80,
-    0x78, 0xFC, 0x01, 0xFF, 0xF0, 0x03, 0xFB, 0xC0, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x1F, 0xFF, 0x01, 0x80, 0x70, 0x18, 0x03, 0x81, 0x80,
-    0x38, 0x18, 0x03, 0x81, 0x80, 0xF0, 0x1F, 0xFE, 0x01, 0xFF, 0x80, 0x18, 0x38, 0x01, 0x81, 0xC0,
-    0x18, 0x0E, 0x01, 0x80, 0xF0, 0x18, 0x07, 0x01, 0x80, 0x78, 0x18, 0x03, 0x81, 0x80, 0x1C, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0xFF, 0xC0, 0x3C, 0x3C,
-    0x06, 0x03, 0x80, 0xC0, 0x30, 0x18, 0x00, 0x03, 0xE0, 0x00, 0x3F, 0xC0, 0x01, 0xFE, 0x00, 0x07,
-    0xE0, 0x00, 0x1E, 0x0E, 0x01, 0xC1, 0xC0, 0x38, 0x38, 0x07, 0x03, 0xC3, 0xC0, 0x3F, 0xF0, 0x03,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xC7, 0xFF, 0xE0, 0x0E, 0x00,
-    0x07, 0x00, 0x03, 0x80, 0x01, 0xC0, 0x00, 0xE0, 0x00, 0x70, 0x00, 0x38, 0x00, 0x1C, 0x00, 0x0E,
-    0x00, 0x07, 0x00, 0x03, 0x80, 0x01, 0xC0, 0x00, 0xE0, 0x00, 0x70, 0x00, 0x38, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x80, 0x38, 0x18, 0x03, 0x81, 0x80, 0x38, 0x18, 0x03, 0x81, 0x80, 0x38,
-    0x18, 0x03, 0x81, 0x80, 0x38, 0x18, 0x03, 0x81, 0x80, 0x38, 0x18, 0x03, 0x81, 0x80, 0x38, 0x18,
-    0x03, 0x01, 0xC0, 0x30, 0x1C, 0x07, 0x00, 0xF0, 0xF0, 0x0F, 0xFE, 0x00, 0x3F, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x01, 0xC7, 0x00, 0x30, 0x70, 0x0E, 0x0E,
-    0x01, 0xC0, 0xC0, 0x30, 0x1C, 0x0E, 0x03, 0x81, 0x80, 0x38, 0x70, 0x07, 0x0E, 0x00, 0x61, 0x80,
-    0x0E, 0x70, 0x01, 0xCC, 0x00, 0x19, 0x80, 0x03, 0xF0, 0x00, 0x3C, 0x00, 0x07, 0x80, 0x00, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x03, 0x80, 0xC7, 0x03,
-    0xC0, 0x61, 0x81, 0xF0, 0x70, 0xE0, 0xF8, 0x38, 0x70, 0xEC, 0x18, 0x18, 0x77, 0x0C, 0x0C, 0x33,
-    0x8E, 0x07, 0x18, 0xC7, 0x03, 0x9C, 0x63, 0x00, 0xCE, 0x39, 0x80, 0x66, 0x1D, 0xC0, 0x3B, 0x06,
-    0xC0, 0x1F, 0x83, 0x60, 0x07, 0x81, 0xF0, 0x03, 0xC0, 0x78, 0x01, 0xE0, 0x38, 0x00, 0xF0, 0x1C,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1C, 0x03, 0x81, 0xC0, 0x60, 0x3C, 0x1C, 0x03, 0x87, 0x00, 0x39, 0xC0,
-    0x03, 0xB0, 0x00, 0x7E, 0x00, 0x07, 0x80, 0x00, 0xF0, 0x00, 0x1F, 0x00, 0x07, 0xE0, 0x01, 0xCE,
-    0x00, 0x70, 0xE0, 0x0E, 0x1E, 0x03, 0x81, 0xC0, 0xE0, 0x1C, 0x38, 0x03, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x01, 0xC3, 0x80, 0x70, 0x38, 0x1C, 0x07, 0x03, 0x80, 0x70,
-    0xE0, 0x07, 0x38, 0x00, 0xE7, 0x00, 0x0F, 0xC0, 0x01, 0xF0, 0x00, 0x1E, 0x00, 0x01, 0x80, 0x00,
-    0x30, 0x00, 0x06, 0x00, 0x00, 0xC0, 0x00, 0x18, 0x00, 0x03, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xC3, 0xFF, 0xE0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0x70,
-    0x00, 0x70, 0x00, 0x70, 0x00, 0x78, 0x00, 0x78, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38,
-    0x00, 0x3C, 0x00, 0x1C, 0x00, 0x1F, 0xFF, 0x8F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC3, 0xE1, 0xC0, 0xE0,
-    0x70, 0x38, 0x1C, 0x0E, 0x07, 0x03, 0x81, 0xC0, 0xE0, 0x70, 0x38, 0x1C, 0x0E, 0x07, 0x03, 0x81,
-    0xC0, 0xE0, 0x7C, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0C, 0x06, 0x03, 0x80, 0xC0, 0x60, 0x38, 0x0C, 0x06, 0x03, 0x00, 0xC0, 0x60, 0x30,
-    0x1C, 0x06, 0x03, 0x01, 0x80, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x87, 0xC0, 0x60, 0x30, 0x18, 0x0C,
-    0x06, 0x03, 0x01, 0x80, 0xC0, 0x60, 0x30, 0x18, 0x0C, 0x06, 0x03, 0x01, 0x80, 0xC0, 0x60, 0x30,
-    0xF8, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xC0, 0x07, 0x00, 0x3E, 0x00, 0xD8, 0x07, 0x70, 0x1C, 0xC0, 0x63, 0x83, 0x86,
-    0x0C, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFE, 0x7F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1C, 0x01, 0xC0, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x1F, 0xF0, 0x38, 0x38,
-    0x38, 0x38, 0x00, 0x38, 0x01, 0xF8, 0x1F, 0xF8, 0x3F, 0x38, 0x38, 0x38, 0x30, 0x38, 0x38, 0x78,
-    0x3F, 0xF8, 0x1F, 0x98, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x3B, 0xE0,
-    0x3F, 0xF0, 0x3C, 0x38, 0x38, 0x38, 0x38, 0x18, 0x38, 0x18, 0x38, 0x18, 0x38, 0x18, 0x38, 0x18,
-    0x38, 0x38, 0x3C, 0x78, 0x3F, 0xF0, 0x3B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xF0, 0x1F, 0xF0, 0x38, 0xE0, 0xE0, 0xE1, 0xC0, 0x03, 0x00, 0x06, 0x00, 0x0C, 0x00,
-    0x1C, 0x1C, 0x38, 0x38, 0x38, 0xE0, 0x7F, 0xC0, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38,
-    0x00, 0x38, 0x0F, 0xB8, 0x1F, 0xF8, 0x1C, 0x78, 0x38, 0x38, 0x30, 0x38, 0x30, 0x38, 0x30, 0x18,
-    0x30, 0x38, 0x30, 0x38, 0x38, 0x38, 0x1C, 0x78, 0x1F, 0xF8, 0x07, 0xD8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x1F, 0xF0, 0x1C, 0x38, 0x38, 0x38, 0x38, 0x18,
-    0x3F, 0xF8, 0x3F, 0xF8, 0x30, 0x00, 0x38, 0x00, 0x38, 0x18, 0x1C, 0x38, 0x1F, 0xF0, 0x07, 0xE0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xF1, 0xF0, 0xE0, 0x60, 0xFE, 0x7F, 0x0C, 0x06, 0x03, 0x01, 0x80, 0xC0, 0x60, 0x30, 0x18, 0x0C,
-    0x06, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xD8, 0x1F, 0xF8, 0x1C, 0x78, 0x38, 0x38, 0x30, 0x38, 0x30, 0x18, 0x30, 0x18, 0x30,
-    0x18, 0x30, 0x38, 0x38, 0x38, 0x1C, 0x78, 0x1F, 0xF8, 0x0F, 0xF8, 0x00, 0x38, 0x30, 0x38, 0x38,
-    0x70, 0x1F, 0xF0, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x38,
-    0x00, 0x38, 0x00, 0x38, 0x00, 0x3B, 0xE0, 0x3F, 0xF0, 0x3C, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
-    0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x38,
-    0x00, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x38, 0x38, 0x00, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
-    0x38, 0x38, 0x38, 0x38, 0xF0, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xC0, 0x03, 0x80, 0x07, 0x00, 0x0E, 0x00, 0x1C, 0x38, 0x38, 0xE0,
-    0x73, 0x80, 0xEE, 0x01, 0xF8, 0x03, 0xF0, 0x07, 0xF0, 0x0E, 0x70, 0x1C, 0xE0, 0x38, 0xE0, 0x70,
-    0xE0, 0xE1, 0xC1, 0xC1, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
-    0x38, 0x38, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0xF3, 0xE0, 0x3F, 0xFF, 0xE0, 0x78, 0xF0, 0xC0, 0xE0, 0xE1,
-    0xC1, 0xC1, 0x83, 0x83, 0x83, 0x07, 0x07, 0x06, 0x0E, 0x0E, 0x0C, 0x1C, 0x1C, 0x18, 0x38, 0x38,
-    0x30, 0x70, 0x70, 0x60, 0xE0, 0xE0, 0xC1, 0xC1, 0xC1, 0x83, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3B, 0xE0, 0x3F, 0xF0, 0x3C, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
-    0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x1F, 0xF0, 0x1C, 0x38, 0x38, 0x38, 0x30, 0x18, 0x30,
-    0x1C, 0x30, 0x1C, 0x30, 0x1C, 0x30, 0x18, 0x38, 0x38, 0x1C, 0x38, 0x1F, 0xF0, 0x07, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0xE0, 0x3F, 0xF0, 0x3C, 0x38, 0x38,
-    0x38, 0x38, 0x18, 0x38, 0x1C, 0x38, 0x1C, 0x38, 0x18, 0x38, 0x18, 0x38, 0x38, 0x3C, 0x38, 0x3F,
-    0xF0, 0x3B, 0xE0, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x98, 0x1F,
-    0xF8, 0x1C, 0x78, 0x38, 0x38, 0x30, 0x38, 0x30, 0x38, 0x30, 0x18, 0x30, 0x18, 0x30, 0x38, 0x38,
-    0x38, 0x1C, 0x78, 0x1F, 0xF8, 0x07, 0xF8, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00,
-    0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x3F, 0x87,
-    0x80, 0xE0, 0x1C, 0x03, 0x80, 0x70, 0x0E, 0x01, 0xC0, 0x38, 0x07, 0x00, 0xE0, 0x1C, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xE0, 0x1F, 0xE0, 0x70, 0xE0, 0xC1, 0xC1, 0xE0, 0x01, 0xF8, 0x01, 0xFC, 0x00, 0xFC, 0x00, 0x38,
-    0x30, 0x30, 0x70, 0xE0, 0x7F, 0x80, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x80, 0xC0, 0x60, 0xFC, 0x7E, 0x0C, 0x06, 0x03, 0x01,
-    0x80, 0xC0, 0x60, 0x30, 0x18, 0x0C, 0x07, 0x81, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
-    0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x1C, 0x78, 0x1F, 0xF8, 0x0F,
-    0x98, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x1C, 0x30, 0x30, 0x70, 0xE0,
-    0xE1, 0xC0, 0xC3, 0x01, 0xCE, 0x03, 0x9C, 0x03, 0x30, 0x07, 0xE0, 0x07, 0xC0, 0x0F, 0x00, 0x1E,
-    0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x0E,
-    0x0C, 0x70, 0xF0, 0xC3, 0x0F, 0x1C, 0x30, 0xF1, 0x83, 0x9B, 0x18, 0x39, 0xB3, 0x81, 0x9B, 0xB8,
-    0x1B, 0xBB, 0x01, 0xF1, 0xF0, 0x0F, 0x1F, 0x00, 0xF1, 0xE0, 0x0F, 0x1E, 0x00, 0x60, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C,
-    0x38, 0x38, 0x70, 0x39, 0xC0, 0x3F, 0x00, 0x7E, 0x00, 0x78, 0x00, 0xF0, 0x01, 0xE0, 0x07, 0xE0,
-    0x1C, 0xE0, 0x39, 0xC0, 0xE1, 0xC3, 0x81, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38,
-    0x1C, 0x30, 0x30, 0x70, 0x60, 0xE1, 0xC0, 0xC3, 0x01, 0xC6, 0x01, 0x9C, 0x03, 0x30, 0x07, 0xE0,
-    0x07, 0xC0, 0x0F, 0x00, 0x1E, 0x00, 0x18, 0x00, 0x30, 0x00, 0xE0, 0x01, 0x80, 0x1F, 0x00, 0x3C,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xF8, 0x3F, 0xF0, 0x01, 0xC0, 0x03, 0x80, 0x0E, 0x00, 0x38, 0x00, 0xE0, 0x03, 0x80, 0x07, 0x00,
-    0x1C, 0x00, 0x70, 0x01, 0xFF, 0xE3, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0xF8, 0x1C, 0x03, 0x00, 0x60, 0x0C, 0x01, 0x80,
-    0x30, 0x06, 0x01, 0xC0, 0x70, 0x0E, 0x00, 0xE0, 0x0C, 0x01, 0x80, 0x30, 0x06, 0x00, 0xC0, 0x18,
-    0x03, 0x80, 0x7C, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0x01, 0x80, 0xC0, 0x60, 0x30, 0x18, 0x0C, 0x06, 0x03, 0x01, 0x80,
-    0xC0, 0x60, 0x30, 0x18, 0x0C, 0x06, 0x03, 0x01, 0x80, 0xC0, 0x60, 0x30, 0x18, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x07, 0xC0, 0x38,
-    0x03, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x30, 0x06, 0x00, 0xE0, 0x0E, 0x01, 0xC0, 0x70, 0x0C, 0x01,
-    0x80, 0x30, 0x06, 0x00, 0xC0, 0x18, 0x07, 0x03, 0xE0, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE3, 0x07, 0xFF,
-    0x83, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-};
-
-const GFXglyph Inter_24Glyphs[] PROGMEM = {
-    { 0, 9, 34, 9, 0, 0 },  // 'space' (32)
-    { 39, 9, 34, 9, 0, 0 },  // '!' (33)
-    { 78, 11, 34, 11, 0, 0 },  // '"' (34)
-    { 125, 16, 34, 16, 0, 0 },  // '#' (35)
-    { 193, 16, 34, 16, 0, 0 },  // '$' (36)
-    { 261, 24, 34, 24, 0, 0 },  // '%' (37)
-    { 363, 19, 34, 19, 0, 0 },  // '&' (38)
-    { 444, 7, 34, 7, 0, 0 },  // ''' (39)
-    { 474, 11, 34, 11, 0, 0 },  // '(' (40)
-    { 521, 11, 34, 11, 0, 0 },  // ')' (41)
-    { 568, 12, 34, 12, 0, 0 },  // '*' (42)
-    { 619, 17, 34, 17, 0, 0 },  // '+' (43)
-    { 692, 9, 34, 9, 0, 0 },  // ',' (44)
-    { 731, 11, 34, 11, 0, 0 },  // '-' (45)
-    { 778, 9, 34, 9, 0, 0 },  // '.' (46)
-    { 817, 9, 34, 9, 0, 0 },  // '/' (47)
-    { 856, 16, 34, 16, 0, 0 },  // '0' (48)
-    { 924, 16, 34, 16, 0, 0 },  // '1' (49)
-    { 992, 16, 34, 16, 0, 0 },  // '2' (50)
-    { 1060, 16, 34, 16, 0, 0 },  // '3' (51)
-    { 1128, 16, 34, 16, 0, 0 },  // '4' (52)
-    { 1196, 16, 34, 16, 0, 0 },  // '5' (53)
-    { 1264, 16, 34, 16, 0, 0 },  // '6' (54)
-    { 1332, 16, 34, 16, 0, 0 },  // '7' (55)
-    { 1400, 16, 34, 16, 0, 0 },  // '8' (56)
-    { 1468, 16, 34, 16, 0, 0 },  // '9' (57)
-    { 1536, 9, 34, 9, 0, 0 },  // ':' (58)
-    { 1575, 9, 34, 9, 0, 0 },  // ';' (59)
-    { 1614, 17, 34, 17, 0, 0 },  // '<' (60)
-    { 1687, 17, 34, 17, 0, 0 },  // '=' (61)
-    { 1760, 17, 34, 17, 0, 0 },  // '>' (62)
-    { 1833, 16, 34, 16, 0, 0 },  // '?' (63)
-    { 1901, 27, 34, 27, 0, 0 },  // '@' (64)
-    { 2016, 19, 34, 19, 0, 0 },  // 'A' (65)
-    { 2097, 19, 34, 19, 0, 0 },  // 'B' (66)
-    { 2178, 20, 34, 20, 0, 0 },  // 'C' (67)
-    { 2263, 20, 34, 20, 0, 0 },  // 'D' (68)
-    { 2348, 19, 34, 19, 0, 0 },  // 'E' (69)
-    { 2429, 17, 34, 17, 0, 0 },  // 'F' (70)
-    { 2502, 21, 34, 21, 0, 0 },  // 'G' (71)
-    { 2592, 20, 34, 20, 0, 0 },  // 'H' (72)
-    { 2677, 9, 34, 9, 0, 0 },  // 'I' (73)
-    { 2716, 15, 34, 15, 0, 0 },  // 'J' (74)
-    { 2780, 19, 34, 19, 0, 0 },  // 'K' (75)
-    { 2861, 16, 34, 16, 0, 0 },  // 'L' (76)
-    { 2929, 23, 34, 23, 0, 0 },  // 'M' (77)
-    { 3027, 20, 34, 20, 0, 0 },  // 'N' (78)
-    { 3112, 21, 34, 21, 0, 0 },  // 'O' (79)
-    { 3202, 19, 34, 19, 0, 0 },  // 'P' (80)
-    { 3283, 21, 34, 21, 0, 0 },  // 'Q' (81)
-    { 3373, 20, 34, 20, 0, 0 },  // 'R' (82)
-    { 3458, 19, 34, 19, 0, 0 },  // 'S' (83)
-    { 3539, 17, 34, 17, 0, 0 },  // 'T' (84)
-    { 3612, 20, 34, 20, 0, 0 },  // 'U' (85)
-    { 3697, 19, 34, 19, 0, 0 },  // 'V' (86)
-    { 3778, 25, 34, 25, 0, 0 },  // 'W' (87)
-    { 3885, 19, 34, 19, 0, 0 },  // 'X' (88)
-    { 3966, 19, 34, 19, 0, 0 },  // 'Y' (89)
-    { 4047, 17, 34, 17, 0, 0 },  // 'Z' (90)
-    { 4120, 9, 34, 9, 0, 0 },  // '[' (91)
-    { 4159, 9, 34, 9, 0, 0 },  // '\' (92)
-    { 4198, 9, 34, 9, 0, 0 },  // ']' (93)
-    { 4237, 14, 34, 14, 0, 0 },  // '^' (94)
-    { 4297, 16, 34, 16, 0, 0 },  // '_' (95)
-    { 4365, 11, 34, 11, 0, 0 },  // '`' (96)
-    { 4412, 16, 34, 16, 0, 0 },  // 'a' (97)
-    { 4480, 16, 34, 16, 0, 0 },  // 'b' (98)
-    { 4548, 15, 34, 15, 0, 0 },  // 'c' (99)
-    { 4612, 16, 34, 16, 0, 0 },  // 'd' (100)
-    { 4680, 16, 34, 16, 0, 0 },  // 'e' (101)
-    { 4748, 9, 34, 9, 0, 0 },  // 'f' (102)
-    { 4787, 16, 34, 16, 0, 0 },  // 'g' (103)
-    { 4855, 16, 34, 16, 0, 0 },  // 'h' (104)
-    { 4923, 8, 34, 8, 0, 0 },  // 'i' (105)
-    { 4957, 8, 34, 8, 0, 0 },  // 'j' (106)
-    { 4991, 15, 34, 15, 0, 0 },  // 'k' (107)
-    { 5055, 8, 34, 8, 0, 0 },  // 'l' (108)
-    { 5089, 23, 34, 23, 0, 0 },  // 'm' (109)
-    { 5187, 16, 34, 16, 0, 0 },  // 'n' (110)
-    { 5255, 16, 34, 16, 0, 0 },  // 'o' (111)
-    { 5323, 16, 34, 16, 0, 0 },  // 'p' (112)
-    { 5391, 16, 34, 16, 0, 0 },  // 'q' (113)
-    { 5459, 11, 34, 11, 0, 0 },  // 'r' (114)
-    { 5506, 15, 34, 15, 0, 0 },  // 's' (115)
-    { 5570, 9, 34, 9, 0, 0 },  // 't' (116)
-    { 5609, 16, 34, 16, 0, 0 },  // 'u' (117)
-    { 5677, 15, 34, 15, 0, 0 },  // 'v' (118)
-    { 5741, 20, 34, 20, 0, 0 },  // 'w' (119)
-    { 5826, 15, 34, 15, 0, 0 },  // 'x' (120)
-    { 5890, 15, 34, 15, 0, 0 },  // 'y' (121)
-    { 5954, 15, 34, 15, 0, 0 },  // 'z' (122)
-    { 6018, 11, 34, 11, 0, 0 },  // '{' (123)
-    { 6065, 9, 34, 9, 0, 0 },  // '|' (124)
-    { 6104, 11, 34, 11, 0, 0 },  // '}' (125)
-    { 6151, 17, 34, 17, 0, 0 }  // '~' (126)
-};
-
-const GFXfont Inter_24 PROGMEM = {
-    (uint8_t*)Inter_24Bitmaps,
-    (GFXglyph*)Inter_24Glyphs,
-    32, 126, 34
-};
-
-#endif // INTER_24_H
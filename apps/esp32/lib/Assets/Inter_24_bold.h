@@ -1,518 +0,0 @@
-// Inter Font - 24px SemiBold (Weight 600)
-// Generated: 18.1.2026, 18:16:25
-// Charset: 95 characters
-
-#ifndef INTER_24B_H
-#define INTER_24B_H
-
-const uint8_t Inter_24BBitmaps[] PROGMEM = {
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x01, 0xE0, 0x3C, 0x07,
-    0x80, 0xF0, 0x1C, 0x03, 0x80, 0x70, 0x0E, 0x01, 0xC0, 0x18, 0x03, 0x00, 0x60, 0x00, 0x03, 0xC0,
-    0x78, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x78, 0x3D, 0xE0, 0xF7,
-    0x83, 0xDE, 0x0F, 0x38, 0x38, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x1C, 0x07, 0x38, 0x07, 0x38, 0x07, 0x38,
-    0x7F, 0xFC, 0x7F, 0xFC, 0x7F, 0xFC, 0x0E, 0x70, 0x0E, 0x70, 0x1C, 0x70, 0x7F, 0xFC, 0x7F, 0xFC,
-    0x7F, 0xFC, 0x1C, 0xE0, 0x38, 0xE0, 0x39, 0xC0, 0x39, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x0F, 0xC0, 0x1F, 0xF0,
-    0x3F, 0xF0, 0x3F, 0xF8, 0x39, 0xB8, 0x3D, 0x80, 0x3F, 0x80, 0x1F, 0xC0, 0x0F, 0xF0, 0x03, 0xF8,
-    0x01, 0xF8, 0x39, 0xB8, 0x3D, 0xB8, 0x3F, 0xB8, 0x1F, 0xF8, 0x1F, 0xF0, 0x07, 0xE0, 0x01, 0x80,
-    0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0x03, 0x80, 0x3F, 0x83, 0x00, 0x3B, 0x87, 0x00, 0x39, 0x86, 0x00, 0x39,
-    0x8E, 0x00, 0x39, 0x8E, 0x00, 0x3B, 0x9C, 0x00, 0x3F, 0x9C, 0x00, 0x1F, 0x38, 0x00, 0x00, 0x39,
-    0xE0, 0x00, 0x73, 0xF0, 0x00, 0x77, 0x38, 0x00, 0xE7, 0x38, 0x00, 0xE7, 0x38, 0x01, 0xC7, 0x38,
-    0x01, 0xC7, 0x38, 0x03, 0x83, 0xF0, 0x03, 0x81, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x0F, 0xF8, 0x00, 0xFF, 0xC0, 0x0F,
-    0x3C, 0x00, 0xF3, 0xC0, 0x0F, 0x38, 0x00, 0x7F, 0x80, 0x07, 0xF0, 0x00, 0xFE, 0x00, 0x1F, 0xF7,
-    0x83, 0xCF, 0xF8, 0x3C, 0x7F, 0x03, 0xC3, 0xF0, 0x3E, 0x7F, 0x83, 0xFF, 0xFC, 0x1F, 0xFF, 0x80,
-    0x7E, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x38, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x70, 0x1C, 0x03,
-    0x80, 0xF0, 0x1C, 0x07, 0x80, 0xF0, 0x1E, 0x03, 0xC0, 0x78, 0x0F, 0x01, 0xE0, 0x3C, 0x07, 0x80,
-    0x70, 0x0E, 0x01, 0xE0, 0x1C, 0x03, 0x80, 0x38, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x03, 0x80, 0x38, 0x07, 0x00,
-    0xF0, 0x0E, 0x01, 0xE0, 0x3C, 0x07, 0x80, 0xF0, 0x1E, 0x03, 0xC0, 0x78, 0x0F, 0x01, 0xE0, 0x38,
-    0x07, 0x01, 0xE0, 0x38, 0x07, 0x01, 0xC0, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x0E, 0x03, 0xD8, 0x7F, 0xC1,
-    0xF0, 0x1F, 0x03, 0xB8, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0x03, 0xC0, 0x01, 0xE0, 0x00, 0xF0, 0x07,
-    0xFF, 0x83, 0xFF, 0xC1, 0xFF, 0xE0, 0x0F, 0x00, 0x07, 0x80, 0x03, 0xC0, 0x01, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0E, 0x07, 0x03, 0x80, 0xC0, 0x60, 0x70, 0x30, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x7F, 0x0F, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x07, 0x03, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xE0, 0x60, 0x70, 0x38, 0x1C, 0x0E, 0x0E, 0x07, 0x03, 0x81, 0xC1, 0xC0, 0xE0, 0x70,
-    0x38, 0x38, 0x1C, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x0F, 0xF0, 0x1F,
-    0xF0, 0x3E, 0x78, 0x3C, 0x78, 0x3C, 0x38, 0x3C, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x3C,
-    0x38, 0x3C, 0x38, 0x3C, 0x78, 0x3E, 0x78, 0x1F, 0xF0, 0x0F, 0xF0, 0x07, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-    0xE0, 0x01, 0xE0, 0x07, 0xE0, 0x0F, 0xE0, 0x1F, 0xE0, 0x1D, 0xE0, 0x19, 0xE0, 0x01, 0xE0, 0x01,
-    0xE0, 0x01, 0xE0, 0x01, 0xE0, 0x01, 0xE0, 0x01, 0xE0, 0x01, 0xE0, 0x01, 0xE0, 0x01, 0xE0, 0x01,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xE0, 0x1F, 0xF0, 0x1F, 0xF8, 0x3E, 0x78, 0x3C, 0x38, 0x3C, 0x38, 0x00,
-    0x78, 0x00, 0x78, 0x00, 0xF0, 0x01, 0xE0, 0x03, 0xC0, 0x0F, 0x80, 0x0F, 0x00, 0x1E, 0x00, 0x3F,
-    0xF8, 0x3F, 0xF8, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x1F, 0xF0, 0x1F, 0xF0, 0x3C, 0x78, 0x3C,
-    0x78, 0x00, 0xF0, 0x03, 0xF0, 0x03, 0xE0, 0x03, 0xF0, 0x00, 0x78, 0x00, 0x38, 0x3C, 0x38, 0x3C,
-    0x78, 0x3E, 0x78, 0x1F, 0xF8, 0x1F, 0xF0, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0xF0, 0x01,
-    0xF0, 0x03, 0xF0, 0x03, 0xF0, 0x07, 0xF0, 0x0F, 0xF0, 0x0E, 0xF0, 0x1C, 0xF0, 0x3C, 0xF0, 0x38,
-    0xF0, 0x7F, 0xFC, 0x7F, 0xFC, 0x7F, 0xFC, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xF8, 0x0F, 0xF8, 0x0F, 0xF8, 0x1E, 0x00, 0x1E, 0x00, 0x1F, 0xE0, 0x1F, 0xF0, 0x3F, 0xF8, 0x3C,
-    0x78, 0x00, 0x3C, 0x00, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3E, 0x78, 0x1F, 0xF8, 0x0F, 0xF0, 0x07,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x07, 0xE0, 0x0F, 0xF0, 0x1F, 0xF8, 0x1E, 0x78, 0x3C, 0x78, 0x3C, 0x00, 0x3F,
-    0xE0, 0x3F, 0xF0, 0x3F, 0xF8, 0x3E, 0x78, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x1E, 0x78, 0x1F,
-    0xF8, 0x0F, 0xF0, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x3F, 0xF8, 0x3F, 0xF8, 0x00, 0x78, 0x00,
-    0xF0, 0x01, 0xE0, 0x01, 0xE0, 0x03, 0xC0, 0x03, 0xC0, 0x07, 0x80, 0x07, 0x80, 0x07, 0x80, 0x07,
-    0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x1F, 0xF0, 0x1F,
-    0xF8, 0x3E, 0x78, 0x3C, 0x78, 0x3C, 0x78, 0x1E, 0x78, 0x1F, 0xF0, 0x0F, 0xE0, 0x1F, 0xF0, 0x3C,
-    0x78, 0x3C, 0x38, 0x3C, 0x38, 0x3C, 0x78, 0x3F, 0xF8, 0x1F, 0xF0, 0x07, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xC0, 0x1F, 0xE0, 0x3F, 0xF0, 0x3C, 0xF8, 0x38, 0x78, 0x38, 0x78, 0x38, 0x78, 0x3C, 0x78, 0x3F,
-    0xF8, 0x1F, 0xF8, 0x0F, 0xF8, 0x00, 0x78, 0x3C, 0x78, 0x3C, 0xF8, 0x1F, 0xF0, 0x1F, 0xE0, 0x0F,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x1E, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x78, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x1E, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xC0, 0x78, 0x0F, 0x00, 0x60, 0x1C, 0x03, 0x00, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0xF0, 0x03, 0xF8, 0x07, 0xF8, 0x0F, 0xF0,
-    0x0F, 0xC0, 0x07, 0x80, 0x03, 0xF0, 0x00, 0xFF, 0x00, 0x1F, 0xE0, 0x03, 0xF8, 0x00, 0x3C, 0x00,
-    0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xF8, 0x3F, 0xFC, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC1,
-    0xFF, 0xE0, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0xF0, 0x00, 0x7E, 0x00, 0x1F, 0xE0,
-    0x03, 0xFC, 0x00, 0x7F, 0x00, 0x07, 0x80, 0x1F, 0xC0, 0x3F, 0xC0, 0x7F, 0x00, 0x7E, 0x00, 0x3C,
-    0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0xFF,
-    0x80, 0xFF, 0xE0, 0xF8, 0xF8, 0x78, 0x3C, 0x00, 0x1E, 0x00, 0x1F, 0x00, 0x1F, 0x00, 0x1F, 0x00,
-    0x1F, 0x00, 0x0F, 0x00, 0x07, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x70, 0x00, 0x38,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x01, 0xFF, 0xF0, 0x00,
-    0xFF, 0xFE, 0x00, 0x7E, 0x0F, 0xC0, 0x3C, 0xF3, 0xF8, 0x1E, 0x7F, 0xEE, 0x07, 0x3F, 0xF9, 0xC3,
-    0x9F, 0x3C, 0x70, 0xE7, 0x0F, 0x1C, 0x33, 0xC1, 0xC7, 0x0C, 0xF0, 0xF1, 0xC3, 0x38, 0x38, 0xE0,
-    0xCF, 0x0E, 0x38, 0x33, 0xCF, 0xBC, 0x0C, 0x7F, 0xFF, 0x03, 0x9F, 0xFF, 0x80, 0xE3, 0xEF, 0x80,
-    0x1C, 0x00, 0x07, 0x07, 0xC0, 0x03, 0xC0, 0xFE, 0x07, 0xE0, 0x1F, 0xFF, 0xF0, 0x01, 0xFF, 0xF8,
-    0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x80, 0x03, 0xF8, 0x00,
-    0x7B, 0x80, 0x07, 0xBC, 0x00, 0xF3, 0xC0, 0x0F, 0x1E, 0x00, 0xF1, 0xE0, 0x1E, 0x1E, 0x01, 0xFF,
-    0xF0, 0x1F, 0xFF, 0x03, 0xFF, 0xF0, 0x3C, 0x07, 0x83, 0xC0, 0x78, 0x78, 0x07, 0xC7, 0x80, 0x3C,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x1F, 0xFF, 0x01,
-    0xFF, 0xF0, 0x1C, 0x0F, 0x81, 0xC0, 0x78, 0x1C, 0x07, 0x81, 0xC0, 0xF0, 0x1F, 0xFE, 0x01, 0xFF,
-    0xE0, 0x1F, 0xFF, 0x01, 0xC0, 0xF8, 0x1C, 0x07, 0x81, 0xC0, 0x78, 0x1C, 0x0F, 0x81, 0xFF, 0xF8,
-    0x1F, 0xFF, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xC0, 0x07, 0xFF, 0x00, 0xFF, 0xF0, 0x1F, 0x0F, 0x81, 0xE0, 0x70, 0x3C, 0x00, 0x03, 0xC0,
-    0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x01, 0xE0, 0x70,
-    0x1F, 0x0F, 0x80, 0xFF, 0xF8, 0x07, 0xFF, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x1F, 0xFE, 0x01, 0xFF, 0xF0, 0x1C, 0x1F, 0x01, 0xC0,
-    0x78, 0x1C, 0x07, 0x81, 0xC0, 0x78, 0x1C, 0x07, 0x81, 0xC0, 0x78, 0x1C, 0x07, 0x81, 0xC0, 0x78,
-    0x1C, 0x07, 0x81, 0xC0, 0x78, 0x1C, 0x1F, 0x01, 0xFF, 0xF0, 0x1F, 0xFE, 0x01, 0xFF, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x81, 0xFF, 0xF0, 0x3F, 0xFE,
-    0x07, 0x00, 0x00, 0xE0, 0x00, 0x1C, 0x00, 0x03, 0x80, 0x00, 0x7F, 0xF8, 0x0F, 0xFF, 0x01, 0xFF,
-    0xE0, 0x38, 0x00, 0x07, 0x00, 0x00, 0xE0, 0x00, 0x1C, 0x00, 0x03, 0xFF, 0xE0, 0x7F, 0xFC, 0x0F,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC1, 0xFF, 0xE0, 0xFF, 0xF0,
-    0x70, 0x00, 0x38, 0x00, 0x1C, 0x00, 0x0E, 0x00, 0x07, 0xFF, 0x03, 0xFF, 0x81, 0xFF, 0xC0, 0xE0,
-    0x00, 0x70, 0x00, 0x38, 0x00, 0x1C, 0x00, 0x0E, 0x00, 0x07, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x7F, 0xF8, 0x07, 0xFF, 0xE0, 0x7E, 0x1F, 0x03, 0xC0,
-    0x70, 0x3C, 0x00, 0x01, 0xE0, 0x00, 0x0F, 0x00, 0x00, 0x78, 0x7F, 0x83, 0xC3, 0xFC, 0x1E, 0x1F,
-    0xE0, 0xF0, 0x07, 0x03, 0xC0, 0x38, 0x1F, 0x87, 0xC0, 0x7F, 0xFE, 0x01, 0xFF, 0xE0, 0x03, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xC0, 0x70,
-    0x1C, 0x07, 0x01, 0xC0, 0x70, 0x1C, 0x07, 0x01, 0xC0, 0x70, 0x1C, 0x07, 0x01, 0xC0, 0x70, 0x1F,
-    0xFF, 0x01, 0xFF, 0xF0, 0x1F, 0xFF, 0x01, 0xC0, 0x70, 0x1C, 0x07, 0x01, 0xC0, 0x70, 0x1C, 0x07,
-    0x01, 0xC0, 0x70, 0x1C, 0x07, 0x01, 0xC0, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x83,
-    0xC1, 0xE0, 0xF0, 0x78, 0x3C, 0x1E, 0x0F, 0x07, 0x83, 0xC1, 0xE0, 0xF0, 0x78, 0x3C, 0x1E, 0x0F,
-    0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x78, 0x00, 0x78, 0x00, 0x78,
-    0x00, 0x78, 0x00, 0x78, 0x00, 0x78, 0x00, 0x78, 0x00, 0x78, 0x00, 0x78, 0x00, 0x78, 0x78, 0x70,
-    0x78, 0x70, 0x3C, 0xF0, 0x3F, 0xF0, 0x1F, 0xE0, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xC0, 0xFC,
-    0x1C, 0x0F, 0x81, 0xC1, 0xF0, 0x1C, 0x3E, 0x01, 0xC7, 0xC0, 0x1C, 0xF8, 0x01, 0xFF, 0x00, 0x1F,
-    0xF0, 0x01, 0xFF, 0x80, 0x1F, 0xFC, 0x01, 0xF3, 0xC0, 0x1E, 0x3E, 0x01, 0xC1, 0xF0, 0x1C, 0x0F,
-    0x01, 0xC0, 0xF8, 0x1C, 0x07, 0x81, 0xC0, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0x80, 0x01, 0xC0, 0x00, 0xE0, 0x00, 0x70, 0x00, 0x38, 0x00, 0x1C, 0x00, 0x0E, 0x00,
-    0x07, 0x00, 0x03, 0x80, 0x01, 0xC0, 0x00, 0xE0, 0x00, 0x70, 0x00, 0x38, 0x00, 0x1C, 0x00, 0x0F,
-    0xFF, 0x07, 0xFF, 0x83, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x1F, 0x83,
-    0xF0, 0x3F, 0x07, 0xF0, 0xFE, 0x0F, 0xE1, 0xFC, 0x1F, 0xC3, 0xF8, 0x3F, 0xC7, 0xF0, 0x7B, 0x9D,
-    0xE0, 0xF7, 0x3B, 0xC1, 0xEE, 0x77, 0x83, 0xCF, 0xEF, 0x07, 0x9F, 0x9E, 0x0F, 0x3F, 0x3C, 0x1E,
-    0x7E, 0x78, 0x3C, 0x7C, 0xF0, 0x78, 0xF1, 0xE0, 0xF1, 0xE3, 0xC1, 0xE3, 0xC7, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x70,
-    0x1F, 0x07, 0x01, 0xF0, 0x70, 0x1F, 0x87, 0x01, 0xF8, 0x70, 0x1F, 0xC7, 0x01, 0xFE, 0x70, 0x1F,
-    0xE7, 0x01, 0xDF, 0x70, 0x1C, 0xF7, 0x01, 0xC7, 0xF0, 0x1C, 0x7F, 0x01, 0xC3, 0xF0, 0x1C, 0x3F,
-    0x01, 0xC1, 0xF0, 0x1C, 0x0F, 0x01, 0xC0, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x7F, 0xF0, 0x07, 0xFF, 0xC0, 0x7E, 0x3F, 0x03, 0xC0, 0x78,
-    0x3C, 0x03, 0xC1, 0xE0, 0x0F, 0x0F, 0x00, 0x78, 0x78, 0x03, 0xC3, 0xC0, 0x1E, 0x1E, 0x00, 0xF0,
-    0xF0, 0x0F, 0x03, 0xC0, 0x78, 0x1F, 0x8F, 0xC0, 0x7F, 0xFC, 0x01, 0xFF, 0xC0, 0x03, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x01, 0xFF,
-    0xE0, 0x3F, 0xFC, 0x07, 0x07, 0xC0, 0xE0, 0x78, 0x1C, 0x0F, 0x03, 0x81, 0xE0, 0x70, 0x7C, 0x0F,
-    0xFF, 0x01, 0xFF, 0xE0, 0x3F, 0xF0, 0x07, 0x00, 0x00, 0xE0, 0x00, 0x1C, 0x00, 0x03, 0x80, 0x00,
-    0x70, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8,
-    0x00, 0x7F, 0xF0, 0x07, 0xFF, 0xC0, 0x7E, 0x3F, 0x03, 0xC0, 0x78, 0x3C, 0x03, 0xE1, 0xE0, 0x0F,
-    0x0F, 0x00, 0x78, 0x78, 0x03, 0xC3, 0xC0, 0x1E, 0x1E, 0x00, 0xF0, 0xF0, 0xCF, 0x03, 0xC7, 0xF8,
-    0x1F, 0xBF, 0x80, 0x7F, 0xFF, 0x01, 0xFF, 0xF8, 0x03, 0xFF, 0xC0, 0x00, 0x0C, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x1F, 0xFF, 0x01, 0xFF, 0xF0, 0x1C,
-    0x0F, 0x81, 0xC0, 0x78, 0x1C, 0x07, 0x81, 0xC0, 0xF8, 0x1F, 0xFF, 0x01, 0xFF, 0xE0, 0x1F, 0xFC,
-    0x01, 0xC7, 0xC0, 0x1C, 0x3E, 0x01, 0xC1, 0xE0, 0x1C, 0x0F, 0x01, 0xC0, 0xF8, 0x1C, 0x07, 0x81,
-    0xC0, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0xFF,
-    0xC0, 0x3F, 0xFC, 0x0F, 0x8F, 0x81, 0xE0, 0xF0, 0x3E, 0x00, 0x03, 0xFC, 0x00, 0x7F, 0xF0, 0x03,
-    0xFF, 0x00, 0x1F, 0xE0, 0x00, 0x3E, 0x0F, 0x03, 0xC1, 0xE0, 0x78, 0x3E, 0x1F, 0x03, 0xFF, 0xC0,
-    0x3F, 0xF0, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xE3, 0xFF,
-    0xF1, 0xFF, 0xF8, 0x07, 0x80, 0x03, 0xC0, 0x01, 0xE0, 0x00, 0xF0, 0x00, 0x78, 0x00, 0x3C, 0x00,
-    0x1E, 0x00, 0x0F, 0x00, 0x07, 0x80, 0x03, 0xC0, 0x01, 0xE0, 0x00, 0xF0, 0x00, 0x78, 0x00, 0x3C,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xC0, 0x70, 0x1C, 0x07, 0x01, 0xC0, 0x70, 0x1C, 0x07,
-    0x01, 0xC0, 0x70, 0x1C, 0x07, 0x01, 0xC0, 0x70, 0x1C, 0x07, 0x01, 0xC0, 0x70, 0x1C, 0x07, 0x01,
-    0xC0, 0x70, 0x1C, 0x07, 0x01, 0xE0, 0xF0, 0x1F, 0x1F, 0x01, 0xFF, 0xF0, 0x0F, 0xFE, 0x00, 0x3F,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x03, 0xC7, 0x80, 0x78,
-    0x78, 0x1E, 0x0F, 0x03, 0xC1, 0xE0, 0x78, 0x1E, 0x1E, 0x03, 0xC3, 0xC0, 0x78, 0x78, 0x07, 0x9E,
-    0x00, 0xF3, 0xC0, 0x1E, 0x70, 0x01, 0xFE, 0x00, 0x3F, 0xC0, 0x07, 0xF0, 0x00, 0x7E, 0x00, 0x0F,
-    0xC0, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x07,
-    0xC1, 0xE7, 0x83, 0xE0, 0xE3, 0xC3, 0xF0, 0xF0, 0xF1, 0xF8, 0x78, 0x78, 0xFE, 0x3C, 0x3C, 0x7F,
-    0x1C, 0x1E, 0x7B, 0x9E, 0x07, 0x3D, 0xCF, 0x03, 0xDC, 0xF7, 0x81, 0xFE, 0x3B, 0x80, 0xFF, 0x1F,
-    0xC0, 0x3F, 0x8F, 0xE0, 0x1F, 0x87, 0xF0, 0x0F, 0xC1, 0xF8, 0x07, 0xE0, 0xF8, 0x03, 0xE0, 0x7C,
-    0x00, 0xF0, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x07, 0x83, 0xE1, 0xF0, 0x3E, 0x7C, 0x03, 0xCF,
-    0x00, 0x7F, 0xE0, 0x07, 0xF8, 0x00, 0x7E, 0x00, 0x0F, 0xC0, 0x01, 0xF8, 0x00, 0x3F, 0x00, 0x0F,
-    0xF0, 0x03, 0xFE, 0x00, 0x79, 0xE0, 0x1F, 0x3E, 0x07, 0xC3, 0xC0, 0xF0, 0x3C, 0x3E, 0x07, 0xC0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x07, 0xC3, 0xC0, 0xF0, 0x7C, 0x3C, 0x07,
-    0x87, 0x80, 0x79, 0xE0, 0x0F, 0x3C, 0x00, 0xFF, 0x00, 0x0F, 0xC0, 0x01, 0xF8, 0x00, 0x1E, 0x00,
-    0x03, 0xC0, 0x00, 0x78, 0x00, 0x0F, 0x00, 0x01, 0xE0, 0x00, 0x3C, 0x00, 0x07, 0x80, 0x00, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xC3, 0xFF, 0xE1, 0xFF, 0xF0, 0x00,
-    0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0x78, 0x00, 0x7C, 0x00, 0x7C, 0x00, 0x7C, 0x00,
-    0x7C, 0x00, 0x7C, 0x00, 0x7C, 0x00, 0x3F, 0xFF, 0x1F, 0xFF, 0x8F, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xC1, 0xF8, 0x3F, 0x07, 0x00, 0xE0, 0x1C, 0x03, 0x80, 0x70, 0x0E, 0x01, 0xC0, 0x38, 0x07, 0x00,
-    0xE0, 0x1C, 0x03, 0x80, 0x70, 0x0E, 0x01, 0xC0, 0x38, 0x07, 0xE0, 0xFC, 0x1F, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x07, 0x03,
-    0x80, 0xE0, 0x70, 0x38, 0x1C, 0x07, 0x03, 0x81, 0xC0, 0xE0, 0x38, 0x1C, 0x0E, 0x07, 0x01, 0x80,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x07, 0xE0, 0xFC, 0x03, 0x80, 0x70, 0x0E, 0x01, 0xC0, 0x38,
-    0x07, 0x00, 0xE0, 0x1C, 0x03, 0x80, 0x70, 0x0E, 0x01, 0xC0, 0x38, 0x07, 0x00, 0xE0, 0x1C, 0x1F,
-    0x83, 0xF0, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x3C, 0x00, 0x3F, 0x00, 0x1F, 0x80, 0x1F,
-    0xE0, 0x0E, 0x70, 0x0F, 0x3C, 0x07, 0x1E, 0x07, 0x87, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFE, 0x7F, 0xFE, 0x7F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1E, 0x03, 0xC0, 0x38, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x1F, 0xF0, 0x1C, 0xF8,
-    0x3C, 0x78, 0x00, 0x78, 0x07, 0xF8, 0x1F, 0xF8, 0x3F, 0xF8, 0x3C, 0x78, 0x38, 0x78, 0x3C, 0xF8,
-    0x3F, 0xF8, 0x1F, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0x03, 0xC0, 0x01, 0xE0, 0x00, 0xF0, 0x00, 0x7B,
-    0xE0, 0x3F, 0xF8, 0x1F, 0xFE, 0x0F, 0x8F, 0x87, 0x83, 0xC3, 0xC1, 0xE1, 0xE0, 0xF0, 0xF0, 0x78,
-    0x78, 0x3C, 0x3E, 0x3C, 0x1F, 0xFE, 0x0F, 0xFE, 0x07, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x0F, 0xF0, 0x1F, 0xF8, 0x3E, 0x7C, 0x3C,
-    0x38, 0x3C, 0x00, 0x38, 0x00, 0x3C, 0x00, 0x3C, 0x38, 0x3E, 0x7C, 0x1F, 0xF8, 0x0F, 0xF8, 0x07,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x01, 0xC0, 0x00, 0xE0, 0x00, 0x70, 0x0F, 0xB8, 0x1F, 0xFC,
-    0x0F, 0xFE, 0x0F, 0x9F, 0x07, 0x87, 0x83, 0xC1, 0xC1, 0xC0, 0xE0, 0xF0, 0x70, 0x78, 0x78, 0x3E,
-    0x7C, 0x0F, 0xFE, 0x07, 0xFF, 0x00, 0xFB, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x1F, 0xF0, 0x1F, 0xF8, 0x3C, 0x78, 0x38, 0x38, 0x3F, 0xF8,
-    0x3F, 0xFC, 0x38, 0x00, 0x3C, 0x00, 0x3E, 0x78, 0x1F, 0xF8, 0x1F, 0xF0, 0x07, 0xE0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE1,
-    0xFC, 0x3C, 0x07, 0x80, 0xF0, 0x7F, 0x8F, 0xF0, 0x78, 0x0F, 0x01, 0xE0, 0x3C, 0x07, 0x80, 0xF0,
-    0x1E, 0x03, 0xC0, 0x78, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xB8, 0x1F, 0xFC, 0x0F, 0xFE, 0x0F, 0x9F,
-    0x07, 0x87, 0x83, 0xC1, 0xC1, 0xC0, 0xE0, 0xF0, 0x70, 0x78, 0x78, 0x3E, 0x7C, 0x0F, 0xFE, 0x07,
-    0xFF, 0x00, 0xF3, 0x80, 0x01, 0xC1, 0xF1, 0xE0, 0xFF, 0xF0, 0x3F, 0xF0, 0x0F, 0xF0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x01, 0xC0, 0x00, 0xE0, 0x00, 0x70,
-    0x00, 0x39, 0xE0, 0x1F, 0xF8, 0x0F, 0xFE, 0x07, 0x8F, 0x03, 0xC7, 0x81, 0xC1, 0xC0, 0xE0, 0xE0,
-    0x70, 0x70, 0x38, 0x38, 0x1C, 0x1C, 0x0E, 0x0E, 0x07, 0x07, 0x03, 0x83, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x81,
-    0xC0, 0xE0, 0x00, 0x38, 0x1C, 0x0E, 0x07, 0x03, 0x81, 0xC0, 0xE0, 0x70, 0x38, 0x1C, 0x0E, 0x07,
-    0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x83, 0xC1, 0xE0, 0x00, 0x78, 0x3C, 0x1E, 0x0F, 0x07, 0x83,
-    0xC1, 0xE0, 0xF0, 0x78, 0x3C, 0x1E, 0x0F, 0x07, 0x83, 0xC1, 0xE3, 0xF1, 0xF8, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C,
-    0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x7C, 0x3C, 0xF8, 0x3C, 0xF0, 0x3D, 0xE0, 0x3F,
-    0xC0, 0x3F, 0xC0, 0x3F, 0xE0, 0x3F, 0xE0, 0x3C, 0xF0, 0x3C, 0x70, 0x3C, 0x78, 0x3C, 0x3C, 0x3C,
-    0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0x81, 0xC0, 0xE0, 0x70, 0x38, 0x1C, 0x0E, 0x07, 0x03, 0x81, 0xC0, 0xE0, 0x70, 0x38, 0x1C,
-    0x0E, 0x07, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0xE3, 0xE0, 0x3F, 0xF7, 0xF0, 0x3F,
-    0xFF, 0xF8, 0x3E, 0x7C, 0x78, 0x3C, 0x3C, 0x78, 0x3C, 0x38, 0x78, 0x3C, 0x38, 0x78, 0x3C, 0x38,
-    0x78, 0x3C, 0x38, 0x78, 0x3C, 0x38, 0x78, 0x3C, 0x38, 0x78, 0x3C, 0x38, 0x78, 0x3C, 0x38, 0x78,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0xE0, 0x1F, 0xFC, 0x0F, 0xFE, 0x07,
-    0x8F, 0x03, 0xC7, 0x81, 0xC1, 0xC0, 0xE0, 0xE0, 0x70, 0x70, 0x38, 0x38, 0x1C, 0x1C, 0x0E, 0x0E,
-    0x07, 0x07, 0x03, 0x83, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0F, 0xC0, 0x0F, 0xF8, 0x0F, 0xFE, 0x0F, 0x8F, 0x07, 0x83, 0xC3, 0xC1, 0xE1, 0xC0,
-    0xF0, 0xF0, 0x78, 0x78, 0x3C, 0x3E, 0x3C, 0x0F, 0xFE, 0x03, 0xFE, 0x00, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7B, 0xE0, 0x3F, 0xF8, 0x1F,
-    0xFE, 0x0F, 0x8F, 0x07, 0x83, 0xC3, 0xC1, 0xE1, 0xE0, 0xF0, 0xF0, 0x78, 0x7C, 0x3C, 0x3F, 0x3C,
-    0x1F, 0xFE, 0x0F, 0xFE, 0x07, 0xBE, 0x03, 0xC0, 0x01, 0xE0, 0x00, 0xF0, 0x00, 0x78, 0x00, 0x3C,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0xB8, 0x1F, 0xFC, 0x0F, 0xFE, 0x0F, 0x9F, 0x07, 0x87, 0x83, 0xC1,
-    0xC1, 0xC0, 0xE0, 0xF0, 0x70, 0x78, 0x78, 0x3E, 0x7C, 0x0F, 0xFE, 0x07, 0xFF, 0x00, 0xFB, 0x80,
-    0x01, 0xC0, 0x00, 0xE0, 0x00, 0x70, 0x00, 0x38, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x3F, 0xE3, 0xFC, 0x3E, 0x03, 0xE0,
-    0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xE0, 0x1F, 0xF0, 0x3C, 0xF0, 0x38, 0x78, 0x3F, 0x00, 0x3F, 0xE0, 0x1F, 0xF8, 0x07, 0xF8, 0x00,
-    0xF8, 0x78, 0x38, 0x3C, 0x78, 0x1F, 0xF0, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x01, 0xC0, 0x38, 0x07, 0x03, 0xFC,
-    0x7F, 0x8F, 0xF0, 0x70, 0x0E, 0x01, 0xC0, 0x38, 0x07, 0x00, 0xE0, 0x1E, 0x03, 0xF0, 0x7E, 0x07,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x38, 0x38, 0x1C, 0x1C, 0x0E, 0x0E, 0x07, 0x07, 0x03, 0x83, 0x81, 0xC1, 0xC0,
-    0xE0, 0xE0, 0x70, 0xF0, 0x38, 0x78, 0x1E, 0x7C, 0x0F, 0xFE, 0x07, 0xFF, 0x01, 0xFB, 0x80, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x3C, 0x78, 0x38, 0x3C,
-    0x78, 0x3C, 0x78, 0x1C, 0x70, 0x1E, 0xF0, 0x1E, 0xF0, 0x0E, 0xE0, 0x0F, 0xE0, 0x07, 0xC0, 0x07,
-    0xC0, 0x07, 0xC0, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0x0F, 0x0E, 0x78, 0xF8, 0xF1, 0xC7, 0xC7, 0x8F, 0x3E, 0x38, 0x79, 0xFB,
-    0xC1, 0xDF, 0xDE, 0x0E, 0xEE, 0xE0, 0x7F, 0x7F, 0x01, 0xFB, 0xF8, 0x0F, 0xCF, 0x80, 0x7C, 0x7C,
-    0x03, 0xE3, 0xE0, 0x0F, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x7C, 0x3E, 0x78, 0x1E, 0xF0, 0x0F,
-    0xF0, 0x0F, 0xE0, 0x07, 0xC0, 0x07, 0xC0, 0x07, 0xE0, 0x0F, 0xE0, 0x1F, 0xF0, 0x1E, 0xF8, 0x3C,
-    0x78, 0x7C, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x3C, 0x78,
-    0x38, 0x38, 0x78, 0x3C, 0x78, 0x3C, 0x70, 0x1C, 0xF0, 0x1E, 0xF0, 0x1E, 0xE0, 0x0F, 0xE0, 0x0F,
-    0xC0, 0x0F, 0xC0, 0x07, 0xC0, 0x07, 0x80, 0x07, 0x80, 0x07, 0x80, 0x3F, 0x00, 0x3F, 0x00, 0x3E,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xF8, 0x3F, 0xF0, 0x7F, 0xE0, 0x07, 0xC0, 0x1F, 0x00, 0x7C, 0x01, 0xF0, 0x07, 0xC0, 0x0F,
-    0x00, 0x3E, 0x00, 0xFF, 0xF1, 0xFF, 0xE3, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x0F, 0xC0, 0xFC, 0x0F, 0x00, 0xE0, 0x0E,
-    0x00, 0xE0, 0x0E, 0x01, 0xE0, 0x3C, 0x03, 0xC0, 0x3C, 0x01, 0xE0, 0x0E, 0x00, 0xE0, 0x0E, 0x00,
-    0xE0, 0x0E, 0x00, 0xF0, 0x0F, 0xC0, 0x7C, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x81, 0xC0, 0xE0, 0x70, 0x38, 0x1C,
-    0x0E, 0x07, 0x03, 0x81, 0xC0, 0xE0, 0x70, 0x38, 0x1C, 0x0E, 0x07, 0x03, 0x81, 0xC0, 0xE0, 0x70,
-    0x38, 0x1C, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xC0, 0x3E, 0x03, 0xE0, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x07,
-    0xC0, 0x3C, 0x07, 0xC0, 0xF0, 0x0F, 0x00, 0xF0, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x3E, 0x03,
-    0xE0, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0F, 0x80, 0x0F, 0xF3, 0x07, 0xFF, 0x83, 0x3F, 0xC0, 0x07, 0xC0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-};
-
-const GFXglyph Inter_24BGlyphs[] PROGMEM = {
-    { 0, 9, 34, 9, 0, 0 },  // 'space' (32)
-    { 39, 11, 34, 11, 0, 0 },  // '!' (33)
-    { 86, 14, 34, 14, 0, 0 },  // '"' (34)
-    { 146, 16, 34, 16, 0, 0 },  // '#' (35)
-    { 214, 16, 34, 16, 0, 0 },  // '$' (36)
-    { 282, 24, 34, 24, 0, 0 },  // '%' (37)
-    { 384, 20, 34, 20, 0, 0 },  // '&' (38)
-    { 469, 8, 34, 8, 0, 0 },  // ''' (39)
-    { 503, 11, 34, 11, 0, 0 },  // '(' (40)
-    { 550, 11, 34, 11, 0, 0 },  // ')' (41)
-    { 597, 12, 34, 12, 0, 0 },  // '*' (42)
-    { 648, 17, 34, 17, 0, 0 },  // '+' (43)
-    { 721, 9, 34, 9, 0, 0 },  // ',' (44)
-    { 760, 11, 34, 11, 0, 0 },  // '-' (45)
-    { 807, 9, 34, 9, 0, 0 },  // '.' (46)
-    { 846, 9, 34, 9, 0, 0 },  // '/' (47)
-    { 885, 16, 34, 16, 0, 0 },  // '0' (48)
-    { 953, 16, 34, 16, 0, 0 },  // '1' (49)
-    { 1021, 16, 34, 16, 0, 0 },  // '2' (50)
-    { 1089, 16, 34, 16, 0, 0 },  // '3' (51)
-    { 1157, 16, 34, 16, 0, 0 },  // '4' (52)
-    { 1225, 16, 34, 16, 0, 0 },  // '5' (53)
-    { 1293, 16, 34, 16, 0, 0 },  // '6' (54)
-    { 1361, 16, 34, 16, 0, 0 },  // '7' (55)
-    { 1429, 16, 34, 16, 0, 0 },  // '8' (56)
-    { 1497, 16, 34, 16, 0, 0 },  // '9' (57)
-    { 1565, 11, 34, 11, 0, 0 },  // ':' (58)
-    { 1612, 11, 34, 11, 0, 0 },  // ';' (59)
-    { 1659, 17, 34, 17, 0, 0 },  // '<' (60)
-    { 1732, 17, 34, 17, 0, 0 },  // '=' (61)
-    { 1805, 17, 34, 17, 0, 0 },  // '>' (62)
-    { 1878, 17, 34, 17, 0, 0 },  // '?' (63)
-    { 1951, 26, 34, 26, 0, 0 },  // '@' (64)
-    { 2062, 20, 34, 20, 0, 0 },  // 'A' (65)
-    { 2147, 20, 34, 20, 0, 0 },  // 'B' (66)
-    { 2232, 20, 34, 20, 0, 0 },  // 'C' (67)
-    { 2317, 20, 34, 20, 0, 0 },  // 'D' (68)
-    { 2402, 19, 34, 19, 0, 0 },  // 'E' (69)
-    { 2483, 17, 34, 17, 0, 0 },  // 'F' (70)
-    { 2556, 21, 34, 21, 0, 0 },  // 'G' (71)
-    { 2646, 20, 34, 20, 0, 0 },  // 'H' (72)
-    { 2731, 9, 34, 9, 0, 0 },  // 'I' (73)
-    { 2770, 16, 34, 16, 0, 0 },  // 'J' (74)
-    { 2838, 20, 34, 20, 0, 0 },  // 'K' (75)
-    { 2923, 17, 34, 17, 0, 0 },  // 'L' (76)
-    { 2996, 23, 34, 23, 0, 0 },  // 'M' (77)
-    { 3094, 20, 34, 20, 0, 0 },  // 'N' (78)
-    { 3179, 21, 34, 21, 0, 0 },  // 'O' (79)
-    { 3269, 19, 34, 19, 0, 0 },  // 'P' (80)
-    { 3350, 21, 34, 21, 0, 0 },  // 'Q' (81)
-    { 3440, 20, 34, 20, 0, 0 },  // 'R' (82)
-    { 3525, 19, 34, 19, 0, 0 },  // 'S' (83)
-    { 3606, 17, 34, 17, 0, 0 },  // 'T' (84)
-    { 3679, 20, 34, 20, 0, 0 },  // 'U' (85)
-    { 3764, 19, 34, 19, 0, 0 },  // 'V' (86)
-    { 3845, 25, 34, 25, 0, 0 },  // 'W' (87)
-    { 3952, 19, 34, 19, 0, 0 },  // 'X' (88)
-    { 4033, 19, 34, 19, 0, 0 },  // 'Y' (89)
-    { 4114, 17, 34, 17, 0, 0 },  // 'Z' (90)
-    { 4187, 11, 34, 11, 0, 0 },  // '[' (91)
-    { 4234, 9, 34, 9, 0, 0 },  // '\' (92)
-    { 4273, 11, 34, 11, 0, 0 },  // ']' (93)
-    { 4320, 17, 34, 17, 0, 0 },  // '^' (94)
-    { 4393, 16, 34, 16, 0, 0 },  // '_' (95)
-    { 4461, 11, 34, 11, 0, 0 },  // '`' (96)
-    { 4508, 16, 34, 16, 0, 0 },  // 'a' (97)
-    { 4576, 17, 34, 17, 0, 0 },  // 'b' (98)
-    { 4649, 16, 34, 16, 0, 0 },  // 'c' (99)
-    { 4717, 17, 34, 17, 0, 0 },  // 'd' (100)
-    { 4790, 16, 34, 16, 0, 0 },  // 'e' (101)
-    { 4858, 11, 34, 11, 0, 0 },  // 'f' (102)
-    { 4905, 17, 34, 17, 0, 0 },  // 'g' (103)
-    { 4978, 17, 34, 17, 0, 0 },  // 'h' (104)
-    { 5051, 9, 34, 9, 0, 0 },  // 'i' (105)
-    { 5090, 9, 34, 9, 0, 0 },  // 'j' (106)
-    { 5129, 16, 34, 16, 0, 0 },  // 'k' (107)
-    { 5197, 9, 34, 9, 0, 0 },  // 'l' (108)
-    { 5236, 24, 34, 24, 0, 0 },  // 'm' (109)
-    { 5338, 17, 34, 17, 0, 0 },  // 'n' (110)
-    { 5411, 17, 34, 17, 0, 0 },  // 'o' (111)
-    { 5484, 17, 34, 17, 0, 0 },  // 'p' (112)
-    { 5557, 17, 34, 17, 0, 0 },  // 'q' (113)
-    { 5630, 12, 34, 12, 0, 0 },  // 'r' (114)
-    { 5681, 16, 34, 16, 0, 0 },  // 's' (115)
-    { 5749, 11, 34, 11, 0, 0 },  // 't' (116)
-    { 5796, 17, 34, 17, 0, 0 },  // 'u' (117)
-    { 5869, 16, 34, 16, 0, 0 },  // 'v' (118)
-    { 5937, 21, 34, 21, 0, 0 },  // 'w' (119)
-    { 6027, 16, 34, 16, 0, 0 },  // 'x' (120)
-    { 6095, 16, 34, 16, 0, 0 },  // 'y' (121)
-    { 6163, 15, 34, 15, 0, 0 },  // 'z' (122)
-    { 6227, 12, 34, 12, 0, 0 },  // '{' (123)
-    { 6278, 9, 34, 9, 0, 0 },  // '|' (124)
-    { 6317, 12, 34, 12, 0, 0 },  // '}' (125)
-    { 6368, 17, 34, 17, 0, 0 }  // '~' (126)
-};
-
-const GFXfont Inter_24B PROGMEM = {
-    (uint8_t*)Inter_24BBitmaps,
-    (GFXglyph*)Inter_24BGlyphs,
-    32, 126, 34
-};
-
-#endif // INTER_24B_H
@@ -0,0 +1,271 @@
+// Inter Font - 16px Regular (Weight 400) (1-bpp source)
+// Generated by scripts/fontgen.py: 2026-10-19
+// Charset: 95 characters, 2459 bytes RLE
+
+#ifndef RLE_INTER_16_H
+#define RLE_INTER_16_H
+
+#include "RleFont.h"
+
+const uint8_t Inter_16Data[] PROGMEM = {
+    0x53, 0x01, 0x41, 0x41, 0x00, 0x43, 0x00, 0x41, 0x00, 0x40, 0x00, 0x41, 0x00, 0x40, 0x01, 0x40,
+    0x02, 0x40, 0x02, 0x40, 0x03, 0x40, 0x02, 0x40, 0x02, 0x41, 0x01, 0x41, 0x02, 0x41, 0x01, 0x41,
+    0x00, 0x48, 0x01, 0x40, 0x02, 0x40, 0x03, 0x40, 0x02, 0x40, 0x02, 0x41, 0x01, 0x41, 0x01, 0x48,
+    0x00, 0x40, 0x02, 0x40, 0x03, 0x40, 0x02, 0x40, 0x03, 0x40, 0x02, 0x40, 0x02, 0x03, 0x40, 0x04,
+    0x44, 0x01, 0x41, 0x00, 0x40, 0x00, 0x41, 0x00, 0x41, 0x00, 0x40, 0x00, 0x41, 0x00, 0x40, 0x01,
+    0x40, 0x03, 0x41, 0x00, 0x40, 0x04, 0x43, 0x05, 0x43, 0x03, 0x40, 0x00, 0x41, 0x03, 0x40, 0x00,
+    0x43, 0x01, 0x40, 0x00, 0x41, 0x00, 0x41, 0x00, 0x40, 0x00, 0x41, 0x01, 0x44, 0x04, 0x40, 0x02,
+    0x00, 0x42, 0x03, 0x41, 0x01, 0x41, 0x00, 0x41, 0x02, 0x40, 0x02, 0x40, 0x01, 0x41, 0x01, 0x41,
+    0x02, 0x40, 0x01, 0x41, 0x01, 0x40, 0x03, 0x41, 0x00, 0x41, 0x00, 0x40, 0x05, 0x42, 0x01, 0x40,
+    0x09, 0x40, 0x01, 0x42, 0x05, 0x40, 0x00, 0x41, 0x00, 0x41, 0x03, 0x40, 0x01, 0x41, 0x01, 0x40,
+    0x03, 0x40, 0x01, 0x41, 0x01, 0x40, 0x02, 0x40, 0x02, 0x41, 0x00, 0x41, 0x01, 0x41, 0x03, 0x42,
+    0x00, 0x01, 0x43, 0x03, 0x41, 0x01, 0x41, 0x02, 0x41, 0x01, 0x41, 0x02, 0x41, 0x01, 0x41, 0x03,
+    0x43, 0x04, 0x42, 0x04, 0x43, 0x03, 0x41, 0x01, 0x41, 0x00, 0x42, 0x03, 0x42, 0x00, 0x41, 0x03,
+    0x41, 0x00, 0x41, 0x02, 0x43, 0x00, 0x44, 0x00, 0x41, 0x43, 0x01, 0x41, 0x01, 0x40, 0x01, 0x41,
+    0x01, 0x40, 0x01, 0x41, 0x01, 0x41, 0x01, 0x41, 0x01, 0x41, 0x01, 0x41, 0x01, 0x41, 0x01, 0x41,
+    0x02, 0x40, 0x02, 0x41, 0x02, 0x40, 0x02, 0x41, 0x40, 0x03, 0x40, 0x02, 0x41, 0x01, 0x41, 0x02,
+    0x41, 0x01, 0x41, 0x01, 0x41, 0x01, 0x41, 0x01, 0x41, 0x01, 0x41, 0x01, 0x40, 0x01, 0x41, 0x01,
+    0x41, 0x01, 0x40, 0x01, 0x41, 0x01, 0x00, 0x41, 0x01, 0x44, 0x00, 0x41, 0x02, 0x42, 0x00, 0x41,
+    0x00, 0x40, 0x00, 0x02, 0x41, 0x05, 0x41, 0x05, 0x41, 0x02, 0x47, 0x02, 0x41, 0x05, 0x41, 0x05,
+    0x41, 0x02, 0x41, 0x00, 0x40, 0x00, 0x41, 0x00, 0x44, 0x41, 0x02, 0x40, 0x02, 0x40, 0x01, 0x41,
+    0x01, 0x41, 0x01, 0x40, 0x02, 0x40, 0x01, 0x41, 0x01, 0x40, 0x02, 0x40, 0x02, 0x40, 0x01, 0x41,
+    0x01, 0x40, 0x02, 0x00, 0x43, 0x02, 0x40, 0x02, 0x40, 0x00, 0x41, 0x02, 0x43, 0x02, 0x42, 0x04,
+    0x41, 0x04, 0x41, 0x04, 0x41, 0x04, 0x42, 0x02, 0x43, 0x02, 0x43, 0x01, 0x41, 0x01, 0x43, 0x01,
+    0x02, 0x40, 0x01, 0x49, 0x01, 0x41, 0x01, 0x41, 0x01, 0x41, 0x01, 0x41, 0x01, 0x41, 0x01, 0x41,
+    0x01, 0x41, 0x01, 0x41, 0x01, 0x44, 0x01, 0x41, 0x02, 0x41, 0x00, 0x40, 0x03, 0x41, 0x05, 0x41,
+    0x05, 0x41, 0x04, 0x41, 0x05, 0x41, 0x04, 0x41, 0x04, 0x41, 0x04, 0x41, 0x04, 0x41, 0x04, 0x47,
+    0x00, 0x43, 0x01, 0x41, 0x01, 0x41, 0x00, 0x41, 0x02, 0x41, 0x04, 0x41, 0x03, 0x41, 0x02, 0x43,
+    0x05, 0x41, 0x04, 0x41, 0x05, 0x42, 0x02, 0x43, 0x02, 0x41, 0x00, 0x44, 0x00, 0x04, 0x41, 0x04,
+    0x42, 0x04, 0x42, 0x03, 0x43, 0x03, 0x40, 0x00, 0x41, 0x02, 0x41, 0x00, 0x41, 0x01, 0x41, 0x01,
+    0x41, 0x01, 0x40, 0x02, 0x41, 0x00, 0x47, 0x04, 0x41, 0x05, 0x41, 0x05, 0x41, 0x00, 0x00, 0x45,
+    0x00, 0x40, 0x04, 0x41, 0x04, 0x41, 0x04, 0x45, 0x00, 0x41, 0x02, 0x41, 0x04, 0x41, 0x05, 0x40,
+    0x05, 0x41, 0x03, 0x43, 0x02, 0x41, 0x00, 0x43, 0x01, 0x02, 0x43, 0x01, 0x41, 0x02, 0x41, 0x00,
+    0x41, 0x02, 0x41, 0x00, 0x40, 0x05, 0x41, 0x00, 0x43, 0x00, 0x42, 0x02, 0x43, 0x03, 0x43, 0x04,
+    0x40, 0x00, 0x40, 0x04, 0x40, 0x00, 0x40, 0x03, 0x41, 0x00, 0x41, 0x02, 0x41, 0x01, 0x44, 0x00,
+    0x46, 0x04, 0x41, 0x03, 0x41, 0x04, 0x41, 0x03, 0x41, 0x04, 0x41, 0x03, 0x41, 0x04, 0x41, 0x04,
+    0x41, 0x04, 0x40, 0x04, 0x41, 0x04, 0x41, 0x03, 0x00, 0x44, 0x00, 0x41, 0x02, 0x43, 0x02, 0x43,
+    0x02, 0x43, 0x02, 0x41, 0x01, 0x42, 0x01, 0x41, 0x02, 0x43, 0x02, 0x42, 0x04, 0x42, 0x02, 0x43,
+    0x02, 0x41, 0x00, 0x44, 0x00, 0x00, 0x43, 0x01, 0x41, 0x02, 0x40, 0x00, 0x41, 0x02, 0x42, 0x04,
+    0x41, 0x04, 0x42, 0x02, 0x43, 0x02, 0x41, 0x00, 0x43, 0x00, 0x40, 0x04, 0x43, 0x02, 0x43, 0x01,
+    0x41, 0x01, 0x43, 0x01, 0x41, 0x0D, 0x41, 0x41, 0x0D, 0x41, 0x00, 0x40, 0x00, 0x41, 0x00, 0x05,
+    0x41, 0x02, 0x42, 0x02, 0x42, 0x03, 0x41, 0x06, 0x42, 0x06, 0x42, 0x07, 0x41, 0x47, 0x17, 0x47,
+    0x40, 0x07, 0x42, 0x06, 0x42, 0x07, 0x41, 0x02, 0x42, 0x02, 0x42, 0x03, 0x40, 0x06, 0x00, 0x44,
+    0x00, 0x41, 0x02, 0x43, 0x02, 0x42, 0x04, 0x40, 0x04, 0x41, 0x04, 0x41, 0x03, 0x41, 0x03, 0x41,
+    0x04, 0x40, 0x04, 0x41, 0x0B, 0x41, 0x02, 0x03, 0x46, 0x06, 0x41, 0x04, 0x41, 0x04, 0x41, 0x06,
+    0x41, 0x02, 0x41, 0x01, 0x45, 0x00, 0x41, 0x00, 0x41, 0x01, 0x41, 0x01, 0x42, 0x01, 0x40, 0x00,
+    0x41, 0x00, 0x41, 0x02, 0x42, 0x01, 0x40, 0x00, 0x40, 0x01, 0x41, 0x03, 0x40, 0x02, 0x40, 0x00,
+    0x40, 0x01, 0x41, 0x02, 0x41, 0x02, 0x40, 0x00, 0x40, 0x01, 0x41, 0x02, 0x41, 0x01, 0x41, 0x00,
+    0x40, 0x01, 0x41, 0x02, 0x41, 0x01, 0x41, 0x00, 0x41, 0x00, 0x41, 0x01, 0x42, 0x00, 0x41, 0x02,
+    0x40, 0x01, 0x42, 0x00, 0x43, 0x03, 0x41, 0x08, 0x42, 0x01, 0x42, 0x05, 0x41, 0x05, 0x46, 0x03,
+    0x03, 0x42, 0x07, 0x42, 0x06, 0x43, 0x06, 0x41, 0x00, 0x41, 0x04, 0x41, 0x01, 0x41, 0x04, 0x41,
+    0x02, 0x40, 0x04, 0x41, 0x02, 0x41, 0x02, 0x47, 0x02, 0x41, 0x04, 0x41, 0x01, 0x40, 0x05, 0x41,
+    0x00, 0x41, 0x05, 0x41, 0x00, 0x41, 0x06, 0x41, 0x46, 0x01, 0x41, 0x03, 0x41, 0x00, 0x41, 0x04,
+    0x40, 0x00, 0x41, 0x04, 0x40, 0x00, 0x41, 0x03, 0x41, 0x00, 0x47, 0x00, 0x41, 0x03, 0x44, 0x04,
+    0x43, 0x04, 0x43, 0x04, 0x43, 0x03, 0x41, 0x00, 0x46, 0x01, 0x02, 0x44, 0x02, 0x41, 0x03, 0x41,
+    0x01, 0x40, 0x05, 0x43, 0x07, 0x41, 0x07, 0x41, 0x07, 0x41, 0x07, 0x41, 0x07, 0x41, 0x05, 0x41,
+    0x00, 0x40, 0x05, 0x41, 0x00, 0x42, 0x02, 0x41, 0x03, 0x44, 0x01, 0x46, 0x02, 0x41, 0x03, 0x41,
+    0x01, 0x41, 0x04, 0x41, 0x00, 0x41, 0x05, 0x40, 0x00, 0x41, 0x05, 0x43, 0x05, 0x43, 0x05, 0x43,
+    0x05, 0x43, 0x05, 0x40, 0x00, 0x41, 0x04, 0x41, 0x00, 0x41, 0x03, 0x41, 0x01, 0x46, 0x02, 0x4A,
+    0x06, 0x41, 0x06, 0x41, 0x06, 0x41, 0x06, 0x47, 0x00, 0x41, 0x06, 0x41, 0x06, 0x41, 0x06, 0x41,
+    0x06, 0x41, 0x06, 0x48, 0x49, 0x05, 0x41, 0x05, 0x41, 0x05, 0x41, 0x05, 0x41, 0x05, 0x46, 0x00,
+    0x41, 0x05, 0x41, 0x05, 0x41, 0x05, 0x41, 0x05, 0x41, 0x05, 0x02, 0x44, 0x03, 0x42, 0x02, 0x42,
+    0x01, 0x41, 0x04, 0x41, 0x00, 0x41, 0x06, 0x40, 0x00, 0x41, 0x08, 0x41, 0x08, 0x41, 0x02, 0x47,
+    0x06, 0x43, 0x06, 0x41, 0x00, 0x41, 0x05, 0x41, 0x01, 0x41, 0x02, 0x42, 0x03, 0x44, 0x02, 0x41,
+    0x05, 0x42, 0x05, 0x42, 0x05, 0x42, 0x05, 0x42, 0x05, 0x4B, 0x05, 0x42, 0x05, 0x42, 0x05, 0x42,
+    0x05, 0x42, 0x05, 0x42, 0x05, 0x40, 0x57, 0x04, 0x41, 0x04, 0x41, 0x04, 0x41, 0x04, 0x41, 0x04,
+    0x41, 0x04, 0x41, 0x04, 0x41, 0x04, 0x43, 0x02, 0x43, 0x02, 0x41, 0x00, 0x41, 0x01, 0x40, 0x02,
+    0x43, 0x00, 0x41, 0x04, 0x44, 0x03, 0x41, 0x01, 0x41, 0x02, 0x41, 0x02, 0x41, 0x01, 0x41, 0x03,
+    0x41, 0x00, 0x41, 0x04, 0x44, 0x04, 0x45, 0x03, 0x41, 0x01, 0x42, 0x02, 0x41, 0x02, 0x41, 0x02,
+    0x41, 0x03, 0x41, 0x01, 0x41, 0x04, 0x41, 0x00, 0x41, 0x04, 0x42, 0x41, 0x05, 0x41, 0x05, 0x41,
+    0x05, 0x41, 0x05, 0x41, 0x05, 0x41, 0x05, 0x41, 0x05, 0x41, 0x05, 0x41, 0x05, 0x41, 0x05, 0x41,
+    0x05, 0x47, 0x41, 0x06, 0x44, 0x04, 0x45, 0x04, 0x46, 0x03, 0x46, 0x02, 0x45, 0x00, 0x40, 0x02,
+    0x40, 0x00, 0x43, 0x00, 0x41, 0x01, 0x40, 0x00, 0x43, 0x00, 0x41, 0x00, 0x41, 0x00, 0x43, 0x01,
+    0x40, 0x00, 0x40, 0x01, 0x43, 0x01, 0x42, 0x01, 0x43, 0x01, 0x42, 0x01, 0x43, 0x01, 0x41, 0x02,
+    0x41, 0x41, 0x05, 0x43, 0x04, 0x44, 0x03, 0x44, 0x03, 0x42, 0x00, 0x41, 0x02, 0x42, 0x00, 0x42,
+    0x01, 0x42, 0x01, 0x41, 0x01, 0x42, 0x02, 0x41, 0x00, 0x42, 0x02, 0x45, 0x03, 0x44, 0x04, 0x43,
+    0x04, 0x41, 0x02, 0x44, 0x03, 0x42, 0x02, 0x41, 0x02, 0x41, 0x04, 0x41, 0x00, 0x41, 0x06, 0x40,
+    0x00, 0x41, 0x06, 0x43, 0x06, 0x43, 0x06, 0x43, 0x06, 0x43, 0x06, 0x40, 0x01, 0x41, 0x04, 0x41,
+    0x01, 0x42, 0x02, 0x41, 0x04, 0x44, 0x02, 0x47, 0x00, 0x41, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43,
+    0x04, 0x43, 0x04, 0x49, 0x00, 0x41, 0x06, 0x41, 0x06, 0x41, 0x06, 0x41, 0x06, 0x41, 0x06, 0x02,
+    0x44, 0x03, 0x41, 0x03, 0x41, 0x01, 0x41, 0x05, 0x41, 0x00, 0x41, 0x06, 0x40, 0x00, 0x40, 0x07,
+    0x42, 0x07, 0x42, 0x07, 0x42, 0x07, 0x43, 0x06, 0x40, 0x00, 0x41, 0x02, 0x41, 0x00, 0x41, 0x01,
+    0x41, 0x02, 0x42, 0x04, 0x47, 0x09, 0x40, 0x47, 0x01, 0x41, 0x04, 0x41, 0x00, 0x41, 0x04, 0x41,
+    0x00, 0x41, 0x05, 0x40, 0x00, 0x41, 0x04, 0x41, 0x00, 0x41, 0x04, 0x41, 0x00, 0x47, 0x01, 0x41,
+    0x02, 0x41, 0x02, 0x41, 0x03, 0x41, 0x01, 0x41, 0x03, 0x42, 0x00, 0x41, 0x04, 0x41, 0x00, 0x41,
+    0x05, 0x41, 0x01, 0x44, 0x02, 0x41, 0x02, 0x41, 0x00, 0x41, 0x04, 0x43, 0x06, 0x42, 0x06, 0x45,
+    0x05, 0x43, 0x07, 0x41, 0x06, 0x43, 0x04, 0x43, 0x04, 0x40, 0x01, 0x45, 0x01, 0x49, 0x03, 0x41,
+    0x07, 0x41, 0x07, 0x41, 0x07, 0x41, 0x07, 0x41, 0x07, 0x41, 0x07, 0x41, 0x07, 0x41, 0x07, 0x41,
+    0x07, 0x41, 0x07, 0x41, 0x03, 0x41, 0x05, 0x42, 0x05, 0x42, 0x05, 0x42, 0x05, 0x42, 0x05, 0x42,
+    0x05, 0x42, 0x05, 0x42, 0x05, 0x42, 0x05, 0x42, 0x04, 0x41, 0x00, 0x41, 0x03, 0x41, 0x01, 0x44,
+    0x01, 0x41, 0x06, 0x43, 0x05, 0x41, 0x01, 0x41, 0x04, 0x41, 0x01, 0x41, 0x04, 0x41, 0x01, 0x41,
+    0x03, 0x41, 0x03, 0x41, 0x02, 0x41, 0x03, 0x41, 0x02, 0x40, 0x05, 0x41, 0x00, 0x41, 0x05, 0x41,
+    0x00, 0x41, 0x05, 0x43, 0x07, 0x42, 0x07, 0x41, 0x04, 0x41, 0x03, 0x42, 0x03, 0x43, 0x03, 0x42,
+    0x03, 0x41, 0x00, 0x40, 0x03, 0x42, 0x03, 0x41, 0x00, 0x41, 0x02, 0x40, 0x00, 0x41, 0x02, 0x40,
+    0x01, 0x41, 0x01, 0x41, 0x00, 0x41, 0x01, 0x41, 0x01, 0x41, 0x01, 0x41, 0x01, 0x40, 0x01, 0x41,
+    0x02, 0x40, 0x01, 0x41, 0x01, 0x41, 0x00, 0x41, 0x02, 0x41, 0x00, 0x40, 0x02, 0x41, 0x00, 0x40,
+    0x03, 0x43, 0x02, 0x43, 0x03, 0x43, 0x03, 0x42, 0x04, 0x41, 0x04, 0x42, 0x04, 0x41, 0x04, 0x41,
+    0x02, 0x42, 0x04, 0x41, 0x01, 0x42, 0x02, 0x41, 0x03, 0x41, 0x02, 0x41, 0x04, 0x41, 0x00, 0x41,
+    0x05, 0x43, 0x07, 0x42, 0x07, 0x42, 0x06, 0x44, 0x04, 0x41, 0x01, 0x41, 0x04, 0x41, 0x02, 0x41,
+    0x02, 0x41, 0x03, 0x42, 0x00, 0x41, 0x05, 0x42, 0x41, 0x05, 0x41, 0x00, 0x41, 0x04, 0x41, 0x00,
+    0x42, 0x02, 0x41, 0x02, 0x41, 0x01, 0x41, 0x04, 0x41, 0x00, 0x41, 0x04, 0x43, 0x06, 0x41, 0x07,
+    0x41, 0x07, 0x41, 0x07, 0x41, 0x07, 0x41, 0x07, 0x41, 0x03, 0x00, 0x47, 0x07, 0x41, 0x06, 0x41,
+    0x06, 0x42, 0x06, 0x41, 0x06, 0x41, 0x06, 0x41, 0x07, 0x41, 0x06, 0x41, 0x06, 0x41, 0x06, 0x42,
+    0x06, 0x49, 0x44, 0x00, 0x41, 0x00, 0x41, 0x00, 0x41, 0x00, 0x41, 0x00, 0x41, 0x00, 0x41, 0x00,
+    0x41, 0x00, 0x41, 0x00, 0x41, 0x00, 0x41, 0x00, 0x41, 0x00, 0x41, 0x00, 0x42, 0x41, 0x03, 0x40,
+    0x03, 0x40, 0x03, 0x41, 0x02, 0x41, 0x03, 0x40, 0x03, 0x40, 0x03, 0x41, 0x03, 0x40, 0x03, 0x40,
+    0x03, 0x40, 0x03, 0x41, 0x43, 0x01, 0x41, 0x01, 0x41, 0x01, 0x41, 0x01, 0x41, 0x01, 0x41, 0x01,
+    0x41, 0x01, 0x41, 0x01, 0x41, 0x01, 0x41, 0x01, 0x41, 0x01, 0x41, 0x01, 0x41, 0x01, 0x45, 0x02,
+    0x41, 0x03, 0x42, 0x03, 0x40, 0x00, 0x40, 0x02, 0x41, 0x00, 0x41, 0x01, 0x41, 0x01, 0x40, 0x00,
+    0x41, 0x02, 0x41, 0x48, 0x41, 0x01, 0x41, 0x01, 0x44, 0x01, 0x41, 0x02, 0x41, 0x00, 0x41, 0x02,
+    0x41, 0x03, 0x43, 0x00, 0x43, 0x00, 0x41, 0x00, 0x40, 0x03, 0x43, 0x03, 0x41, 0x00, 0x41, 0x01,
+    0x42, 0x00, 0x46, 0x41, 0x04, 0x41, 0x04, 0x41, 0x04, 0x45, 0x00, 0x42, 0x01, 0x43, 0x02, 0x43,
+    0x03, 0x42, 0x03, 0x42, 0x03, 0x42, 0x02, 0x43, 0x02, 0x47, 0x00, 0x01, 0x44, 0x01, 0x41, 0x02,
+    0x41, 0x00, 0x41, 0x05, 0x40, 0x05, 0x41, 0x05, 0x41, 0x06, 0x41, 0x05, 0x41, 0x02, 0x41, 0x01,
+    0x44, 0x00, 0x05, 0x41, 0x05, 0x41, 0x05, 0x41, 0x01, 0x45, 0x00, 0x41, 0x01, 0x42, 0x00, 0x40,
+    0x03, 0x43, 0x03, 0x43, 0x03, 0x43, 0x03, 0x41, 0x00, 0x41, 0x02, 0x41, 0x00, 0x41, 0x01, 0x42,
+    0x01, 0x45, 0x01, 0x44, 0x01, 0x41, 0x02, 0x41, 0x00, 0x41, 0x02, 0x41, 0x00, 0x40, 0x04, 0x4A,
+    0x06, 0x41, 0x02, 0x41, 0x00, 0x41, 0x02, 0x41, 0x01, 0x44, 0x00, 0x01, 0x42, 0x00, 0x41, 0x02,
+    0x41, 0x01, 0x44, 0x00, 0x41, 0x02, 0x41, 0x02, 0x41, 0x02, 0x41, 0x02, 0x41, 0x02, 0x41, 0x02,
+    0x41, 0x02, 0x41, 0x01, 0x01, 0x45, 0x00, 0x41, 0x01, 0x42, 0x00, 0x40, 0x03, 0x43, 0x03, 0x43,
+    0x03, 0x43, 0x03, 0x41, 0x00, 0x40, 0x03, 0x41, 0x00, 0x41, 0x01, 0x42, 0x01, 0x45, 0x05, 0x41,
+    0x00, 0x41, 0x01, 0x41, 0x01, 0x44, 0x01, 0x41, 0x04, 0x41, 0x04, 0x41, 0x04, 0x45, 0x00, 0x42,
+    0x01, 0x43, 0x02, 0x43, 0x02, 0x43, 0x02, 0x43, 0x02, 0x43, 0x02, 0x43, 0x02, 0x43, 0x02, 0x41,
+    0x41, 0x03, 0x51, 0x01, 0x41, 0x09, 0x41, 0x01, 0x41, 0x01, 0x41, 0x01, 0x41, 0x01, 0x41, 0x01,
+    0x41, 0x01, 0x41, 0x01, 0x41, 0x01, 0x41, 0x01, 0x41, 0x01, 0x40, 0x00, 0x42, 0x00, 0x41, 0x04,
+    0x41, 0x04, 0x41, 0x04, 0x41, 0x01, 0x44, 0x00, 0x41, 0x01, 0x43, 0x02, 0x43, 0x02, 0x43, 0x02,
+    0x41, 0x00, 0x41, 0x01, 0x41, 0x01, 0x41, 0x00, 0x41, 0x01, 0x41, 0x00, 0x41, 0x02, 0x41, 0x57,
+    0x45, 0x00, 0x43, 0x00, 0x41, 0x01, 0x42, 0x01, 0x41, 0x00, 0x41, 0x02, 0x41, 0x02, 0x40, 0x00,
+    0x41, 0x02, 0x41, 0x02, 0x43, 0x02, 0x41, 0x02, 0x43, 0x02, 0x41, 0x02, 0x43, 0x02, 0x41, 0x02,
+    0x43, 0x02, 0x41, 0x02, 0x43, 0x02, 0x41, 0x02, 0x41, 0x45, 0x00, 0x42, 0x01, 0x43, 0x02, 0x43,
+    0x02, 0x43, 0x02, 0x43, 0x02, 0x43, 0x02, 0x43, 0x02, 0x43, 0x02, 0x41, 0x01, 0x44, 0x01, 0x41,
+    0x02, 0x41, 0x00, 0x41, 0x02, 0x43, 0x04, 0x42, 0x04, 0x42, 0x04, 0x40, 0x00, 0x41, 0x02, 0x41,
+    0x00, 0x41, 0x02, 0x41, 0x01, 0x44, 0x00, 0x45, 0x00, 0x42, 0x01, 0x43, 0x02, 0x43, 0x03, 0x42,
+    0x03, 0x42, 0x03, 0x42, 0x02, 0x43, 0x02, 0x47, 0x00, 0x41, 0x04, 0x41, 0x04, 0x41, 0x04, 0x01,
+    0x45, 0x00, 0x41, 0x01, 0x42, 0x00, 0x40, 0x03, 0x43, 0x03, 0x43, 0x03, 0x43, 0x03, 0x41, 0x00,
+    0x41, 0x02, 0x41, 0x00, 0x41, 0x01, 0x42, 0x01, 0x45, 0x05, 0x41, 0x05, 0x41, 0x05, 0x41, 0x46,
+    0x02, 0x41, 0x02, 0x41, 0x02, 0x41, 0x02, 0x41, 0x02, 0x41, 0x02, 0x41, 0x02, 0x41, 0x02, 0x01,
+    0x43, 0x02, 0x41, 0x01, 0x41, 0x01, 0x40, 0x06, 0x42, 0x05, 0x44, 0x05, 0x41, 0x06, 0x43, 0x02,
+    0x41, 0x01, 0x44, 0x01, 0x01, 0x40, 0x01, 0x41, 0x01, 0x41, 0x00, 0x43, 0x00, 0x41, 0x01, 0x41,
+    0x01, 0x41, 0x01, 0x41, 0x01, 0x41, 0x01, 0x41, 0x01, 0x41, 0x02, 0x41, 0x41, 0x02, 0x43, 0x02,
+    0x43, 0x02, 0x43, 0x02, 0x43, 0x02, 0x43, 0x02, 0x43, 0x02, 0x43, 0x01, 0x42, 0x00, 0x45, 0x41,
+    0x03, 0x41, 0x00, 0x40, 0x03, 0x41, 0x00, 0x41, 0x01, 0x41, 0x01, 0x41, 0x01, 0x41, 0x02, 0x40,
+    0x01, 0x41, 0x02, 0x43, 0x03, 0x43, 0x04, 0x42, 0x04, 0x41, 0x02, 0x41, 0x02, 0x41, 0x02, 0x42,
+    0x02, 0x41, 0x01, 0x41, 0x00, 0x40, 0x01, 0x42, 0x01, 0x41, 0x00, 0x41, 0x00, 0x42, 0x01, 0x41,
+    0x00, 0x41, 0x00, 0x40, 0x00, 0x41, 0x00, 0x40, 0x01, 0x41, 0x00, 0x40, 0x00, 0x43, 0x02, 0x42,
+    0x01, 0x42, 0x02, 0x41, 0x02, 0x41, 0x03, 0x41, 0x02, 0x41, 0x01, 0x41, 0x02, 0x42, 0x00, 0x41,
+    0x01, 0x41, 0x02, 0x43, 0x03, 0x43, 0x04, 0x41, 0x04, 0x43, 0x03, 0x43, 0x02, 0x41, 0x01, 0x41,
+    0x00, 0x41, 0x03, 0x41, 0x41, 0x03, 0x41, 0x00, 0x41, 0x02, 0x40, 0x01, 0x41, 0x01, 0x41, 0x01,
+    0x41, 0x01, 0x41, 0x02, 0x41, 0x00, 0x40, 0x03, 0x43, 0x03, 0x43, 0x04, 0x41, 0x05, 0x41, 0x05,
+    0x41, 0x05, 0x40, 0x04, 0x42, 0x03, 0x47, 0x04, 0x41, 0x04, 0x41, 0x05, 0x41, 0x04, 0x41, 0x04,
+    0x41, 0x04, 0x41, 0x04, 0x41, 0x05, 0x47, 0x02, 0x41, 0x01, 0x41, 0x02, 0x41, 0x02, 0x41, 0x02,
+    0x41, 0x02, 0x40, 0x02, 0x41, 0x01, 0x41, 0x03, 0x41, 0x03, 0x40, 0x03, 0x41, 0x02, 0x41, 0x02,
+    0x41, 0x02, 0x41, 0x03, 0x41, 0x5D, 0x42, 0x03, 0x40, 0x03, 0x40, 0x03, 0x41, 0x02, 0x41, 0x02,
+    0x41, 0x02, 0x41, 0x03, 0x41, 0x01, 0x41, 0x02, 0x41, 0x02, 0x41, 0x02, 0x41, 0x02, 0x41, 0x02,
+    0x40, 0x01, 0x42, 0x01, 0x00, 0x43, 0x02, 0x41, 0x02, 0x43, 0x00,
+};
+
+const RleGlyph Inter_16Glyphs[] PROGMEM = {
+    { 0, 32, 0, 0, 7, 0, 0 },  // 'space'
+    { 0, 33, 2, 12, 7, 2, 1 },  // '!'
+    { 3, 34, 5, 4, 8, 1, 1 },  // '"'
+    { 16, 35, 9, 12, 11, 1, 1 },  // '#'
+    { 61, 36, 8, 14, 11, 1, 0 },  // '$'
+    { 112, 37, 12, 12, 17, 2, 1 },  // '%'
+    { 177, 38, 9, 12, 13, 2, 1 },  // '&'
+    { 217, 39, 1, 4, 6, 2, 1 },  // '''
+    { 218, 40, 4, 15, 8, 2, 1 },  // '('
+    { 248, 41, 4, 15, 8, 2, 1 },  // ')'
+    { 278, 42, 5, 5, 9, 2, 1 },  // '*'
+    { 291, 43, 8, 7, 12, 2, 4 },  // '+'
+    { 306, 44, 2, 4, 7, 2, 12 },  // ','
+    { 312, 45, 5, 1, 8, 1, 9 },  // '-'
+    { 313, 46, 2, 1, 7, 2, 12 },  // '.'
+    { 314, 47, 4, 12, 7, 1, 1 },  // '/'
+    { 339, 48, 7, 12, 11, 2, 1 },  // '0'
+    { 368, 49, 4, 12, 11, 3, 1 },  // '1'
+    { 388, 50, 8, 12, 11, 1, 1 },  // '2'
+    { 416, 51, 7, 12, 11, 2, 1 },  // '3'
+    { 445, 52, 8, 12, 11, 1, 1 },  // '4'
+    { 478, 53, 7, 12, 11, 2, 1 },  // '5'
+    { 505, 54, 8, 12, 11, 1, 1 },  // '6'
+    { 544, 55, 7, 12, 11, 2, 1 },  // '7'
+    { 568, 56, 7, 12, 11, 2, 1 },  // '8'
+    { 597, 57, 7, 12, 11, 2, 1 },  // '9'
+    { 628, 58, 2, 9, 7, 2, 4 },  // ':'
+    { 631, 59, 2, 12, 7, 2, 4 },  // ';'
+    { 639, 60, 8, 7, 12, 2, 4 },  // '<'
+    { 653, 61, 8, 5, 12, 2, 5 },  // '='
+    { 656, 62, 8, 7, 12, 2, 4 },  // '>'
+    { 670, 63, 7, 12, 11, 2, 1 },  // '?'
+    { 695, 64, 15, 15, 19, 2, 1 },  // '@'
+    { 784, 65, 11, 12, 13, 1, 1 },  // 'A'
+    { 824, 66, 9, 12, 13, 2, 1 },  // 'B'
+    { 858, 67, 10, 12, 14, 2, 1 },  // 'C'
+    { 891, 68, 10, 12, 14, 2, 1 },  // 'D'
+    { 927, 69, 9, 12, 13, 2, 1 },  // 'E'
+    { 948, 70, 8, 12, 12, 2, 1 },  // 'F'
+    { 970, 71, 11, 12, 15, 2, 1 },  // 'G'
+    { 1007, 72, 9, 12, 14, 2, 1 },  // 'H'
+    { 1030, 73, 2, 12, 7, 2, 1 },  // 'I'
+    { 1031, 74, 7, 12, 10, 1, 1 },  // 'J'
+    { 1058, 75, 10, 12, 13, 2, 1 },  // 'K'
+    { 1099, 76, 8, 12, 11, 2, 1 },  // 'L'
+    { 1122, 77, 11, 12, 16, 2, 1 },  // 'M'
+    { 1169, 78, 9, 12, 14, 2, 1 },  // 'N'
+    { 1202, 79, 11, 12, 15, 2, 1 },  // 'O'
+    { 1239, 80, 9, 12, 13, 2, 1 },  // 'P'
+    { 1263, 81, 11, 13, 15, 2, 1 },  // 'Q'
+    { 1303, 82, 10, 12, 14, 2, 1 },  // 'R'
+    { 1346, 83, 9, 12, 13, 2, 1 },  // 'S'
+    { 1373, 84, 10, 12, 12, 1, 1 },  // 'T'
+    { 1397, 85, 9, 12, 14, 2, 1 },  // 'U'
+    { 1425, 86, 11, 12, 13, 1, 1 },  // 'V'
+    { 1465, 87, 15, 12, 18, 1, 1 },  // 'W'
+    { 1537, 88, 11, 12, 13, 1, 1 },  // 'X'
+    { 1576, 89, 10, 12, 13, 1, 1 },  // 'Y'
+    { 1610, 90, 10, 12, 12, 1, 1 },  // 'Z'
+    { 1634, 91, 3, 15, 7, 2, 1 },  // '['
+    { 1661, 92, 5, 12, 7, 1, 1 },  // '\\'
+    { 1684, 93, 4, 15, 7, 1, 1 },  // ']'
+    { 1711, 94, 7, 6, 10, 1, 1 },  // '^'
+    { 1731, 95, 9, 1, 11, 1, 15 },  // '_'
+    { 1732, 96, 3, 2, 8, 2, 1 },  // '`'
+    { 1735, 97, 8, 9, 11, 1, 4 },  // 'a'
+    { 1763, 98, 7, 12, 11, 2, 1 },  // 'b'
+    { 1787, 99, 8, 9, 10, 1, 4 },  // 'c'
+    { 1810, 100, 8, 12, 11, 1, 1 },  // 'd'
+    { 1842, 101, 8, 9, 11, 1, 4 },  // 'e'
+    { 1867, 102, 5, 12, 7, 1, 1 },  // 'f'
+    { 1892, 103, 8, 12, 11, 1, 4 },  // 'g'
+    { 1927, 104, 7, 12, 11, 2, 1 },  // 'h'
+    { 1952, 105, 2, 12, 6, 2, 1 },  // 'i'
+    { 1955, 106, 4, 15, 6, 0, 1 },  // 'j'
+    { 1982, 107, 7, 12, 10, 2, 1 },  // 'k'
+    { 2015, 108, 2, 12, 6, 2, 1 },  // 'l'
+    { 2016, 109, 12, 9, 16, 2, 4 },  // 'm'
+    { 2057, 110, 7, 9, 11, 2, 4 },  // 'n'
+    { 2076, 111, 8, 9, 11, 1, 4 },  // 'o'
+    { 2103, 112, 7, 12, 11, 2, 4 },  // 'p'
+    { 2127, 113, 8, 12, 11, 1, 4 },  // 'q'
+    { 2159, 114, 5, 9, 8, 2, 4 },  // 'r'
+    { 2175, 115, 8, 9, 10, 1, 4 },  // 's'
+    { 2196, 116, 4, 12, 7, 1, 1 },  // 't'
+    { 2220, 117, 7, 9, 11, 2, 4 },  // 'u'
+    { 2239, 118, 8, 9, 10, 1, 4 },  // 'v'
+    { 2267, 119, 11, 9, 14, 1, 4 },  // 'w'
+    { 2315, 120, 8, 9, 10, 1, 4 },  // 'x'
+    { 2340, 121, 8, 12, 10, 1, 4 },  // 'y'
+    { 2374, 122, 8, 9, 10, 1, 4 },  // 'z'
+    { 2391, 123, 5, 15, 8, 1, 1 },  // '{'
+    { 2421, 124, 2, 15, 7, 2, 1 },  // '|'
+    { 2422, 125, 5, 15, 8, 1, 1 },  // '}'
+    { 2452, 126, 9, 2, 12, 1, 6 },  // '~'
+};
+
+const RleFont Inter_16 PROGMEM = {
+    Inter_16Data,
+    Inter_16Glyphs,
+    95, 23, 0, 23
+};
+
+#endif // RLE_INTER_16_H
@@ -0,0 +1,255 @@
+// Inter Font - 16px SemiBold (Weight 600) (1-bpp source)
+// Generated by scripts/fontgen.py: 2026-10-19
+// Charset: 95 characters, 2202 bytes RLE
+
+#ifndef RLE_INTER_16B_H
+#define RLE_INTER_16B_H
+
+#include "RleFont.h"
+
+const uint8_t Inter_16BData[] PROGMEM = {
+    0x51, 0x00, 0x40, 0x01, 0x40, 0x01, 0x40, 0x03, 0x45, 0x41, 0x00, 0x44, 0x00, 0x44, 0x00, 0x44,
+    0x01, 0x41, 0x02, 0x41, 0x00, 0x41, 0x03, 0x41, 0x00, 0x41, 0x02, 0x42, 0x00, 0x41, 0x00, 0x51,
+    0x01, 0x41, 0x00, 0x41, 0x03, 0x41, 0x00, 0x41, 0x01, 0x51, 0x00, 0x41, 0x00, 0x42, 0x02, 0x41,
+    0x00, 0x41, 0x03, 0x41, 0x00, 0x41, 0x02, 0x03, 0x40, 0x04, 0x44, 0x01, 0x46, 0x00, 0x41, 0x00,
+    0x43, 0x00, 0x41, 0x00, 0x40, 0x03, 0x43, 0x03, 0x45, 0x03, 0x44, 0x03, 0x40, 0x00, 0x44, 0x00,
+    0x40, 0x00, 0x41, 0x00, 0x43, 0x00, 0x41, 0x00, 0x46, 0x01, 0x44, 0x04, 0x40, 0x02, 0x43, 0x03,
+    0x41, 0x01, 0x41, 0x00, 0x41, 0x01, 0x41, 0x02, 0x41, 0x00, 0x41, 0x01, 0x41, 0x02, 0x41, 0x00,
+    0x41, 0x00, 0x41, 0x03, 0x41, 0x00, 0x41, 0x00, 0x41, 0x03, 0x43, 0x00, 0x41, 0x09, 0x41, 0x00,
+    0x42, 0x04, 0x41, 0x00, 0x41, 0x00, 0x41, 0x03, 0x41, 0x00, 0x41, 0x00, 0x41, 0x02, 0x41, 0x01,
+    0x41, 0x00, 0x41, 0x02, 0x41, 0x01, 0x41, 0x00, 0x41, 0x01, 0x41, 0x03, 0x42, 0x00, 0x01, 0x43,
+    0x04, 0x45, 0x03, 0x42, 0x00, 0x42, 0x02, 0x42, 0x00, 0x42, 0x03, 0x44, 0x04, 0x43, 0x03, 0x45,
+    0x00, 0x40, 0x01, 0x41, 0x01, 0x44, 0x00, 0x41, 0x02, 0x43, 0x00, 0x42, 0x01, 0x43, 0x00, 0x49,
+    0x00, 0x44, 0x01, 0x41, 0x47, 0x00, 0x42, 0x00, 0x41, 0x01, 0x41, 0x00, 0x42, 0x00, 0x41, 0x01,
+    0x41, 0x01, 0x41, 0x01, 0x41, 0x01, 0x41, 0x01, 0x41, 0x01, 0x41, 0x01, 0x42, 0x01, 0x41, 0x01,
+    0x41, 0x01, 0x42, 0x41, 0x01, 0x41, 0x01, 0x42, 0x01, 0x41, 0x01, 0x41, 0x01, 0x42, 0x00, 0x42,
+    0x00, 0x42, 0x00, 0x42, 0x00, 0x42, 0x00, 0x41, 0x01, 0x41, 0x00, 0x42, 0x00, 0x41, 0x01, 0x41,
+    0x01, 0x01, 0x41, 0x01, 0x45, 0x01, 0x41, 0x01, 0x42, 0x00, 0x41, 0x02, 0x42, 0x05, 0x42, 0x05,
+    0x42, 0x02, 0x51, 0x02, 0x42, 0x05, 0x42, 0x05, 0x42, 0x02, 0x45, 0x00, 0x41, 0x00, 0x40, 0x00,
+    0x40, 0x01, 0x47, 0x45, 0x01, 0x41, 0x01, 0x41, 0x01, 0x41, 0x01, 0x41, 0x01, 0x41, 0x00, 0x41,
+    0x01, 0x41, 0x01, 0x41, 0x01, 0x41, 0x00, 0x41, 0x01, 0x41, 0x01, 0x41, 0x01, 0x00, 0x43, 0x01,
+    0x45, 0x00, 0x42, 0x00, 0x44, 0x02, 0x43, 0x02, 0x43, 0x02, 0x43, 0x02, 0x43, 0x02, 0x43, 0x02,
+    0x44, 0x00, 0x48, 0x01, 0x43, 0x01, 0x02, 0x42, 0x01, 0x43, 0x00, 0x4C, 0x00, 0x42, 0x02, 0x42,
+    0x02, 0x42, 0x02, 0x42, 0x02, 0x42, 0x02, 0x42, 0x02, 0x42, 0x02, 0x42, 0x01, 0x44, 0x01, 0x46,
+    0x00, 0x42, 0x00, 0x42, 0x00, 0x41, 0x02, 0x41, 0x05, 0x41, 0x04, 0x42, 0x03, 0x42, 0x03, 0x42,
+    0x03, 0x42, 0x03, 0x42, 0x04, 0x4E, 0x01, 0x43, 0x02, 0x46, 0x00, 0x41, 0x01, 0x42, 0x04, 0x42,
+    0x03, 0x42, 0x04, 0x42, 0x05, 0x42, 0x05, 0x44, 0x02, 0x41, 0x00, 0x42, 0x00, 0x42, 0x00, 0x46,
+    0x01, 0x43, 0x01, 0x04, 0x41, 0x05, 0x42, 0x04, 0x43, 0x04, 0x43, 0x03, 0x44, 0x03, 0x41, 0x00,
+    0x41, 0x02, 0x41, 0x01, 0x41, 0x01, 0x42, 0x01, 0x41, 0x01, 0x51, 0x04, 0x41, 0x06, 0x41, 0x01,
+    0x00, 0x45, 0x01, 0x45, 0x01, 0x41, 0x04, 0x42, 0x04, 0x45, 0x01, 0x46, 0x00, 0x41, 0x01, 0x42,
+    0x05, 0x44, 0x02, 0x45, 0x00, 0x42, 0x00, 0x46, 0x01, 0x44, 0x01, 0x01, 0x43, 0x01, 0x48, 0x00,
+    0x44, 0x04, 0x45, 0x00, 0x49, 0x00, 0x44, 0x02, 0x43, 0x02, 0x44, 0x00, 0x42, 0x00, 0x45, 0x01,
+    0x43, 0x00, 0x4F, 0x04, 0x42, 0x03, 0x42, 0x04, 0x42, 0x03, 0x42, 0x04, 0x42, 0x04, 0x41, 0x04,
+    0x42, 0x04, 0x42, 0x04, 0x42, 0x04, 0x42, 0x02, 0x00, 0x44, 0x00, 0x49, 0x00, 0x44, 0x01, 0x45,
+    0x00, 0x42, 0x00, 0x44, 0x00, 0x45, 0x00, 0x41, 0x01, 0x44, 0x02, 0x43, 0x01, 0x49, 0x00, 0x44,
+    0x00, 0x01, 0x43, 0x02, 0x45, 0x01, 0x41, 0x01, 0x45, 0x02, 0x44, 0x02, 0x41, 0x00, 0x41, 0x01,
+    0x42, 0x00, 0x46, 0x01, 0x45, 0x05, 0x41, 0x00, 0x41, 0x01, 0x42, 0x00, 0x45, 0x02, 0x43, 0x01,
+    0x45, 0x0E, 0x45, 0x45, 0x0E, 0x45, 0x00, 0x41, 0x00, 0x43, 0x00, 0x06, 0x41, 0x04, 0x43, 0x02,
+    0x44, 0x01, 0x43, 0x03, 0x42, 0x06, 0x43, 0x06, 0x44, 0x05, 0x43, 0x06, 0x41, 0x51, 0x08, 0x51,
+    0x41, 0x06, 0x43, 0x06, 0x43, 0x06, 0x44, 0x05, 0x42, 0x03, 0x44, 0x01, 0x43, 0x02, 0x43, 0x04,
+    0x41, 0x06, 0x01, 0x43, 0x02, 0x49, 0x01, 0x44, 0x03, 0x41, 0x04, 0x42, 0x03, 0x42, 0x03, 0x42,
+    0x04, 0x41, 0x04, 0x42, 0x0C, 0x42, 0x04, 0x42, 0x02, 0x04, 0x45, 0x07, 0x49, 0x04, 0x43, 0x04,
+    0x42, 0x03, 0x41, 0x01, 0x42, 0x00, 0x44, 0x01, 0x41, 0x01, 0x46, 0x00, 0x41, 0x01, 0x41, 0x00,
+    0x42, 0x01, 0x42, 0x00, 0x41, 0x00, 0x41, 0x01, 0x41, 0x02, 0x41, 0x01, 0x41, 0x00, 0x41, 0x00,
+    0x42, 0x02, 0x41, 0x01, 0x41, 0x00, 0x41, 0x00, 0x42, 0x02, 0x41, 0x01, 0x41, 0x00, 0x41, 0x00,
+    0x42, 0x01, 0x42, 0x00, 0x41, 0x02, 0x40, 0x01, 0x49, 0x02, 0x41, 0x01, 0x42, 0x00, 0x42, 0x04,
+    0x42, 0x08, 0x42, 0x01, 0x43, 0x04, 0x43, 0x03, 0x4A, 0x06, 0x46, 0x03, 0x03, 0x42, 0x06, 0x44,
+    0x05, 0x44, 0x05, 0x41, 0x00, 0x42, 0x03, 0x42, 0x00, 0x42, 0x03, 0x42, 0x01, 0x41, 0x03, 0x41,
+    0x02, 0x42, 0x01, 0x48, 0x01, 0x48, 0x01, 0x41, 0x04, 0x45, 0x04, 0x45, 0x04, 0x42, 0x47, 0x01,
+    0x48, 0x00, 0x41, 0x04, 0x44, 0x04, 0x44, 0x04, 0x41, 0x00, 0x48, 0x00, 0x48, 0x00, 0x41, 0x04,
+    0x44, 0x04, 0x44, 0x04, 0x54, 0x01, 0x01, 0x45, 0x02, 0x47, 0x00, 0x42, 0x02, 0x46, 0x03, 0x41,
+    0x00, 0x41, 0x07, 0x41, 0x07, 0x41, 0x07, 0x41, 0x07, 0x42, 0x03, 0x41, 0x00, 0x42, 0x02, 0x43,
+    0x00, 0x47, 0x02, 0x45, 0x01, 0x46, 0x02, 0x48, 0x00, 0x41, 0x03, 0x42, 0x00, 0x41, 0x04, 0x44,
+    0x04, 0x44, 0x04, 0x44, 0x04, 0x44, 0x04, 0x44, 0x04, 0x44, 0x03, 0x42, 0x00, 0x48, 0x00, 0x46,
+    0x02, 0x53, 0x06, 0x41, 0x06, 0x41, 0x06, 0x47, 0x00, 0x47, 0x00, 0x41, 0x06, 0x41, 0x06, 0x41,
+    0x06, 0x51, 0x51, 0x05, 0x41, 0x05, 0x41, 0x05, 0x51, 0x05, 0x41, 0x05, 0x41, 0x05, 0x41, 0x05,
+    0x41, 0x05, 0x02, 0x44, 0x03, 0x48, 0x00, 0x43, 0x02, 0x42, 0x00, 0x42, 0x04, 0x40, 0x01, 0x41,
+    0x08, 0x41, 0x08, 0x41, 0x02, 0x47, 0x02, 0x48, 0x04, 0x46, 0x02, 0x43, 0x00, 0x48, 0x03, 0x44,
+    0x02, 0x41, 0x04, 0x44, 0x04, 0x44, 0x04, 0x44, 0x04, 0x44, 0x04, 0x58, 0x04, 0x44, 0x04, 0x44,
+    0x04, 0x44, 0x04, 0x44, 0x04, 0x42, 0x63, 0x04, 0x42, 0x04, 0x42, 0x04, 0x42, 0x04, 0x42, 0x04,
+    0x42, 0x04, 0x42, 0x04, 0x42, 0x04, 0x45, 0x01, 0x45, 0x01, 0x42, 0x00, 0x45, 0x02, 0x43, 0x01,
+    0x41, 0x03, 0x45, 0x03, 0x42, 0x00, 0x41, 0x02, 0x42, 0x01, 0x41, 0x01, 0x42, 0x02, 0x41, 0x00,
+    0x42, 0x03, 0x46, 0x02, 0x46, 0x02, 0x42, 0x01, 0x42, 0x01, 0x41, 0x02, 0x43, 0x00, 0x41, 0x03,
+    0x42, 0x00, 0x41, 0x04, 0x44, 0x04, 0x42, 0x41, 0x06, 0x41, 0x06, 0x41, 0x06, 0x41, 0x06, 0x41,
+    0x06, 0x41, 0x06, 0x41, 0x06, 0x41, 0x06, 0x41, 0x06, 0x41, 0x06, 0x51, 0x43, 0x03, 0x47, 0x02,
+    0x48, 0x02, 0x49, 0x01, 0x49, 0x01, 0x46, 0x00, 0x41, 0x00, 0x47, 0x00, 0x41, 0x00, 0x41, 0x00,
+    0x44, 0x00, 0x44, 0x00, 0x44, 0x01, 0x43, 0x00, 0x44, 0x01, 0x43, 0x00, 0x44, 0x01, 0x42, 0x01,
+    0x44, 0x01, 0x42, 0x01, 0x42, 0x42, 0x03, 0x44, 0x03, 0x45, 0x02, 0x46, 0x01, 0x46, 0x01, 0x43,
+    0x00, 0x42, 0x00, 0x43, 0x00, 0x42, 0x00, 0x43, 0x01, 0x46, 0x02, 0x45, 0x02, 0x45, 0x03, 0x44,
+    0x03, 0x42, 0x01, 0x45, 0x03, 0x47, 0x01, 0x43, 0x02, 0x42, 0x00, 0x42, 0x04, 0x44, 0x05, 0x44,
+    0x05, 0x44, 0x05, 0x44, 0x05, 0x45, 0x04, 0x46, 0x02, 0x42, 0x01, 0x47, 0x04, 0x44, 0x02, 0x47,
+    0x00, 0x4A, 0x03, 0x44, 0x04, 0x43, 0x03, 0x52, 0x01, 0x41, 0x06, 0x41, 0x06, 0x41, 0x06, 0x41,
+    0x06, 0x41, 0x06, 0x02, 0x44, 0x03, 0x47, 0x01, 0x43, 0x02, 0x42, 0x00, 0x42, 0x04, 0x44, 0x05,
+    0x44, 0x05, 0x44, 0x05, 0x44, 0x05, 0x45, 0x01, 0x41, 0x00, 0x46, 0x00, 0x44, 0x01, 0x48, 0x03,
+    0x46, 0x09, 0x41, 0x47, 0x01, 0x48, 0x00, 0x41, 0x04, 0x44, 0x04, 0x44, 0x04, 0x4B, 0x00, 0x46,
+    0x02, 0x41, 0x01, 0x43, 0x01, 0x41, 0x02, 0x42, 0x01, 0x41, 0x03, 0x42, 0x00, 0x41, 0x03, 0x45,
+    0x04, 0x42, 0x01, 0x44, 0x02, 0x46, 0x01, 0x42, 0x01, 0x41, 0x01, 0x42, 0x01, 0x42, 0x00, 0x43,
+    0x05, 0x44, 0x04, 0x44, 0x06, 0x45, 0x02, 0x42, 0x00, 0x42, 0x01, 0x42, 0x00, 0x46, 0x02, 0x44,
+    0x01, 0x53, 0x03, 0x41, 0x07, 0x41, 0x07, 0x41, 0x07, 0x41, 0x07, 0x41, 0x07, 0x41, 0x07, 0x41,
+    0x07, 0x41, 0x07, 0x41, 0x07, 0x41, 0x03, 0x41, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43,
+    0x04, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x44, 0x03, 0x44, 0x02, 0x42, 0x00, 0x47, 0x01, 0x44,
+    0x01, 0x42, 0x04, 0x45, 0x04, 0x41, 0x01, 0x41, 0x03, 0x42, 0x01, 0x42, 0x02, 0x42, 0x01, 0x42,
+    0x02, 0x41, 0x03, 0x41, 0x01, 0x42, 0x03, 0x42, 0x00, 0x42, 0x03, 0x42, 0x00, 0x41, 0x05, 0x44,
+    0x05, 0x44, 0x05, 0x43, 0x07, 0x42, 0x03, 0x42, 0x02, 0x42, 0x03, 0x44, 0x02, 0x42, 0x02, 0x45,
+    0x01, 0x44, 0x01, 0x42, 0x00, 0x41, 0x01, 0x44, 0x01, 0x42, 0x00, 0x41, 0x01, 0x41, 0x00, 0x41,
+    0x01, 0x41, 0x01, 0x42, 0x00, 0x41, 0x00, 0x42, 0x00, 0x41, 0x01, 0x45, 0x00, 0x45, 0x02, 0x44,
+    0x01, 0x44, 0x02, 0x43, 0x02, 0x43, 0x03, 0x43, 0x02, 0x43, 0x03, 0x43, 0x03, 0x42, 0x03, 0x42,
+    0x04, 0x42, 0x01, 0x00, 0x42, 0x02, 0x42, 0x00, 0x42, 0x01, 0x42, 0x02, 0x42, 0x00, 0x42, 0x02,
+    0x45, 0x04, 0x44, 0x05, 0x42, 0x05, 0x43, 0x05, 0x44, 0x03, 0x42, 0x00, 0x42, 0x01, 0x42, 0x01,
+    0x42, 0x01, 0x42, 0x02, 0x45, 0x03, 0x42, 0x42, 0x04, 0x42, 0x00, 0x42, 0x02, 0x42, 0x01, 0x42,
+    0x01, 0x42, 0x03, 0x42, 0x00, 0x42, 0x04, 0x44, 0x05, 0x44, 0x06, 0x42, 0x07, 0x42, 0x07, 0x42,
+    0x07, 0x42, 0x07, 0x42, 0x07, 0x42, 0x03, 0x00, 0x47, 0x01, 0x47, 0x06, 0x42, 0x05, 0x42, 0x05,
+    0x42, 0x05, 0x43, 0x05, 0x42, 0x05, 0x42, 0x05, 0x42, 0x05, 0x43, 0x05, 0x53, 0x4C, 0x01, 0x42,
+    0x01, 0x42, 0x01, 0x42, 0x01, 0x42, 0x01, 0x42, 0x01, 0x42, 0x01, 0x42, 0x01, 0x42, 0x01, 0x42,
+    0x01, 0x42, 0x01, 0x49, 0x41, 0x01, 0x41, 0x01, 0x41, 0x02, 0x41, 0x01, 0x41, 0x01, 0x41, 0x01,
+    0x41, 0x02, 0x41, 0x01, 0x41, 0x01, 0x41, 0x01, 0x41, 0x01, 0x41, 0x47, 0x01, 0x41, 0x01, 0x41,
+    0x01, 0x41, 0x01, 0x41, 0x01, 0x41, 0x01, 0x41, 0x01, 0x41, 0x01, 0x41, 0x01, 0x41, 0x01, 0x41,
+    0x01, 0x49, 0x01, 0x42, 0x03, 0x42, 0x02, 0x44, 0x01, 0x41, 0x00, 0x41, 0x00, 0x42, 0x00, 0x44,
+    0x02, 0x41, 0x51, 0x41, 0x01, 0x41, 0x01, 0x44, 0x01, 0x46, 0x00, 0x41, 0x01, 0x42, 0x03, 0x43,
+    0x00, 0x49, 0x01, 0x45, 0x01, 0x42, 0x00, 0x46, 0x00, 0x43, 0x00, 0x41, 0x41, 0x05, 0x41, 0x05,
+    0x41, 0x05, 0x41, 0x00, 0x43, 0x00, 0x4A, 0x01, 0x44, 0x03, 0x43, 0x03, 0x43, 0x03, 0x44, 0x01,
+    0x4C, 0x00, 0x43, 0x00, 0x00, 0x44, 0x01, 0x46, 0x00, 0x42, 0x01, 0x41, 0x00, 0x41, 0x05, 0x41,
+    0x05, 0x41, 0x05, 0x42, 0x01, 0x49, 0x01, 0x44, 0x01, 0x04, 0x42, 0x04, 0x42, 0x04, 0x42, 0x00,
+    0x51, 0x01, 0x44, 0x02, 0x44, 0x02, 0x44, 0x02, 0x45, 0x01, 0x4A, 0x00, 0x46, 0x01, 0x44, 0x01,
+    0x46, 0x00, 0x41, 0x02, 0x54, 0x05, 0x41, 0x01, 0x42, 0x00, 0x46, 0x01, 0x44, 0x00, 0x01, 0x43,
+    0x00, 0x44, 0x00, 0x42, 0x01, 0x4B, 0x00, 0x42, 0x02, 0x42, 0x02, 0x42, 0x02, 0x42, 0x02, 0x42,
+    0x02, 0x42, 0x02, 0x42, 0x01, 0x00, 0x51, 0x01, 0x44, 0x02, 0x44, 0x02, 0x44, 0x02, 0x45, 0x01,
+    0x4A, 0x00, 0x49, 0x01, 0x4A, 0x00, 0x45, 0x00, 0x41, 0x05, 0x41, 0x05, 0x41, 0x05, 0x41, 0x00,
+    0x43, 0x00, 0x4A, 0x01, 0x45, 0x01, 0x44, 0x02, 0x44, 0x02, 0x44, 0x02, 0x44, 0x02, 0x44, 0x02,
+    0x42, 0x43, 0x01, 0x51, 0x01, 0x42, 0x01, 0x42, 0x06, 0x42, 0x01, 0x42, 0x01, 0x42, 0x01, 0x42,
+    0x01, 0x42, 0x01, 0x42, 0x01, 0x42, 0x01, 0x42, 0x01, 0x41, 0x02, 0x41, 0x00, 0x43, 0x00, 0x43,
+    0x00, 0x41, 0x05, 0x41, 0x05, 0x41, 0x05, 0x41, 0x01, 0x42, 0x00, 0x41, 0x01, 0x41, 0x01, 0x45,
+    0x01, 0x44, 0x02, 0x45, 0x01, 0x45, 0x01, 0x41, 0x01, 0x42, 0x00, 0x41, 0x02, 0x41, 0x00, 0x41,
+    0x02, 0x42, 0x57, 0x45, 0x01, 0x42, 0x00, 0x4E, 0x01, 0x42, 0x01, 0x43, 0x02, 0x41, 0x02, 0x43,
+    0x02, 0x41, 0x02, 0x43, 0x02, 0x41, 0x02, 0x43, 0x02, 0x41, 0x02, 0x43, 0x02, 0x41, 0x02, 0x43,
+    0x02, 0x41, 0x02, 0x41, 0x41, 0x00, 0x43, 0x00, 0x4A, 0x01, 0x45, 0x01, 0x44, 0x02, 0x44, 0x02,
+    0x44, 0x02, 0x44, 0x02, 0x44, 0x02, 0x42, 0x02, 0x43, 0x02, 0x46, 0x01, 0x42, 0x01, 0x42, 0x00,
+    0x41, 0x03, 0x44, 0x03, 0x41, 0x00, 0x41, 0x03, 0x41, 0x00, 0x42, 0x01, 0x42, 0x00, 0x46, 0x03,
+    0x43, 0x01, 0x41, 0x00, 0x43, 0x00, 0x4A, 0x01, 0x44, 0x03, 0x43, 0x03, 0x44, 0x02, 0x44, 0x01,
+    0x4C, 0x00, 0x43, 0x00, 0x41, 0x05, 0x41, 0x05, 0x41, 0x05, 0x00, 0x51, 0x01, 0x44, 0x02, 0x44,
+    0x02, 0x44, 0x02, 0x45, 0x01, 0x4A, 0x00, 0x46, 0x04, 0x42, 0x04, 0x42, 0x04, 0x42, 0x4A, 0x00,
+    0x42, 0x02, 0x42, 0x02, 0x41, 0x03, 0x41, 0x03, 0x41, 0x03, 0x41, 0x03, 0x41, 0x03, 0x01, 0x44,
+    0x01, 0x45, 0x01, 0x41, 0x01, 0x42, 0x00, 0x43, 0x04, 0x45, 0x04, 0x45, 0x02, 0x41, 0x00, 0x46,
+    0x01, 0x44, 0x00, 0x01, 0x41, 0x02, 0x42, 0x02, 0x42, 0x01, 0x44, 0x00, 0x44, 0x01, 0x42, 0x02,
+    0x42, 0x02, 0x42, 0x02, 0x42, 0x02, 0x42, 0x02, 0x43, 0x02, 0x43, 0x41, 0x02, 0x44, 0x02, 0x44,
+    0x02, 0x44, 0x02, 0x44, 0x02, 0x44, 0x02, 0x45, 0x01, 0x4A, 0x00, 0x46, 0x42, 0x02, 0x44, 0x02,
+    0x41, 0x00, 0x41, 0x01, 0x42, 0x00, 0x42, 0x00, 0x41, 0x02, 0x41, 0x00, 0x41, 0x02, 0x44, 0x02,
+    0x43, 0x04, 0x42, 0x04, 0x42, 0x01, 0x42, 0x01, 0x42, 0x01, 0x45, 0x01, 0x42, 0x01, 0x42, 0x00,
+    0x41, 0x01, 0x42, 0x01, 0x41, 0x01, 0x41, 0x00, 0x47, 0x01, 0x4A, 0x02, 0x43, 0x00, 0x43, 0x03,
+    0x43, 0x00, 0x43, 0x03, 0x43, 0x00, 0x43, 0x03, 0x42, 0x02, 0x41, 0x02, 0x00, 0x42, 0x00, 0x42,
+    0x01, 0x42, 0x00, 0x42, 0x02, 0x44, 0x03, 0x43, 0x05, 0x42, 0x04, 0x44, 0x03, 0x44, 0x02, 0x42,
+    0x00, 0x42, 0x00, 0x42, 0x02, 0x42, 0x41, 0x03, 0x45, 0x02, 0x41, 0x01, 0x41, 0x01, 0x42, 0x01,
+    0x41, 0x01, 0x42, 0x01, 0x42, 0x00, 0x41, 0x03, 0x44, 0x03, 0x43, 0x04, 0x43, 0x05, 0x42, 0x05,
+    0x41, 0x04, 0x43, 0x04, 0x42, 0x04, 0x00, 0x46, 0x00, 0x46, 0x03, 0x42, 0x03, 0x42, 0x03, 0x43,
+    0x02, 0x43, 0x03, 0x42, 0x03, 0x4F, 0x02, 0x42, 0x01, 0x43, 0x01, 0x41, 0x03, 0x41, 0x03, 0x41,
+    0x02, 0x42, 0x01, 0x43, 0x01, 0x42, 0x03, 0x42, 0x03, 0x41, 0x03, 0x41, 0x03, 0x41, 0x03, 0x41,
+    0x03, 0x43, 0x02, 0x42, 0x5D, 0x43, 0x01, 0x43, 0x03, 0x41, 0x03, 0x41, 0x03, 0x41, 0x03, 0x42,
+    0x03, 0x42, 0x02, 0x42, 0x01, 0x42, 0x02, 0x41, 0x03, 0x41, 0x03, 0x41, 0x03, 0x41, 0x01, 0x43,
+    0x01, 0x42, 0x02, 0x00, 0x43, 0x02, 0x4A, 0x02, 0x43, 0x00,
+};
+
+const RleGlyph Inter_16BGlyphs[] PROGMEM = {
+    { 0, 32, 0, 0, 7, 0, 0 },  // 'space'
+    { 0, 33, 3, 12, 8, 2, 1 },  // '!'
+    { 9, 34, 6, 4, 10, 2, 1 },  // '"'
+    { 18, 35, 9, 12, 11, 1, 1 },  // '#'
+    { 55, 36, 8, 14, 11, 1, 0 },  // '$'
+    { 94, 37, 12, 12, 17, 2, 1 },  // '%'
+    { 158, 38, 10, 12, 14, 2, 1 },  // '&'
+    { 196, 39, 2, 4, 6, 2, 1 },  // '''
+    { 197, 40, 4, 15, 8, 2, 1 },  // '('
+    { 227, 41, 4, 15, 8, 2, 1 },  // ')'
+    { 257, 42, 6, 4, 9, 1, 1 },  // '*'
+    { 267, 43, 9, 8, 12, 1, 3 },  // '+'
+    { 282, 44, 3, 5, 7, 2, 11 },  // ','
+    { 290, 45, 4, 2, 8, 2, 8 },  // '-'
+    { 291, 46, 3, 2, 7, 2, 11 },  // '.'
+    { 292, 47, 4, 12, 7, 1, 1 },  // '/'
+    { 317, 48, 7, 12, 11, 2, 1 },  // '0'
+    { 342, 49, 6, 12, 11, 2, 1 },  // '1'
+    { 364, 50, 8, 12, 11, 1, 1 },  // '2'
+    { 390, 51, 8, 12, 11, 1, 1 },  // '3'
+    { 419, 52, 9, 12, 11, 1, 1 },  // '4'
+    { 448, 53, 8, 12, 11, 2, 1 },  // '5'
+    { 475, 54, 7, 12, 11, 2, 1 },  // '6'
+    { 498, 55, 8, 12, 11, 1, 1 },  // '7'
+    { 520, 56, 7, 12, 11, 2, 1 },  // '8'
+    { 545, 57, 8, 12, 11, 1, 1 },  // '9'
+    { 576, 58, 3, 9, 8, 2, 4 },  // ':'
+    { 579, 59, 3, 12, 8, 2, 4 },  // ';'
+    { 587, 60, 9, 9, 12, 1, 3 },  // '<'
+    { 605, 61, 9, 5, 12, 1, 4 },  // '='
+    { 608, 62, 9, 9, 12, 1, 3 },  // '>'
+    { 626, 63, 8, 12, 12, 2, 1 },  // '?'
+    { 649, 64, 16, 16, 18, 1, 1 },  // '@'
+    { 732, 65, 11, 12, 14, 1, 1 },  // 'A'
+    { 766, 66, 10, 12, 14, 2, 1 },  // 'B'
+    { 790, 67, 10, 12, 14, 2, 1 },  // 'C'
+    { 821, 68, 10, 12, 14, 2, 1 },  // 'D'
+    { 849, 69, 9, 12, 13, 2, 1 },  // 'E'
+    { 866, 70, 8, 12, 12, 2, 1 },  // 'F'
+    { 882, 71, 11, 12, 15, 2, 1 },  // 'G'
+    { 913, 72, 10, 12, 14, 2, 1 },  // 'H'
+    { 934, 73, 3, 12, 7, 2, 1 },  // 'I'
+    { 935, 74, 8, 12, 11, 1, 1 },  // 'J'
+    { 960, 75, 10, 12, 14, 2, 1 },  // 'K'
+    { 999, 76, 9, 12, 12, 2, 1 },  // 'L'
+    { 1020, 77, 12, 12, 16, 2, 1 },  // 'M'
+    { 1061, 78, 9, 12, 14, 2, 1 },  // 'N'
+    { 1090, 79, 11, 12, 15, 2, 1 },  // 'O'
+    { 1119, 80, 9, 12, 13, 2, 1 },  // 'P'
+    { 1139, 81, 11, 13, 15, 2, 1 },  // 'Q'
+    { 1171, 82, 10, 12, 14, 2, 1 },  // 'R'
+    { 1202, 83, 9, 12, 13, 2, 1 },  // 'S'
+    { 1233, 84, 10, 12, 12, 2, 1 },  // 'T'
+    { 1255, 85, 9, 12, 14, 2, 1 },  // 'U'
+    { 1281, 86, 11, 12, 13, 1, 1 },  // 'V'
+    { 1319, 87, 15, 12, 18, 1, 1 },  // 'W'
+    { 1379, 88, 10, 12, 13, 1, 1 },  // 'X'
+    { 1415, 89, 11, 12, 13, 1, 1 },  // 'Y'
+    { 1447, 90, 10, 12, 12, 1, 1 },  // 'Z'
+    { 1469, 91, 5, 15, 8, 2, 1 },  // '['
+    { 1492, 92, 4, 12, 7, 1, 1 },  // '\\'
+    { 1515, 93, 4, 15, 8, 1, 1 },  // ']'
+    { 1538, 94, 7, 6, 12, 2, 1 },  // '^'
+    { 1554, 95, 9, 2, 11, 1, 14 },  // '_'
+    { 1555, 96, 3, 2, 8, 2, 1 },  // '`'
+    { 1558, 97, 8, 9, 11, 1, 4 },  // 'a'
+    { 1580, 98, 8, 12, 12, 2, 1 },  // 'b'
+    { 1604, 99, 8, 9, 11, 2, 4 },  // 'c'
+    { 1625, 100, 8, 12, 12, 2, 1 },  // 'd'
+    { 1645, 101, 8, 9, 11, 1, 4 },  // 'e'
+    { 1662, 102, 6, 12, 8, 1, 1 },  // 'f'
+    { 1685, 103, 8, 12, 12, 2, 4 },  // 'g'
+    { 1704, 104, 8, 12, 12, 2, 1 },  // 'h'
+    { 1729, 105, 2, 12, 7, 2, 1 },  // 'i'
+    { 1732, 106, 5, 15, 7, 0, 1 },  // 'j'
+    { 1761, 107, 8, 12, 11, 2, 1 },  // 'k'
+    { 1794, 108, 2, 12, 7, 2, 1 },  // 'l'
+    { 1795, 109, 12, 9, 17, 2, 4 },  // 'm'
+    { 1828, 110, 8, 9, 12, 2, 4 },  // 'n'
+    { 1847, 111, 9, 9, 12, 1, 4 },  // 'o'
+    { 1874, 112, 8, 12, 12, 2, 4 },  // 'p'
+    { 1898, 113, 8, 12, 12, 2, 4 },  // 'q'
+    { 1918, 114, 6, 9, 9, 2, 4 },  // 'r'
+    { 1934, 115, 8, 9, 11, 1, 4 },  // 's'
+    { 1955, 116, 6, 12, 8, 1, 1 },  // 't'
+    { 1979, 117, 8, 9, 12, 2, 4 },  // 'u'
+    { 1996, 118, 8, 9, 11, 1, 4 },  // 'v'
+    { 2022, 119, 13, 9, 15, 1, 4 },  // 'w'
+    { 2060, 120, 9, 9, 11, 1, 4 },  // 'x'
+    { 2086, 121, 9, 12, 11, 1, 4 },  // 'y'
+    { 2118, 122, 8, 9, 10, 1, 4 },  // 'z'
+    { 2134, 123, 6, 15, 9, 1, 1 },  // '{'
+    { 2164, 124, 2, 15, 7, 2, 1 },  // '|'
+    { 2165, 125, 6, 15, 9, 1, 1 },  // '}'
+    { 2195, 126, 9, 3, 12, 1, 6 },  // '~'
+};
+
+const RleFont Inter_16B PROGMEM = {
+    Inter_16BData,
+    Inter_16BGlyphs,
+    95, 23, 0, 23
+};
+
+#endif // RLE_INTER_16B_H
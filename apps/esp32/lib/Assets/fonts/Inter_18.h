@@ -0,0 +1,281 @@
+// Inter Font - 18px Regular (Weight 400) (1-bpp source)
+// Generated by scripts/fontgen.py: 2026-10-19
+// Charset: 95 characters, 2613 bytes RLE
+
+#ifndef RLE_INTER_18_H
+#define RLE_INTER_18_H
+
+#include "RleFont.h"
+
+const uint8_t Inter_18Data[] PROGMEM = {
+    0x4B, 0x00, 0x41, 0x00, 0x40, 0x01, 0x40, 0x01, 0x40, 0x01, 0x40, 0x01, 0x40, 0x03, 0x45, 0x41,
+    0x00, 0x43, 0x00, 0x43, 0x00, 0x43, 0x00, 0x42, 0x01, 0x40, 0x00, 0x02, 0x41, 0x01, 0x41, 0x03,
+    0x41, 0x01, 0x41, 0x03, 0x41, 0x01, 0x41, 0x03, 0x40, 0x02, 0x41, 0x00, 0x49, 0x01, 0x41, 0x01,
+    0x41, 0x03, 0x41, 0x01, 0x41, 0x03, 0x41, 0x01, 0x41, 0x01, 0x49, 0x00, 0x41, 0x01, 0x41, 0x03,
+    0x41, 0x01, 0x41, 0x03, 0x41, 0x01, 0x41, 0x03, 0x41, 0x01, 0x41, 0x02, 0x02, 0x41, 0x03, 0x45,
+    0x00, 0x49, 0x00, 0x41, 0x00, 0x43, 0x00, 0x41, 0x02, 0x44, 0x02, 0x45, 0x03, 0x44, 0x03, 0x44,
+    0x02, 0x41, 0x00, 0x43, 0x00, 0x41, 0x00, 0x43, 0x00, 0x41, 0x00, 0x49, 0x00, 0x45, 0x03, 0x41,
+    0x05, 0x41, 0x02, 0x00, 0x43, 0x03, 0x41, 0x02, 0x41, 0x00, 0x41, 0x03, 0x41, 0x02, 0x41, 0x01,
+    0x41, 0x01, 0x41, 0x03, 0x41, 0x01, 0x41, 0x01, 0x40, 0x04, 0x41, 0x01, 0x41, 0x00, 0x41, 0x04,
+    0x41, 0x00, 0x41, 0x01, 0x40, 0x06, 0x43, 0x00, 0x41, 0x00, 0x43, 0x06, 0x40, 0x01, 0x41, 0x00,
+    0x41, 0x04, 0x41, 0x00, 0x41, 0x01, 0x41, 0x04, 0x40, 0x01, 0x41, 0x01, 0x41, 0x03, 0x41, 0x01,
+    0x41, 0x01, 0x41, 0x02, 0x41, 0x03, 0x41, 0x00, 0x41, 0x02, 0x41, 0x03, 0x43, 0x00, 0x01, 0x44,
+    0x04, 0x41, 0x00, 0x42, 0x02, 0x41, 0x02, 0x41, 0x02, 0x42, 0x01, 0x41, 0x03, 0x44, 0x04, 0x43,
+    0x04, 0x44, 0x03, 0x42, 0x00, 0x42, 0x00, 0x43, 0x02, 0x46, 0x03, 0x42, 0x00, 0x41, 0x03, 0x42,
+    0x00, 0x49, 0x00, 0x44, 0x02, 0x40, 0x48, 0x00, 0x02, 0x40, 0x01, 0x41, 0x00, 0x41, 0x01, 0x41,
+    0x01, 0x41, 0x00, 0x41, 0x01, 0x41, 0x01, 0x41, 0x01, 0x41, 0x01, 0x41, 0x01, 0x41, 0x01, 0x41,
+    0x02, 0x41, 0x01, 0x41, 0x01, 0x41, 0x02, 0x41, 0x02, 0x40, 0x41, 0x02, 0x40, 0x02, 0x41, 0x02,
+    0x40, 0x02, 0x41, 0x01, 0x41, 0x01, 0x41, 0x02, 0x40, 0x02, 0x40, 0x02, 0x40, 0x01, 0x41, 0x01,
+    0x41, 0x01, 0x41, 0x01, 0x40, 0x01, 0x41, 0x01, 0x40, 0x01, 0x41, 0x01, 0x01, 0x40, 0x01, 0x49,
+    0x00, 0x42, 0x00, 0x41, 0x00, 0x41, 0x02, 0x41, 0x06, 0x41, 0x06, 0x41, 0x03, 0x50, 0x03, 0x41,
+    0x06, 0x41, 0x06, 0x41, 0x03, 0x45, 0x00, 0x41, 0x00, 0x40, 0x01, 0x40, 0x00, 0x4B, 0x43, 0x02,
+    0x41, 0x02, 0x41, 0x02, 0x41, 0x01, 0x41, 0x02, 0x41, 0x02, 0x41, 0x02, 0x40, 0x02, 0x41, 0x02,
+    0x41, 0x02, 0x41, 0x01, 0x41, 0x02, 0x41, 0x02, 0x41, 0x02, 0x01, 0x43, 0x02, 0x45, 0x00, 0x41,
+    0x03, 0x43, 0x03, 0x43, 0x03, 0x43, 0x03, 0x43, 0x03, 0x43, 0x03, 0x43, 0x03, 0x43, 0x03, 0x43,
+    0x03, 0x41, 0x00, 0x45, 0x02, 0x43, 0x01, 0x02, 0x41, 0x01, 0x42, 0x00, 0x49, 0x01, 0x41, 0x02,
+    0x41, 0x02, 0x41, 0x02, 0x41, 0x02, 0x41, 0x02, 0x41, 0x02, 0x41, 0x02, 0x41, 0x02, 0x41, 0x01,
+    0x45, 0x01, 0x42, 0x00, 0x43, 0x00, 0x41, 0x03, 0x41, 0x00, 0x41, 0x03, 0x41, 0x06, 0x41, 0x05,
+    0x42, 0x04, 0x42, 0x04, 0x42, 0x04, 0x42, 0x04, 0x42, 0x04, 0x42, 0x05, 0x50, 0x01, 0x43, 0x02,
+    0x41, 0x00, 0x42, 0x00, 0x41, 0x03, 0x43, 0x03, 0x41, 0x04, 0x41, 0x03, 0x43, 0x04, 0x43, 0x05,
+    0x41, 0x05, 0x43, 0x03, 0x43, 0x03, 0x44, 0x00, 0x42, 0x01, 0x44, 0x01, 0x05, 0x41, 0x05, 0x42,
+    0x04, 0x43, 0x03, 0x44, 0x03, 0x41, 0x00, 0x41, 0x02, 0x41, 0x01, 0x41, 0x01, 0x41, 0x02, 0x41,
+    0x00, 0x41, 0x03, 0x41, 0x00, 0x48, 0x04, 0x42, 0x06, 0x41, 0x06, 0x41, 0x06, 0x41, 0x00, 0x00,
+    0x46, 0x00, 0x46, 0x00, 0x41, 0x04, 0x41, 0x05, 0x46, 0x00, 0x42, 0x00, 0x45, 0x03, 0x41, 0x05,
+    0x41, 0x05, 0x43, 0x03, 0x43, 0x03, 0x48, 0x01, 0x44, 0x01, 0x01, 0x43, 0x02, 0x45, 0x00, 0x41,
+    0x03, 0x43, 0x03, 0x43, 0x05, 0x40, 0x00, 0x44, 0x00, 0x43, 0x00, 0x44, 0x03, 0x43, 0x03, 0x43,
+    0x03, 0x43, 0x03, 0x41, 0x00, 0x42, 0x00, 0x42, 0x01, 0x44, 0x00, 0x4F, 0x04, 0x41, 0x05, 0x41,
+    0x04, 0x41, 0x04, 0x42, 0x04, 0x41, 0x05, 0x41, 0x04, 0x41, 0x05, 0x41, 0x05, 0x41, 0x05, 0x41,
+    0x05, 0x40, 0x04, 0x00, 0x44, 0x02, 0x45, 0x00, 0x41, 0x03, 0x43, 0x03, 0x44, 0x01, 0x42, 0x00,
+    0x45, 0x00, 0x42, 0x00, 0x45, 0x03, 0x43, 0x03, 0x43, 0x03, 0x43, 0x03, 0x49, 0x00, 0x44, 0x01,
+    0x00, 0x44, 0x01, 0x46, 0x00, 0x41, 0x03, 0x43, 0x03, 0x43, 0x03, 0x43, 0x03, 0x44, 0x00, 0x43,
+    0x00, 0x46, 0x05, 0x43, 0x03, 0x43, 0x03, 0x41, 0x00, 0x41, 0x00, 0x42, 0x01, 0x44, 0x01, 0x45,
+    0x0E, 0x45, 0x45, 0x0E, 0x45, 0x00, 0x41, 0x00, 0x40, 0x01, 0x40, 0x00, 0x06, 0x41, 0x04, 0x43,
+    0x02, 0x44, 0x01, 0x43, 0x03, 0x42, 0x06, 0x43, 0x06, 0x44, 0x05, 0x43, 0x06, 0x41, 0x50, 0x12,
+    0x50, 0x00, 0x40, 0x07, 0x43, 0x05, 0x44, 0x05, 0x44, 0x06, 0x42, 0x02, 0x44, 0x01, 0x44, 0x02,
+    0x43, 0x04, 0x40, 0x07, 0x00, 0x45, 0x00, 0x49, 0x03, 0x43, 0x03, 0x41, 0x05, 0x41, 0x04, 0x42,
+    0x03, 0x42, 0x03, 0x42, 0x04, 0x41, 0x05, 0x41, 0x0D, 0x41, 0x05, 0x41, 0x02, 0x04, 0x46, 0x07,
+    0x44, 0x00, 0x44, 0x04, 0x42, 0x06, 0x42, 0x02, 0x42, 0x09, 0x41, 0x01, 0x41, 0x02, 0x43, 0x00,
+    0x41, 0x00, 0x41, 0x00, 0x41, 0x02, 0x46, 0x02, 0x40, 0x00, 0x41, 0x01, 0x41, 0x03, 0x41, 0x02,
+    0x40, 0x00, 0x41, 0x00, 0x42, 0x03, 0x41, 0x02, 0x40, 0x00, 0x40, 0x01, 0x41, 0x04, 0x41, 0x01,
+    0x41, 0x00, 0x40, 0x01, 0x41, 0x03, 0x41, 0x02, 0x41, 0x00, 0x41, 0x00, 0x41, 0x03, 0x41, 0x01,
+    0x41, 0x01, 0x41, 0x01, 0x49, 0x02, 0x41, 0x02, 0x42, 0x00, 0x43, 0x04, 0x41, 0x0A, 0x42, 0x01,
+    0x41, 0x08, 0x42, 0x03, 0x44, 0x01, 0x44, 0x06, 0x47, 0x03, 0x03, 0x42, 0x08, 0x43, 0x07, 0x43,
+    0x06, 0x44, 0x06, 0x41, 0x01, 0x41, 0x05, 0x41, 0x01, 0x41, 0x04, 0x41, 0x02, 0x42, 0x03, 0x41,
+    0x03, 0x41, 0x02, 0x48, 0x02, 0x49, 0x01, 0x41, 0x05, 0x41, 0x00, 0x42, 0x05, 0x44, 0x07, 0x41,
+    0x47, 0x01, 0x48, 0x00, 0x41, 0x04, 0x44, 0x05, 0x43, 0x04, 0x41, 0x00, 0x47, 0x01, 0x48, 0x00,
+    0x41, 0x05, 0x43, 0x05, 0x43, 0x05, 0x43, 0x05, 0x4A, 0x00, 0x47, 0x01, 0x02, 0x45, 0x03, 0x42,
+    0x01, 0x42, 0x01, 0x41, 0x04, 0x44, 0x06, 0x43, 0x08, 0x41, 0x08, 0x41, 0x08, 0x41, 0x08, 0x41,
+    0x06, 0x43, 0x06, 0x41, 0x00, 0x41, 0x04, 0x42, 0x00, 0x43, 0x00, 0x43, 0x03, 0x45, 0x01, 0x47,
+    0x02, 0x49, 0x00, 0x41, 0x05, 0x41, 0x00, 0x41, 0x06, 0x43, 0x06, 0x43, 0x06, 0x43, 0x06, 0x43,
+    0x06, 0x43, 0x06, 0x43, 0x06, 0x43, 0x05, 0x41, 0x00, 0x49, 0x00, 0x47, 0x02, 0x55, 0x07, 0x41,
+    0x07, 0x41, 0x07, 0x41, 0x07, 0x48, 0x00, 0x48, 0x00, 0x41, 0x07, 0x41, 0x07, 0x41, 0x07, 0x53,
+    0x53, 0x06, 0x41, 0x06, 0x41, 0x06, 0x41, 0x06, 0x47, 0x00, 0x47, 0x00, 0x41, 0x06, 0x41, 0x06,
+    0x41, 0x06, 0x41, 0x06, 0x41, 0x06, 0x02, 0x46, 0x03, 0x43, 0x00, 0x43, 0x01, 0x41, 0x05, 0x41,
+    0x00, 0x42, 0x06, 0x43, 0x09, 0x41, 0x09, 0x41, 0x09, 0x41, 0x03, 0x47, 0x04, 0x47, 0x06, 0x41,
+    0x00, 0x41, 0x05, 0x42, 0x01, 0x43, 0x00, 0x44, 0x02, 0x46, 0x01, 0x41, 0x06, 0x43, 0x06, 0x43,
+    0x06, 0x43, 0x06, 0x43, 0x06, 0x59, 0x06, 0x43, 0x06, 0x43, 0x06, 0x43, 0x06, 0x43, 0x06, 0x43,
+    0x06, 0x41, 0x59, 0x05, 0x41, 0x05, 0x41, 0x05, 0x41, 0x05, 0x41, 0x05, 0x41, 0x05, 0x41, 0x05,
+    0x41, 0x05, 0x41, 0x05, 0x43, 0x03, 0x44, 0x01, 0x42, 0x00, 0x45, 0x02, 0x43, 0x01, 0x41, 0x05,
+    0x41, 0x00, 0x41, 0x04, 0x41, 0x01, 0x41, 0x02, 0x42, 0x02, 0x41, 0x01, 0x42, 0x03, 0x41, 0x00,
+    0x42, 0x04, 0x45, 0x04, 0x46, 0x03, 0x42, 0x01, 0x41, 0x03, 0x41, 0x03, 0x41, 0x02, 0x41, 0x03,
+    0x42, 0x01, 0x41, 0x04, 0x41, 0x01, 0x41, 0x05, 0x41, 0x00, 0x41, 0x05, 0x42, 0x41, 0x06, 0x41,
+    0x06, 0x41, 0x06, 0x41, 0x06, 0x41, 0x06, 0x41, 0x06, 0x41, 0x06, 0x41, 0x06, 0x41, 0x06, 0x41,
+    0x06, 0x41, 0x06, 0x47, 0x00, 0x48, 0x42, 0x06, 0x46, 0x05, 0x46, 0x04, 0x47, 0x04, 0x45, 0x00,
+    0x41, 0x03, 0x40, 0x00, 0x43, 0x00, 0x41, 0x02, 0x41, 0x00, 0x43, 0x00, 0x41, 0x02, 0x41, 0x00,
+    0x43, 0x01, 0x41, 0x01, 0x40, 0x01, 0x43, 0x01, 0x41, 0x00, 0x41, 0x01, 0x43, 0x01, 0x41, 0x00,
+    0x41, 0x01, 0x43, 0x02, 0x42, 0x02, 0x43, 0x02, 0x42, 0x02, 0x43, 0x02, 0x42, 0x02, 0x41, 0x42,
+    0x05, 0x44, 0x05, 0x45, 0x04, 0x46, 0x03, 0x43, 0x00, 0x41, 0x03, 0x43, 0x01, 0x41, 0x02, 0x43,
+    0x01, 0x42, 0x01, 0x43, 0x02, 0x41, 0x01, 0x43, 0x03, 0x41, 0x00, 0x43, 0x03, 0x46, 0x04, 0x45,
+    0x05, 0x44, 0x05, 0x42, 0x02, 0x45, 0x04, 0x42, 0x01, 0x42, 0x02, 0x41, 0x05, 0x41, 0x00, 0x41,
+    0x07, 0x43, 0x07, 0x43, 0x07, 0x43, 0x07, 0x43, 0x07, 0x43, 0x07, 0x43, 0x07, 0x41, 0x00, 0x41,
+    0x05, 0x41, 0x02, 0x42, 0x01, 0x42, 0x04, 0x45, 0x02, 0x48, 0x00, 0x4B, 0x05, 0x43, 0x05, 0x43,
+    0x05, 0x43, 0x04, 0x4B, 0x00, 0x46, 0x02, 0x41, 0x07, 0x41, 0x07, 0x41, 0x07, 0x41, 0x07, 0x41,
+    0x07, 0x02, 0x45, 0x04, 0x42, 0x01, 0x42, 0x02, 0x41, 0x05, 0x41, 0x00, 0x41, 0x06, 0x44, 0x07,
+    0x43, 0x07, 0x43, 0x07, 0x43, 0x07, 0x43, 0x07, 0x43, 0x03, 0x41, 0x01, 0x41, 0x00, 0x41, 0x02,
+    0x44, 0x02, 0x42, 0x01, 0x43, 0x03, 0x48, 0x09, 0x41, 0x48, 0x02, 0x42, 0x03, 0x42, 0x01, 0x41,
+    0x05, 0x42, 0x00, 0x41, 0x06, 0x41, 0x00, 0x41, 0x06, 0x41, 0x00, 0x41, 0x05, 0x41, 0x01, 0x48,
+    0x02, 0x42, 0x01, 0x42, 0x03, 0x41, 0x03, 0x42, 0x02, 0x41, 0x04, 0x42, 0x01, 0x41, 0x05, 0x41,
+    0x01, 0x41, 0x05, 0x42, 0x00, 0x41, 0x06, 0x42, 0x01, 0x45, 0x02, 0x47, 0x00, 0x41, 0x04, 0x44,
+    0x05, 0x44, 0x07, 0x44, 0x05, 0x46, 0x06, 0x43, 0x07, 0x43, 0x05, 0x43, 0x05, 0x41, 0x00, 0x47,
+    0x02, 0x45, 0x01, 0x4A, 0x00, 0x49, 0x04, 0x41, 0x08, 0x41, 0x08, 0x41, 0x08, 0x41, 0x08, 0x41,
+    0x08, 0x41, 0x08, 0x41, 0x08, 0x41, 0x08, 0x41, 0x08, 0x41, 0x08, 0x41, 0x03, 0x41, 0x06, 0x43,
+    0x06, 0x43, 0x06, 0x43, 0x06, 0x43, 0x06, 0x43, 0x06, 0x43, 0x06, 0x43, 0x06, 0x43, 0x06, 0x44,
+    0x04, 0x42, 0x00, 0x41, 0x04, 0x41, 0x01, 0x48, 0x02, 0x46, 0x01, 0x41, 0x07, 0x44, 0x05, 0x42,
+    0x00, 0x41, 0x05, 0x41, 0x01, 0x41, 0x05, 0x41, 0x02, 0x41, 0x03, 0x41, 0x03, 0x41, 0x03, 0x41,
+    0x03, 0x41, 0x02, 0x42, 0x04, 0x41, 0x01, 0x41, 0x05, 0x41, 0x01, 0x41, 0x06, 0x43, 0x07, 0x43,
+    0x07, 0x43, 0x08, 0x41, 0x04, 0x41, 0x04, 0x42, 0x04, 0x44, 0x03, 0x42, 0x03, 0x42, 0x00, 0x41,
+    0x03, 0x42, 0x03, 0x41, 0x01, 0x41, 0x02, 0x41, 0x00, 0x41, 0x02, 0x41, 0x01, 0x41, 0x02, 0x41,
+    0x00, 0x41, 0x02, 0x41, 0x01, 0x41, 0x02, 0x41, 0x00, 0x41, 0x02, 0x41, 0x02, 0x41, 0x00, 0x41,
+    0x02, 0x41, 0x00, 0x41, 0x03, 0x41, 0x00, 0x41, 0x02, 0x41, 0x00, 0x41, 0x03, 0x41, 0x00, 0x41,
+    0x02, 0x41, 0x00, 0x41, 0x03, 0x41, 0x00, 0x41, 0x02, 0x43, 0x05, 0x42, 0x04, 0x42, 0x05, 0x42,
+    0x04, 0x42, 0x05, 0x42, 0x04, 0x42, 0x02, 0x00, 0x41, 0x05, 0x41, 0x02, 0x41, 0x03, 0x42, 0x02,
+    0x42, 0x02, 0x41, 0x04, 0x41, 0x01, 0x41, 0x06, 0x43, 0x07, 0x43, 0x08, 0x41, 0x08, 0x43, 0x06,
+    0x45, 0x04, 0x42, 0x01, 0x42, 0x03, 0x41, 0x03, 0x41, 0x02, 0x41, 0x05, 0x41, 0x00, 0x42, 0x05,
+    0x42, 0x42, 0x05, 0x42, 0x00, 0x41, 0x05, 0x41, 0x02, 0x41, 0x03, 0x41, 0x03, 0x42, 0x01, 0x42,
+    0x04, 0x41, 0x01, 0x41, 0x06, 0x43, 0x07, 0x42, 0x09, 0x41, 0x09, 0x41, 0x09, 0x41, 0x09, 0x41,
+    0x09, 0x41, 0x09, 0x41, 0x04, 0x00, 0x48, 0x01, 0x48, 0x07, 0x42, 0x06, 0x42, 0x07, 0x41, 0x07,
+    0x41, 0x07, 0x42, 0x06, 0x42, 0x06, 0x42, 0x07, 0x41, 0x07, 0x41, 0x07, 0x49, 0x00, 0x4A, 0x45,
+    0x01, 0x41, 0x01, 0x41, 0x01, 0x41, 0x01, 0x41, 0x01, 0x41, 0x01, 0x41, 0x01, 0x41, 0x01, 0x41,
+    0x01, 0x41, 0x01, 0x41, 0x01, 0x41, 0x01, 0x41, 0x01, 0x41, 0x01, 0x41, 0x01, 0x43, 0x41, 0x02,
+    0x41, 0x02, 0x41, 0x03, 0x41, 0x02, 0x41, 0x02, 0x41, 0x03, 0x40, 0x03, 0x41, 0x02, 0x41, 0x02,
+    0x41, 0x03, 0x41, 0x02, 0x41, 0x02, 0x41, 0x43, 0x01, 0x41, 0x01, 0x41, 0x01, 0x41, 0x01, 0x41,
+    0x01, 0x41, 0x01, 0x41, 0x01, 0x41, 0x01, 0x41, 0x01, 0x41, 0x01, 0x41, 0x01, 0x41, 0x01, 0x41,
+    0x01, 0x41, 0x01, 0x41, 0x01, 0x45, 0x02, 0x41, 0x05, 0x42, 0x03, 0x43, 0x03, 0x41, 0x00, 0x41,
+    0x01, 0x41, 0x01, 0x41, 0x01, 0x41, 0x02, 0x44, 0x02, 0x41, 0x49, 0x41, 0x01, 0x41, 0x00, 0x45,
+    0x00, 0x42, 0x00, 0x45, 0x03, 0x41, 0x05, 0x41, 0x01, 0x4F, 0x03, 0x43, 0x03, 0x44, 0x00, 0x48,
+    0x00, 0x41, 0x41, 0x05, 0x41, 0x05, 0x41, 0x05, 0x46, 0x00, 0x43, 0x00, 0x44, 0x03, 0x43, 0x03,
+    0x43, 0x03, 0x43, 0x03, 0x43, 0x03, 0x43, 0x03, 0x48, 0x00, 0x45, 0x01, 0x01, 0x43, 0x01, 0x46,
+    0x00, 0x41, 0x03, 0x43, 0x05, 0x40, 0x06, 0x40, 0x06, 0x41, 0x03, 0x43, 0x03, 0x44, 0x00, 0x42,
+    0x02, 0x43, 0x01, 0x06, 0x41, 0x06, 0x41, 0x06, 0x41, 0x01, 0x43, 0x00, 0x41, 0x00, 0x42, 0x00,
+    0x43, 0x00, 0x41, 0x03, 0x41, 0x00, 0x41, 0x03, 0x43, 0x04, 0x43, 0x04, 0x41, 0x00, 0x41, 0x03,
+    0x41, 0x00, 0x41, 0x03, 0x41, 0x00, 0x42, 0x00, 0x43, 0x01, 0x46, 0x01, 0x43, 0x02, 0x42, 0x00,
+    0x44, 0x03, 0x43, 0x03, 0x4B, 0x05, 0x41, 0x05, 0x41, 0x03, 0x45, 0x00, 0x42, 0x01, 0x44, 0x00,
+    0x01, 0x43, 0x00, 0x42, 0x02, 0x41, 0x02, 0x44, 0x01, 0x42, 0x02, 0x41, 0x03, 0x41, 0x03, 0x41,
+    0x03, 0x41, 0x03, 0x41, 0x03, 0x41, 0x03, 0x41, 0x03, 0x41, 0x02, 0x01, 0x46, 0x00, 0x42, 0x00,
+    0x43, 0x00, 0x41, 0x03, 0x41, 0x00, 0x41, 0x03, 0x43, 0x04, 0x43, 0x04, 0x41, 0x00, 0x41, 0x03,
+    0x41, 0x00, 0x41, 0x03, 0x41, 0x00, 0x42, 0x00, 0x43, 0x01, 0x46, 0x06, 0x41, 0x00, 0x41, 0x03,
+    0x41, 0x00, 0x42, 0x00, 0x42, 0x02, 0x44, 0x01, 0x41, 0x05, 0x41, 0x05, 0x41, 0x05, 0x46, 0x00,
+    0x43, 0x00, 0x44, 0x03, 0x43, 0x03, 0x43, 0x03, 0x43, 0x03, 0x43, 0x03, 0x43, 0x03, 0x43, 0x03,
+    0x43, 0x03, 0x41, 0x43, 0x01, 0x53, 0x01, 0x41, 0x01, 0x41, 0x05, 0x41, 0x01, 0x41, 0x01, 0x41,
+    0x01, 0x41, 0x01, 0x41, 0x01, 0x41, 0x01, 0x41, 0x01, 0x41, 0x01, 0x41, 0x01, 0x41, 0x01, 0x41,
+    0x01, 0x41, 0x00, 0x45, 0x00, 0x41, 0x05, 0x41, 0x05, 0x41, 0x05, 0x41, 0x02, 0x41, 0x00, 0x41,
+    0x01, 0x41, 0x01, 0x41, 0x00, 0x41, 0x02, 0x43, 0x03, 0x44, 0x02, 0x44, 0x02, 0x41, 0x01, 0x41,
+    0x01, 0x41, 0x01, 0x42, 0x00, 0x41, 0x02, 0x41, 0x00, 0x41, 0x02, 0x42, 0x59, 0x46, 0x00, 0x43,
+    0x00, 0x48, 0x00, 0x44, 0x02, 0x42, 0x02, 0x43, 0x03, 0x41, 0x02, 0x43, 0x03, 0x40, 0x03, 0x43,
+    0x03, 0x40, 0x03, 0x43, 0x03, 0x40, 0x03, 0x43, 0x03, 0x40, 0x03, 0x43, 0x03, 0x40, 0x03, 0x43,
+    0x03, 0x40, 0x03, 0x41, 0x46, 0x00, 0x43, 0x00, 0x44, 0x03, 0x43, 0x03, 0x43, 0x03, 0x43, 0x03,
+    0x43, 0x03, 0x43, 0x03, 0x43, 0x03, 0x43, 0x03, 0x41, 0x02, 0x43, 0x02, 0x47, 0x00, 0x41, 0x03,
+    0x41, 0x00, 0x41, 0x03, 0x43, 0x05, 0x42, 0x05, 0x40, 0x00, 0x41, 0x03, 0x41, 0x00, 0x41, 0x03,
+    0x41, 0x00, 0x47, 0x01, 0x44, 0x01, 0x46, 0x00, 0x43, 0x00, 0x44, 0x03, 0x43, 0x03, 0x43, 0x04,
+    0x42, 0x03, 0x43, 0x03, 0x43, 0x03, 0x48, 0x00, 0x45, 0x01, 0x41, 0x05, 0x41, 0x05, 0x41, 0x05,
+    0x41, 0x05, 0x00, 0x49, 0x00, 0x45, 0x03, 0x43, 0x03, 0x42, 0x04, 0x42, 0x04, 0x43, 0x03, 0x43,
+    0x03, 0x44, 0x00, 0x43, 0x01, 0x45, 0x05, 0x41, 0x05, 0x41, 0x05, 0x41, 0x05, 0x41, 0x47, 0x00,
+    0x42, 0x02, 0x41, 0x02, 0x41, 0x02, 0x41, 0x02, 0x41, 0x02, 0x41, 0x02, 0x41, 0x02, 0x41, 0x02,
+    0x00, 0x44, 0x00, 0x42, 0x00, 0x44, 0x02, 0x44, 0x03, 0x45, 0x02, 0x44, 0x04, 0x43, 0x02, 0x44,
+    0x00, 0x42, 0x00, 0x44, 0x00, 0x01, 0x40, 0x02, 0x41, 0x02, 0x41, 0x01, 0x44, 0x00, 0x41, 0x02,
+    0x41, 0x02, 0x41, 0x02, 0x41, 0x02, 0x41, 0x02, 0x41, 0x02, 0x41, 0x02, 0x42, 0x02, 0x42, 0x41,
+    0x03, 0x43, 0x03, 0x43, 0x03, 0x43, 0x03, 0x43, 0x03, 0x43, 0x03, 0x43, 0x03, 0x43, 0x03, 0x44,
+    0x00, 0x43, 0x00, 0x46, 0x41, 0x04, 0x41, 0x00, 0x41, 0x02, 0x42, 0x00, 0x41, 0x02, 0x41, 0x01,
+    0x41, 0x02, 0x41, 0x02, 0x41, 0x00, 0x41, 0x03, 0x41, 0x00, 0x41, 0x03, 0x41, 0x00, 0x41, 0x04,
+    0x42, 0x05, 0x42, 0x05, 0x42, 0x02, 0x41, 0x02, 0x42, 0x02, 0x43, 0x02, 0x42, 0x02, 0x41, 0x00,
+    0x41, 0x01, 0x42, 0x01, 0x41, 0x01, 0x41, 0x01, 0x42, 0x01, 0x41, 0x01, 0x41, 0x00, 0x41, 0x00,
+    0x41, 0x00, 0x41, 0x01, 0x41, 0x00, 0x41, 0x00, 0x41, 0x00, 0x40, 0x03, 0x43, 0x00, 0x43, 0x03,
+    0x42, 0x01, 0x43, 0x03, 0x42, 0x02, 0x42, 0x03, 0x42, 0x02, 0x41, 0x02, 0x00, 0x41, 0x02, 0x41,
+    0x01, 0x41, 0x02, 0x41, 0x02, 0x41, 0x00, 0x41, 0x03, 0x43, 0x05, 0x42, 0x05, 0x42, 0x04, 0x44,
+    0x03, 0x41, 0x00, 0x41, 0x02, 0x41, 0x02, 0x41, 0x00, 0x42, 0x02, 0x42, 0x41, 0x04, 0x41, 0x00,
+    0x41, 0x03, 0x41, 0x00, 0x41, 0x02, 0x41, 0x01, 0x41, 0x02, 0x41, 0x02, 0x41, 0x00, 0x42, 0x02,
+    0x41, 0x00, 0x41, 0x03, 0x41, 0x00, 0x41, 0x04, 0x42, 0x05, 0x42, 0x05, 0x42, 0x05, 0x41, 0x06,
+    0x41, 0x04, 0x43, 0x04, 0x42, 0x04, 0x00, 0x46, 0x05, 0x42, 0x05, 0x41, 0x05, 0x42, 0x05, 0x41,
+    0x05, 0x41, 0x05, 0x41, 0x05, 0x42, 0x04, 0x42, 0x05, 0x48, 0x02, 0x42, 0x01, 0x41, 0x03, 0x41,
+    0x03, 0x41, 0x03, 0x41, 0x03, 0x41, 0x03, 0x41, 0x02, 0x41, 0x02, 0x42, 0x03, 0x41, 0x04, 0x41,
+    0x03, 0x41, 0x03, 0x41, 0x03, 0x41, 0x03, 0x41, 0x03, 0x41, 0x04, 0x42, 0x50, 0x42, 0x04, 0x41,
+    0x03, 0x41, 0x03, 0x41, 0x03, 0x41, 0x03, 0x41, 0x03, 0x41, 0x04, 0x41, 0x03, 0x42, 0x02, 0x41,
+    0x02, 0x41, 0x03, 0x41, 0x03, 0x41, 0x03, 0x41, 0x03, 0x41, 0x03, 0x41, 0x01, 0x42, 0x02, 0x44,
+    0x02, 0x4A, 0x01, 0x44, 0x00,
+};
+
+const RleGlyph Inter_18Glyphs[] PROGMEM = {
+    { 0, 32, 0, 0, 7, 0, 0 },  // 'space'
+    { 0, 33, 3, 13, 7, 2, 1 },  // '!'
+    { 15, 34, 5, 5, 9, 2, 1 },  // '"'
+    { 27, 35, 10, 13, 12, 1, 1 },  // '#'
+    { 76, 36, 8, 16, 12, 2, 0 },  // '$'
+    { 115, 37, 14, 13, 18, 2, 1 },  // '%'
+    { 190, 38, 10, 13, 14, 2, 1 },  // '&'
+    { 230, 39, 2, 5, 6, 2, 1 },  // '''
+    { 232, 40, 4, 17, 8, 2, 1 },  // '('
+    { 266, 41, 4, 17, 8, 2, 1 },  // ')'
+    { 300, 42, 5, 5, 9, 2, 1 },  // '*'
+    { 310, 43, 9, 8, 13, 2, 4 },  // '+'
+    { 325, 44, 3, 5, 7, 2, 12 },  // ','
+    { 333, 45, 6, 2, 8, 1, 9 },  // '-'
+    { 334, 46, 2, 2, 7, 3, 12 },  // '.'
+    { 335, 47, 5, 13, 7, 1, 1 },  // '/'
+    { 362, 48, 8, 13, 12, 2, 1 },  // '0'
+    { 391, 49, 5, 13, 12, 3, 1 },  // '1'
+    { 415, 50, 9, 13, 12, 1, 1 },  // '2'
+    { 445, 51, 8, 13, 12, 2, 1 },  // '3'
+    { 476, 52, 9, 13, 12, 1, 1 },  // '4'
+    { 511, 53, 8, 13, 12, 2, 1 },  // '5'
+    { 538, 54, 8, 13, 12, 2, 1 },  // '6'
+    { 571, 55, 8, 13, 12, 2, 1 },  // '7'
+    { 595, 56, 8, 13, 12, 2, 1 },  // '8'
+    { 624, 57, 8, 13, 12, 2, 1 },  // '9'
+    { 655, 58, 3, 9, 7, 2, 5 },  // ':'
+    { 658, 59, 3, 12, 7, 2, 5 },  // ';'
+    { 668, 60, 9, 9, 13, 2, 3 },  // '<'
+    { 686, 61, 9, 6, 13, 2, 5 },  // '='
+    { 690, 62, 9, 9, 13, 2, 3 },  // '>'
+    { 708, 63, 8, 13, 12, 2, 1 },  // '?'
+    { 733, 64, 17, 17, 21, 2, 1 },  // '@'
+    { 826, 65, 12, 13, 14, 1, 1 },  // 'A'
+    { 864, 66, 10, 13, 14, 2, 1 },  // 'B'
+    { 892, 67, 11, 13, 15, 2, 1 },  // 'C'
+    { 927, 68, 11, 13, 15, 2, 1 },  // 'D'
+    { 957, 69, 10, 13, 14, 2, 1 },  // 'E'
+    { 976, 70, 9, 13, 13, 2, 1 },  // 'F'
+    { 998, 71, 12, 13, 16, 2, 1 },  // 'G'
+    { 1035, 72, 11, 13, 15, 2, 1 },  // 'H'
+    { 1058, 73, 2, 13, 7, 3, 1 },  // 'I'
+    { 1059, 74, 8, 13, 11, 1, 1 },  // 'J'
+    { 1086, 75, 11, 13, 14, 2, 1 },  // 'K'
+    { 1133, 76, 9, 13, 12, 2, 1 },  // 'L'
+    { 1158, 77, 13, 13, 17, 2, 1 },  // 'M'
+    { 1215, 78, 11, 13, 15, 2, 1 },  // 'N'
+    { 1252, 79, 12, 13, 16, 2, 1 },  // 'O'
+    { 1289, 80, 10, 13, 14, 2, 1 },  // 'P'
+    { 1313, 81, 12, 14, 16, 2, 1 },  // 'Q'
+    { 1353, 82, 12, 13, 15, 2, 1 },  // 'R'
+    { 1400, 83, 10, 13, 14, 2, 1 },  // 'S'
+    { 1427, 84, 11, 13, 13, 1, 1 },  // 'T'
+    { 1453, 85, 11, 13, 15, 2, 1 },  // 'U'
+    { 1483, 86, 12, 13, 14, 1, 1 },  // 'V'
+    { 1525, 87, 17, 13, 19, 1, 1 },  // 'W'
+    { 1607, 88, 12, 13, 14, 1, 1 },  // 'X'
+    { 1649, 89, 12, 13, 14, 1, 1 },  // 'Y'
+    { 1685, 90, 11, 13, 13, 1, 1 },  // 'Z'
+    { 1711, 91, 4, 17, 7, 2, 1 },  // '['
+    { 1742, 92, 5, 13, 7, 1, 1 },  // '\\'
+    { 1767, 93, 4, 17, 7, 1, 1 },  // ']'
+    { 1798, 94, 8, 7, 11, 1, 1 },  // '^'
+    { 1818, 95, 10, 1, 12, 1, 16 },  // '_'
+    { 1819, 96, 3, 2, 8, 2, 1 },  // '`'
+    { 1822, 97, 8, 10, 12, 2, 4 },  // 'a'
+    { 1842, 98, 8, 13, 12, 2, 1 },  // 'b'
+    { 1868, 99, 8, 10, 11, 2, 4 },  // 'c'
+    { 1891, 100, 9, 13, 12, 1, 1 },  // 'd'
+    { 1931, 101, 8, 10, 12, 2, 4 },  // 'e'
+    { 1952, 102, 6, 13, 7, 1, 1 },  // 'f'
+    { 1979, 103, 9, 14, 12, 1, 4 },  // 'g'
+    { 2024, 104, 8, 13, 12, 2, 1 },  // 'h'
+    { 2051, 105, 2, 13, 6, 2, 1 },  // 'i'
+    { 2054, 106, 4, 17, 6, 0, 1 },  // 'j'
+    { 2085, 107, 8, 13, 11, 2, 1 },  // 'k'
+    { 2124, 108, 2, 13, 6, 2, 1 },  // 'l'
+    { 2125, 109, 13, 10, 17, 2, 4 },  // 'm'
+    { 2164, 110, 8, 10, 12, 2, 4 },  // 'n'
+    { 2185, 111, 9, 10, 12, 1, 4 },  // 'o'
+    { 2214, 112, 8, 14, 12, 2, 4 },  // 'p'
+    { 2242, 113, 8, 14, 12, 2, 4 },  // 'q'
+    { 2270, 114, 5, 10, 8, 2, 4 },  // 'r'
+    { 2288, 115, 7, 10, 11, 2, 4 },  // 's'
+    { 2309, 116, 5, 13, 7, 1, 1 },  // 't'
+    { 2335, 117, 8, 10, 12, 2, 4 },  // 'u'
+    { 2356, 118, 9, 10, 11, 1, 4 },  // 'v'
+    { 2390, 119, 13, 10, 15, 1, 4 },  // 'w'
+    { 2444, 120, 9, 10, 11, 1, 4 },  // 'x'
+    { 2476, 121, 9, 14, 11, 1, 4 },  // 'y'
+    { 2518, 122, 9, 10, 11, 1, 4 },  // 'z'
+    { 2538, 123, 6, 17, 8, 1, 1 },  // '{'
+    { 2572, 124, 1, 17, 7, 3, 1 },  // '|'
+    { 2573, 125, 6, 17, 8, 1, 1 },  // '}'
+    { 2607, 126, 9, 3, 13, 2, 6 },  // '~'
+};
+
+const RleFont Inter_18 PROGMEM = {
+    Inter_18Data,
+    Inter_18Glyphs,
+    95, 26, 0, 26
+};
+
+#endif // RLE_INTER_18_H
@@ -0,0 +1,315 @@
+// Inter Font - 22px Regular (Weight 400) (1-bpp source)
+// Generated by scripts/fontgen.py: 2026-10-19
+// Charset: 95 characters, 3165 bytes RLE
+
+#ifndef RLE_INTER_22_H
+#define RLE_INTER_22_H
+
+#include "RleFont.h"
+
+const uint8_t Inter_22Data[] PROGMEM = {
+    0x57, 0x03, 0x43, 0x41, 0x00, 0x44, 0x00, 0x44, 0x00, 0x44, 0x01, 0x43, 0x01, 0x43, 0x01, 0x41,
+    0x03, 0x41, 0x02, 0x41, 0x04, 0x41, 0x02, 0x41, 0x04, 0x41, 0x02, 0x41, 0x04, 0x41, 0x02, 0x41,
+    0x03, 0x41, 0x02, 0x41, 0x01, 0x57, 0x02, 0x41, 0x02, 0x41, 0x03, 0x42, 0x01, 0x42, 0x03, 0x41,
+    0x02, 0x41, 0x02, 0x57, 0x01, 0x41, 0x02, 0x41, 0x03, 0x41, 0x02, 0x41, 0x04, 0x41, 0x02, 0x41,
+    0x04, 0x41, 0x02, 0x41, 0x03, 0x03, 0x41, 0x05, 0x45, 0x02, 0x47, 0x00, 0x42, 0x00, 0x41, 0x00,
+    0x44, 0x01, 0x41, 0x00, 0x44, 0x01, 0x41, 0x03, 0x45, 0x04, 0x45, 0x04, 0x46, 0x04, 0x45, 0x03,
+    0x41, 0x00, 0x42, 0x03, 0x41, 0x01, 0x43, 0x01, 0x41, 0x01, 0x43, 0x01, 0x41, 0x01, 0x44, 0x00,
+    0x41, 0x00, 0x42, 0x00, 0x47, 0x02, 0x45, 0x05, 0x41, 0x07, 0x41, 0x03, 0x01, 0x43, 0x05, 0x41,
+    0x03, 0x45, 0x03, 0x41, 0x03, 0x41, 0x02, 0x41, 0x03, 0x41, 0x03, 0x41, 0x02, 0x41, 0x02, 0x41,
+    0x04, 0x41, 0x02, 0x41, 0x02, 0x41, 0x04, 0x41, 0x02, 0x41, 0x01, 0x41, 0x05, 0x41, 0x02, 0x41,
+    0x01, 0x41, 0x06, 0x44, 0x01, 0x41, 0x01, 0x43, 0x02, 0x43, 0x00, 0x41, 0x01, 0x45, 0x06, 0x41,
+    0x01, 0x41, 0x01, 0x41, 0x05, 0x41, 0x01, 0x41, 0x02, 0x41, 0x05, 0x41, 0x01, 0x41, 0x02, 0x41,
+    0x04, 0x41, 0x02, 0x41, 0x02, 0x41, 0x04, 0x41, 0x03, 0x41, 0x01, 0x41, 0x03, 0x41, 0x04, 0x45,
+    0x03, 0x41, 0x05, 0x43, 0x00, 0x02, 0x44, 0x06, 0x46, 0x05, 0x41, 0x02, 0x42, 0x04, 0x41, 0x02,
+    0x42, 0x04, 0x42, 0x01, 0x41, 0x05, 0x46, 0x06, 0x44, 0x06, 0x44, 0x06, 0x42, 0x00, 0x42, 0x01,
+    0x41, 0x00, 0x42, 0x02, 0x45, 0x00, 0x41, 0x03, 0x45, 0x00, 0x41, 0x04, 0x43, 0x01, 0x42, 0x04,
+    0x43, 0x00, 0x42, 0x03, 0x45, 0x00, 0x47, 0x00, 0x42, 0x01, 0x45, 0x02, 0x40, 0x00, 0x4B, 0x03,
+    0x40, 0x02, 0x41, 0x01, 0x41, 0x02, 0x41, 0x01, 0x41, 0x02, 0x41, 0x02, 0x41, 0x01, 0x42, 0x01,
+    0x42, 0x01, 0x41, 0x02, 0x41, 0x02, 0x42, 0x01, 0x42, 0x02, 0x41, 0x02, 0x41, 0x02, 0x42, 0x02,
+    0x41, 0x02, 0x41, 0x03, 0x41, 0x03, 0x40, 0x41, 0x04, 0x41, 0x04, 0x41, 0x03, 0x41, 0x03, 0x42,
+    0x03, 0x41, 0x03, 0x41, 0x03, 0x41, 0x03, 0x42, 0x02, 0x42, 0x02, 0x42, 0x02, 0x42, 0x02, 0x41,
+    0x03, 0x41, 0x03, 0x41, 0x02, 0x42, 0x02, 0x41, 0x03, 0x41, 0x02, 0x41, 0x02, 0x41, 0x03, 0x01,
+    0x41, 0x04, 0x41, 0x02, 0x4D, 0x01, 0x42, 0x02, 0x41, 0x00, 0x41, 0x01, 0x40, 0x01, 0x41, 0x00,
+    0x03, 0x41, 0x08, 0x41, 0x08, 0x41, 0x08, 0x41, 0x04, 0x55, 0x03, 0x41, 0x08, 0x41, 0x08, 0x41,
+    0x08, 0x41, 0x04, 0x43, 0x00, 0x43, 0x00, 0x4B, 0x43, 0x03, 0x41, 0x03, 0x41, 0x03, 0x41, 0x02,
+    0x41, 0x03, 0x41, 0x03, 0x41, 0x02, 0x41, 0x03, 0x41, 0x03, 0x41, 0x03, 0x41, 0x02, 0x41, 0x03,
+    0x41, 0x03, 0x41, 0x02, 0x42, 0x02, 0x41, 0x03, 0x41, 0x03, 0x01, 0x45, 0x02, 0x47, 0x01, 0x41,
+    0x03, 0x41, 0x00, 0x42, 0x03, 0x44, 0x05, 0x43, 0x05, 0x43, 0x05, 0x43, 0x05, 0x43, 0x05, 0x43,
+    0x05, 0x43, 0x05, 0x43, 0x05, 0x44, 0x03, 0x42, 0x00, 0x41, 0x03, 0x41, 0x01, 0x47, 0x02, 0x45,
+    0x01, 0x03, 0x41, 0x03, 0x41, 0x02, 0x42, 0x00, 0x47, 0x00, 0x43, 0x01, 0x41, 0x03, 0x41, 0x03,
+    0x41, 0x03, 0x41, 0x03, 0x41, 0x03, 0x41, 0x03, 0x41, 0x03, 0x41, 0x03, 0x41, 0x03, 0x41, 0x03,
+    0x41, 0x01, 0x45, 0x02, 0x47, 0x00, 0x42, 0x03, 0x45, 0x04, 0x43, 0x05, 0x41, 0x07, 0x41, 0x06,
+    0x42, 0x05, 0x42, 0x05, 0x42, 0x05, 0x42, 0x05, 0x42, 0x05, 0x42, 0x05, 0x42, 0x05, 0x42, 0x06,
+    0x53, 0x01, 0x44, 0x03, 0x47, 0x00, 0x42, 0x03, 0x41, 0x00, 0x41, 0x04, 0x42, 0x06, 0x42, 0x06,
+    0x41, 0x06, 0x42, 0x04, 0x43, 0x05, 0x44, 0x07, 0x42, 0x07, 0x41, 0x07, 0x43, 0x05, 0x44, 0x03,
+    0x42, 0x00, 0x47, 0x02, 0x45, 0x01, 0x06, 0x41, 0x07, 0x42, 0x06, 0x43, 0x06, 0x43, 0x05, 0x41,
+    0x00, 0x41, 0x04, 0x42, 0x00, 0x41, 0x04, 0x41, 0x01, 0x41, 0x03, 0x41, 0x02, 0x41, 0x02, 0x41,
+    0x03, 0x41, 0x01, 0x42, 0x03, 0x41, 0x01, 0x55, 0x06, 0x41, 0x08, 0x41, 0x08, 0x41, 0x08, 0x41,
+    0x01, 0x00, 0x48, 0x00, 0x48, 0x00, 0x41, 0x07, 0x41, 0x07, 0x41, 0x06, 0x47, 0x01, 0x48, 0x00,
+    0x42, 0x03, 0x42, 0x07, 0x41, 0x07, 0x41, 0x07, 0x43, 0x05, 0x44, 0x04, 0x44, 0x03, 0x42, 0x00,
+    0x47, 0x02, 0x45, 0x01, 0x02, 0x44, 0x03, 0x46, 0x01, 0x42, 0x02, 0x45, 0x04, 0x43, 0x07, 0x41,
+    0x07, 0x41, 0x00, 0x44, 0x01, 0x48, 0x00, 0x42, 0x03, 0x45, 0x04, 0x43, 0x05, 0x43, 0x05, 0x44,
+    0x04, 0x41, 0x00, 0x41, 0x03, 0x42, 0x00, 0x47, 0x03, 0x44, 0x01, 0x53, 0x06, 0x42, 0x05, 0x42,
+    0x06, 0x41, 0x06, 0x42, 0x06, 0x41, 0x06, 0x42, 0x06, 0x41, 0x06, 0x42, 0x06, 0x42, 0x06, 0x41,
+    0x06, 0x42, 0x06, 0x42, 0x06, 0x42, 0x06, 0x41, 0x05, 0x01, 0x45, 0x02, 0x47, 0x01, 0x41, 0x03,
+    0x41, 0x00, 0x42, 0x03, 0x45, 0x03, 0x45, 0x03, 0x42, 0x00, 0x42, 0x01, 0x42, 0x02, 0x45, 0x02,
+    0x47, 0x00, 0x42, 0x03, 0x44, 0x05, 0x43, 0x05, 0x43, 0x05, 0x44, 0x03, 0x42, 0x00, 0x47, 0x02,
+    0x45, 0x01, 0x01, 0x44, 0x03, 0x47, 0x00, 0x42, 0x03, 0x41, 0x00, 0x41, 0x05, 0x43, 0x05, 0x43,
+    0x05, 0x43, 0x05, 0x44, 0x03, 0x42, 0x00, 0x48, 0x01, 0x44, 0x00, 0x41, 0x07, 0x41, 0x07, 0x43,
+    0x04, 0x45, 0x03, 0x41, 0x01, 0x47, 0x02, 0x44, 0x02, 0x43, 0x0D, 0x43, 0x43, 0x0D, 0x43, 0x00,
+    0x43, 0x00, 0x08, 0x41, 0x06, 0x43, 0x04, 0x44, 0x03, 0x44, 0x03, 0x44, 0x04, 0x43, 0x06, 0x43,
+    0x07, 0x45, 0x07, 0x45, 0x06, 0x44, 0x08, 0x41, 0x55, 0x20, 0x55, 0x41, 0x08, 0x43, 0x07, 0x44,
+    0x07, 0x44, 0x07, 0x44, 0x07, 0x43, 0x05, 0x44, 0x03, 0x45, 0x01, 0x45, 0x03, 0x44, 0x05, 0x41,
+    0x08, 0x01, 0x45, 0x02, 0x47, 0x00, 0x42, 0x03, 0x45, 0x04, 0x43, 0x05, 0x41, 0x07, 0x41, 0x06,
+    0x42, 0x05, 0x42, 0x05, 0x42, 0x05, 0x42, 0x06, 0x41, 0x07, 0x41, 0x1B, 0x41, 0x07, 0x41, 0x03,
+    0x06, 0x47, 0x09, 0x4B, 0x05, 0x43, 0x06, 0x43, 0x03, 0x42, 0x0A, 0x42, 0x02, 0x41, 0x03, 0x43,
+    0x00, 0x41, 0x01, 0x41, 0x01, 0x41, 0x02, 0x48, 0x02, 0x41, 0x00, 0x41, 0x02, 0x41, 0x03, 0x42,
+    0x02, 0x44, 0x01, 0x41, 0x04, 0x42, 0x02, 0x43, 0x02, 0x41, 0x04, 0x42, 0x02, 0x43, 0x01, 0x42,
+    0x04, 0x41, 0x03, 0x43, 0x01, 0x41, 0x05, 0x41, 0x03, 0x43, 0x01, 0x41, 0x05, 0x41, 0x02, 0x44,
+    0x01, 0x42, 0x03, 0x42, 0x02, 0x41, 0x00, 0x42, 0x01, 0x41, 0x02, 0x43, 0x01, 0x41, 0x02, 0x41,
+    0x01, 0x4B, 0x03, 0x42, 0x01, 0x43, 0x01, 0x43, 0x01, 0x41, 0x01, 0x42, 0x0B, 0x42, 0x02, 0x43,
+    0x07, 0x43, 0x04, 0x4C, 0x08, 0x49, 0x03, 0x05, 0x42, 0x0A, 0x43, 0x0A, 0x43, 0x09, 0x45, 0x08,
+    0x41, 0x01, 0x41, 0x08, 0x41, 0x01, 0x42, 0x06, 0x42, 0x02, 0x41, 0x06, 0x41, 0x03, 0x42, 0x05,
+    0x41, 0x03, 0x42, 0x04, 0x49, 0x04, 0x4A, 0x02, 0x42, 0x06, 0x41, 0x02, 0x42, 0x06, 0x42, 0x01,
+    0x41, 0x07, 0x42, 0x00, 0x42, 0x08, 0x41, 0x00, 0x42, 0x08, 0x42, 0x49, 0x02, 0x4A, 0x01, 0x42,
+    0x05, 0x42, 0x00, 0x42, 0x05, 0x42, 0x00, 0x42, 0x06, 0x41, 0x00, 0x42, 0x05, 0x42, 0x00, 0x42,
+    0x04, 0x42, 0x01, 0x49, 0x02, 0x4A, 0x01, 0x42, 0x05, 0x42, 0x00, 0x42, 0x06, 0x45, 0x06, 0x45,
+    0x06, 0x45, 0x05, 0x42, 0x00, 0x4B, 0x00, 0x49, 0x02, 0x03, 0x46, 0x05, 0x48, 0x03, 0x42, 0x04,
+    0x42, 0x01, 0x42, 0x06, 0x45, 0x07, 0x45, 0x0A, 0x42, 0x0A, 0x41, 0x0B, 0x41, 0x0B, 0x42, 0x0A,
+    0x42, 0x08, 0x44, 0x07, 0x42, 0x00, 0x42, 0x06, 0x41, 0x02, 0x42, 0x04, 0x42, 0x02, 0x49, 0x05,
+    0x46, 0x02, 0x48, 0x03, 0x4A, 0x01, 0x41, 0x05, 0x42, 0x01, 0x41, 0x06, 0x42, 0x00, 0x41, 0x07,
+    0x41, 0x00, 0x41, 0x07, 0x44, 0x07, 0x44, 0x07, 0x44, 0x07, 0x44, 0x07, 0x44, 0x07, 0x44, 0x07,
+    0x41, 0x00, 0x41, 0x06, 0x42, 0x00, 0x41, 0x05, 0x42, 0x01, 0x4A, 0x01, 0x48, 0x03, 0x4A, 0x00,
+    0x4A, 0x00, 0x41, 0x09, 0x41, 0x09, 0x41, 0x09, 0x41, 0x09, 0x41, 0x09, 0x4A, 0x00, 0x4A, 0x00,
+    0x41, 0x09, 0x41, 0x09, 0x41, 0x09, 0x41, 0x09, 0x41, 0x09, 0x57, 0x57, 0x08, 0x41, 0x08, 0x41,
+    0x08, 0x41, 0x08, 0x41, 0x08, 0x48, 0x01, 0x48, 0x01, 0x41, 0x08, 0x41, 0x08, 0x41, 0x08, 0x41,
+    0x08, 0x41, 0x08, 0x41, 0x08, 0x41, 0x08, 0x03, 0x47, 0x05, 0x49, 0x03, 0x42, 0x05, 0x42, 0x01,
+    0x42, 0x07, 0x41, 0x01, 0x41, 0x08, 0x41, 0x00, 0x42, 0x0B, 0x42, 0x0B, 0x41, 0x0C, 0x41, 0x05,
+    0x49, 0x04, 0x49, 0x09, 0x41, 0x00, 0x41, 0x09, 0x41, 0x00, 0x42, 0x08, 0x41, 0x01, 0x42, 0x05,
+    0x43, 0x02, 0x4A, 0x05, 0x46, 0x02, 0x41, 0x07, 0x43, 0x07, 0x43, 0x07, 0x43, 0x07, 0x43, 0x07,
+    0x43, 0x07, 0x43, 0x07, 0x5B, 0x07, 0x43, 0x07, 0x43, 0x07, 0x43, 0x07, 0x43, 0x07, 0x43, 0x07,
+    0x43, 0x07, 0x41, 0x5F, 0x05, 0x41, 0x05, 0x41, 0x05, 0x41, 0x05, 0x41, 0x05, 0x41, 0x05, 0x41,
+    0x05, 0x41, 0x05, 0x41, 0x05, 0x41, 0x05, 0x41, 0x05, 0x43, 0x03, 0x43, 0x03, 0x43, 0x02, 0x4A,
+    0x00, 0x45, 0x00, 0x42, 0x06, 0x45, 0x05, 0x42, 0x00, 0x42, 0x04, 0x42, 0x01, 0x42, 0x03, 0x42,
+    0x02, 0x42, 0x02, 0x42, 0x03, 0x42, 0x01, 0x42, 0x04, 0x42, 0x00, 0x42, 0x05, 0x47, 0x04, 0x44,
+    0x00, 0x42, 0x03, 0x43, 0x01, 0x42, 0x03, 0x42, 0x03, 0x42, 0x02, 0x42, 0x04, 0x42, 0x01, 0x42,
+    0x04, 0x42, 0x01, 0x42, 0x05, 0x42, 0x00, 0x42, 0x06, 0x45, 0x06, 0x42, 0x42, 0x07, 0x42, 0x07,
+    0x42, 0x07, 0x42, 0x07, 0x42, 0x07, 0x42, 0x07, 0x42, 0x07, 0x42, 0x07, 0x42, 0x07, 0x42, 0x07,
+    0x42, 0x07, 0x42, 0x07, 0x42, 0x07, 0x42, 0x07, 0x55, 0x42, 0x07, 0x47, 0x06, 0x47, 0x06, 0x47,
+    0x05, 0x48, 0x05, 0x41, 0x00, 0x46, 0x04, 0x41, 0x00, 0x43, 0x00, 0x41, 0x03, 0x42, 0x00, 0x43,
+    0x00, 0x41, 0x03, 0x41, 0x01, 0x43, 0x00, 0x42, 0x02, 0x41, 0x01, 0x43, 0x01, 0x41, 0x01, 0x42,
+    0x01, 0x43, 0x01, 0x41, 0x01, 0x41, 0x02, 0x43, 0x01, 0x42, 0x00, 0x41, 0x02, 0x43, 0x02, 0x44,
+    0x02, 0x43, 0x02, 0x43, 0x03, 0x43, 0x02, 0x43, 0x03, 0x43, 0x03, 0x41, 0x04, 0x41, 0x41, 0x07,
+    0x44, 0x06, 0x45, 0x05, 0x45, 0x05, 0x46, 0x04, 0x43, 0x00, 0x42, 0x03, 0x43, 0x00, 0x42, 0x03,
+    0x43, 0x01, 0x42, 0x02, 0x43, 0x02, 0x42, 0x01, 0x43, 0x02, 0x42, 0x01, 0x43, 0x03, 0x42, 0x00,
+    0x43, 0x04, 0x46, 0x04, 0x46, 0x05, 0x45, 0x06, 0x44, 0x06, 0x42, 0x03, 0x46, 0x06, 0x49, 0x03,
+    0x42, 0x04, 0x43, 0x01, 0x42, 0x06, 0x42, 0x00, 0x42, 0x08, 0x45, 0x08, 0x45, 0x09, 0x43, 0x0A,
+    0x43, 0x0A, 0x43, 0x0A, 0x44, 0x08, 0x42, 0x00, 0x41, 0x08, 0x42, 0x00, 0x42, 0x06, 0x42, 0x02,
+    0x42, 0x04, 0x43, 0x03, 0x49, 0x05, 0x46, 0x03, 0x49, 0x01, 0x4A, 0x00, 0x41, 0x05, 0x42, 0x00,
+    0x41, 0x06, 0x44, 0x06, 0x44, 0x06, 0x44, 0x06, 0x44, 0x05, 0x42, 0x00, 0x49, 0x01, 0x48, 0x02,
+    0x41, 0x09, 0x41, 0x09, 0x41, 0x09, 0x41, 0x09, 0x41, 0x09, 0x41, 0x09, 0x03, 0x46, 0x06, 0x48,
+    0x04, 0x42, 0x04, 0x42, 0x02, 0x42, 0x06, 0x42, 0x00, 0x42, 0x08, 0x45, 0x08, 0x44, 0x0A, 0x43,
+    0x0A, 0x43, 0x0A, 0x43, 0x0A, 0x44, 0x08, 0x45, 0x08, 0x42, 0x00, 0x42, 0x03, 0x41, 0x00, 0x42,
+    0x02, 0x42, 0x01, 0x45, 0x04, 0x49, 0x05, 0x46, 0x00, 0x42, 0x0C, 0x41, 0x49, 0x03, 0x4B, 0x01,
+    0x41, 0x06, 0x42, 0x01, 0x41, 0x07, 0x41, 0x01, 0x41, 0x07, 0x41, 0x01, 0x41, 0x07, 0x41, 0x01,
+    0x41, 0x05, 0x43, 0x01, 0x4A, 0x02, 0x48, 0x04, 0x41, 0x04, 0x42, 0x03, 0x41, 0x04, 0x42, 0x03,
+    0x41, 0x05, 0x42, 0x02, 0x41, 0x06, 0x42, 0x01, 0x41, 0x06, 0x42, 0x01, 0x41, 0x07, 0x42, 0x00,
+    0x41, 0x07, 0x43, 0x02, 0x45, 0x04, 0x49, 0x02, 0x42, 0x04, 0x42, 0x00, 0x42, 0x05, 0x42, 0x00,
+    0x42, 0x06, 0x41, 0x01, 0x42, 0x09, 0x45, 0x07, 0x47, 0x06, 0x47, 0x08, 0x43, 0x0A, 0x44, 0x07,
+    0x45, 0x06, 0x46, 0x04, 0x42, 0x01, 0x49, 0x04, 0x46, 0x02, 0x59, 0x05, 0x41, 0x0A, 0x41, 0x0A,
+    0x41, 0x0A, 0x41, 0x0A, 0x41, 0x0A, 0x41, 0x0A, 0x41, 0x0A, 0x41, 0x0A, 0x41, 0x0A, 0x41, 0x0A,
+    0x41, 0x0A, 0x41, 0x0A, 0x41, 0x0A, 0x41, 0x04, 0x41, 0x07, 0x43, 0x07, 0x43, 0x07, 0x43, 0x07,
+    0x43, 0x07, 0x43, 0x07, 0x43, 0x07, 0x43, 0x07, 0x43, 0x07, 0x43, 0x07, 0x43, 0x07, 0x43, 0x07,
+    0x44, 0x05, 0x45, 0x04, 0x42, 0x01, 0x49, 0x02, 0x46, 0x02, 0x42, 0x08, 0x45, 0x08, 0x41, 0x01,
+    0x41, 0x07, 0x42, 0x01, 0x42, 0x06, 0x41, 0x03, 0x41, 0x05, 0x42, 0x03, 0x42, 0x04, 0x42, 0x03,
+    0x42, 0x04, 0x41, 0x05, 0x41, 0x03, 0x42, 0x05, 0x42, 0x02, 0x41, 0x06, 0x42, 0x02, 0x41, 0x07,
+    0x41, 0x01, 0x42, 0x07, 0x42, 0x00, 0x41, 0x09, 0x41, 0x00, 0x41, 0x09, 0x44, 0x09, 0x43, 0x0B,
+    0x42, 0x05, 0x42, 0x05, 0x42, 0x05, 0x45, 0x05, 0x42, 0x05, 0x41, 0x01, 0x41, 0x04, 0x44, 0x04,
+    0x41, 0x01, 0x41, 0x04, 0x41, 0x00, 0x41, 0x03, 0x42, 0x01, 0x42, 0x03, 0x41, 0x00, 0x41, 0x03,
+    0x42, 0x01, 0x42, 0x02, 0x42, 0x00, 0x41, 0x03, 0x41, 0x03, 0x41, 0x02, 0x41, 0x01, 0x42, 0x02,
+    0x41, 0x03, 0x41, 0x02, 0x41, 0x02, 0x41, 0x01, 0x42, 0x03, 0x42, 0x01, 0x41, 0x02, 0x41, 0x01,
+    0x41, 0x05, 0x41, 0x00, 0x42, 0x02, 0x42, 0x00, 0x41, 0x05, 0x41, 0x00, 0x41, 0x03, 0x42, 0x00,
+    0x41, 0x05, 0x41, 0x00, 0x41, 0x04, 0x44, 0x05, 0x44, 0x04, 0x43, 0x07, 0x42, 0x05, 0x43, 0x07,
+    0x42, 0x06, 0x42, 0x07, 0x42, 0x06, 0x42, 0x03, 0x00, 0x42, 0x06, 0x42, 0x01, 0x42, 0x04, 0x42,
+    0x02, 0x42, 0x04, 0x41, 0x04, 0x42, 0x02, 0x42, 0x05, 0x42, 0x00, 0x42, 0x06, 0x45, 0x08, 0x44,
+    0x09, 0x42, 0x09, 0x43, 0x09, 0x44, 0x07, 0x42, 0x00, 0x42, 0x05, 0x42, 0x02, 0x42, 0x03, 0x42,
+    0x03, 0x42, 0x03, 0x42, 0x04, 0x42, 0x01, 0x42, 0x06, 0x45, 0x07, 0x42, 0x42, 0x08, 0x41, 0x00,
+    0x42, 0x06, 0x42, 0x01, 0x41, 0x05, 0x42, 0x02, 0x42, 0x04, 0x41, 0x04, 0x42, 0x02, 0x42, 0x05,
+    0x41, 0x01, 0x42, 0x06, 0x42, 0x00, 0x41, 0x08, 0x43, 0x0A, 0x42, 0x0A, 0x41, 0x0B, 0x41, 0x0B,
+    0x41, 0x0B, 0x41, 0x0B, 0x41, 0x0B, 0x41, 0x0B, 0x41, 0x05, 0x00, 0x4B, 0x00, 0x4B, 0x08, 0x42,
+    0x08, 0x42, 0x09, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x09, 0x42, 0x08, 0x42, 0x08, 0x42,
+    0x08, 0x42, 0x09, 0x41, 0x09, 0x42, 0x08, 0x59, 0x4C, 0x01, 0x42, 0x01, 0x42, 0x01, 0x42, 0x01,
+    0x42, 0x01, 0x42, 0x01, 0x42, 0x01, 0x42, 0x01, 0x42, 0x01, 0x42, 0x01, 0x42, 0x01, 0x42, 0x01,
+    0x42, 0x01, 0x42, 0x01, 0x42, 0x01, 0x42, 0x01, 0x49, 0x41, 0x03, 0x41, 0x03, 0x42, 0x03, 0x41,
+    0x03, 0x41, 0x03, 0x41, 0x04, 0x41, 0x03, 0x41, 0x03, 0x41, 0x03, 0x41, 0x04, 0x41, 0x03, 0x41,
+    0x03, 0x41, 0x04, 0x41, 0x03, 0x41, 0x03, 0x41, 0x44, 0x00, 0x43, 0x02, 0x41, 0x02, 0x41, 0x02,
+    0x41, 0x02, 0x41, 0x02, 0x41, 0x02, 0x41, 0x02, 0x41, 0x02, 0x41, 0x02, 0x41, 0x02, 0x41, 0x02,
+    0x41, 0x02, 0x41, 0x02, 0x41, 0x02, 0x41, 0x02, 0x41, 0x02, 0x41, 0x00, 0x48, 0x02, 0x41, 0x06,
+    0x42, 0x04, 0x43, 0x04, 0x44, 0x02, 0x41, 0x01, 0x41, 0x02, 0x41, 0x01, 0x41, 0x01, 0x42, 0x02,
+    0x41, 0x00, 0x41, 0x03, 0x41, 0x00, 0x41, 0x03, 0x42, 0x58, 0x00, 0x42, 0x01, 0x41, 0x02, 0x41,
+    0x01, 0x45, 0x02, 0x47, 0x00, 0x42, 0x03, 0x44, 0x05, 0x41, 0x03, 0x45, 0x00, 0x4C, 0x03, 0x43,
+    0x04, 0x44, 0x04, 0x44, 0x03, 0x4D, 0x00, 0x44, 0x01, 0x41, 0x42, 0x06, 0x42, 0x06, 0x42, 0x06,
+    0x42, 0x06, 0x47, 0x01, 0x48, 0x00, 0x43, 0x02, 0x45, 0x04, 0x44, 0x04, 0x43, 0x05, 0x43, 0x05,
+    0x44, 0x04, 0x44, 0x04, 0x44, 0x03, 0x4B, 0x00, 0x41, 0x00, 0x44, 0x01, 0x01, 0x45, 0x02, 0x47,
+    0x00, 0x42, 0x03, 0x41, 0x00, 0x41, 0x04, 0x44, 0x07, 0x41, 0x07, 0x41, 0x07, 0x41, 0x07, 0x41,
+    0x05, 0x44, 0x03, 0x42, 0x00, 0x47, 0x02, 0x45, 0x01, 0x07, 0x41, 0x07, 0x41, 0x07, 0x41, 0x07,
+    0x41, 0x01, 0x44, 0x00, 0x41, 0x00, 0x4B, 0x03, 0x44, 0x04, 0x44, 0x05, 0x43, 0x05, 0x43, 0x05,
+    0x43, 0x05, 0x43, 0x04, 0x45, 0x03, 0x42, 0x00, 0x48, 0x01, 0x47, 0x01, 0x45, 0x02, 0x47, 0x00,
+    0x42, 0x03, 0x45, 0x04, 0x43, 0x05, 0x57, 0x07, 0x41, 0x07, 0x42, 0x04, 0x41, 0x00, 0x48, 0x01,
+    0x45, 0x01, 0x02, 0x43, 0x01, 0x44, 0x01, 0x41, 0x04, 0x41, 0x02, 0x45, 0x00, 0x45, 0x02, 0x41,
+    0x04, 0x41, 0x04, 0x41, 0x04, 0x41, 0x04, 0x41, 0x04, 0x41, 0x04, 0x41, 0x04, 0x41, 0x04, 0x41,
+    0x04, 0x41, 0x02, 0x01, 0x44, 0x00, 0x41, 0x00, 0x4B, 0x03, 0x44, 0x04, 0x44, 0x05, 0x43, 0x05,
+    0x43, 0x05, 0x43, 0x05, 0x43, 0x04, 0x45, 0x03, 0x42, 0x00, 0x48, 0x01, 0x47, 0x06, 0x44, 0x04,
+    0x41, 0x00, 0x48, 0x01, 0x46, 0x01, 0x42, 0x06, 0x42, 0x06, 0x42, 0x06, 0x42, 0x06, 0x47, 0x01,
+    0x48, 0x00, 0x42, 0x03, 0x45, 0x04, 0x44, 0x04, 0x44, 0x04, 0x44, 0x04, 0x44, 0x04, 0x44, 0x04,
+    0x44, 0x04, 0x44, 0x04, 0x44, 0x04, 0x41, 0x45, 0x05, 0x63, 0x01, 0x42, 0x01, 0x42, 0x0B, 0x42,
+    0x01, 0x42, 0x01, 0x42, 0x01, 0x42, 0x01, 0x42, 0x01, 0x42, 0x01, 0x42, 0x01, 0x42, 0x01, 0x42,
+    0x01, 0x42, 0x01, 0x42, 0x01, 0x42, 0x01, 0x41, 0x02, 0x41, 0x00, 0x43, 0x00, 0x43, 0x00, 0x42,
+    0x06, 0x42, 0x06, 0x42, 0x06, 0x42, 0x06, 0x42, 0x02, 0x42, 0x00, 0x42, 0x01, 0x42, 0x01, 0x42,
+    0x00, 0x42, 0x02, 0x45, 0x03, 0x45, 0x03, 0x45, 0x03, 0x42, 0x00, 0x42, 0x02, 0x42, 0x01, 0x41,
+    0x02, 0x42, 0x01, 0x42, 0x01, 0x42, 0x02, 0x42, 0x00, 0x42, 0x02, 0x42, 0x00, 0x42, 0x03, 0x42,
+    0x5F, 0x41, 0x00, 0x44, 0x01, 0x44, 0x00, 0x52, 0x03, 0x42, 0x02, 0x45, 0x03, 0x42, 0x03, 0x44,
+    0x03, 0x41, 0x04, 0x44, 0x03, 0x41, 0x04, 0x44, 0x03, 0x41, 0x04, 0x44, 0x03, 0x41, 0x04, 0x44,
+    0x03, 0x41, 0x04, 0x44, 0x03, 0x41, 0x04, 0x44, 0x03, 0x41, 0x04, 0x44, 0x03, 0x41, 0x04, 0x41,
+    0x41, 0x00, 0x44, 0x01, 0x48, 0x00, 0x42, 0x03, 0x45, 0x04, 0x44, 0x04, 0x44, 0x04, 0x44, 0x04,
+    0x44, 0x04, 0x44, 0x04, 0x44, 0x04, 0x44, 0x04, 0x44, 0x04, 0x41, 0x01, 0x45, 0x03, 0x47, 0x01,
+    0x42, 0x03, 0x42, 0x00, 0x41, 0x05, 0x41, 0x00, 0x41, 0x05, 0x41, 0x00, 0x41, 0x05, 0x44, 0x05,
+    0x44, 0x05, 0x41, 0x00, 0x41, 0x05, 0x41, 0x00, 0x42, 0x03, 0x42, 0x01, 0x47, 0x03, 0x45, 0x02,
+    0x41, 0x00, 0x44, 0x01, 0x48, 0x00, 0x43, 0x02, 0x45, 0x04, 0x44, 0x04, 0x43, 0x05, 0x43, 0x05,
+    0x44, 0x04, 0x44, 0x04, 0x44, 0x03, 0x4B, 0x00, 0x47, 0x01, 0x42, 0x06, 0x42, 0x06, 0x42, 0x06,
+    0x42, 0x06, 0x01, 0x44, 0x00, 0x41, 0x00, 0x4B, 0x03, 0x44, 0x04, 0x44, 0x05, 0x43, 0x05, 0x43,
+    0x05, 0x43, 0x05, 0x43, 0x04, 0x45, 0x03, 0x42, 0x00, 0x48, 0x01, 0x47, 0x07, 0x41, 0x07, 0x41,
+    0x07, 0x41, 0x07, 0x41, 0x4C, 0x00, 0x42, 0x03, 0x42, 0x03, 0x42, 0x03, 0x41, 0x04, 0x41, 0x04,
+    0x41, 0x04, 0x41, 0x04, 0x41, 0x04, 0x41, 0x04, 0x41, 0x04, 0x00, 0x45, 0x01, 0x47, 0x00, 0x41,
+    0x03, 0x44, 0x06, 0x43, 0x05, 0x45, 0x04, 0x45, 0x05, 0x44, 0x04, 0x43, 0x04, 0x4A, 0x01, 0x44,
+    0x01, 0x02, 0x40, 0x03, 0x41, 0x03, 0x41, 0x03, 0x41, 0x01, 0x45, 0x00, 0x44, 0x01, 0x41, 0x03,
+    0x41, 0x03, 0x41, 0x03, 0x41, 0x03, 0x41, 0x03, 0x41, 0x03, 0x41, 0x03, 0x41, 0x03, 0x43, 0x01,
+    0x43, 0x41, 0x05, 0x43, 0x05, 0x43, 0x05, 0x43, 0x05, 0x43, 0x05, 0x43, 0x05, 0x43, 0x05, 0x43,
+    0x05, 0x44, 0x03, 0x45, 0x03, 0x42, 0x00, 0x48, 0x01, 0x44, 0x00, 0x41, 0x42, 0x04, 0x42, 0x00,
+    0x41, 0x04, 0x41, 0x01, 0x41, 0x04, 0x41, 0x01, 0x42, 0x02, 0x42, 0x02, 0x41, 0x02, 0x41, 0x03,
+    0x41, 0x02, 0x41, 0x03, 0x42, 0x00, 0x42, 0x04, 0x41, 0x00, 0x41, 0x05, 0x41, 0x00, 0x41, 0x05,
+    0x44, 0x06, 0x42, 0x07, 0x42, 0x03, 0x41, 0x04, 0x41, 0x03, 0x45, 0x02, 0x43, 0x02, 0x42, 0x00,
+    0x41, 0x02, 0x43, 0x02, 0x41, 0x01, 0x41, 0x02, 0x43, 0x02, 0x41, 0x01, 0x41, 0x02, 0x43, 0x01,
+    0x42, 0x01, 0x42, 0x00, 0x41, 0x00, 0x42, 0x00, 0x41, 0x03, 0x41, 0x00, 0x41, 0x01, 0x41, 0x00,
+    0x41, 0x03, 0x41, 0x00, 0x41, 0x01, 0x44, 0x03, 0x44, 0x01, 0x43, 0x05, 0x42, 0x02, 0x43, 0x05,
+    0x42, 0x03, 0x42, 0x05, 0x42, 0x03, 0x42, 0x02, 0x00, 0x41, 0x04, 0x41, 0x01, 0x42, 0x02, 0x42,
+    0x02, 0x42, 0x00, 0x42, 0x04, 0x44, 0x05, 0x44, 0x06, 0x42, 0x07, 0x42, 0x06, 0x44, 0x04, 0x42,
+    0x00, 0x42, 0x03, 0x41, 0x02, 0x41, 0x02, 0x42, 0x02, 0x42, 0x00, 0x42, 0x04, 0x42, 0x42, 0x04,
+    0x42, 0x00, 0x41, 0x04, 0x41, 0x01, 0x42, 0x03, 0x41, 0x01, 0x42, 0x02, 0x42, 0x02, 0x41, 0x02,
+    0x41, 0x03, 0x42, 0x01, 0x41, 0x03, 0x42, 0x00, 0x42, 0x04, 0x41, 0x00, 0x41, 0x05, 0x44, 0x06,
+    0x42, 0x07, 0x42, 0x07, 0x42, 0x07, 0x41, 0x08, 0x41, 0x05, 0x43, 0x06, 0x43, 0x05, 0x00, 0x48,
+    0x01, 0x48, 0x07, 0x41, 0x07, 0x42, 0x06, 0x42, 0x06, 0x42, 0x06, 0x42, 0x07, 0x42, 0x06, 0x42,
+    0x06, 0x42, 0x06, 0x49, 0x00, 0x4A, 0x03, 0x42, 0x02, 0x43, 0x02, 0x41, 0x04, 0x41, 0x04, 0x41,
+    0x04, 0x41, 0x04, 0x41, 0x03, 0x42, 0x03, 0x41, 0x02, 0x43, 0x02, 0x43, 0x04, 0x41, 0x04, 0x42,
+    0x04, 0x41, 0x04, 0x41, 0x04, 0x41, 0x04, 0x41, 0x04, 0x41, 0x04, 0x43, 0x03, 0x42, 0x67, 0x43,
+    0x02, 0x43, 0x04, 0x42, 0x03, 0x42, 0x04, 0x41, 0x04, 0x41, 0x04, 0x41, 0x04, 0x41, 0x04, 0x42,
+    0x04, 0x42, 0x03, 0x42, 0x02, 0x42, 0x03, 0x41, 0x04, 0x41, 0x04, 0x41, 0x04, 0x41, 0x03, 0x42,
+    0x03, 0x42, 0x01, 0x43, 0x02, 0x43, 0x02, 0x46, 0x01, 0x4D, 0x02, 0x45, 0x00,
+};
+
+const RleGlyph Inter_22Glyphs[] PROGMEM = {
+    { 0, 32, 0, 0, 9, 0, 0 },  // 'space'
+    { 0, 33, 2, 16, 9, 3, 2 },  // '!'
+    { 3, 34, 6, 6, 10, 2, 2 },  // '"'
+    { 16, 35, 12, 16, 15, 1, 2 },  // '#'
+    { 69, 36, 10, 19, 15, 2, 1 },  // '$'
+    { 124, 37, 17, 16, 22, 2, 2 },  // '%'
+    { 213, 38, 13, 16, 17, 2, 2 },  // '&'
+    { 270, 39, 2, 6, 7, 2, 2 },  // '''
+    { 271, 40, 5, 20, 10, 2, 2 },  // '('
+    { 311, 41, 6, 20, 10, 2, 2 },  // ')'
+    { 351, 42, 7, 7, 11, 2, 2 },  // '*'
+    { 368, 43, 11, 10, 15, 2, 5 },  // '+'
+    { 387, 44, 2, 5, 9, 3, 16 },  // ','
+    { 391, 45, 6, 2, 10, 2, 11 },  // '-'
+    { 392, 46, 2, 2, 9, 3, 16 },  // '.'
+    { 393, 47, 6, 16, 9, 1, 2 },  // '/'
+    { 426, 48, 10, 16, 15, 2, 2 },  // '0'
+    { 465, 49, 6, 16, 15, 3, 2 },  // '1'
+    { 497, 50, 10, 16, 15, 2, 2 },  // '2'
+    { 529, 51, 10, 16, 15, 2, 2 },  // '3'
+    { 566, 52, 11, 16, 15, 1, 2 },  // '4'
+    { 609, 53, 10, 16, 15, 2, 2 },  // '5'
+    { 644, 54, 10, 16, 15, 2, 2 },  // '6'
+    { 683, 55, 10, 16, 15, 2, 2 },  // '7'
+    { 713, 56, 10, 16, 15, 2, 2 },  // '8'
+    { 754, 57, 10, 16, 15, 2, 2 },  // '9'
+    { 793, 58, 2, 11, 9, 3, 7 },  // ':'
+    { 796, 59, 2, 14, 9, 3, 7 },  // ';'
+    { 802, 60, 11, 11, 15, 2, 5 },  // '<'
+    { 824, 61, 11, 7, 15, 2, 7 },  // '='
+    { 827, 62, 11, 11, 15, 2, 5 },  // '>'
+    { 849, 63, 10, 16, 15, 2, 2 },  // '?'
+    { 880, 64, 20, 20, 25, 2, 2 },  // '@'
+    { 983, 65, 15, 16, 17, 1, 2 },  // 'A'
+    { 1035, 66, 13, 16, 17, 2, 2 },  // 'B'
+    { 1081, 67, 14, 16, 18, 2, 2 },  // 'C'
+    { 1122, 68, 13, 16, 18, 3, 2 },  // 'D'
+    { 1166, 69, 12, 16, 17, 3, 2 },  // 'E'
+    { 1195, 70, 11, 16, 16, 3, 2 },  // 'F'
+    { 1223, 71, 15, 16, 20, 2, 2 },  // 'G'
+    { 1270, 72, 12, 16, 18, 3, 2 },  // 'H'
+    { 1299, 73, 2, 16, 9, 3, 2 },  // 'I'
+    { 1300, 74, 8, 16, 13, 2, 2 },  // 'J'
+    { 1331, 75, 13, 16, 17, 2, 2 },  // 'K'
+    { 1388, 76, 11, 16, 15, 2, 2 },  // 'L'
+    { 1417, 77, 15, 16, 21, 3, 2 },  // 'M'
+    { 1486, 78, 12, 16, 18, 3, 2 },  // 'N'
+    { 1531, 79, 15, 16, 20, 2, 2 },  // 'O'
+    { 1576, 80, 12, 16, 17, 3, 2 },  // 'P'
+    { 1612, 81, 15, 17, 20, 2, 2 },  // 'Q'
+    { 1660, 82, 14, 16, 18, 3, 2 },  // 'R'
+    { 1715, 83, 13, 16, 17, 2, 2 },  // 'S'
+    { 1754, 84, 13, 16, 16, 1, 2 },  // 'T'
+    { 1784, 85, 12, 16, 18, 3, 2 },  // 'U'
+    { 1818, 86, 15, 16, 17, 1, 2 },  // 'V'
+    { 1874, 87, 21, 16, 23, 1, 2 },  // 'W'
+    { 1976, 88, 14, 16, 17, 1, 2 },  // 'X'
+    { 2028, 89, 14, 16, 17, 1, 2 },  // 'Y'
+    { 2074, 90, 13, 16, 16, 1, 2 },  // 'Z'
+    { 2104, 91, 5, 20, 9, 2, 2 },  // '['
+    { 2137, 92, 6, 16, 9, 1, 2 },  // '\\'
+    { 2168, 93, 5, 20, 9, 1, 2 },  // ']'
+    { 2205, 94, 9, 9, 13, 2, 2 },  // '^'
+    { 2233, 95, 13, 2, 15, 1, 21 },  // '_'
+    { 2235, 96, 4, 3, 10, 2, 2 },  // '`'
+    { 2240, 97, 10, 12, 15, 2, 6 },  // 'a'
+    { 2266, 98, 10, 16, 15, 2, 2 },  // 'b'
+    { 2300, 99, 10, 12, 13, 2, 6 },  // 'c'
+    { 2329, 100, 10, 16, 15, 2, 2 },  // 'd'
+    { 2363, 101, 10, 12, 15, 2, 6 },  // 'e'
+    { 2386, 102, 7, 16, 9, 1, 2 },  // 'f'
+    { 2419, 103, 10, 16, 15, 2, 6 },  // 'g'
+    { 2454, 104, 10, 16, 15, 2, 2 },  // 'h'
+    { 2487, 105, 3, 16, 7, 2, 2 },  // 'i'
+    { 2490, 106, 5, 20, 7, 0, 2 },  // 'j'
+    { 2527, 107, 10, 16, 13, 2, 2 },  // 'k'
+    { 2576, 108, 2, 16, 7, 2, 2 },  // 'l'
+    { 2577, 109, 16, 12, 21, 2, 6 },  // 'm'
+    { 2624, 110, 10, 12, 15, 2, 6 },  // 'n'
+    { 2651, 111, 11, 12, 15, 2, 6 },  // 'o'
+    { 2688, 112, 10, 16, 15, 2, 6 },  // 'p'
+    { 2722, 113, 10, 16, 15, 2, 6 },  // 'q'
+    { 2756, 114, 7, 12, 10, 2, 6 },  // 'r'
+    { 2778, 115, 9, 12, 13, 2, 6 },  // 's'
+    { 2801, 116, 6, 16, 9, 1, 2 },  // 't'
+    { 2833, 117, 10, 12, 15, 2, 6 },  // 'u'
+    { 2860, 118, 11, 12, 13, 1, 6 },  // 'v'
+    { 2902, 119, 16, 12, 18, 1, 6 },  // 'w'
+    { 2968, 120, 11, 12, 13, 1, 6 },  // 'x'
+    { 3006, 121, 11, 16, 13, 1, 6 },  // 'y'
+    { 3054, 122, 11, 12, 13, 1, 6 },  // 'z'
+    { 3078, 123, 7, 20, 10, 1, 2 },  // '{'
+    { 3118, 124, 2, 20, 8, 3, 2 },  // '|'
+    { 3119, 125, 7, 20, 10, 1, 2 },  // '}'
+    { 3159, 126, 11, 3, 15, 2, 8 },  // '~'
+};
+
+const RleFont Inter_22 PROGMEM = {
+    Inter_22Data,
+    Inter_22Glyphs,
+    95, 31, 0, 31
+};
+
+#endif // RLE_INTER_22_H
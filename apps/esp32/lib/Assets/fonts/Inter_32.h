@@ -0,0 +1,425 @@
+// Inter Font - 32px Regular (Weight 400) (1-bpp source)
+// Generated by scripts/fontgen.py: 2026-10-19
+// Charset: 95 characters, 4918 bytes RLE
+
+#ifndef RLE_INTER_32_H
+#define RLE_INTER_32_H
+
+#include "RleFont.h"
+
+const uint8_t Inter_32Data[] PROGMEM = {
+    0x75, 0x05, 0x48, 0x43, 0x01, 0x46, 0x01, 0x46, 0x01, 0x46, 0x01, 0x46, 0x01, 0x42, 0x00, 0x42,
+    0x01, 0x42, 0x00, 0x41, 0x02, 0x42, 0x00, 0x41, 0x02, 0x41, 0x00, 0x05, 0x42, 0x03, 0x42, 0x07,
+    0x42, 0x03, 0x42, 0x07, 0x41, 0x04, 0x42, 0x07, 0x41, 0x04, 0x42, 0x06, 0x42, 0x04, 0x41, 0x07,
+    0x42, 0x03, 0x42, 0x07, 0x42, 0x03, 0x42, 0x02, 0x63, 0x03, 0x42, 0x03, 0x43, 0x06, 0x42, 0x03,
+    0x42, 0x07, 0x42, 0x03, 0x42, 0x07, 0x41, 0x04, 0x42, 0x06, 0x42, 0x04, 0x41, 0x04, 0x63, 0x01,
+    0x43, 0x03, 0x42, 0x07, 0x41, 0x04, 0x42, 0x06, 0x42, 0x04, 0x41, 0x07, 0x42, 0x03, 0x42, 0x07,
+    0x42, 0x03, 0x42, 0x07, 0x41, 0x04, 0x42, 0x07, 0x41, 0x04, 0x42, 0x05, 0x06, 0x41, 0x09, 0x46,
+    0x05, 0x4A, 0x03, 0x4B, 0x01, 0x43, 0x01, 0x41, 0x01, 0x42, 0x01, 0x42, 0x02, 0x41, 0x01, 0x43,
+    0x00, 0x42, 0x02, 0x41, 0x02, 0x42, 0x00, 0x42, 0x02, 0x41, 0x06, 0x42, 0x02, 0x41, 0x06, 0x44,
+    0x00, 0x41, 0x07, 0x47, 0x07, 0x48, 0x07, 0x48, 0x07, 0x47, 0x06, 0x41, 0x01, 0x43, 0x06, 0x41,
+    0x02, 0x42, 0x06, 0x41, 0x02, 0x45, 0x03, 0x41, 0x02, 0x46, 0x02, 0x41, 0x02, 0x46, 0x02, 0x41,
+    0x02, 0x42, 0x00, 0x43, 0x01, 0x41, 0x01, 0x43, 0x00, 0x4C, 0x02, 0x4A, 0x05, 0x47, 0x09, 0x41,
+    0x0C, 0x41, 0x0C, 0x41, 0x05, 0x01, 0x44, 0x09, 0x41, 0x06, 0x46, 0x07, 0x42, 0x05, 0x43, 0x01,
+    0x42, 0x06, 0x41, 0x06, 0x42, 0x03, 0x42, 0x04, 0x42, 0x06, 0x42, 0x03, 0x42, 0x04, 0x41, 0x07,
+    0x41, 0x04, 0x42, 0x03, 0x42, 0x07, 0x41, 0x04, 0x42, 0x03, 0x41, 0x08, 0x42, 0x03, 0x42, 0x02,
+    0x42, 0x08, 0x42, 0x03, 0x42, 0x01, 0x42, 0x09, 0x43, 0x01, 0x42, 0x02, 0x42, 0x0A, 0x46, 0x02,
+    0x42, 0x0C, 0x44, 0x03, 0x42, 0x02, 0x44, 0x0C, 0x42, 0x02, 0x46, 0x0B, 0x41, 0x02, 0x42, 0x02,
+    0x42, 0x09, 0x42, 0x02, 0x42, 0x02, 0x42, 0x09, 0x41, 0x03, 0x41, 0x04, 0x42, 0x07, 0x42, 0x03,
+    0x41, 0x04, 0x42, 0x07, 0x41, 0x04, 0x41, 0x04, 0x42, 0x06, 0x42, 0x04, 0x41, 0x04, 0x42, 0x05,
+    0x42, 0x05, 0x42, 0x02, 0x42, 0x06, 0x42, 0x05, 0x42, 0x02, 0x42, 0x05, 0x42, 0x07, 0x46, 0x06,
+    0x42, 0x08, 0x44, 0x02, 0x05, 0x45, 0x0B, 0x47, 0x09, 0x43, 0x00, 0x44, 0x07, 0x43, 0x03, 0x42,
+    0x07, 0x42, 0x04, 0x42, 0x07, 0x43, 0x03, 0x42, 0x07, 0x43, 0x03, 0x42, 0x08, 0x43, 0x01, 0x43,
+    0x08, 0x48, 0x0A, 0x45, 0x0B, 0x45, 0x0B, 0x47, 0x09, 0x43, 0x01, 0x43, 0x02, 0x42, 0x01, 0x43,
+    0x03, 0x43, 0x00, 0x43, 0x01, 0x42, 0x04, 0x48, 0x00, 0x43, 0x05, 0x46, 0x01, 0x43, 0x06, 0x45,
+    0x01, 0x43, 0x07, 0x43, 0x02, 0x43, 0x07, 0x44, 0x02, 0x43, 0x04, 0x47, 0x02, 0x50, 0x02, 0x49,
+    0x01, 0x43, 0x03, 0x46, 0x05, 0x40, 0x00, 0x53, 0x00, 0x41, 0x01, 0x41, 0x01, 0x41, 0x00, 0x04,
+    0x41, 0x03, 0x42, 0x03, 0x41, 0x03, 0x42, 0x02, 0x42, 0x03, 0x42, 0x02, 0x42, 0x03, 0x42, 0x03,
+    0x42, 0x02, 0x43, 0x02, 0x42, 0x03, 0x42, 0x03, 0x42, 0x03, 0x42, 0x03, 0x42, 0x03, 0x42, 0x03,
+    0x42, 0x03, 0x42, 0x03, 0x42, 0x03, 0x43, 0x03, 0x42, 0x03, 0x42, 0x03, 0x42, 0x04, 0x42, 0x03,
+    0x42, 0x04, 0x42, 0x03, 0x42, 0x04, 0x42, 0x04, 0x41, 0x42, 0x05, 0x41, 0x05, 0x42, 0x05, 0x42,
+    0x04, 0x42, 0x05, 0x42, 0x04, 0x42, 0x04, 0x42, 0x05, 0x42, 0x04, 0x42, 0x04, 0x42, 0x04, 0x42,
+    0x04, 0x43, 0x03, 0x43, 0x03, 0x43, 0x03, 0x43, 0x03, 0x43, 0x03, 0x42, 0x04, 0x42, 0x04, 0x42,
+    0x04, 0x42, 0x03, 0x42, 0x04, 0x42, 0x04, 0x42, 0x03, 0x42, 0x04, 0x42, 0x03, 0x42, 0x04, 0x41,
+    0x04, 0x42, 0x04, 0x03, 0x41, 0x07, 0x41, 0x03, 0x41, 0x01, 0x41, 0x01, 0x4B, 0x00, 0x48, 0x02,
+    0x44, 0x04, 0x44, 0x03, 0x45, 0x02, 0x42, 0x01, 0x42, 0x02, 0x41, 0x02, 0x40, 0x01, 0x05, 0x42,
+    0x0B, 0x42, 0x0B, 0x42, 0x0B, 0x42, 0x0B, 0x42, 0x0B, 0x42, 0x05, 0x6C, 0x05, 0x42, 0x0B, 0x42,
+    0x0B, 0x42, 0x0B, 0x42, 0x0B, 0x42, 0x0B, 0x42, 0x05, 0x48, 0x00, 0x41, 0x00, 0x41, 0x00, 0x43,
+    0x00, 0x41, 0x00, 0x5A, 0x48, 0x05, 0x42, 0x05, 0x42, 0x05, 0x41, 0x05, 0x42, 0x05, 0x42, 0x05,
+    0x42, 0x05, 0x41, 0x05, 0x42, 0x05, 0x42, 0x05, 0x41, 0x05, 0x42, 0x05, 0x42, 0x05, 0x42, 0x05,
+    0x41, 0x05, 0x42, 0x05, 0x42, 0x05, 0x41, 0x05, 0x42, 0x05, 0x42, 0x05, 0x42, 0x04, 0x42, 0x05,
+    0x42, 0x05, 0x42, 0x05, 0x04, 0x45, 0x06, 0x48, 0x04, 0x44, 0x00, 0x44, 0x03, 0x42, 0x04, 0x43,
+    0x01, 0x43, 0x05, 0x42, 0x01, 0x42, 0x06, 0x43, 0x00, 0x42, 0x07, 0x46, 0x07, 0x46, 0x07, 0x45,
+    0x08, 0x45, 0x08, 0x45, 0x08, 0x45, 0x08, 0x45, 0x08, 0x45, 0x08, 0x46, 0x07, 0x42, 0x00, 0x42,
+    0x07, 0x42, 0x00, 0x42, 0x06, 0x43, 0x00, 0x42, 0x06, 0x42, 0x02, 0x42, 0x04, 0x43, 0x02, 0x44,
+    0x00, 0x44, 0x04, 0x48, 0x07, 0x45, 0x03, 0x06, 0x41, 0x05, 0x42, 0x04, 0x43, 0x02, 0x45, 0x00,
+    0x54, 0x01, 0x44, 0x03, 0x42, 0x05, 0x42, 0x05, 0x42, 0x05, 0x42, 0x05, 0x42, 0x05, 0x42, 0x05,
+    0x42, 0x05, 0x42, 0x05, 0x42, 0x05, 0x42, 0x05, 0x42, 0x05, 0x42, 0x05, 0x42, 0x05, 0x42, 0x05,
+    0x42, 0x05, 0x42, 0x03, 0x46, 0x06, 0x49, 0x03, 0x44, 0x01, 0x44, 0x01, 0x43, 0x05, 0x43, 0x00,
+    0x42, 0x07, 0x46, 0x07, 0x46, 0x07, 0x42, 0x0B, 0x42, 0x0A, 0x43, 0x0A, 0x42, 0x0A, 0x43, 0x09,
+    0x43, 0x09, 0x43, 0x09, 0x43, 0x09, 0x43, 0x08, 0x44, 0x08, 0x44, 0x08, 0x44, 0x08, 0x44, 0x09,
+    0x43, 0x09, 0x6C, 0x03, 0x46, 0x06, 0x48, 0x04, 0x44, 0x00, 0x44, 0x02, 0x43, 0x04, 0x43, 0x01,
+    0x42, 0x06, 0x42, 0x01, 0x42, 0x06, 0x42, 0x0B, 0x42, 0x0B, 0x42, 0x0A, 0x43, 0x08, 0x44, 0x07,
+    0x45, 0x08, 0x46, 0x07, 0x40, 0x01, 0x44, 0x0B, 0x43, 0x0B, 0x42, 0x0B, 0x42, 0x0B, 0x46, 0x07,
+    0x46, 0x07, 0x42, 0x00, 0x43, 0x05, 0x43, 0x00, 0x45, 0x00, 0x45, 0x02, 0x4A, 0x05, 0x46, 0x03,
+    0x09, 0x42, 0x0C, 0x42, 0x0B, 0x43, 0x0A, 0x44, 0x0A, 0x44, 0x09, 0x45, 0x08, 0x42, 0x00, 0x42,
+    0x07, 0x43, 0x00, 0x42, 0x07, 0x42, 0x01, 0x42, 0x06, 0x42, 0x02, 0x42, 0x05, 0x42, 0x03, 0x42,
+    0x05, 0x42, 0x03, 0x42, 0x04, 0x42, 0x04, 0x42, 0x03, 0x42, 0x05, 0x42, 0x03, 0x42, 0x05, 0x42,
+    0x02, 0x5F, 0x09, 0x43, 0x0B, 0x42, 0x0C, 0x42, 0x0C, 0x42, 0x0C, 0x42, 0x0C, 0x42, 0x02, 0x02,
+    0x4B, 0x03, 0x4B, 0x02, 0x4C, 0x02, 0x42, 0x0C, 0x42, 0x0C, 0x42, 0x0C, 0x42, 0x0B, 0x43, 0x00,
+    0x44, 0x05, 0x4B, 0x03, 0x45, 0x00, 0x45, 0x02, 0x43, 0x05, 0x43, 0x01, 0x42, 0x07, 0x42, 0x0C,
+    0x42, 0x0C, 0x43, 0x0B, 0x43, 0x0B, 0x43, 0x0B, 0x47, 0x07, 0x42, 0x00, 0x43, 0x06, 0x43, 0x01,
+    0x43, 0x05, 0x42, 0x03, 0x44, 0x00, 0x45, 0x03, 0x4A, 0x06, 0x46, 0x04, 0x04, 0x46, 0x05, 0x49,
+    0x03, 0x45, 0x00, 0x44, 0x02, 0x43, 0x04, 0x42, 0x01, 0x43, 0x05, 0x43, 0x00, 0x42, 0x07, 0x42,
+    0x00, 0x42, 0x0A, 0x42, 0x0B, 0x42, 0x02, 0x45, 0x02, 0x42, 0x00, 0x48, 0x01, 0x46, 0x01, 0x44,
+    0x00, 0x44, 0x05, 0x47, 0x07, 0x46, 0x07, 0x46, 0x07, 0x46, 0x07, 0x46, 0x07, 0x42, 0x00, 0x42,
+    0x07, 0x42, 0x00, 0x43, 0x06, 0x42, 0x01, 0x42, 0x05, 0x42, 0x02, 0x44, 0x01, 0x44, 0x03, 0x49,
+    0x06, 0x45, 0x03, 0x6C, 0x0A, 0x42, 0x0A, 0x43, 0x09, 0x43, 0x0A, 0x42, 0x0A, 0x43, 0x0A, 0x42,
+    0x0A, 0x43, 0x0A, 0x42, 0x0A, 0x43, 0x0A, 0x42, 0x0A, 0x43, 0x0A, 0x43, 0x0A, 0x42, 0x0B, 0x42,
+    0x0A, 0x43, 0x0A, 0x42, 0x0B, 0x42, 0x0B, 0x42, 0x0B, 0x42, 0x0B, 0x42, 0x07, 0x03, 0x46, 0x07,
+    0x49, 0x04, 0x44, 0x01, 0x44, 0x02, 0x43, 0x04, 0x43, 0x02, 0x43, 0x05, 0x43, 0x01, 0x42, 0x06,
+    0x43, 0x01, 0x42, 0x06, 0x43, 0x01, 0x43, 0x05, 0x42, 0x03, 0x43, 0x02, 0x44, 0x04, 0x49, 0x05,
+    0x49, 0x04, 0x44, 0x01, 0x44, 0x02, 0x43, 0x05, 0x43, 0x00, 0x43, 0x07, 0x42, 0x00, 0x43, 0x07,
+    0x42, 0x00, 0x42, 0x08, 0x46, 0x08, 0x47, 0x07, 0x42, 0x01, 0x42, 0x07, 0x42, 0x01, 0x43, 0x05,
+    0x43, 0x02, 0x44, 0x01, 0x44, 0x04, 0x49, 0x06, 0x46, 0x04, 0x03, 0x46, 0x07, 0x48, 0x05, 0x44,
+    0x01, 0x43, 0x03, 0x43, 0x05, 0x42, 0x02, 0x42, 0x06, 0x43, 0x00, 0x43, 0x07, 0x42, 0x00, 0x43,
+    0x07, 0x42, 0x00, 0x42, 0x08, 0x42, 0x00, 0x42, 0x08, 0x42, 0x00, 0x43, 0x07, 0x43, 0x00, 0x42,
+    0x06, 0x44, 0x00, 0x43, 0x05, 0x44, 0x01, 0x44, 0x01, 0x45, 0x03, 0x4B, 0x04, 0x45, 0x01, 0x42,
+    0x0C, 0x42, 0x0C, 0x42, 0x01, 0x42, 0x06, 0x43, 0x01, 0x42, 0x06, 0x42, 0x02, 0x43, 0x04, 0x43,
+    0x03, 0x44, 0x00, 0x44, 0x05, 0x48, 0x07, 0x45, 0x05, 0x48, 0x20, 0x48, 0x48, 0x20, 0x48, 0x00,
+    0x41, 0x00, 0x41, 0x00, 0x43, 0x00, 0x41, 0x00, 0x0C, 0x41, 0x0A, 0x43, 0x08, 0x45, 0x06, 0x46,
+    0x05, 0x46, 0x05, 0x46, 0x04, 0x47, 0x06, 0x45, 0x08, 0x43, 0x0A, 0x45, 0x08, 0x48, 0x08, 0x48,
+    0x07, 0x48, 0x08, 0x46, 0x0A, 0x43, 0x0C, 0x41, 0x6C, 0x3B, 0x6C, 0x40, 0x0D, 0x42, 0x0B, 0x45,
+    0x08, 0x47, 0x09, 0x46, 0x09, 0x46, 0x09, 0x46, 0x09, 0x45, 0x0A, 0x43, 0x07, 0x46, 0x05, 0x47,
+    0x03, 0x48, 0x02, 0x48, 0x05, 0x46, 0x07, 0x43, 0x0A, 0x41, 0x0C, 0x03, 0x46, 0x06, 0x49, 0x03,
+    0x44, 0x01, 0x44, 0x01, 0x43, 0x05, 0x43, 0x00, 0x42, 0x07, 0x46, 0x07, 0x46, 0x07, 0x42, 0x0B,
+    0x42, 0x0A, 0x43, 0x0A, 0x43, 0x08, 0x44, 0x08, 0x44, 0x09, 0x43, 0x09, 0x43, 0x09, 0x43, 0x0A,
+    0x43, 0x0A, 0x42, 0x0B, 0x42, 0x29, 0x43, 0x0A, 0x43, 0x0A, 0x43, 0x04, 0x09, 0x49, 0x10, 0x4D,
+    0x0C, 0x47, 0x01, 0x47, 0x09, 0x44, 0x09, 0x44, 0x07, 0x43, 0x0D, 0x43, 0x05, 0x42, 0x10, 0x43,
+    0x03, 0x42, 0x05, 0x44, 0x02, 0x42, 0x01, 0x42, 0x03, 0x42, 0x03, 0x48, 0x00, 0x42, 0x02, 0x42,
+    0x01, 0x42, 0x03, 0x4D, 0x02, 0x42, 0x01, 0x41, 0x04, 0x43, 0x03, 0x44, 0x04, 0x45, 0x03, 0x43,
+    0x05, 0x43, 0x04, 0x45, 0x03, 0x42, 0x06, 0x43, 0x04, 0x45, 0x02, 0x43, 0x06, 0x43, 0x04, 0x44,
+    0x03, 0x42, 0x07, 0x42, 0x05, 0x44, 0x03, 0x42, 0x07, 0x42, 0x05, 0x41, 0x00, 0x41, 0x03, 0x42,
+    0x07, 0x42, 0x04, 0x42, 0x00, 0x41, 0x03, 0x42, 0x07, 0x42, 0x04, 0x42, 0x00, 0x41, 0x03, 0x42,
+    0x06, 0x43, 0x03, 0x42, 0x01, 0x42, 0x02, 0x42, 0x05, 0x43, 0x03, 0x43, 0x01, 0x42, 0x02, 0x43,
+    0x03, 0x44, 0x02, 0x43, 0x02, 0x42, 0x03, 0x51, 0x04, 0x42, 0x03, 0x46, 0x00, 0x47, 0x05, 0x43,
+    0x03, 0x44, 0x02, 0x44, 0x03, 0x42, 0x01, 0x43, 0x12, 0x43, 0x02, 0x43, 0x0F, 0x44, 0x04, 0x44,
+    0x0B, 0x45, 0x06, 0x48, 0x02, 0x47, 0x0A, 0x50, 0x0E, 0x4A, 0x07, 0x07, 0x43, 0x10, 0x44, 0x0F,
+    0x44, 0x0E, 0x46, 0x0D, 0x42, 0x00, 0x42, 0x0C, 0x43, 0x00, 0x42, 0x0C, 0x42, 0x01, 0x43, 0x0B,
+    0x42, 0x02, 0x42, 0x0A, 0x43, 0x02, 0x43, 0x09, 0x42, 0x03, 0x43, 0x09, 0x42, 0x04, 0x43, 0x07,
+    0x43, 0x04, 0x43, 0x07, 0x42, 0x06, 0x42, 0x06, 0x43, 0x06, 0x43, 0x05, 0x4E, 0x05, 0x4F, 0x03,
+    0x50, 0x03, 0x43, 0x08, 0x43, 0x02, 0x43, 0x0A, 0x43, 0x01, 0x43, 0x0A, 0x43, 0x01, 0x42, 0x0C,
+    0x47, 0x0C, 0x47, 0x0D, 0x42, 0x4C, 0x04, 0x4E, 0x02, 0x4F, 0x01, 0x43, 0x07, 0x43, 0x01, 0x43,
+    0x08, 0x43, 0x00, 0x43, 0x08, 0x43, 0x00, 0x43, 0x08, 0x43, 0x00, 0x43, 0x08, 0x43, 0x00, 0x43,
+    0x08, 0x42, 0x01, 0x43, 0x06, 0x44, 0x01, 0x4E, 0x02, 0x4E, 0x02, 0x4F, 0x01, 0x43, 0x07, 0x44,
+    0x00, 0x43, 0x09, 0x47, 0x09, 0x47, 0x09, 0x47, 0x09, 0x47, 0x09, 0x47, 0x08, 0x43, 0x00, 0x50,
+    0x00, 0x4F, 0x01, 0x4D, 0x03, 0x06, 0x47, 0x0A, 0x4B, 0x07, 0x45, 0x01, 0x45, 0x05, 0x43, 0x07,
+    0x43, 0x03, 0x43, 0x09, 0x43, 0x02, 0x42, 0x0B, 0x42, 0x01, 0x43, 0x0B, 0x42, 0x01, 0x42, 0x11,
+    0x42, 0x11, 0x42, 0x10, 0x43, 0x10, 0x43, 0x10, 0x43, 0x11, 0x42, 0x11, 0x42, 0x11, 0x43, 0x0B,
+    0x42, 0x01, 0x43, 0x0B, 0x43, 0x01, 0x42, 0x0B, 0x42, 0x02, 0x43, 0x09, 0x43, 0x03, 0x43, 0x07,
+    0x43, 0x05, 0x45, 0x01, 0x45, 0x07, 0x4B, 0x0A, 0x47, 0x05, 0x4D, 0x05, 0x4E, 0x04, 0x50, 0x02,
+    0x43, 0x07, 0x44, 0x02, 0x43, 0x09, 0x43, 0x01, 0x43, 0x0A, 0x43, 0x00, 0x43, 0x0A, 0x43, 0x00,
+    0x43, 0x0B, 0x42, 0x00, 0x43, 0x0B, 0x42, 0x00, 0x43, 0x0B, 0x42, 0x00, 0x43, 0x0B, 0x47, 0x0B,
+    0x47, 0x0B, 0x47, 0x0B, 0x42, 0x00, 0x43, 0x0B, 0x42, 0x00, 0x43, 0x0B, 0x42, 0x00, 0x43, 0x0A,
+    0x43, 0x00, 0x43, 0x0A, 0x42, 0x01, 0x43, 0x09, 0x43, 0x01, 0x43, 0x07, 0x44, 0x02, 0x50, 0x02,
+    0x4E, 0x04, 0x4D, 0x05, 0x50, 0x00, 0x50, 0x00, 0x50, 0x00, 0x43, 0x0D, 0x43, 0x0D, 0x43, 0x0D,
+    0x43, 0x0D, 0x43, 0x0D, 0x43, 0x0D, 0x43, 0x0D, 0x4F, 0x01, 0x4F, 0x01, 0x4F, 0x01, 0x43, 0x0D,
+    0x43, 0x0D, 0x43, 0x0D, 0x43, 0x0D, 0x43, 0x0D, 0x43, 0x0D, 0x43, 0x0D, 0x75, 0x73, 0x0B, 0x43,
+    0x0B, 0x43, 0x0B, 0x43, 0x0B, 0x43, 0x0B, 0x43, 0x0B, 0x43, 0x0B, 0x4E, 0x00, 0x4E, 0x00, 0x4E,
+    0x00, 0x43, 0x0B, 0x43, 0x0B, 0x43, 0x0B, 0x43, 0x0B, 0x43, 0x0B, 0x43, 0x0B, 0x43, 0x0B, 0x43,
+    0x0B, 0x43, 0x0B, 0x43, 0x0B, 0x06, 0x48, 0x09, 0x4C, 0x05, 0x46, 0x01, 0x46, 0x03, 0x44, 0x07,
+    0x44, 0x01, 0x43, 0x0A, 0x43, 0x01, 0x43, 0x0B, 0x47, 0x0C, 0x42, 0x00, 0x43, 0x10, 0x42, 0x11,
+    0x42, 0x11, 0x42, 0x11, 0x42, 0x11, 0x42, 0x07, 0x4C, 0x07, 0x4C, 0x07, 0x4D, 0x0D, 0x46, 0x0D,
+    0x42, 0x00, 0x43, 0x0C, 0x42, 0x00, 0x43, 0x0B, 0x43, 0x01, 0x44, 0x07, 0x45, 0x02, 0x46, 0x01,
+    0x47, 0x05, 0x4D, 0x08, 0x48, 0x04, 0x43, 0x0A, 0x47, 0x0A, 0x47, 0x0A, 0x47, 0x0A, 0x47, 0x0A,
+    0x47, 0x0A, 0x47, 0x0A, 0x47, 0x0A, 0x47, 0x0A, 0x7F, 0x40, 0x0A, 0x47, 0x0A, 0x47, 0x0A, 0x47,
+    0x0A, 0x47, 0x0A, 0x47, 0x0A, 0x47, 0x0A, 0x47, 0x0A, 0x47, 0x0A, 0x47, 0x0A, 0x47, 0x0A, 0x43,
+    0x7F, 0x44, 0x08, 0x43, 0x08, 0x43, 0x08, 0x43, 0x08, 0x43, 0x08, 0x43, 0x08, 0x43, 0x08, 0x43,
+    0x08, 0x43, 0x08, 0x43, 0x08, 0x43, 0x08, 0x43, 0x08, 0x43, 0x08, 0x43, 0x08, 0x43, 0x08, 0x43,
+    0x08, 0x46, 0x05, 0x46, 0x05, 0x46, 0x05, 0x42, 0x00, 0x43, 0x03, 0x43, 0x01, 0x4A, 0x01, 0x49,
+    0x04, 0x45, 0x03, 0x43, 0x09, 0x48, 0x08, 0x44, 0x00, 0x43, 0x07, 0x44, 0x01, 0x43, 0x06, 0x43,
+    0x03, 0x43, 0x05, 0x43, 0x04, 0x43, 0x04, 0x43, 0x05, 0x43, 0x03, 0x43, 0x06, 0x43, 0x02, 0x43,
+    0x07, 0x43, 0x01, 0x43, 0x08, 0x43, 0x00, 0x44, 0x08, 0x49, 0x08, 0x4A, 0x07, 0x45, 0x01, 0x43,
+    0x06, 0x44, 0x02, 0x44, 0x05, 0x43, 0x04, 0x43, 0x05, 0x43, 0x05, 0x43, 0x04, 0x43, 0x06, 0x43,
+    0x03, 0x43, 0x06, 0x43, 0x03, 0x43, 0x07, 0x43, 0x02, 0x43, 0x08, 0x43, 0x01, 0x43, 0x08, 0x44,
+    0x00, 0x43, 0x09, 0x43, 0x00, 0x43, 0x0A, 0x43, 0x43, 0x0A, 0x43, 0x0A, 0x43, 0x0A, 0x43, 0x0A,
+    0x43, 0x0A, 0x43, 0x0A, 0x43, 0x0A, 0x43, 0x0A, 0x43, 0x0A, 0x43, 0x0A, 0x43, 0x0A, 0x43, 0x0A,
+    0x43, 0x0A, 0x43, 0x0A, 0x43, 0x0A, 0x43, 0x0A, 0x43, 0x0A, 0x43, 0x0A, 0x43, 0x0A, 0x43, 0x0A,
+    0x6C, 0x44, 0x0C, 0x49, 0x0A, 0x4A, 0x0A, 0x4A, 0x0A, 0x4B, 0x08, 0x48, 0x00, 0x42, 0x08, 0x48,
+    0x00, 0x42, 0x08, 0x48, 0x00, 0x43, 0x06, 0x42, 0x00, 0x45, 0x01, 0x42, 0x06, 0x42, 0x00, 0x45,
+    0x01, 0x42, 0x06, 0x42, 0x00, 0x45, 0x01, 0x43, 0x04, 0x42, 0x01, 0x45, 0x02, 0x42, 0x04, 0x42,
+    0x01, 0x45, 0x02, 0x42, 0x04, 0x42, 0x01, 0x45, 0x02, 0x43, 0x02, 0x42, 0x02, 0x45, 0x03, 0x42,
+    0x02, 0x42, 0x02, 0x45, 0x03, 0x42, 0x02, 0x41, 0x03, 0x45, 0x03, 0x43, 0x00, 0x42, 0x03, 0x45,
+    0x04, 0x42, 0x00, 0x42, 0x03, 0x45, 0x04, 0x42, 0x00, 0x41, 0x04, 0x45, 0x04, 0x45, 0x04, 0x45,
+    0x05, 0x44, 0x04, 0x45, 0x05, 0x43, 0x05, 0x45, 0x06, 0x42, 0x05, 0x42, 0x43, 0x0A, 0x48, 0x09,
+    0x48, 0x09, 0x49, 0x08, 0x4A, 0x07, 0x4A, 0x07, 0x46, 0x00, 0x43, 0x06, 0x46, 0x01, 0x43, 0x05,
+    0x46, 0x02, 0x42, 0x05, 0x46, 0x02, 0x43, 0x04, 0x46, 0x03, 0x43, 0x03, 0x46, 0x04, 0x42, 0x03,
+    0x46, 0x04, 0x43, 0x02, 0x46, 0x05, 0x43, 0x01, 0x46, 0x06, 0x42, 0x01, 0x46, 0x06, 0x43, 0x00,
+    0x46, 0x07, 0x4A, 0x08, 0x49, 0x08, 0x49, 0x09, 0x48, 0x0A, 0x47, 0x0A, 0x47, 0x0B, 0x43, 0x06,
+    0x48, 0x0B, 0x4C, 0x08, 0x45, 0x02, 0x45, 0x06, 0x44, 0x06, 0x44, 0x04, 0x43, 0x0A, 0x43, 0x03,
+    0x42, 0x0C, 0x42, 0x02, 0x43, 0x0C, 0x43, 0x01, 0x42, 0x0D, 0x43, 0x01, 0x42, 0x0E, 0x42, 0x01,
+    0x42, 0x0E, 0x42, 0x00, 0x43, 0x0E, 0x47, 0x0E, 0x47, 0x0E, 0x47, 0x0E, 0x42, 0x01, 0x42, 0x0E,
+    0x42, 0x01, 0x42, 0x0D, 0x43, 0x01, 0x43, 0x0C, 0x43, 0x02, 0x42, 0x0C, 0x42, 0x03, 0x43, 0x0A,
+    0x43, 0x04, 0x44, 0x06, 0x44, 0x06, 0x45, 0x02, 0x45, 0x08, 0x4C, 0x0B, 0x48, 0x06, 0x4D, 0x03,
+    0x4F, 0x01, 0x50, 0x00, 0x43, 0x08, 0x43, 0x00, 0x43, 0x09, 0x47, 0x09, 0x47, 0x0A, 0x46, 0x0A,
+    0x46, 0x09, 0x47, 0x09, 0x47, 0x07, 0x44, 0x00, 0x50, 0x00, 0x4E, 0x02, 0x4C, 0x04, 0x43, 0x0D,
+    0x43, 0x0D, 0x43, 0x0D, 0x43, 0x0D, 0x43, 0x0D, 0x43, 0x0D, 0x43, 0x0D, 0x43, 0x0D, 0x43, 0x0D,
+    0x06, 0x48, 0x0B, 0x4B, 0x09, 0x45, 0x01, 0x46, 0x06, 0x43, 0x07, 0x44, 0x04, 0x43, 0x0A, 0x43,
+    0x03, 0x42, 0x0B, 0x43, 0x02, 0x43, 0x0C, 0x43, 0x01, 0x42, 0x0D, 0x43, 0x00, 0x43, 0x0E, 0x42,
+    0x00, 0x43, 0x0E, 0x42, 0x00, 0x43, 0x0E, 0x42, 0x00, 0x43, 0x0E, 0x42, 0x00, 0x43, 0x0E, 0x42,
+    0x00, 0x43, 0x0E, 0x42, 0x00, 0x43, 0x0E, 0x42, 0x01, 0x42, 0x0D, 0x43, 0x01, 0x43, 0x0C, 0x43,
+    0x02, 0x42, 0x06, 0x41, 0x02, 0x43, 0x03, 0x43, 0x04, 0x49, 0x04, 0x43, 0x04, 0x47, 0x06, 0x45,
+    0x01, 0x47, 0x07, 0x50, 0x07, 0x48, 0x01, 0x44, 0x13, 0x41, 0x00, 0x4F, 0x04, 0x50, 0x03, 0x43,
+    0x07, 0x45, 0x02, 0x43, 0x09, 0x43, 0x02, 0x43, 0x0A, 0x43, 0x01, 0x43, 0x0A, 0x43, 0x01, 0x43,
+    0x0A, 0x43, 0x01, 0x43, 0x0A, 0x43, 0x01, 0x43, 0x0A, 0x42, 0x02, 0x43, 0x08, 0x44, 0x02, 0x50,
+    0x03, 0x4E, 0x05, 0x43, 0x03, 0x45, 0x06, 0x43, 0x05, 0x44, 0x05, 0x43, 0x06, 0x44, 0x04, 0x43,
+    0x07, 0x43, 0x04, 0x43, 0x08, 0x43, 0x03, 0x43, 0x08, 0x44, 0x02, 0x43, 0x09, 0x43, 0x02, 0x43,
+    0x0A, 0x43, 0x01, 0x43, 0x0A, 0x43, 0x01, 0x43, 0x0B, 0x43, 0x00, 0x43, 0x0B, 0x44, 0x04, 0x48,
+    0x07, 0x4B, 0x05, 0x4E, 0x03, 0x43, 0x06, 0x43, 0x02, 0x43, 0x08, 0x43, 0x01, 0x43, 0x08, 0x43,
+    0x01, 0x42, 0x0A, 0x42, 0x01, 0x43, 0x0F, 0x44, 0x0D, 0x47, 0x0C, 0x49, 0x09, 0x4A, 0x0B, 0x47,
+    0x0E, 0x44, 0x0F, 0x47, 0x0A, 0x47, 0x0B, 0x42, 0x00, 0x42, 0x0A, 0x43, 0x00, 0x43, 0x09, 0x42,
+    0x02, 0x44, 0x05, 0x44, 0x02, 0x4E, 0x05, 0x4B, 0x07, 0x48, 0x04, 0x75, 0x06, 0x42, 0x0E, 0x42,
+    0x0E, 0x42, 0x0E, 0x42, 0x0E, 0x42, 0x0E, 0x42, 0x0E, 0x42, 0x0E, 0x42, 0x0E, 0x42, 0x0E, 0x42,
+    0x0E, 0x42, 0x0E, 0x42, 0x0E, 0x42, 0x0E, 0x42, 0x0E, 0x42, 0x0E, 0x42, 0x0E, 0x42, 0x0E, 0x42,
+    0x0E, 0x42, 0x0E, 0x42, 0x07, 0x43, 0x0A, 0x47, 0x0A, 0x47, 0x0A, 0x47, 0x0A, 0x47, 0x0A, 0x47,
+    0x0A, 0x47, 0x0A, 0x47, 0x0A, 0x47, 0x0A, 0x47, 0x0A, 0x47, 0x0A, 0x47, 0x0A, 0x47, 0x0A, 0x47,
+    0x0A, 0x47, 0x0A, 0x47, 0x0A, 0x43, 0x00, 0x42, 0x0A, 0x42, 0x01, 0x42, 0x0A, 0x42, 0x01, 0x43,
+    0x08, 0x43, 0x02, 0x43, 0x06, 0x43, 0x03, 0x4E, 0x04, 0x4C, 0x07, 0x48, 0x04, 0x43, 0x0D, 0x46,
+    0x0C, 0x43, 0x00, 0x43, 0x0B, 0x42, 0x01, 0x43, 0x0A, 0x43, 0x02, 0x42, 0x0A, 0x43, 0x02, 0x43,
+    0x09, 0x42, 0x03, 0x43, 0x08, 0x43, 0x04, 0x42, 0x08, 0x42, 0x05, 0x43, 0x07, 0x42, 0x06, 0x42,
+    0x06, 0x43, 0x06, 0x42, 0x06, 0x42, 0x07, 0x43, 0x05, 0x42, 0x08, 0x42, 0x04, 0x42, 0x09, 0x42,
+    0x04, 0x42, 0x0A, 0x42, 0x02, 0x43, 0x0A, 0x42, 0x02, 0x42, 0x0B, 0x43, 0x01, 0x42, 0x0C, 0x42,
+    0x00, 0x42, 0x0D, 0x42, 0x00, 0x42, 0x0D, 0x46, 0x0E, 0x44, 0x0F, 0x44, 0x10, 0x43, 0x07, 0x43,
+    0x08, 0x43, 0x08, 0x43, 0x00, 0x42, 0x08, 0x44, 0x07, 0x43, 0x00, 0x42, 0x07, 0x45, 0x07, 0x42,
+    0x01, 0x43, 0x06, 0x45, 0x07, 0x42, 0x01, 0x43, 0x06, 0x45, 0x06, 0x43, 0x02, 0x42, 0x06, 0x42,
+    0x00, 0x42, 0x05, 0x43, 0x02, 0x42, 0x05, 0x42, 0x01, 0x42, 0x05, 0x42, 0x03, 0x42, 0x05, 0x42,
+    0x01, 0x42, 0x05, 0x42, 0x03, 0x43, 0x04, 0x42, 0x01, 0x43, 0x04, 0x42, 0x04, 0x42, 0x03, 0x43,
+    0x02, 0x42, 0x03, 0x42, 0x05, 0x42, 0x03, 0x42, 0x03, 0x42, 0x03, 0x42, 0x05, 0x42, 0x03, 0x42,
+    0x03, 0x42, 0x03, 0x42, 0x05, 0x43, 0x02, 0x42, 0x04, 0x42, 0x02, 0x42, 0x06, 0x42, 0x01, 0x42,
+    0x05, 0x42, 0x01, 0x42, 0x07, 0x42, 0x01, 0x42, 0x05, 0x42, 0x01, 0x42, 0x07, 0x42, 0x01, 0x42,
+    0x05, 0x42, 0x01, 0x42, 0x08, 0x42, 0x00, 0x42, 0x06, 0x42, 0x00, 0x42, 0x08, 0x45, 0x07, 0x45,
+    0x09, 0x45, 0x07, 0x45, 0x09, 0x45, 0x07, 0x45, 0x0A, 0x43, 0x09, 0x43, 0x0B, 0x43, 0x09, 0x43,
+    0x0B, 0x43, 0x09, 0x43, 0x05, 0x00, 0x43, 0x0B, 0x42, 0x02, 0x43, 0x09, 0x43, 0x03, 0x43, 0x07,
+    0x43, 0x04, 0x43, 0x06, 0x43, 0x06, 0x43, 0x05, 0x42, 0x08, 0x43, 0x03, 0x43, 0x09, 0x43, 0x01,
+    0x43, 0x0A, 0x43, 0x00, 0x43, 0x0C, 0x46, 0x0E, 0x45, 0x0E, 0x44, 0x0F, 0x44, 0x0F, 0x45, 0x0D,
+    0x47, 0x0B, 0x43, 0x00, 0x43, 0x0A, 0x43, 0x02, 0x43, 0x09, 0x43, 0x03, 0x43, 0x07, 0x43, 0x04,
+    0x43, 0x06, 0x43, 0x06, 0x43, 0x05, 0x43, 0x07, 0x43, 0x03, 0x43, 0x08, 0x44, 0x01, 0x43, 0x0A,
+    0x43, 0x00, 0x43, 0x0C, 0x43, 0x43, 0x0C, 0x43, 0x00, 0x43, 0x0A, 0x43, 0x02, 0x43, 0x09, 0x43,
+    0x02, 0x43, 0x08, 0x43, 0x04, 0x43, 0x06, 0x43, 0x06, 0x43, 0x05, 0x42, 0x07, 0x43, 0x04, 0x43,
+    0x08, 0x43, 0x02, 0x43, 0x0A, 0x43, 0x01, 0x42, 0x0B, 0x43, 0x00, 0x43, 0x0C, 0x46, 0x0E, 0x44,
+    0x0F, 0x44, 0x10, 0x42, 0x11, 0x42, 0x11, 0x42, 0x11, 0x42, 0x11, 0x42, 0x11, 0x42, 0x11, 0x42,
+    0x11, 0x42, 0x11, 0x42, 0x11, 0x42, 0x08, 0x00, 0x50, 0x00, 0x50, 0x00, 0x50, 0x0C, 0x43, 0x0C,
+    0x43, 0x0C, 0x43, 0x0C, 0x44, 0x0C, 0x43, 0x0C, 0x43, 0x0C, 0x43, 0x0C, 0x43, 0x0C, 0x44, 0x0C,
+    0x43, 0x0C, 0x43, 0x0C, 0x43, 0x0C, 0x43, 0x0C, 0x43, 0x0D, 0x43, 0x0C, 0x43, 0x0C, 0x43, 0x0D,
+    0x75, 0x50, 0x03, 0x42, 0x03, 0x42, 0x03, 0x42, 0x03, 0x42, 0x03, 0x42, 0x03, 0x42, 0x03, 0x42,
+    0x03, 0x42, 0x03, 0x42, 0x03, 0x42, 0x03, 0x42, 0x03, 0x42, 0x03, 0x42, 0x03, 0x42, 0x03, 0x42,
+    0x03, 0x42, 0x03, 0x42, 0x03, 0x42, 0x03, 0x42, 0x03, 0x42, 0x03, 0x42, 0x03, 0x42, 0x03, 0x42,
+    0x03, 0x42, 0x03, 0x4D, 0x42, 0x05, 0x42, 0x05, 0x42, 0x06, 0x42, 0x05, 0x42, 0x05, 0x42, 0x06,
+    0x41, 0x06, 0x42, 0x05, 0x42, 0x06, 0x41, 0x06, 0x42, 0x05, 0x42, 0x05, 0x42, 0x06, 0x41, 0x06,
+    0x42, 0x05, 0x42, 0x06, 0x41, 0x06, 0x42, 0x05, 0x42, 0x05, 0x42, 0x06, 0x41, 0x06, 0x42, 0x05,
+    0x42, 0x4D, 0x03, 0x42, 0x03, 0x42, 0x03, 0x42, 0x03, 0x42, 0x03, 0x42, 0x03, 0x42, 0x03, 0x42,
+    0x03, 0x42, 0x03, 0x42, 0x03, 0x42, 0x03, 0x42, 0x03, 0x42, 0x03, 0x42, 0x03, 0x42, 0x03, 0x42,
+    0x03, 0x42, 0x03, 0x42, 0x03, 0x42, 0x03, 0x42, 0x03, 0x42, 0x03, 0x42, 0x03, 0x42, 0x03, 0x42,
+    0x03, 0x42, 0x03, 0x50, 0x04, 0x42, 0x09, 0x42, 0x08, 0x44, 0x07, 0x44, 0x06, 0x42, 0x00, 0x42,
+    0x05, 0x42, 0x00, 0x42, 0x04, 0x42, 0x02, 0x42, 0x03, 0x42, 0x02, 0x42, 0x03, 0x42, 0x02, 0x42,
+    0x02, 0x42, 0x04, 0x42, 0x01, 0x42, 0x04, 0x42, 0x00, 0x43, 0x05, 0x45, 0x06, 0x42, 0x65, 0x43,
+    0x01, 0x42, 0x01, 0x43, 0x01, 0x42, 0x03, 0x47, 0x04, 0x4B, 0x01, 0x45, 0x01, 0x44, 0x01, 0x42,
+    0x06, 0x43, 0x00, 0x42, 0x06, 0x43, 0x0B, 0x42, 0x08, 0x45, 0x02, 0x4B, 0x01, 0x4C, 0x00, 0x45,
+    0x04, 0x46, 0x06, 0x46, 0x07, 0x46, 0x07, 0x47, 0x05, 0x44, 0x00, 0x44, 0x00, 0x47, 0x00, 0x49,
+    0x00, 0x42, 0x02, 0x45, 0x02, 0x42, 0x42, 0x0B, 0x42, 0x0B, 0x42, 0x0B, 0x42, 0x0B, 0x42, 0x0B,
+    0x42, 0x0B, 0x42, 0x01, 0x45, 0x03, 0x4B, 0x02, 0x46, 0x00, 0x44, 0x01, 0x44, 0x04, 0x43, 0x00,
+    0x43, 0x06, 0x42, 0x00, 0x42, 0x07, 0x42, 0x00, 0x42, 0x07, 0x46, 0x07, 0x46, 0x07, 0x46, 0x07,
+    0x46, 0x07, 0x42, 0x00, 0x42, 0x07, 0x42, 0x00, 0x43, 0x06, 0x42, 0x00, 0x43, 0x05, 0x42, 0x01,
+    0x45, 0x01, 0x44, 0x01, 0x4B, 0x02, 0x42, 0x01, 0x44, 0x04, 0x03, 0x46, 0x06, 0x49, 0x03, 0x44,
+    0x01, 0x43, 0x02, 0x43, 0x04, 0x43, 0x01, 0x42, 0x06, 0x42, 0x00, 0x43, 0x06, 0x42, 0x00, 0x42,
+    0x0B, 0x42, 0x0B, 0x42, 0x0B, 0x42, 0x0B, 0x42, 0x0B, 0x43, 0x07, 0x42, 0x00, 0x42, 0x06, 0x43,
+    0x00, 0x43, 0x05, 0x42, 0x02, 0x44, 0x01, 0x44, 0x03, 0x49, 0x05, 0x46, 0x03, 0x0B, 0x42, 0x0B,
+    0x42, 0x0B, 0x42, 0x0B, 0x42, 0x0B, 0x42, 0x0B, 0x42, 0x03, 0x45, 0x01, 0x42, 0x02, 0x4B, 0x01,
+    0x44, 0x00, 0x46, 0x00, 0x43, 0x04, 0x44, 0x00, 0x42, 0x06, 0x47, 0x06, 0x46, 0x08, 0x45, 0x08,
+    0x45, 0x08, 0x45, 0x08, 0x45, 0x08, 0x46, 0x06, 0x43, 0x00, 0x42, 0x06, 0x43, 0x00, 0x43, 0x04,
+    0x44, 0x01, 0x44, 0x00, 0x46, 0x02, 0x4B, 0x03, 0x45, 0x01, 0x42, 0x04, 0x45, 0x07, 0x49, 0x04,
+    0x44, 0x01, 0x44, 0x02, 0x43, 0x05, 0x43, 0x01, 0x42, 0x07, 0x42, 0x00, 0x43, 0x07, 0x42, 0x00,
+    0x43, 0x07, 0x66, 0x0C, 0x42, 0x0C, 0x43, 0x0C, 0x42, 0x07, 0x42, 0x01, 0x43, 0x05, 0x43, 0x02,
+    0x44, 0x01, 0x44, 0x04, 0x49, 0x06, 0x47, 0x03, 0x03, 0x45, 0x02, 0x46, 0x02, 0x43, 0x05, 0x42,
+    0x06, 0x42, 0x06, 0x42, 0x03, 0x48, 0x00, 0x48, 0x02, 0x43, 0x06, 0x42, 0x06, 0x42, 0x06, 0x42,
+    0x06, 0x42, 0x06, 0x42, 0x06, 0x42, 0x06, 0x42, 0x06, 0x42, 0x06, 0x42, 0x06, 0x42, 0x06, 0x42,
+    0x06, 0x42, 0x06, 0x42, 0x06, 0x42, 0x03, 0x03, 0x45, 0x01, 0x42, 0x02, 0x4B, 0x01, 0x44, 0x00,
+    0x46, 0x00, 0x43, 0x04, 0x44, 0x00, 0x42, 0x06, 0x47, 0x06, 0x46, 0x08, 0x45, 0x08, 0x45, 0x08,
+    0x45, 0x08, 0x45, 0x08, 0x46, 0x06, 0x43, 0x00, 0x42, 0x06, 0x43, 0x00, 0x43, 0x04, 0x44, 0x01,
+    0x44, 0x00, 0x46, 0x02, 0x4B, 0x03, 0x45, 0x01, 0x42, 0x0B, 0x45, 0x07, 0x42, 0x01, 0x42, 0x06,
+    0x42, 0x01, 0x44, 0x01, 0x44, 0x03, 0x4A, 0x04, 0x47, 0x03, 0x42, 0x0A, 0x42, 0x0A, 0x42, 0x0A,
+    0x42, 0x0A, 0x42, 0x0A, 0x42, 0x0A, 0x42, 0x01, 0x45, 0x02, 0x4B, 0x01, 0x46, 0x00, 0x44, 0x00,
+    0x43, 0x05, 0x47, 0x05, 0x46, 0x07, 0x45, 0x07, 0x45, 0x07, 0x45, 0x07, 0x45, 0x07, 0x45, 0x07,
+    0x45, 0x07, 0x45, 0x07, 0x45, 0x07, 0x45, 0x07, 0x45, 0x07, 0x45, 0x07, 0x42, 0x48, 0x08, 0x72,
+    0x02, 0x42, 0x02, 0x42, 0x02, 0x42, 0x14, 0x42, 0x02, 0x42, 0x02, 0x42, 0x02, 0x42, 0x02, 0x42,
+    0x02, 0x42, 0x02, 0x42, 0x02, 0x42, 0x02, 0x42, 0x02, 0x42, 0x02, 0x42, 0x02, 0x42, 0x02, 0x42,
+    0x02, 0x42, 0x02, 0x42, 0x02, 0x42, 0x02, 0x42, 0x02, 0x42, 0x02, 0x42, 0x02, 0x43, 0x00, 0x48,
+    0x00, 0x43, 0x01, 0x42, 0x0A, 0x42, 0x0A, 0x42, 0x0A, 0x42, 0x0A, 0x42, 0x0A, 0x42, 0x0A, 0x42,
+    0x05, 0x43, 0x00, 0x42, 0x04, 0x43, 0x01, 0x42, 0x03, 0x43, 0x02, 0x42, 0x02, 0x43, 0x03, 0x42,
+    0x01, 0x43, 0x04, 0x42, 0x00, 0x43, 0x05, 0x46, 0x06, 0x47, 0x05, 0x48, 0x04, 0x43, 0x00, 0x43,
+    0x04, 0x42, 0x02, 0x43, 0x03, 0x42, 0x03, 0x42, 0x03, 0x42, 0x03, 0x43, 0x02, 0x42, 0x04, 0x43,
+    0x01, 0x42, 0x05, 0x42, 0x01, 0x42, 0x05, 0x43, 0x00, 0x42, 0x06, 0x43, 0x7F, 0x44, 0x42, 0x01,
+    0x45, 0x03, 0x44, 0x02, 0x4B, 0x00, 0x48, 0x00, 0x45, 0x01, 0x47, 0x00, 0x44, 0x00, 0x43, 0x04,
+    0x44, 0x04, 0x47, 0x05, 0x42, 0x05, 0x46, 0x06, 0x42, 0x06, 0x45, 0x06, 0x42, 0x06, 0x45, 0x06,
+    0x42, 0x06, 0x45, 0x06, 0x42, 0x06, 0x45, 0x06, 0x42, 0x06, 0x45, 0x06, 0x42, 0x06, 0x45, 0x06,
+    0x42, 0x06, 0x45, 0x06, 0x42, 0x06, 0x45, 0x06, 0x42, 0x06, 0x45, 0x06, 0x42, 0x06, 0x45, 0x06,
+    0x42, 0x06, 0x45, 0x06, 0x42, 0x06, 0x42, 0x42, 0x01, 0x45, 0x02, 0x4B, 0x01, 0x46, 0x00, 0x44,
+    0x00, 0x43, 0x05, 0x47, 0x05, 0x46, 0x07, 0x45, 0x07, 0x45, 0x07, 0x45, 0x07, 0x45, 0x07, 0x45,
+    0x07, 0x45, 0x07, 0x45, 0x07, 0x45, 0x07, 0x45, 0x07, 0x45, 0x07, 0x45, 0x07, 0x42, 0x03, 0x46,
+    0x07, 0x49, 0x04, 0x44, 0x01, 0x44, 0x02, 0x43, 0x05, 0x43, 0x01, 0x42, 0x07, 0x42, 0x00, 0x43,
+    0x07, 0x42, 0x00, 0x42, 0x08, 0x46, 0x09, 0x45, 0x09, 0x45, 0x09, 0x45, 0x08, 0x47, 0x07, 0x42,
+    0x01, 0x42, 0x07, 0x42, 0x01, 0x43, 0x05, 0x43, 0x02, 0x44, 0x01, 0x44, 0x04, 0x49, 0x06, 0x46,
+    0x04, 0x42, 0x01, 0x45, 0x03, 0x4B, 0x02, 0x46, 0x00, 0x44, 0x01, 0x44, 0x04, 0x43, 0x00, 0x43,
+    0x06, 0x42, 0x00, 0x42, 0x07, 0x42, 0x00, 0x42, 0x07, 0x46, 0x07, 0x46, 0x08, 0x45, 0x07, 0x46,
+    0x07, 0x46, 0x07, 0x42, 0x00, 0x43, 0x06, 0x42, 0x00, 0x43, 0x05, 0x42, 0x01, 0x45, 0x01, 0x44,
+    0x01, 0x4B, 0x02, 0x42, 0x01, 0x44, 0x04, 0x42, 0x0B, 0x42, 0x0B, 0x42, 0x0B, 0x42, 0x0B, 0x42,
+    0x0B, 0x42, 0x0B, 0x03, 0x45, 0x01, 0x42, 0x02, 0x47, 0x00, 0x42, 0x01, 0x44, 0x00, 0x46, 0x00,
+    0x43, 0x04, 0x44, 0x00, 0x42, 0x06, 0x47, 0x06, 0x46, 0x08, 0x45, 0x08, 0x45, 0x08, 0x45, 0x08,
+    0x45, 0x08, 0x46, 0x06, 0x43, 0x00, 0x42, 0x06, 0x43, 0x00, 0x43, 0x04, 0x44, 0x01, 0x44, 0x00,
+    0x46, 0x02, 0x4B, 0x03, 0x45, 0x01, 0x42, 0x0B, 0x42, 0x0B, 0x42, 0x0B, 0x42, 0x0B, 0x42, 0x0B,
+    0x42, 0x0B, 0x42, 0x42, 0x00, 0x53, 0x00, 0x40, 0x00, 0x43, 0x04, 0x43, 0x04, 0x42, 0x05, 0x42,
+    0x05, 0x42, 0x05, 0x42, 0x05, 0x42, 0x05, 0x42, 0x05, 0x42, 0x05, 0x42, 0x05, 0x42, 0x05, 0x42,
+    0x05, 0x42, 0x05, 0x42, 0x05, 0x02, 0x46, 0x05, 0x49, 0x02, 0x44, 0x01, 0x44, 0x00, 0x43, 0x05,
+    0x42, 0x00, 0x42, 0x06, 0x42, 0x00, 0x43, 0x0A, 0x45, 0x07, 0x48, 0x06, 0x48, 0x06, 0x47, 0x09,
+    0x47, 0x06, 0x46, 0x07, 0x46, 0x05, 0x43, 0x00, 0x44, 0x01, 0x44, 0x02, 0x49, 0x04, 0x47, 0x02,
+    0x03, 0x41, 0x05, 0x42, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43, 0x02, 0x47, 0x00, 0x47,
+    0x02, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43, 0x04, 0x43,
+    0x04, 0x43, 0x04, 0x43, 0x05, 0x42, 0x05, 0x42, 0x05, 0x43, 0x04, 0x45, 0x03, 0x44, 0x42, 0x07,
+    0x45, 0x07, 0x45, 0x07, 0x45, 0x07, 0x45, 0x07, 0x45, 0x07, 0x45, 0x07, 0x45, 0x07, 0x45, 0x07,
+    0x45, 0x07, 0x45, 0x06, 0x46, 0x06, 0x46, 0x06, 0x47, 0x04, 0x44, 0x00, 0x44, 0x00, 0x46, 0x00,
+    0x48, 0x00, 0x42, 0x02, 0x45, 0x01, 0x42, 0x43, 0x07, 0x43, 0x00, 0x42, 0x07, 0x42, 0x01, 0x42,
+    0x07, 0x42, 0x01, 0x43, 0x05, 0x43, 0x02, 0x42, 0x05, 0x42, 0x03, 0x43, 0x04, 0x42, 0x04, 0x42,
+    0x03, 0x42, 0x05, 0x42, 0x03, 0x42, 0x05, 0x43, 0x01, 0x43, 0x06, 0x42, 0x01, 0x42, 0x07, 0x42,
+    0x01, 0x42, 0x07, 0x47, 0x08, 0x45, 0x09, 0x45, 0x0A, 0x44, 0x0A, 0x43, 0x0B, 0x43, 0x05, 0x42,
+    0x06, 0x42, 0x06, 0x46, 0x05, 0x43, 0x05, 0x42, 0x00, 0x42, 0x04, 0x44, 0x04, 0x42, 0x01, 0x42,
+    0x04, 0x44, 0x04, 0x42, 0x01, 0x42, 0x04, 0x44, 0x04, 0x42, 0x02, 0x42, 0x03, 0x41, 0x00, 0x42,
+    0x02, 0x42, 0x03, 0x42, 0x02, 0x42, 0x00, 0x42, 0x02, 0x42, 0x03, 0x42, 0x02, 0x42, 0x00, 0x42,
+    0x02, 0x42, 0x03, 0x43, 0x01, 0x42, 0x00, 0x42, 0x01, 0x43, 0x04, 0x42, 0x00, 0x42, 0x02, 0x42,
+    0x00, 0x42, 0x05, 0x42, 0x00, 0x42, 0x02, 0x42, 0x00, 0x42, 0x05, 0x42, 0x00, 0x42, 0x02, 0x42,
+    0x00, 0x42, 0x06, 0x45, 0x02, 0x45, 0x07, 0x44, 0x04, 0x44, 0x07, 0x44, 0x04, 0x44, 0x07, 0x44,
+    0x04, 0x43, 0x09, 0x43, 0x04, 0x43, 0x04, 0x00, 0x43, 0x05, 0x43, 0x02, 0x42, 0x05, 0x42, 0x03,
+    0x43, 0x03, 0x43, 0x04, 0x43, 0x01, 0x43, 0x06, 0x42, 0x01, 0x42, 0x07, 0x47, 0x08, 0x45, 0x0A,
+    0x43, 0x0B, 0x43, 0x0A, 0x45, 0x08, 0x47, 0x07, 0x42, 0x01, 0x42, 0x06, 0x43, 0x01, 0x43, 0x04,
+    0x43, 0x03, 0x43, 0x03, 0x42, 0x04, 0x43, 0x02, 0x43, 0x05, 0x43, 0x00, 0x43, 0x07, 0x43, 0x43,
+    0x07, 0x43, 0x00, 0x42, 0x07, 0x42, 0x01, 0x43, 0x06, 0x42, 0x02, 0x42, 0x05, 0x43, 0x02, 0x42,
+    0x05, 0x42, 0x03, 0x43, 0x04, 0x42, 0x04, 0x42, 0x03, 0x42, 0x05, 0x42, 0x03, 0x42, 0x05, 0x43,
+    0x02, 0x42, 0x06, 0x42, 0x01, 0x42, 0x07, 0x42, 0x01, 0x42, 0x08, 0x42, 0x00, 0x42, 0x08, 0x45,
+    0x09, 0x45, 0x0A, 0x43, 0x0B, 0x43, 0x0B, 0x43, 0x0B, 0x42, 0x0C, 0x42, 0x0B, 0x42, 0x09, 0x45,
+    0x09, 0x44, 0x0A, 0x43, 0x09, 0x00, 0x4D, 0x00, 0x4D, 0x09, 0x44, 0x09, 0x43, 0x09, 0x43, 0x09,
+    0x43, 0x09, 0x43, 0x0A, 0x42, 0x0A, 0x43, 0x09, 0x43, 0x09, 0x43, 0x09, 0x43, 0x09, 0x43, 0x0A,
+    0x43, 0x09, 0x43, 0x09, 0x5D, 0x04, 0x43, 0x03, 0x44, 0x02, 0x43, 0x04, 0x42, 0x05, 0x42, 0x05,
+    0x42, 0x05, 0x42, 0x05, 0x42, 0x05, 0x42, 0x05, 0x42, 0x05, 0x42, 0x04, 0x43, 0x03, 0x43, 0x03,
+    0x43, 0x04, 0x42, 0x05, 0x43, 0x05, 0x43, 0x05, 0x43, 0x05, 0x42, 0x05, 0x42, 0x05, 0x42, 0x05,
+    0x42, 0x05, 0x42, 0x05, 0x42, 0x05, 0x42, 0x05, 0x42, 0x05, 0x43, 0x05, 0x44, 0x04, 0x43, 0x7F,
+    0x56, 0x43, 0x04, 0x44, 0x05, 0x42, 0x06, 0x42, 0x05, 0x42, 0x05, 0x42, 0x05, 0x42, 0x05, 0x42,
+    0x05, 0x42, 0x05, 0x42, 0x05, 0x42, 0x05, 0x42, 0x06, 0x42, 0x05, 0x44, 0x05, 0x42, 0x03, 0x44,
+    0x03, 0x42, 0x04, 0x42, 0x05, 0x42, 0x05, 0x42, 0x05, 0x42, 0x05, 0x42, 0x05, 0x42, 0x05, 0x42,
+    0x05, 0x42, 0x05, 0x42, 0x04, 0x42, 0x03, 0x44, 0x03, 0x43, 0x04, 0x01, 0x45, 0x08, 0x49, 0x02,
+    0x54, 0x02, 0x4A, 0x07, 0x45, 0x00,
+};
+
+const RleGlyph Inter_32Glyphs[] PROGMEM = {
+    { 0, 32, 0, 0, 11, 0, 0 },  // 'space'
+    { 0, 33, 3, 23, 11, 4, 3 },  // '!'
+    { 3, 34, 9, 8, 14, 2, 3 },  // '"'
+    { 27, 35, 18, 23, 20, 1, 3 },  // '#'
+    { 108, 36, 15, 27, 20, 2, 2 },  // '$'
+    { 197, 37, 25, 23, 31, 3, 3 },  // '%'
+    { 324, 38, 19, 23, 24, 2, 3 },  // '&'
+    { 407, 39, 4, 8, 9, 2, 3 },  // '''
+    { 415, 40, 7, 29, 13, 3, 3 },  // '('
+    { 473, 41, 8, 29, 13, 3, 3 },  // ')'
+    { 531, 42, 10, 10, 15, 2, 3 },  // '*'
+    { 558, 43, 15, 15, 21, 3, 7 },  // '+'
+    { 585, 44, 3, 8, 11, 4, 23 },  // ','
+    { 595, 45, 9, 3, 13, 2, 16 },  // '-'
+    { 596, 46, 3, 3, 11, 4, 23 },  // '.'
+    { 597, 47, 9, 23, 11, 1, 3 },  // '/'
+    { 644, 48, 15, 23, 20, 2, 3 },  // '0'
+    { 711, 49, 9, 23, 20, 4, 3 },  // '1'
+    { 755, 50, 15, 23, 20, 2, 3 },  // '2'
+    { 803, 51, 15, 23, 20, 2, 3 },  // '3'
+    { 864, 52, 16, 23, 20, 1, 3 },  // '4'
+    { 927, 53, 16, 23, 20, 2, 3 },  // '5'
+    { 988, 54, 15, 23, 20, 2, 3 },  // '6'
+    { 1059, 55, 15, 23, 20, 2, 3 },  // '7'
+    { 1101, 56, 16, 23, 20, 2, 3 },  // '8'
+    { 1178, 57, 16, 23, 20, 2, 3 },  // '9'
+    { 1257, 58, 3, 17, 11, 4, 9 },  // ':'
+    { 1260, 59, 3, 22, 11, 4, 9 },  // ';'
+    { 1272, 60, 15, 16, 21, 3, 7 },  // '<'
+    { 1304, 61, 15, 10, 21, 3, 10 },  // '='
+    { 1307, 62, 15, 16, 21, 3, 7 },  // '>'
+    { 1339, 63, 15, 23, 20, 2, 3 },  // '?'
+    { 1388, 64, 29, 29, 35, 3, 3 },  // '@'
+    { 1547, 65, 21, 23, 24, 1, 3 },  // 'A'
+    { 1621, 66, 18, 23, 24, 3, 3 },  // 'B'
+    { 1685, 67, 21, 23, 26, 2, 3 },  // 'C'
+    { 1754, 68, 20, 23, 26, 3, 3 },  // 'D'
+    { 1828, 69, 18, 23, 24, 3, 3 },  // 'E'
+    { 1869, 70, 16, 23, 22, 3, 3 },  // 'F'
+    { 1909, 71, 21, 23, 27, 3, 3 },  // 'G'
+    { 1974, 72, 19, 23, 26, 3, 3 },  // 'H'
+    { 2016, 73, 3, 23, 11, 4, 3 },  // 'I'
+    { 2018, 74, 13, 23, 18, 2, 3 },  // 'J'
+    { 2067, 75, 19, 23, 24, 3, 3 },  // 'K'
+    { 2152, 76, 15, 23, 20, 3, 3 },  // 'L'
+    { 2193, 77, 22, 23, 29, 3, 3 },  // 'M'
+    { 2300, 78, 19, 23, 26, 3, 3 },  // 'N'
+    { 2367, 79, 23, 23, 27, 2, 3 },  // 'O'
+    { 2446, 80, 18, 23, 24, 3, 3 },  // 'P'
+    { 2496, 81, 23, 24, 27, 2, 3 },  // 'Q'
+    { 2587, 82, 21, 23, 26, 3, 3 },  // 'R'
+    { 2670, 83, 19, 23, 24, 2, 3 },  // 'S'
+    { 2731, 84, 18, 23, 22, 2, 3 },  // 'T'
+    { 2773, 85, 19, 23, 26, 3, 3 },  // 'U'
+    { 2829, 86, 21, 23, 24, 1, 3 },  // 'V'
+    { 2911, 87, 30, 23, 33, 1, 3 },  // 'W'
+    { 3061, 88, 21, 23, 24, 1, 3 },  // 'X'
+    { 3141, 89, 21, 23, 24, 1, 3 },  // 'Y'
+    { 3207, 90, 18, 23, 22, 2, 3 },  // 'Z'
+    { 3249, 91, 7, 29, 11, 3, 3 },  // '['
+    { 3300, 92, 9, 23, 11, 1, 3 },  // '\\'
+    { 3345, 93, 7, 29, 11, 1, 3 },  // ']'
+    { 3396, 94, 13, 13, 17, 2, 3 },  // '^'
+    { 3438, 95, 19, 2, 20, 0, 30 },  // '_'
+    { 3439, 96, 5, 4, 13, 3, 3 },  // '`'
+    { 3446, 97, 15, 17, 20, 2, 9 },  // 'a'
+    { 3494, 98, 15, 23, 20, 3, 3 },  // 'b'
+    { 3562, 99, 15, 17, 18, 2, 9 },  // 'c'
+    { 3613, 100, 15, 23, 20, 2, 3 },  // 'd'
+    { 3675, 101, 16, 17, 20, 2, 9 },  // 'e'
+    { 3720, 102, 10, 23, 11, 1, 3 },  // 'f'
+    { 3767, 103, 15, 23, 20, 2, 9 },  // 'g'
+    { 3834, 104, 14, 23, 20, 3, 3 },  // 'h'
+    { 3885, 105, 3, 23, 10, 3, 3 },  // 'i'
+    { 3888, 106, 6, 29, 10, 0, 3 },  // 'j'
+    { 3939, 107, 14, 23, 18, 3, 3 },  // 'k'
+    { 4012, 108, 3, 23, 10, 3, 3 },  // 'l'
+    { 4014, 109, 23, 17, 29, 3, 9 },  // 'm'
+    { 4087, 110, 14, 17, 20, 3, 9 },  // 'n'
+    { 4126, 111, 16, 17, 20, 2, 9 },  // 'o'
+    { 4177, 112, 15, 23, 20, 3, 9 },  // 'p'
+    { 4243, 113, 15, 23, 20, 2, 9 },  // 'q'
+    { 4307, 114, 9, 17, 13, 3, 9 },  // 'r'
+    { 4341, 115, 14, 17, 18, 2, 9 },  // 's'
+    { 4384, 116, 9, 23, 11, 1, 3 },  // 't'
+    { 4430, 117, 14, 17, 20, 3, 9 },  // 'u'
+    { 4471, 118, 16, 17, 18, 1, 9 },  // 'v'
+    { 4527, 119, 23, 17, 26, 1, 9 },  // 'w'
+    { 4631, 120, 16, 17, 18, 1, 9 },  // 'x'
+    { 4687, 121, 16, 23, 18, 1, 9 },  // 'y'
+    { 4757, 122, 15, 17, 18, 1, 9 },  // 'z'
+    { 4789, 123, 9, 29, 13, 2, 3 },  // '{'
+    { 4847, 124, 3, 29, 11, 4, 3 },  // '|'
+    { 4849, 125, 9, 29, 13, 2, 3 },  // '}'
+    { 4907, 126, 16, 5, 21, 2, 12 },  // '~'
+};
+
+const RleFont Inter_32 PROGMEM = {
+    Inter_32Data,
+    Inter_32Glyphs,
+    95, 45, 0, 45
+};
+
+#endif // RLE_INTER_32_H
@@ -0,0 +1,404 @@
+// Inter Font - 32px SemiBold (Weight 600) (1-bpp source)
+// Generated by scripts/fontgen.py: 2026-10-19
+// Charset: 95 characters, 4590 bytes RLE
+
+#ifndef RLE_INTER_32B_H
+#define RLE_INTER_32B_H
+
+#include "RleFont.h"
+
+const uint8_t Inter_32BData[] PROGMEM = {
+    0x6B, 0x00, 0x43, 0x00, 0x43, 0x00, 0x43, 0x00, 0x43, 0x01, 0x42, 0x01, 0x42, 0x01, 0x42, 0x01,
+    0x42, 0x0A, 0x53, 0x44, 0x01, 0x49, 0x01, 0x49, 0x01, 0x49, 0x01, 0x49, 0x01, 0x44, 0x00, 0x43,
+    0x02, 0x43, 0x00, 0x43, 0x02, 0x43, 0x00, 0x43, 0x02, 0x43, 0x05, 0x43, 0x02, 0x43, 0x06, 0x43,
+    0x02, 0x43, 0x05, 0x43, 0x02, 0x43, 0x06, 0x43, 0x02, 0x43, 0x06, 0x43, 0x02, 0x43, 0x06, 0x43,
+    0x02, 0x43, 0x01, 0x75, 0x03, 0x43, 0x02, 0x43, 0x06, 0x43, 0x02, 0x43, 0x06, 0x42, 0x03, 0x42,
+    0x06, 0x43, 0x02, 0x43, 0x06, 0x43, 0x02, 0x43, 0x03, 0x75, 0x01, 0x43, 0x02, 0x43, 0x06, 0x43,
+    0x02, 0x43, 0x06, 0x43, 0x02, 0x43, 0x06, 0x43, 0x02, 0x43, 0x05, 0x43, 0x02, 0x43, 0x06, 0x43,
+    0x02, 0x43, 0x05, 0x05, 0x42, 0x0B, 0x42, 0x09, 0x46, 0x06, 0x49, 0x03, 0x4A, 0x02, 0x4C, 0x01,
+    0x4C, 0x01, 0x43, 0x00, 0x42, 0x00, 0x44, 0x00, 0x43, 0x00, 0x42, 0x00, 0x44, 0x00, 0x43, 0x00,
+    0x42, 0x06, 0x47, 0x06, 0x47, 0x07, 0x49, 0x05, 0x4A, 0x05, 0x49, 0x05, 0x48, 0x05, 0x42, 0x00,
+    0x44, 0x05, 0x42, 0x01, 0x48, 0x00, 0x42, 0x01, 0x48, 0x00, 0x42, 0x01, 0x43, 0x00, 0x47, 0x00,
+    0x44, 0x00, 0x4D, 0x01, 0x4B, 0x03, 0x49, 0x05, 0x46, 0x09, 0x42, 0x0B, 0x42, 0x0B, 0x42, 0x05,
+    0x02, 0x44, 0x08, 0x42, 0x05, 0x47, 0x06, 0x43, 0x05, 0x43, 0x00, 0x43, 0x05, 0x42, 0x05, 0x43,
+    0x01, 0x43, 0x04, 0x43, 0x05, 0x43, 0x02, 0x42, 0x04, 0x42, 0x06, 0x43, 0x02, 0x42, 0x03, 0x43,
+    0x06, 0x43, 0x02, 0x42, 0x03, 0x42, 0x07, 0x43, 0x02, 0x42, 0x02, 0x43, 0x07, 0x43, 0x01, 0x43,
+    0x02, 0x42, 0x09, 0x43, 0x00, 0x43, 0x01, 0x43, 0x09, 0x47, 0x02, 0x42, 0x0C, 0x44, 0x02, 0x43,
+    0x14, 0x42, 0x03, 0x44, 0x0B, 0x43, 0x01, 0x47, 0x0A, 0x42, 0x02, 0x43, 0x00, 0x43, 0x08, 0x43,
+    0x02, 0x42, 0x02, 0x42, 0x08, 0x43, 0x01, 0x43, 0x02, 0x42, 0x07, 0x43, 0x02, 0x43, 0x02, 0x42,
+    0x07, 0x43, 0x02, 0x43, 0x02, 0x42, 0x06, 0x43, 0x03, 0x43, 0x02, 0x42, 0x06, 0x43, 0x04, 0x42,
+    0x02, 0x42, 0x05, 0x43, 0x05, 0x43, 0x00, 0x43, 0x05, 0x43, 0x05, 0x47, 0x05, 0x43, 0x08, 0x44,
+    0x01, 0x05, 0x46, 0x0B, 0x4A, 0x09, 0x4A, 0x08, 0x44, 0x02, 0x44, 0x07, 0x44, 0x03, 0x43, 0x07,
+    0x44, 0x03, 0x43, 0x07, 0x45, 0x01, 0x44, 0x08, 0x44, 0x00, 0x44, 0x09, 0x4A, 0x0A, 0x48, 0x0A,
+    0x47, 0x0B, 0x49, 0x09, 0x4A, 0x02, 0x41, 0x03, 0x45, 0x00, 0x45, 0x00, 0x44, 0x00, 0x45, 0x02,
+    0x4A, 0x00, 0x44, 0x04, 0x48, 0x01, 0x44, 0x05, 0x47, 0x01, 0x44, 0x05, 0x46, 0x02, 0x44, 0x06,
+    0x46, 0x02, 0x45, 0x02, 0x4A, 0x01, 0x52, 0x02, 0x4B, 0x00, 0x44, 0x03, 0x48, 0x03, 0x42, 0x00,
+    0x58, 0x00, 0x43, 0x00, 0x43, 0x00, 0x43, 0x04, 0x42, 0x03, 0x43, 0x03, 0x43, 0x02, 0x43, 0x03,
+    0x43, 0x02, 0x44, 0x02, 0x43, 0x02, 0x44, 0x02, 0x44, 0x02, 0x44, 0x02, 0x43, 0x03, 0x43, 0x02,
+    0x44, 0x02, 0x44, 0x02, 0x44, 0x02, 0x44, 0x02, 0x44, 0x03, 0x43, 0x03, 0x43, 0x03, 0x44, 0x02,
+    0x44, 0x02, 0x44, 0x03, 0x43, 0x03, 0x43, 0x04, 0x43, 0x03, 0x43, 0x04, 0x42, 0x04, 0x43, 0x04,
+    0x42, 0x43, 0x04, 0x43, 0x03, 0x43, 0x04, 0x43, 0x03, 0x43, 0x03, 0x44, 0x02, 0x44, 0x03, 0x43,
+    0x03, 0x44, 0x02, 0x44, 0x02, 0x44, 0x02, 0x44, 0x03, 0x43, 0x03, 0x43, 0x03, 0x43, 0x03, 0x43,
+    0x03, 0x43, 0x02, 0x44, 0x02, 0x44, 0x02, 0x44, 0x02, 0x44, 0x02, 0x43, 0x03, 0x43, 0x02, 0x44,
+    0x02, 0x43, 0x03, 0x43, 0x02, 0x43, 0x03, 0x43, 0x02, 0x43, 0x03, 0x03, 0x42, 0x08, 0x42, 0x05,
+    0x41, 0x01, 0x41, 0x01, 0x41, 0x01, 0x49, 0x00, 0x4B, 0x01, 0x47, 0x04, 0x45, 0x04, 0x47, 0x02,
+    0x43, 0x01, 0x42, 0x03, 0x41, 0x02, 0x41, 0x02, 0x05, 0x43, 0x0B, 0x43, 0x0B, 0x43, 0x0B, 0x43,
+    0x0B, 0x43, 0x0B, 0x43, 0x05, 0x7F, 0x05, 0x43, 0x0B, 0x43, 0x0B, 0x43, 0x0B, 0x43, 0x0B, 0x43,
+    0x0B, 0x43, 0x05, 0x53, 0x01, 0x42, 0x01, 0x42, 0x00, 0x42, 0x00, 0x43, 0x00, 0x41, 0x02, 0x63,
+    0x53, 0x04, 0x43, 0x04, 0x43, 0x04, 0x42, 0x05, 0x42, 0x04, 0x43, 0x04, 0x43, 0x04, 0x42, 0x05,
+    0x42, 0x05, 0x42, 0x04, 0x43, 0x04, 0x43, 0x04, 0x42, 0x05, 0x42, 0x04, 0x43, 0x04, 0x43, 0x04,
+    0x42, 0x05, 0x42, 0x04, 0x43, 0x04, 0x43, 0x04, 0x42, 0x05, 0x42, 0x04, 0x43, 0x04, 0x43, 0x04,
+    0x04, 0x45, 0x06, 0x49, 0x03, 0x4A, 0x03, 0x4B, 0x01, 0x45, 0x01, 0x45, 0x00, 0x44, 0x03, 0x44,
+    0x00, 0x43, 0x04, 0x49, 0x04, 0x49, 0x05, 0x48, 0x05, 0x48, 0x05, 0x48, 0x05, 0x48, 0x05, 0x48,
+    0x05, 0x48, 0x05, 0x48, 0x04, 0x44, 0x00, 0x43, 0x04, 0x44, 0x00, 0x44, 0x03, 0x44, 0x00, 0x45,
+    0x01, 0x45, 0x01, 0x4B, 0x02, 0x4A, 0x04, 0x49, 0x06, 0x45, 0x03, 0x06, 0x43, 0x05, 0x44, 0x04,
+    0x45, 0x03, 0x46, 0x02, 0x47, 0x00, 0x63, 0x01, 0x46, 0x03, 0x44, 0x05, 0x44, 0x05, 0x44, 0x05,
+    0x44, 0x05, 0x44, 0x05, 0x44, 0x05, 0x44, 0x05, 0x44, 0x05, 0x44, 0x05, 0x44, 0x05, 0x44, 0x05,
+    0x44, 0x05, 0x44, 0x05, 0x44, 0x03, 0x47, 0x05, 0x49, 0x03, 0x4B, 0x01, 0x4D, 0x00, 0x44, 0x02,
+    0x4A, 0x04, 0x49, 0x05, 0x43, 0x0A, 0x43, 0x09, 0x44, 0x09, 0x44, 0x08, 0x44, 0x08, 0x45, 0x07,
+    0x45, 0x07, 0x45, 0x07, 0x45, 0x07, 0x45, 0x07, 0x45, 0x07, 0x44, 0x08, 0x45, 0x08, 0x7A, 0x03,
+    0x46, 0x06, 0x48, 0x04, 0x4A, 0x02, 0x4C, 0x01, 0x44, 0x02, 0x44, 0x01, 0x43, 0x03, 0x44, 0x01,
+    0x43, 0x04, 0x43, 0x09, 0x44, 0x08, 0x45, 0x06, 0x46, 0x07, 0x45, 0x08, 0x47, 0x09, 0x44, 0x0A,
+    0x44, 0x0A, 0x43, 0x0A, 0x48, 0x05, 0x48, 0x04, 0x44, 0x00, 0x45, 0x01, 0x45, 0x00, 0x4C, 0x02,
+    0x4B, 0x03, 0x49, 0x05, 0x46, 0x03, 0x09, 0x43, 0x0B, 0x44, 0x0A, 0x45, 0x0A, 0x45, 0x09, 0x46,
+    0x08, 0x47, 0x08, 0x47, 0x07, 0x48, 0x06, 0x44, 0x00, 0x43, 0x06, 0x43, 0x01, 0x43, 0x05, 0x43,
+    0x02, 0x43, 0x04, 0x44, 0x02, 0x43, 0x03, 0x44, 0x03, 0x43, 0x03, 0x43, 0x04, 0x43, 0x02, 0x7F,
+    0x43, 0x09, 0x43, 0x0C, 0x43, 0x0C, 0x43, 0x0C, 0x43, 0x0C, 0x43, 0x02, 0x02, 0x4B, 0x03, 0x4B,
+    0x02, 0x4C, 0x02, 0x4C, 0x02, 0x44, 0x0A, 0x43, 0x0B, 0x43, 0x0B, 0x49, 0x04, 0x4B, 0x03, 0x4C,
+    0x02, 0x4D, 0x01, 0x45, 0x01, 0x45, 0x01, 0x43, 0x05, 0x44, 0x0A, 0x44, 0x0A, 0x44, 0x0A, 0x49,
+    0x05, 0x49, 0x04, 0x45, 0x00, 0x45, 0x01, 0x45, 0x01, 0x4D, 0x02, 0x4B, 0x04, 0x49, 0x06, 0x46,
+    0x04, 0x04, 0x46, 0x07, 0x48, 0x05, 0x4A, 0x03, 0x4C, 0x01, 0x45, 0x01, 0x45, 0x01, 0x44, 0x03,
+    0x44, 0x01, 0x44, 0x03, 0x44, 0x00, 0x44, 0x0A, 0x44, 0x0A, 0x44, 0x00, 0x45, 0x03, 0x4D, 0x01,
+    0x4D, 0x01, 0x4E, 0x00, 0x46, 0x02, 0x4B, 0x04, 0x49, 0x05, 0x44, 0x00, 0x44, 0x04, 0x44, 0x00,
+    0x44, 0x04, 0x44, 0x00, 0x45, 0x02, 0x45, 0x01, 0x4C, 0x02, 0x4B, 0x04, 0x49, 0x07, 0x46, 0x03,
+    0x7B, 0x09, 0x43, 0x09, 0x44, 0x08, 0x44, 0x09, 0x43, 0x09, 0x44, 0x09, 0x43, 0x09, 0x44, 0x09,
+    0x43, 0x09, 0x44, 0x09, 0x44, 0x08, 0x44, 0x09, 0x44, 0x09, 0x44, 0x09, 0x43, 0x09, 0x44, 0x09,
+    0x44, 0x09, 0x44, 0x09, 0x44, 0x09, 0x44, 0x06, 0x03, 0x46, 0x06, 0x49, 0x03, 0x4B, 0x01, 0x45,
+    0x01, 0x44, 0x01, 0x44, 0x03, 0x44, 0x00, 0x43, 0x04, 0x44, 0x00, 0x43, 0x04, 0x44, 0x00, 0x43,
+    0x04, 0x44, 0x00, 0x44, 0x03, 0x43, 0x02, 0x43, 0x02, 0x44, 0x02, 0x4A, 0x04, 0x48, 0x04, 0x4B,
+    0x01, 0x44, 0x02, 0x45, 0x00, 0x43, 0x04, 0x49, 0x05, 0x48, 0x05, 0x48, 0x05, 0x48, 0x04, 0x44,
+    0x00, 0x45, 0x01, 0x45, 0x00, 0x4C, 0x02, 0x4A, 0x05, 0x47, 0x02, 0x03, 0x46, 0x05, 0x49, 0x03,
+    0x4B, 0x02, 0x4C, 0x00, 0x45, 0x02, 0x44, 0x00, 0x44, 0x04, 0x49, 0x04, 0x49, 0x04, 0x49, 0x04,
+    0x4A, 0x02, 0x45, 0x00, 0x4D, 0x00, 0x4D, 0x01, 0x4C, 0x03, 0x44, 0x00, 0x44, 0x09, 0x44, 0x09,
+    0x44, 0x00, 0x43, 0x04, 0x4A, 0x02, 0x45, 0x00, 0x44, 0x02, 0x44, 0x01, 0x4C, 0x02, 0x4A, 0x03,
+    0x49, 0x06, 0x45, 0x04, 0x53, 0x2C, 0x53, 0x53, 0x2C, 0x53, 0x01, 0x42, 0x01, 0x42, 0x00, 0x42,
+    0x00, 0x42, 0x01, 0x41, 0x02, 0x0D, 0x41, 0x0B, 0x43, 0x09, 0x45, 0x06, 0x48, 0x04, 0x49, 0x02,
+    0x4A, 0x02, 0x49, 0x05, 0x47, 0x07, 0x45, 0x09, 0x47, 0x07, 0x4A, 0x07, 0x49, 0x07, 0x49, 0x07,
+    0x48, 0x09, 0x45, 0x0B, 0x43, 0x0D, 0x41, 0x7F, 0x2F, 0x7F, 0x41, 0x0D, 0x43, 0x0B, 0x46, 0x08,
+    0x48, 0x07, 0x49, 0x07, 0x4A, 0x07, 0x49, 0x07, 0x47, 0x09, 0x45, 0x07, 0x47, 0x05, 0x49, 0x02,
+    0x4A, 0x02, 0x49, 0x04, 0x48, 0x06, 0x46, 0x08, 0x43, 0x0B, 0x41, 0x0D, 0x03, 0x47, 0x05, 0x4B,
+    0x02, 0x4D, 0x00, 0x45, 0x02, 0x45, 0x00, 0x44, 0x05, 0x48, 0x06, 0x44, 0x0B, 0x43, 0x0A, 0x44,
+    0x0A, 0x44, 0x08, 0x45, 0x08, 0x46, 0x07, 0x46, 0x07, 0x45, 0x09, 0x44, 0x0A, 0x43, 0x0B, 0x43,
+    0x0B, 0x43, 0x2B, 0x43, 0x0B, 0x43, 0x0B, 0x43, 0x0B, 0x43, 0x05, 0x0A, 0x49, 0x10, 0x4E, 0x0C,
+    0x52, 0x09, 0x47, 0x05, 0x46, 0x07, 0x45, 0x0B, 0x44, 0x05, 0x44, 0x0E, 0x44, 0x04, 0x43, 0x03,
+    0x45, 0x00, 0x44, 0x00, 0x43, 0x03, 0x43, 0x03, 0x4C, 0x01, 0x43, 0x01, 0x43, 0x03, 0x4D, 0x01,
+    0x43, 0x01, 0x43, 0x02, 0x4D, 0x03, 0x42, 0x01, 0x42, 0x02, 0x45, 0x02, 0x45, 0x03, 0x42, 0x00,
+    0x43, 0x02, 0x44, 0x04, 0x44, 0x03, 0x42, 0x00, 0x43, 0x01, 0x44, 0x05, 0x44, 0x03, 0x42, 0x00,
+    0x42, 0x02, 0x44, 0x05, 0x44, 0x03, 0x42, 0x00, 0x42, 0x02, 0x43, 0x06, 0x43, 0x04, 0x42, 0x00,
+    0x42, 0x02, 0x43, 0x06, 0x43, 0x03, 0x43, 0x00, 0x42, 0x02, 0x43, 0x05, 0x44, 0x03, 0x42, 0x01,
+    0x42, 0x02, 0x44, 0x04, 0x44, 0x02, 0x43, 0x01, 0x42, 0x02, 0x44, 0x02, 0x46, 0x01, 0x43, 0x02,
+    0x43, 0x01, 0x4E, 0x00, 0x44, 0x02, 0x43, 0x02, 0x52, 0x04, 0x43, 0x02, 0x4F, 0x06, 0x43, 0x03,
+    0x44, 0x02, 0x45, 0x08, 0x43, 0x13, 0x43, 0x01, 0x44, 0x11, 0x43, 0x03, 0x45, 0x0D, 0x45, 0x04,
+    0x47, 0x07, 0x47, 0x07, 0x53, 0x0B, 0x50, 0x0E, 0x4B, 0x07, 0x07, 0x46, 0x0F, 0x46, 0x0E, 0x48,
+    0x0D, 0x48, 0x0D, 0x48, 0x0C, 0x44, 0x00, 0x44, 0x0B, 0x44, 0x00, 0x44, 0x0B, 0x43, 0x01, 0x44,
+    0x0A, 0x44, 0x02, 0x44, 0x09, 0x44, 0x02, 0x44, 0x08, 0x44, 0x03, 0x45, 0x07, 0x44, 0x04, 0x44,
+    0x07, 0x44, 0x04, 0x44, 0x06, 0x44, 0x05, 0x45, 0x05, 0x50, 0x05, 0x50, 0x04, 0x52, 0x03, 0x52,
+    0x02, 0x45, 0x08, 0x45, 0x01, 0x44, 0x09, 0x45, 0x01, 0x44, 0x0A, 0x44, 0x00, 0x44, 0x0B, 0x4A,
+    0x0C, 0x44, 0x4E, 0x04, 0x50, 0x02, 0x51, 0x01, 0x51, 0x01, 0x44, 0x07, 0x45, 0x00, 0x44, 0x08,
+    0x44, 0x00, 0x44, 0x08, 0x44, 0x00, 0x44, 0x08, 0x44, 0x00, 0x44, 0x06, 0x45, 0x01, 0x50, 0x02,
+    0x4F, 0x03, 0x51, 0x01, 0x52, 0x00, 0x44, 0x07, 0x45, 0x00, 0x44, 0x08, 0x4A, 0x09, 0x49, 0x09,
+    0x49, 0x08, 0x4A, 0x07, 0x59, 0x00, 0x52, 0x00, 0x51, 0x01, 0x4F, 0x03, 0x06, 0x47, 0x0A, 0x4B,
+    0x07, 0x4D, 0x05, 0x4F, 0x03, 0x46, 0x03, 0x46, 0x01, 0x45, 0x06, 0x45, 0x01, 0x44, 0x08, 0x44,
+    0x01, 0x44, 0x08, 0x43, 0x01, 0x45, 0x0E, 0x44, 0x0F, 0x44, 0x0F, 0x44, 0x0F, 0x44, 0x0F, 0x44,
+    0x0F, 0x45, 0x09, 0x42, 0x02, 0x44, 0x08, 0x45, 0x00, 0x44, 0x08, 0x44, 0x01, 0x45, 0x06, 0x45,
+    0x02, 0x46, 0x02, 0x46, 0x04, 0x4F, 0x05, 0x4D, 0x07, 0x4B, 0x0A, 0x47, 0x05, 0x4D, 0x05, 0x4F,
+    0x03, 0x50, 0x02, 0x51, 0x01, 0x44, 0x05, 0x46, 0x01, 0x44, 0x07, 0x45, 0x00, 0x44, 0x08, 0x44,
+    0x00, 0x44, 0x08, 0x4A, 0x09, 0x49, 0x09, 0x49, 0x09, 0x49, 0x09, 0x49, 0x09, 0x49, 0x09, 0x49,
+    0x09, 0x49, 0x08, 0x4A, 0x08, 0x44, 0x00, 0x44, 0x07, 0x45, 0x00, 0x44, 0x05, 0x46, 0x01, 0x51,
+    0x01, 0x50, 0x02, 0x4F, 0x03, 0x4D, 0x05, 0x50, 0x00, 0x50, 0x00, 0x50, 0x00, 0x50, 0x00, 0x44,
+    0x0C, 0x44, 0x0C, 0x44, 0x0C, 0x44, 0x0C, 0x44, 0x0C, 0x50, 0x00, 0x50, 0x00, 0x50, 0x00, 0x50,
+    0x00, 0x44, 0x0C, 0x44, 0x0C, 0x44, 0x0C, 0x44, 0x0C, 0x44, 0x0C, 0x44, 0x0C, 0x7F, 0x47, 0x7F,
+    0x44, 0x0A, 0x44, 0x0A, 0x44, 0x0A, 0x44, 0x0A, 0x44, 0x0A, 0x4E, 0x00, 0x4E, 0x00, 0x4E, 0x00,
+    0x4E, 0x00, 0x44, 0x0A, 0x44, 0x0A, 0x44, 0x0A, 0x44, 0x0A, 0x44, 0x0A, 0x44, 0x0A, 0x44, 0x0A,
+    0x44, 0x0A, 0x44, 0x0A, 0x44, 0x0A, 0x06, 0x48, 0x0A, 0x4C, 0x07, 0x4F, 0x04, 0x50, 0x03, 0x47,
+    0x03, 0x46, 0x02, 0x45, 0x07, 0x44, 0x01, 0x45, 0x08, 0x45, 0x00, 0x44, 0x0A, 0x42, 0x01, 0x45,
+    0x0F, 0x44, 0x10, 0x44, 0x10, 0x44, 0x06, 0x4E, 0x06, 0x4F, 0x05, 0x49, 0x00, 0x44, 0x05, 0x49,
+    0x00, 0x44, 0x0A, 0x44, 0x00, 0x45, 0x09, 0x44, 0x01, 0x45, 0x08, 0x44, 0x01, 0x47, 0x03, 0x47,
+    0x02, 0x52, 0x03, 0x50, 0x05, 0x4D, 0x09, 0x49, 0x04, 0x44, 0x08, 0x49, 0x08, 0x49, 0x08, 0x49,
+    0x08, 0x49, 0x08, 0x49, 0x08, 0x49, 0x08, 0x49, 0x08, 0x49, 0x08, 0x7F, 0x55, 0x08, 0x49, 0x08,
+    0x49, 0x08, 0x49, 0x08, 0x49, 0x08, 0x49, 0x08, 0x49, 0x08, 0x49, 0x08, 0x49, 0x08, 0x49, 0x08,
+    0x44, 0x7F, 0x72, 0x0A, 0x43, 0x0A, 0x43, 0x0A, 0x43, 0x0A, 0x43, 0x0A, 0x43, 0x0A, 0x43, 0x0A,
+    0x43, 0x0A, 0x43, 0x0A, 0x43, 0x0A, 0x43, 0x0A, 0x43, 0x0A, 0x43, 0x0A, 0x43, 0x0A, 0x43, 0x0A,
+    0x48, 0x05, 0x48, 0x04, 0x44, 0x00, 0x44, 0x03, 0x44, 0x00, 0x45, 0x01, 0x45, 0x00, 0x4D, 0x01,
+    0x4B, 0x03, 0x49, 0x05, 0x46, 0x03, 0x44, 0x08, 0x45, 0x00, 0x44, 0x07, 0x45, 0x01, 0x44, 0x06,
+    0x45, 0x02, 0x44, 0x05, 0x45, 0x03, 0x44, 0x04, 0x45, 0x04, 0x44, 0x03, 0x45, 0x05, 0x44, 0x02,
+    0x45, 0x06, 0x44, 0x01, 0x45, 0x07, 0x44, 0x00, 0x45, 0x08, 0x4C, 0x07, 0x4C, 0x07, 0x4D, 0x06,
+    0x47, 0x00, 0x45, 0x05, 0x46, 0x02, 0x44, 0x05, 0x45, 0x03, 0x45, 0x04, 0x44, 0x05, 0x45, 0x03,
+    0x44, 0x05, 0x45, 0x03, 0x44, 0x06, 0x45, 0x02, 0x44, 0x06, 0x45, 0x02, 0x44, 0x07, 0x45, 0x01,
+    0x44, 0x07, 0x46, 0x00, 0x44, 0x08, 0x45, 0x00, 0x44, 0x09, 0x45, 0x44, 0x0B, 0x44, 0x0B, 0x44,
+    0x0B, 0x44, 0x0B, 0x44, 0x0B, 0x44, 0x0B, 0x44, 0x0B, 0x44, 0x0B, 0x44, 0x0B, 0x44, 0x0B, 0x44,
+    0x0B, 0x44, 0x0B, 0x44, 0x0B, 0x44, 0x0B, 0x44, 0x0B, 0x44, 0x0B, 0x44, 0x0B, 0x44, 0x0B, 0x44,
+    0x0B, 0x7F, 0x43, 0x46, 0x07, 0x4F, 0x06, 0x4F, 0x06, 0x4F, 0x06, 0x50, 0x04, 0x51, 0x04, 0x51,
+    0x04, 0x51, 0x03, 0x43, 0x00, 0x49, 0x00, 0x43, 0x02, 0x43, 0x00, 0x49, 0x00, 0x43, 0x02, 0x43,
+    0x00, 0x49, 0x00, 0x43, 0x02, 0x43, 0x00, 0x49, 0x00, 0x43, 0x01, 0x43, 0x01, 0x49, 0x01, 0x43,
+    0x00, 0x43, 0x01, 0x49, 0x01, 0x43, 0x00, 0x43, 0x01, 0x49, 0x01, 0x48, 0x01, 0x49, 0x01, 0x48,
+    0x01, 0x49, 0x01, 0x47, 0x02, 0x49, 0x02, 0x46, 0x02, 0x49, 0x02, 0x46, 0x02, 0x49, 0x02, 0x46,
+    0x02, 0x49, 0x02, 0x45, 0x03, 0x49, 0x03, 0x44, 0x03, 0x49, 0x03, 0x44, 0x03, 0x44, 0x45, 0x07,
+    0x4A, 0x07, 0x4B, 0x06, 0x4B, 0x06, 0x4C, 0x05, 0x4D, 0x04, 0x4D, 0x04, 0x4E, 0x03, 0x4E, 0x03,
+    0x4F, 0x02, 0x49, 0x00, 0x45, 0x01, 0x49, 0x01, 0x44, 0x01, 0x49, 0x01, 0x45, 0x00, 0x49, 0x02,
+    0x44, 0x00, 0x49, 0x02, 0x4F, 0x03, 0x4E, 0x04, 0x4D, 0x04, 0x4D, 0x05, 0x4C, 0x05, 0x4C, 0x06,
+    0x4B, 0x07, 0x4A, 0x07, 0x45, 0x06, 0x48, 0x0B, 0x4C, 0x08, 0x4E, 0x06, 0x50, 0x04, 0x46, 0x03,
+    0x47, 0x02, 0x45, 0x07, 0x45, 0x02, 0x45, 0x08, 0x45, 0x01, 0x44, 0x0A, 0x44, 0x00, 0x45, 0x0A,
+    0x44, 0x00, 0x44, 0x0B, 0x4A, 0x0C, 0x49, 0x0C, 0x49, 0x0B, 0x4A, 0x0B, 0x4B, 0x0A, 0x44, 0x01,
+    0x44, 0x0A, 0x44, 0x01, 0x45, 0x08, 0x45, 0x01, 0x46, 0x06, 0x45, 0x03, 0x47, 0x02, 0x47, 0x04,
+    0x50, 0x06, 0x4E, 0x08, 0x4C, 0x0B, 0x48, 0x06, 0x4D, 0x03, 0x4F, 0x01, 0x50, 0x00, 0x50, 0x00,
+    0x44, 0x05, 0x4B, 0x07, 0x49, 0x07, 0x49, 0x07, 0x49, 0x07, 0x49, 0x05, 0x57, 0x00, 0x50, 0x00,
+    0x4F, 0x01, 0x4D, 0x03, 0x44, 0x0C, 0x44, 0x0C, 0x44, 0x0C, 0x44, 0x0C, 0x44, 0x0C, 0x44, 0x0C,
+    0x44, 0x0C, 0x44, 0x0C, 0x44, 0x0C, 0x06, 0x48, 0x0B, 0x4C, 0x08, 0x4E, 0x06, 0x50, 0x04, 0x47,
+    0x02, 0x47, 0x02, 0x46, 0x06, 0x45, 0x02, 0x45, 0x08, 0x45, 0x01, 0x44, 0x0A, 0x44, 0x00, 0x45,
+    0x0A, 0x44, 0x00, 0x44, 0x0B, 0x4A, 0x0C, 0x49, 0x0C, 0x49, 0x0C, 0x49, 0x0B, 0x4B, 0x04, 0x41,
+    0x03, 0x44, 0x01, 0x44, 0x04, 0x43, 0x01, 0x44, 0x01, 0x45, 0x02, 0x4B, 0x01, 0x46, 0x02, 0x4A,
+    0x02, 0x46, 0x02, 0x48, 0x04, 0x50, 0x06, 0x50, 0x06, 0x51, 0x06, 0x48, 0x00, 0x45, 0x11, 0x44,
+    0x13, 0x41, 0x00, 0x4F, 0x04, 0x50, 0x03, 0x51, 0x02, 0x52, 0x01, 0x44, 0x07, 0x45, 0x01, 0x44,
+    0x08, 0x44, 0x01, 0x44, 0x08, 0x44, 0x01, 0x44, 0x08, 0x44, 0x01, 0x44, 0x07, 0x45, 0x01, 0x51,
+    0x02, 0x51, 0x02, 0x4F, 0x04, 0x4D, 0x06, 0x44, 0x02, 0x46, 0x05, 0x44, 0x03, 0x46, 0x04, 0x44,
+    0x04, 0x46, 0x03, 0x44, 0x05, 0x45, 0x03, 0x44, 0x05, 0x46, 0x02, 0x44, 0x06, 0x45, 0x02, 0x44,
+    0x07, 0x45, 0x01, 0x44, 0x07, 0x46, 0x00, 0x44, 0x08, 0x45, 0x00, 0x44, 0x09, 0x45, 0x04, 0x48,
+    0x07, 0x4C, 0x04, 0x4E, 0x03, 0x4E, 0x02, 0x45, 0x04, 0x45, 0x01, 0x44, 0x06, 0x44, 0x01, 0x44,
+    0x0D, 0x44, 0x0D, 0x47, 0x0B, 0x49, 0x08, 0x4C, 0x07, 0x4C, 0x06, 0x4C, 0x08, 0x49, 0x0B, 0x47,
+    0x0D, 0x49, 0x08, 0x4A, 0x07, 0x44, 0x00, 0x45, 0x04, 0x46, 0x00, 0x50, 0x02, 0x4E, 0x04, 0x4C,
+    0x07, 0x48, 0x04, 0x7F, 0x47, 0x05, 0x44, 0x0C, 0x44, 0x0C, 0x44, 0x0C, 0x44, 0x0C, 0x44, 0x0C,
+    0x44, 0x0C, 0x44, 0x0C, 0x44, 0x0C, 0x44, 0x0C, 0x44, 0x0C, 0x44, 0x0C, 0x44, 0x0C, 0x44, 0x0C,
+    0x44, 0x0C, 0x44, 0x0C, 0x44, 0x0C, 0x44, 0x0C, 0x44, 0x0C, 0x44, 0x06, 0x44, 0x08, 0x49, 0x08,
+    0x49, 0x08, 0x49, 0x08, 0x49, 0x08, 0x49, 0x08, 0x49, 0x08, 0x49, 0x08, 0x49, 0x08, 0x49, 0x08,
+    0x49, 0x08, 0x49, 0x08, 0x49, 0x08, 0x49, 0x08, 0x49, 0x08, 0x49, 0x08, 0x49, 0x08, 0x44, 0x00,
+    0x44, 0x06, 0x44, 0x01, 0x46, 0x03, 0x45, 0x01, 0x50, 0x02, 0x4E, 0x04, 0x4C, 0x07, 0x48, 0x04,
+    0x44, 0x0A, 0x4A, 0x09, 0x44, 0x00, 0x44, 0x08, 0x45, 0x00, 0x44, 0x08, 0x44, 0x01, 0x45, 0x07,
+    0x44, 0x02, 0x44, 0x06, 0x45, 0x02, 0x44, 0x06, 0x44, 0x03, 0x45, 0x05, 0x44, 0x04, 0x44, 0x04,
+    0x44, 0x05, 0x44, 0x04, 0x44, 0x05, 0x45, 0x03, 0x44, 0x06, 0x44, 0x02, 0x44, 0x07, 0x44, 0x02,
+    0x44, 0x07, 0x45, 0x01, 0x44, 0x08, 0x44, 0x00, 0x44, 0x09, 0x44, 0x00, 0x44, 0x09, 0x4A, 0x0A,
+    0x48, 0x0B, 0x48, 0x0C, 0x46, 0x0D, 0x46, 0x0D, 0x46, 0x0E, 0x44, 0x07, 0x44, 0x06, 0x45, 0x06,
+    0x49, 0x06, 0x46, 0x05, 0x49, 0x06, 0x46, 0x05, 0x44, 0x00, 0x44, 0x04, 0x47, 0x05, 0x44, 0x00,
+    0x44, 0x04, 0x47, 0x04, 0x44, 0x01, 0x44, 0x04, 0x48, 0x03, 0x44, 0x01, 0x44, 0x03, 0x49, 0x03,
+    0x44, 0x02, 0x43, 0x03, 0x49, 0x03, 0x44, 0x02, 0x44, 0x02, 0x44, 0x00, 0x43, 0x03, 0x43, 0x03,
+    0x44, 0x02, 0x43, 0x01, 0x44, 0x01, 0x44, 0x03, 0x44, 0x01, 0x44, 0x01, 0x44, 0x01, 0x44, 0x04,
+    0x43, 0x01, 0x44, 0x01, 0x44, 0x01, 0x44, 0x04, 0x44, 0x00, 0x44, 0x02, 0x43, 0x01, 0x43, 0x05,
+    0x44, 0x00, 0x43, 0x03, 0x49, 0x05, 0x49, 0x03, 0x49, 0x06, 0x48, 0x03, 0x49, 0x06, 0x47, 0x05,
+    0x47, 0x07, 0x47, 0x05, 0x47, 0x07, 0x47, 0x05, 0x47, 0x08, 0x46, 0x05, 0x47, 0x08, 0x45, 0x07,
+    0x45, 0x09, 0x45, 0x07, 0x45, 0x09, 0x45, 0x07, 0x45, 0x04, 0x00, 0x45, 0x06, 0x45, 0x02, 0x44,
+    0x06, 0x45, 0x02, 0x45, 0x04, 0x45, 0x04, 0x45, 0x03, 0x44, 0x06, 0x44, 0x02, 0x45, 0x06, 0x45,
+    0x00, 0x45, 0x08, 0x4A, 0x0A, 0x49, 0x0A, 0x48, 0x0C, 0x46, 0x0D, 0x46, 0x0D, 0x46, 0x0D, 0x47,
+    0x0B, 0x48, 0x0A, 0x4A, 0x09, 0x4B, 0x07, 0x45, 0x00, 0x45, 0x06, 0x45, 0x02, 0x45, 0x05, 0x45,
+    0x03, 0x45, 0x03, 0x45, 0x04, 0x45, 0x02, 0x45, 0x06, 0x45, 0x01, 0x45, 0x07, 0x44, 0x00, 0x45,
+    0x08, 0x45, 0x45, 0x09, 0x44, 0x00, 0x44, 0x08, 0x44, 0x01, 0x45, 0x07, 0x44, 0x02, 0x45, 0x05,
+    0x44, 0x04, 0x44, 0x04, 0x45, 0x04, 0x45, 0x03, 0x44, 0x06, 0x44, 0x02, 0x44, 0x08, 0x44, 0x01,
+    0x44, 0x08, 0x4A, 0x0A, 0x48, 0x0B, 0x48, 0x0C, 0x46, 0x0E, 0x45, 0x0E, 0x44, 0x0F, 0x44, 0x0F,
+    0x44, 0x0F, 0x44, 0x0F, 0x44, 0x0F, 0x44, 0x0F, 0x44, 0x0F, 0x44, 0x0F, 0x44, 0x0F, 0x44, 0x07,
+    0x01, 0x50, 0x01, 0x50, 0x01, 0x50, 0x01, 0x4F, 0x0B, 0x46, 0x0B, 0x45, 0x0B, 0x45, 0x0B, 0x45,
+    0x0B, 0x45, 0x0B, 0x46, 0x0B, 0x45, 0x0B, 0x45, 0x0B, 0x45, 0x0B, 0x46, 0x0B, 0x45, 0x0B, 0x45,
+    0x0B, 0x45, 0x0B, 0x46, 0x0B, 0x45, 0x0B, 0x7F, 0x4B, 0x64, 0x02, 0x44, 0x02, 0x44, 0x02, 0x44,
+    0x02, 0x44, 0x02, 0x44, 0x02, 0x44, 0x02, 0x44, 0x02, 0x44, 0x02, 0x44, 0x02, 0x44, 0x02, 0x44,
+    0x02, 0x44, 0x02, 0x44, 0x02, 0x44, 0x02, 0x44, 0x02, 0x44, 0x02, 0x44, 0x02, 0x44, 0x02, 0x44,
+    0x02, 0x44, 0x02, 0x5F, 0x43, 0x04, 0x43, 0x05, 0x42, 0x05, 0x42, 0x05, 0x43, 0x04, 0x43, 0x05,
+    0x42, 0x05, 0x42, 0x05, 0x43, 0x04, 0x43, 0x05, 0x42, 0x05, 0x42, 0x05, 0x43, 0x04, 0x43, 0x05,
+    0x42, 0x05, 0x42, 0x05, 0x42, 0x05, 0x43, 0x04, 0x43, 0x05, 0x42, 0x05, 0x42, 0x05, 0x43, 0x04,
+    0x43, 0x63, 0x03, 0x44, 0x03, 0x44, 0x03, 0x44, 0x03, 0x44, 0x03, 0x44, 0x03, 0x44, 0x03, 0x44,
+    0x03, 0x44, 0x03, 0x44, 0x03, 0x44, 0x03, 0x44, 0x03, 0x44, 0x03, 0x44, 0x03, 0x44, 0x03, 0x44,
+    0x03, 0x44, 0x03, 0x44, 0x03, 0x44, 0x03, 0x44, 0x03, 0x44, 0x03, 0x68, 0x04, 0x43, 0x0A, 0x44,
+    0x08, 0x45, 0x08, 0x46, 0x06, 0x47, 0x06, 0x48, 0x04, 0x44, 0x00, 0x43, 0x04, 0x43, 0x01, 0x44,
+    0x02, 0x44, 0x02, 0x43, 0x02, 0x43, 0x03, 0x44, 0x00, 0x44, 0x03, 0x44, 0x00, 0x43, 0x05, 0x44,
+    0x78, 0x44, 0x02, 0x43, 0x03, 0x43, 0x02, 0x43, 0x03, 0x43, 0x02, 0x48, 0x05, 0x4B, 0x02, 0x4C,
+    0x02, 0x44, 0x02, 0x45, 0x02, 0x42, 0x04, 0x44, 0x0A, 0x44, 0x08, 0x46, 0x03, 0x4B, 0x02, 0x4C,
+    0x01, 0x47, 0x00, 0x44, 0x00, 0x44, 0x04, 0x44, 0x00, 0x44, 0x04, 0x44, 0x00, 0x44, 0x04, 0x44,
+    0x00, 0x45, 0x01, 0x46, 0x00, 0x4E, 0x01, 0x4D, 0x02, 0x46, 0x01, 0x44, 0x44, 0x0B, 0x44, 0x0B,
+    0x44, 0x0B, 0x44, 0x0B, 0x44, 0x0B, 0x44, 0x0B, 0x44, 0x01, 0x45, 0x03, 0x4D, 0x02, 0x4E, 0x01,
+    0x46, 0x02, 0x45, 0x00, 0x45, 0x04, 0x44, 0x00, 0x44, 0x05, 0x44, 0x00, 0x44, 0x06, 0x49, 0x06,
+    0x49, 0x06, 0x49, 0x06, 0x49, 0x06, 0x49, 0x05, 0x44, 0x00, 0x45, 0x04, 0x44, 0x00, 0x46, 0x02,
+    0x45, 0x00, 0x4E, 0x01, 0x4D, 0x02, 0x43, 0x01, 0x45, 0x04, 0x04, 0x46, 0x06, 0x4A, 0x03, 0x4B,
+    0x02, 0x45, 0x01, 0x45, 0x01, 0x44, 0x03, 0x4A, 0x05, 0x42, 0x01, 0x44, 0x0A, 0x44, 0x0A, 0x44,
+    0x0A, 0x44, 0x0A, 0x44, 0x0A, 0x44, 0x05, 0x43, 0x01, 0x44, 0x04, 0x44, 0x00, 0x45, 0x02, 0x44,
+    0x02, 0x4C, 0x03, 0x4A, 0x06, 0x46, 0x03, 0x0B, 0x44, 0x0B, 0x44, 0x0B, 0x44, 0x0B, 0x44, 0x0B,
+    0x44, 0x0B, 0x44, 0x03, 0x45, 0x01, 0x44, 0x02, 0x4D, 0x01, 0x4E, 0x00, 0x45, 0x02, 0x46, 0x00,
+    0x44, 0x04, 0x4A, 0x05, 0x4A, 0x06, 0x49, 0x06, 0x49, 0x06, 0x49, 0x06, 0x49, 0x06, 0x49, 0x05,
+    0x45, 0x00, 0x44, 0x04, 0x45, 0x00, 0x45, 0x02, 0x46, 0x01, 0x4E, 0x02, 0x4D, 0x03, 0x45, 0x01,
+    0x44, 0x03, 0x46, 0x07, 0x49, 0x04, 0x4B, 0x02, 0x45, 0x01, 0x44, 0x02, 0x43, 0x04, 0x44, 0x00,
+    0x44, 0x05, 0x43, 0x00, 0x44, 0x05, 0x43, 0x00, 0x74, 0x0A, 0x44, 0x0A, 0x44, 0x0B, 0x45, 0x02,
+    0x43, 0x03, 0x4C, 0x03, 0x4A, 0x05, 0x47, 0x03, 0x04, 0x45, 0x02, 0x47, 0x02, 0x47, 0x02, 0x44,
+    0x05, 0x43, 0x06, 0x43, 0x03, 0x49, 0x00, 0x49, 0x00, 0x49, 0x03, 0x43, 0x06, 0x43, 0x06, 0x43,
+    0x06, 0x43, 0x06, 0x43, 0x06, 0x43, 0x06, 0x43, 0x06, 0x43, 0x06, 0x43, 0x06, 0x43, 0x06, 0x43,
+    0x06, 0x43, 0x06, 0x43, 0x06, 0x43, 0x03, 0x03, 0x45, 0x01, 0x44, 0x02, 0x4D, 0x01, 0x4E, 0x00,
+    0x45, 0x02, 0x46, 0x00, 0x44, 0x04, 0x4A, 0x05, 0x4A, 0x06, 0x49, 0x06, 0x49, 0x06, 0x49, 0x06,
+    0x49, 0x06, 0x49, 0x05, 0x45, 0x00, 0x44, 0x04, 0x45, 0x00, 0x45, 0x02, 0x46, 0x01, 0x4E, 0x02,
+    0x4D, 0x03, 0x45, 0x01, 0x44, 0x0B, 0x44, 0x00, 0x42, 0x07, 0x43, 0x01, 0x45, 0x02, 0x45, 0x01,
+    0x4E, 0x02, 0x4C, 0x05, 0x48, 0x03, 0x44, 0x0A, 0x44, 0x0A, 0x44, 0x0A, 0x44, 0x0A, 0x44, 0x0A,
+    0x44, 0x0A, 0x44, 0x01, 0x45, 0x02, 0x4D, 0x01, 0x4E, 0x00, 0x46, 0x02, 0x44, 0x00, 0x45, 0x03,
+    0x44, 0x00, 0x44, 0x05, 0x43, 0x00, 0x44, 0x05, 0x43, 0x00, 0x44, 0x05, 0x49, 0x05, 0x49, 0x05,
+    0x49, 0x05, 0x49, 0x05, 0x49, 0x05, 0x49, 0x05, 0x49, 0x05, 0x49, 0x05, 0x49, 0x05, 0x44, 0x4E,
+    0x0E, 0x7F, 0x54, 0x02, 0x44, 0x02, 0x44, 0x02, 0x44, 0x1A, 0x44, 0x02, 0x44, 0x02, 0x44, 0x02,
+    0x44, 0x02, 0x44, 0x02, 0x44, 0x02, 0x44, 0x02, 0x44, 0x02, 0x44, 0x02, 0x44, 0x02, 0x44, 0x02,
+    0x44, 0x02, 0x44, 0x02, 0x44, 0x02, 0x44, 0x02, 0x44, 0x02, 0x44, 0x02, 0x44, 0x02, 0x44, 0x01,
+    0x4C, 0x00, 0x46, 0x00, 0x45, 0x01, 0x44, 0x09, 0x44, 0x09, 0x44, 0x09, 0x44, 0x09, 0x44, 0x09,
+    0x44, 0x09, 0x44, 0x03, 0x4A, 0x02, 0x45, 0x00, 0x44, 0x01, 0x45, 0x01, 0x44, 0x00, 0x45, 0x02,
+    0x44, 0x00, 0x44, 0x03, 0x49, 0x04, 0x49, 0x04, 0x49, 0x04, 0x4A, 0x03, 0x4A, 0x03, 0x45, 0x00,
+    0x44, 0x02, 0x44, 0x02, 0x44, 0x01, 0x44, 0x02, 0x44, 0x01, 0x44, 0x03, 0x44, 0x00, 0x44, 0x03,
+    0x44, 0x00, 0x44, 0x04, 0x49, 0x04, 0x44, 0x7F, 0x72, 0x43, 0x01, 0x45, 0x03, 0x45, 0x01, 0x4C,
+    0x00, 0x48, 0x00, 0x5D, 0x02, 0x46, 0x02, 0x49, 0x03, 0x45, 0x03, 0x49, 0x04, 0x44, 0x03, 0x49,
+    0x04, 0x43, 0x05, 0x47, 0x05, 0x43, 0x05, 0x47, 0x05, 0x43, 0x05, 0x47, 0x05, 0x43, 0x05, 0x47,
+    0x05, 0x43, 0x05, 0x47, 0x05, 0x43, 0x05, 0x47, 0x05, 0x43, 0x05, 0x47, 0x05, 0x43, 0x05, 0x47,
+    0x05, 0x43, 0x05, 0x47, 0x05, 0x43, 0x05, 0x47, 0x05, 0x43, 0x05, 0x43, 0x43, 0x02, 0x45, 0x02,
+    0x4D, 0x01, 0x4E, 0x00, 0x46, 0x01, 0x45, 0x00, 0x45, 0x03, 0x44, 0x00, 0x44, 0x05, 0x43, 0x00,
+    0x44, 0x05, 0x49, 0x05, 0x49, 0x05, 0x49, 0x05, 0x49, 0x05, 0x49, 0x05, 0x49, 0x05, 0x49, 0x05,
+    0x49, 0x05, 0x49, 0x05, 0x49, 0x05, 0x44, 0x04, 0x47, 0x07, 0x4A, 0x05, 0x4C, 0x04, 0x45, 0x01,
+    0x45, 0x02, 0x44, 0x05, 0x44, 0x01, 0x44, 0x05, 0x44, 0x00, 0x44, 0x07, 0x49, 0x07, 0x49, 0x07,
+    0x49, 0x07, 0x49, 0x07, 0x44, 0x00, 0x44, 0x05, 0x44, 0x01, 0x44, 0x05, 0x44, 0x01, 0x46, 0x01,
+    0x45, 0x03, 0x4C, 0x05, 0x4A, 0x08, 0x47, 0x04, 0x43, 0x01, 0x46, 0x03, 0x4D, 0x02, 0x4E, 0x01,
+    0x46, 0x02, 0x45, 0x00, 0x45, 0x04, 0x44, 0x00, 0x44, 0x05, 0x44, 0x00, 0x44, 0x06, 0x49, 0x06,
+    0x49, 0x06, 0x49, 0x06, 0x49, 0x06, 0x49, 0x05, 0x44, 0x00, 0x45, 0x04, 0x44, 0x00, 0x46, 0x02,
+    0x45, 0x00, 0x4E, 0x01, 0x4D, 0x02, 0x44, 0x01, 0x44, 0x04, 0x44, 0x0B, 0x44, 0x0B, 0x44, 0x0B,
+    0x44, 0x0B, 0x44, 0x0B, 0x44, 0x0B, 0x03, 0x46, 0x00, 0x44, 0x02, 0x4D, 0x01, 0x4E, 0x00, 0x45,
+    0x02, 0x46, 0x00, 0x44, 0x04, 0x45, 0x00, 0x44, 0x05, 0x49, 0x06, 0x49, 0x06, 0x49, 0x06, 0x49,
+    0x06, 0x49, 0x06, 0x44, 0x00, 0x44, 0x04, 0x45, 0x00, 0x44, 0x04, 0x45, 0x00, 0x45, 0x02, 0x46,
+    0x01, 0x4E, 0x02, 0x4D, 0x03, 0x45, 0x01, 0x44, 0x0B, 0x44, 0x0B, 0x44, 0x0B, 0x44, 0x0B, 0x44,
+    0x0B, 0x44, 0x0B, 0x44, 0x43, 0x00, 0x5A, 0x00, 0x45, 0x04, 0x45, 0x04, 0x44, 0x05, 0x44, 0x05,
+    0x44, 0x05, 0x44, 0x05, 0x44, 0x05, 0x44, 0x05, 0x44, 0x05, 0x44, 0x05, 0x44, 0x05, 0x44, 0x05,
+    0x44, 0x05, 0x44, 0x05, 0x02, 0x48, 0x04, 0x4A, 0x02, 0x4C, 0x00, 0x45, 0x02, 0x4A, 0x04, 0x43,
+    0x00, 0x44, 0x09, 0x47, 0x07, 0x4A, 0x04, 0x4B, 0x04, 0x4A, 0x06, 0x47, 0x00, 0x43, 0x04, 0x49,
+    0x05, 0x49, 0x02, 0x45, 0x00, 0x4D, 0x01, 0x4B, 0x04, 0x47, 0x02, 0x05, 0x40, 0x08, 0x41, 0x06,
+    0x43, 0x06, 0x43, 0x06, 0x43, 0x06, 0x43, 0x03, 0x49, 0x00, 0x49, 0x00, 0x49, 0x03, 0x43, 0x06,
+    0x43, 0x06, 0x43, 0x06, 0x43, 0x06, 0x43, 0x06, 0x43, 0x06, 0x43, 0x06, 0x43, 0x06, 0x43, 0x06,
+    0x43, 0x06, 0x44, 0x05, 0x47, 0x02, 0x47, 0x03, 0x45, 0x00, 0x44, 0x05, 0x48, 0x05, 0x48, 0x05,
+    0x48, 0x05, 0x48, 0x05, 0x48, 0x05, 0x48, 0x05, 0x48, 0x05, 0x48, 0x05, 0x48, 0x05, 0x48, 0x05,
+    0x48, 0x04, 0x49, 0x04, 0x4A, 0x02, 0x45, 0x00, 0x4D, 0x00, 0x4D, 0x02, 0x45, 0x01, 0x43, 0x44,
+    0x06, 0x44, 0x00, 0x43, 0x06, 0x44, 0x00, 0x44, 0x05, 0x43, 0x01, 0x44, 0x04, 0x44, 0x02, 0x44,
+    0x03, 0x44, 0x02, 0x44, 0x03, 0x43, 0x04, 0x43, 0x02, 0x44, 0x04, 0x44, 0x01, 0x44, 0x04, 0x44,
+    0x01, 0x43, 0x06, 0x43, 0x00, 0x44, 0x06, 0x48, 0x07, 0x48, 0x08, 0x47, 0x08, 0x46, 0x0A, 0x45,
+    0x0A, 0x45, 0x0A, 0x44, 0x05, 0x44, 0x04, 0x44, 0x05, 0x49, 0x04, 0x45, 0x03, 0x44, 0x01, 0x43,
+    0x04, 0x45, 0x03, 0x44, 0x01, 0x44, 0x03, 0x45, 0x03, 0x44, 0x01, 0x44, 0x02, 0x46, 0x03, 0x43,
+    0x03, 0x43, 0x02, 0x47, 0x01, 0x44, 0x03, 0x44, 0x01, 0x47, 0x01, 0x44, 0x03, 0x44, 0x00, 0x48,
+    0x01, 0x43, 0x05, 0x43, 0x00, 0x43, 0x00, 0x49, 0x05, 0x43, 0x00, 0x43, 0x01, 0x48, 0x05, 0x48,
+    0x01, 0x47, 0x07, 0x47, 0x01, 0x47, 0x07, 0x46, 0x02, 0x47, 0x07, 0x46, 0x03, 0x45, 0x09, 0x45,
+    0x03, 0x45, 0x09, 0x45, 0x03, 0x45, 0x09, 0x44, 0x04, 0x45, 0x04, 0x00, 0x44, 0x04, 0x45, 0x00,
+    0x45, 0x03, 0x44, 0x02, 0x45, 0x01, 0x44, 0x04, 0x44, 0x00, 0x45, 0x04, 0x4A, 0x06, 0x48, 0x08,
+    0x47, 0x09, 0x45, 0x0A, 0x45, 0x09, 0x47, 0x08, 0x47, 0x07, 0x49, 0x05, 0x4B, 0x04, 0x44, 0x01,
+    0x44, 0x03, 0x44, 0x02, 0x45, 0x01, 0x45, 0x03, 0x4B, 0x05, 0x44, 0x44, 0x06, 0x49, 0x06, 0x44,
+    0x00, 0x43, 0x05, 0x44, 0x01, 0x44, 0x04, 0x44, 0x01, 0x44, 0x04, 0x43, 0x03, 0x43, 0x03, 0x44,
+    0x03, 0x44, 0x02, 0x44, 0x03, 0x44, 0x02, 0x43, 0x05, 0x43, 0x01, 0x44, 0x05, 0x44, 0x00, 0x44,
+    0x06, 0x43, 0x00, 0x43, 0x07, 0x48, 0x07, 0x48, 0x08, 0x46, 0x09, 0x46, 0x09, 0x45, 0x0B, 0x44,
+    0x0B, 0x44, 0x0A, 0x44, 0x0A, 0x45, 0x07, 0x47, 0x08, 0x47, 0x08, 0x45, 0x09, 0x00, 0x4D, 0x00,
+    0x4D, 0x00, 0x4D, 0x07, 0x46, 0x06, 0x46, 0x07, 0x45, 0x07, 0x45, 0x07, 0x46, 0x06, 0x46, 0x07,
+    0x45, 0x07, 0x45, 0x07, 0x46, 0x06, 0x46, 0x07, 0x45, 0x07, 0x6C, 0x05, 0x44, 0x03, 0x46, 0x03,
+    0x46, 0x02, 0x47, 0x02, 0x44, 0x05, 0x44, 0x05, 0x44, 0x05, 0x44, 0x05, 0x44, 0x05, 0x44, 0x05,
+    0x44, 0x05, 0x43, 0x04, 0x45, 0x03, 0x45, 0x04, 0x44, 0x05, 0x45, 0x05, 0x45, 0x06, 0x43, 0x06,
+    0x43, 0x06, 0x44, 0x05, 0x44, 0x05, 0x44, 0x05, 0x44, 0x05, 0x44, 0x05, 0x44, 0x05, 0x47, 0x03,
+    0x46, 0x03, 0x46, 0x05, 0x44, 0x7F, 0x59, 0x44, 0x05, 0x45, 0x04, 0x46, 0x03, 0x46, 0x05, 0x44,
+    0x06, 0x43, 0x06, 0x43, 0x06, 0x43, 0x06, 0x43, 0x06, 0x43, 0x06, 0x43, 0x06, 0x44, 0x06, 0x44,
+    0x05, 0x46, 0x04, 0x45, 0x03, 0x46, 0x03, 0x44, 0x04, 0x44, 0x05, 0x44, 0x05, 0x43, 0x06, 0x43,
+    0x06, 0x43, 0x06, 0x43, 0x06, 0x43, 0x05, 0x44, 0x03, 0x46, 0x03, 0x46, 0x03, 0x45, 0x04, 0x44,
+    0x05, 0x01, 0x45, 0x07, 0x4B, 0x02, 0x67, 0x02, 0x49, 0x00, 0x40, 0x07, 0x45, 0x01,
+};
+
+const RleGlyph Inter_32BGlyphs[] PROGMEM = {
+    { 0, 32, 0, 0, 11, 0, 0 },  // 'space'
+    { 0, 33, 5, 23, 13, 4, 3 },  // '!'
+    { 19, 34, 12, 8, 18, 2, 3 },  // '"'
+    { 42, 35, 18, 23, 20, 1, 3 },  // '#'
+    { 115, 36, 15, 28, 20, 2, 1 },  // '$'
+    { 192, 37, 25, 24, 31, 2, 3 },  // '%'
+    { 321, 38, 21, 23, 26, 2, 3 },  // '&'
+    { 400, 39, 5, 8, 10, 2, 3 },  // '''
+    { 407, 40, 8, 29, 13, 2, 3 },  // '('
+    { 465, 41, 8, 29, 13, 2, 3 },  // ')'
+    { 523, 42, 12, 10, 15, 1, 3 },  // '*'
+    { 552, 43, 16, 16, 21, 2, 7 },  // '+'
+    { 579, 44, 5, 9, 11, 3, 22 },  // ','
+    { 591, 45, 9, 4, 13, 2, 16 },  // '-'
+    { 592, 46, 5, 4, 11, 3, 22 },  // '.'
+    { 593, 47, 9, 23, 11, 1, 3 },  // '/'
+    { 640, 48, 15, 23, 20, 2, 3 },  // '0'
+    { 699, 49, 11, 23, 20, 3, 3 },  // '1'
+    { 741, 50, 15, 23, 20, 2, 3 },  // '2'
+    { 783, 51, 15, 23, 20, 2, 3 },  // '3'
+    { 838, 52, 17, 23, 20, 1, 3 },  // '4'
+    { 892, 53, 16, 23, 20, 2, 3 },  // '5'
+    { 945, 54, 16, 23, 20, 2, 3 },  // '6'
+    { 1008, 55, 15, 23, 20, 2, 3 },  // '7'
+    { 1048, 56, 15, 23, 20, 2, 3 },  // '8'
+    { 1115, 57, 15, 23, 20, 2, 3 },  // '9'
+    { 1172, 58, 5, 17, 13, 4, 9 },  // ':'
+    { 1175, 59, 5, 22, 13, 4, 9 },  // ';'
+    { 1189, 60, 16, 17, 21, 2, 6 },  // '<'
+    { 1223, 61, 16, 11, 21, 2, 9 },  // '='
+    { 1226, 62, 16, 17, 21, 2, 6 },  // '>'
+    { 1260, 63, 16, 23, 22, 3, 3 },  // '?'
+    { 1307, 64, 30, 30, 34, 2, 3 },  // '@'
+    { 1466, 65, 23, 23, 26, 1, 3 },  // 'A'
+    { 1538, 66, 20, 23, 26, 3, 3 },  // 'B'
+    { 1596, 67, 21, 23, 26, 2, 3 },  // 'C'
+    { 1661, 68, 20, 23, 26, 3, 3 },  // 'D'
+    { 1719, 69, 18, 23, 24, 3, 3 },  // 'E'
+    { 1759, 70, 16, 23, 22, 3, 3 },  // 'F'
+    { 1798, 71, 22, 23, 27, 2, 3 },  // 'G'
+    { 1865, 72, 19, 23, 26, 3, 3 },  // 'H'
+    { 1905, 73, 5, 23, 11, 3, 3 },  // 'I'
+    { 1907, 74, 15, 23, 20, 1, 3 },  // 'J'
+    { 1958, 75, 21, 23, 26, 3, 3 },  // 'K'
+    { 2043, 76, 17, 23, 22, 3, 3 },  // 'L'
+    { 2083, 77, 23, 23, 29, 3, 3 },  // 'M'
+    { 2174, 78, 19, 23, 26, 3, 3 },  // 'N'
+    { 2229, 79, 23, 23, 27, 2, 3 },  // 'O'
+    { 2296, 80, 18, 23, 24, 3, 3 },  // 'P'
+    { 2342, 81, 23, 25, 27, 2, 3 },  // 'Q'
+    { 2419, 82, 21, 23, 26, 3, 3 },  // 'R'
+    { 2494, 83, 19, 23, 24, 2, 3 },  // 'S'
+    { 2547, 84, 18, 23, 22, 3, 3 },  // 'T'
+    { 2588, 85, 19, 23, 26, 3, 3 },  // 'U'
+    { 2640, 86, 21, 23, 24, 1, 3 },  // 'V'
+    { 2716, 87, 30, 23, 33, 1, 3 },  // 'W'
+    { 2842, 88, 21, 23, 24, 1, 3 },  // 'X'
+    { 2914, 89, 21, 23, 24, 1, 3 },  // 'Y'
+    { 2976, 90, 19, 23, 22, 1, 3 },  // 'Z'
+    { 3017, 91, 8, 29, 13, 3, 3 },  // '['
+    { 3060, 92, 9, 23, 11, 1, 3 },  // '\\'
+    { 3105, 93, 9, 29, 13, 1, 3 },  // ']'
+    { 3148, 94, 15, 12, 21, 3, 3 },  // '^'
+    { 3184, 95, 19, 3, 20, 0, 29 },  // '_'
+    { 3185, 96, 7, 5, 13, 2, 3 },  // '`'
+    { 3194, 97, 16, 17, 20, 2, 9 },  // 'a'
+    { 3244, 98, 17, 23, 22, 3, 3 },  // 'b'
+    { 3306, 99, 16, 17, 20, 2, 9 },  // 'c'
+    { 3351, 100, 17, 23, 22, 2, 3 },  // 'd'
+    { 3409, 101, 16, 17, 20, 2, 9 },  // 'e'
+    { 3448, 102, 11, 23, 13, 1, 3 },  // 'f'
+    { 3495, 103, 17, 23, 22, 2, 9 },  // 'g'
+    { 3558, 104, 16, 23, 22, 3, 3 },  // 'h'
+    { 3615, 105, 5, 23, 11, 3, 3 },  // 'i'
+    { 3619, 106, 8, 29, 11, 0, 3 },  // 'j'
+    { 3670, 107, 15, 23, 20, 3, 3 },  // 'k'
+    { 3735, 108, 5, 23, 11, 3, 3 },  // 'l'
+    { 3737, 109, 24, 17, 31, 3, 9 },  // 'm'
+    { 3804, 110, 16, 17, 22, 3, 9 },  // 'n'
+    { 3847, 111, 18, 17, 22, 2, 9 },  // 'o'
+    { 3896, 112, 17, 23, 22, 3, 9 },  // 'p'
+    { 3958, 113, 17, 23, 22, 2, 9 },  // 'q'
+    { 4020, 114, 11, 17, 15, 3, 9 },  // 'r'
+    { 4052, 115, 15, 17, 20, 2, 9 },  // 's'
+    { 4091, 116, 11, 23, 13, 1, 3 },  // 't'
+    { 4138, 117, 15, 17, 22, 3, 9 },  // 'u'
+    { 4175, 118, 17, 17, 20, 1, 9 },  // 'v'
+    { 4229, 119, 26, 17, 27, 1, 9 },  // 'w'
+    { 4315, 120, 17, 17, 20, 1, 9 },  // 'x'
+    { 4363, 121, 17, 23, 20, 1, 9 },  // 'y'
+    { 4429, 122, 15, 17, 18, 1, 9 },  // 'z'
+    { 4459, 123, 11, 29, 15, 2, 3 },  // '{'
+    { 4517, 124, 3, 30, 11, 4, 3 },  // '|'
+    { 4519, 125, 11, 29, 15, 2, 3 },  // '}'
+    { 4577, 126, 17, 6, 21, 2, 12 },  // '~'
+};
+
+const RleFont Inter_32B PROGMEM = {
+    Inter_32BData,
+    Inter_32BGlyphs,
+    95, 45, 0, 45
+};
+
+#endif // RLE_INTER_32B_H
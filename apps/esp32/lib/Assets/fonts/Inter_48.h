@@ -0,0 +1,135 @@
+// Inter Font - 48px SemiBold (Weight 600) (1-bpp source)
+// Generated by scripts/fontgen.py: 2026-10-19
+// Charset: 21 characters, 1466 bytes RLE
+
+#ifndef RLE_INTER_48_H
+#define RLE_INTER_48_H
+
+#include "RleFont.h"
+
+const uint8_t Inter_48Data[] PROGMEM = {
+    0x03, 0x46, 0x0D, 0x44, 0x09, 0x49, 0x0C, 0x44, 0x09, 0x4A, 0x0A, 0x44, 0x09, 0x4C, 0x09, 0x44,
+    0x08, 0x45, 0x01, 0x45, 0x08, 0x44, 0x09, 0x45, 0x02, 0x45, 0x07, 0x44, 0x09, 0x44, 0x03, 0x45,
+    0x06, 0x44, 0x0A, 0x44, 0x04, 0x44, 0x06, 0x44, 0x0A, 0x44, 0x04, 0x44, 0x05, 0x44, 0x0B, 0x44,
+    0x04, 0x44, 0x05, 0x44, 0x0B, 0x44, 0x04, 0x44, 0x04, 0x44, 0x0C, 0x44, 0x03, 0x45, 0x04, 0x44,
+    0x0C, 0x45, 0x02, 0x45, 0x03, 0x44, 0x0D, 0x45, 0x01, 0x45, 0x04, 0x44, 0x0E, 0x4C, 0x03, 0x44,
+    0x10, 0x4A, 0x04, 0x44, 0x10, 0x49, 0x04, 0x44, 0x13, 0x46, 0x05, 0x44, 0x1F, 0x44, 0x05, 0x45,
+    0x14, 0x44, 0x03, 0x49, 0x11, 0x44, 0x03, 0x4B, 0x10, 0x44, 0x03, 0x4C, 0x0E, 0x44, 0x03, 0x45,
+    0x01, 0x45, 0x0E, 0x44, 0x03, 0x44, 0x03, 0x44, 0x0D, 0x44, 0x04, 0x44, 0x03, 0x45, 0x0C, 0x44,
+    0x04, 0x44, 0x03, 0x45, 0x0B, 0x44, 0x05, 0x44, 0x03, 0x45, 0x0B, 0x44, 0x05, 0x44, 0x03, 0x45,
+    0x0A, 0x44, 0x06, 0x44, 0x03, 0x45, 0x0A, 0x44, 0x06, 0x44, 0x03, 0x45, 0x09, 0x45, 0x06, 0x44,
+    0x03, 0x44, 0x0A, 0x44, 0x07, 0x45, 0x01, 0x45, 0x09, 0x45, 0x08, 0x4C, 0x09, 0x44, 0x09, 0x4B,
+    0x09, 0x45, 0x0A, 0x49, 0x0A, 0x44, 0x0D, 0x45, 0x04, 0x7F, 0x4D, 0x70, 0x06, 0x47, 0x0C, 0x4B,
+    0x09, 0x4D, 0x07, 0x4F, 0x05, 0x51, 0x04, 0x51, 0x03, 0x48, 0x02, 0x47, 0x02, 0x46, 0x05, 0x46,
+    0x02, 0x46, 0x05, 0x47, 0x00, 0x47, 0x06, 0x46, 0x00, 0x46, 0x07, 0x46, 0x00, 0x46, 0x07, 0x46,
+    0x00, 0x46, 0x07, 0x46, 0x00, 0x46, 0x07, 0x46, 0x00, 0x46, 0x08, 0x45, 0x00, 0x46, 0x08, 0x4D,
+    0x08, 0x4D, 0x08, 0x4D, 0x08, 0x4D, 0x08, 0x4D, 0x08, 0x45, 0x00, 0x46, 0x07, 0x46, 0x00, 0x46,
+    0x07, 0x46, 0x00, 0x46, 0x07, 0x46, 0x00, 0x46, 0x07, 0x46, 0x00, 0x47, 0x06, 0x46, 0x01, 0x46,
+    0x05, 0x47, 0x01, 0x46, 0x05, 0x46, 0x02, 0x48, 0x02, 0x47, 0x03, 0x51, 0x04, 0x51, 0x05, 0x4F,
+    0x07, 0x4D, 0x09, 0x4B, 0x0C, 0x47, 0x07, 0x08, 0x45, 0x08, 0x45, 0x07, 0x46, 0x06, 0x47, 0x06,
+    0x47, 0x04, 0x49, 0x03, 0x4A, 0x02, 0x4B, 0x00, 0x72, 0x00, 0x4B, 0x02, 0x4A, 0x03, 0x48, 0x05,
+    0x46, 0x07, 0x46, 0x07, 0x46, 0x07, 0x46, 0x07, 0x46, 0x07, 0x46, 0x07, 0x46, 0x07, 0x46, 0x07,
+    0x46, 0x07, 0x46, 0x07, 0x46, 0x07, 0x46, 0x07, 0x46, 0x07, 0x46, 0x07, 0x46, 0x07, 0x46, 0x07,
+    0x46, 0x07, 0x46, 0x07, 0x46, 0x07, 0x46, 0x07, 0x46, 0x07, 0x48, 0x0C, 0x4C, 0x08, 0x50, 0x05,
+    0x52, 0x04, 0x52, 0x03, 0x54, 0x02, 0x48, 0x02, 0x48, 0x01, 0x47, 0x06, 0x46, 0x01, 0x46, 0x07,
+    0x47, 0x00, 0x46, 0x07, 0x47, 0x00, 0x46, 0x08, 0x46, 0x0F, 0x46, 0x10, 0x46, 0x10, 0x46, 0x0F,
+    0x46, 0x0F, 0x47, 0x0E, 0x47, 0x0E, 0x48, 0x0D, 0x48, 0x0D, 0x48, 0x0D, 0x48, 0x0D, 0x48, 0x0D,
+    0x48, 0x0D, 0x47, 0x0E, 0x47, 0x0E, 0x47, 0x0F, 0x46, 0x0F, 0x46, 0x0F, 0x55, 0x01, 0x55, 0x00,
+    0x56, 0x00, 0x7F, 0x5E, 0x06, 0x47, 0x0C, 0x4B, 0x09, 0x4D, 0x07, 0x4F, 0x05, 0x51, 0x04, 0x51,
+    0x03, 0x47, 0x02, 0x48, 0x02, 0x46, 0x05, 0x46, 0x02, 0x45, 0x06, 0x46, 0x03, 0x44, 0x06, 0x46,
+    0x0F, 0x46, 0x0E, 0x46, 0x0D, 0x48, 0x0B, 0x49, 0x0C, 0x48, 0x0D, 0x47, 0x0E, 0x49, 0x0B, 0x4B,
+    0x0F, 0x47, 0x0F, 0x47, 0x0F, 0x46, 0x0F, 0x46, 0x10, 0x46, 0x0F, 0x46, 0x00, 0x45, 0x07, 0x4E,
+    0x07, 0x46, 0x00, 0x46, 0x07, 0x46, 0x00, 0x47, 0x05, 0x47, 0x01, 0x48, 0x02, 0x48, 0x01, 0x53,
+    0x03, 0x51, 0x05, 0x50, 0x06, 0x4E, 0x08, 0x4B, 0x0C, 0x47, 0x07, 0x0D, 0x45, 0x12, 0x45, 0x11,
+    0x46, 0x10, 0x47, 0x10, 0x47, 0x0F, 0x48, 0x0E, 0x49, 0x0D, 0x4A, 0x0D, 0x4A, 0x0C, 0x4B, 0x0B,
+    0x4C, 0x0B, 0x45, 0x00, 0x45, 0x0A, 0x45, 0x01, 0x45, 0x09, 0x46, 0x01, 0x45, 0x09, 0x45, 0x02,
+    0x45, 0x08, 0x45, 0x03, 0x45, 0x07, 0x46, 0x03, 0x45, 0x07, 0x45, 0x04, 0x45, 0x06, 0x45, 0x05,
+    0x45, 0x05, 0x46, 0x05, 0x45, 0x05, 0x45, 0x06, 0x45, 0x04, 0x45, 0x07, 0x45, 0x04, 0x7F, 0x7F,
+    0x55, 0x0D, 0x45, 0x12, 0x45, 0x12, 0x45, 0x12, 0x45, 0x12, 0x45, 0x12, 0x45, 0x12, 0x45, 0x04,
+    0x03, 0x51, 0x04, 0x51, 0x03, 0x52, 0x03, 0x52, 0x03, 0x52, 0x03, 0x52, 0x03, 0x52, 0x03, 0x45,
+    0x0F, 0x46, 0x0F, 0x46, 0x0F, 0x45, 0x10, 0x45, 0x10, 0x45, 0x00, 0x46, 0x08, 0x4F, 0x05, 0x52,
+    0x03, 0x53, 0x02, 0x54, 0x01, 0x54, 0x01, 0x48, 0x02, 0x49, 0x00, 0x46, 0x06, 0x47, 0x01, 0x44,
+    0x08, 0x46, 0x0F, 0x46, 0x0F, 0x46, 0x0F, 0x4D, 0x08, 0x4D, 0x08, 0x4E, 0x07, 0x4E, 0x06, 0x47,
+    0x00, 0x48, 0x02, 0x48, 0x01, 0x54, 0x02, 0x52, 0x04, 0x50, 0x06, 0x4E, 0x08, 0x4C, 0x0B, 0x48,
+    0x06, 0x07, 0x47, 0x0C, 0x4B, 0x09, 0x4D, 0x07, 0x4F, 0x05, 0x51, 0x03, 0x52, 0x03, 0x48, 0x02,
+    0x47, 0x01, 0x47, 0x05, 0x46, 0x01, 0x46, 0x06, 0x46, 0x01, 0x46, 0x07, 0x45, 0x00, 0x47, 0x0E,
+    0x46, 0x0F, 0x46, 0x0F, 0x46, 0x02, 0x46, 0x05, 0x46, 0x00, 0x49, 0x04, 0x53, 0x02, 0x54, 0x01,
+    0x54, 0x01, 0x55, 0x00, 0x49, 0x02, 0x48, 0x00, 0x48, 0x05, 0x4F, 0x07, 0x4E, 0x07, 0x4D, 0x08,
+    0x4E, 0x07, 0x46, 0x00, 0x46, 0x07, 0x46, 0x00, 0x46, 0x07, 0x46, 0x00, 0x47, 0x05, 0x47, 0x01,
+    0x48, 0x02, 0x47, 0x02, 0x53, 0x03, 0x51, 0x05, 0x4F, 0x07, 0x4D, 0x09, 0x4B, 0x0C, 0x47, 0x06,
+    0x7F, 0x7F, 0x48, 0x00, 0x54, 0x0F, 0x46, 0x0F, 0x45, 0x0F, 0x45, 0x0F, 0x45, 0x10, 0x45, 0x0F,
+    0x45, 0x0F, 0x46, 0x0F, 0x45, 0x0F, 0x46, 0x0F, 0x45, 0x0F, 0x46, 0x0F, 0x45, 0x10, 0x45, 0x0F,
+    0x46, 0x0F, 0x45, 0x0F, 0x46, 0x0F, 0x46, 0x0F, 0x46, 0x0F, 0x45, 0x0F, 0x46, 0x0F, 0x46, 0x0F,
+    0x46, 0x0F, 0x45, 0x10, 0x45, 0x10, 0x45, 0x0F, 0x46, 0x0F, 0x46, 0x0F, 0x46, 0x0B, 0x05, 0x49,
+    0x0A, 0x4D, 0x07, 0x4F, 0x05, 0x51, 0x04, 0x51, 0x03, 0x48, 0x02, 0x47, 0x02, 0x46, 0x05, 0x46,
+    0x02, 0x45, 0x07, 0x45, 0x02, 0x45, 0x07, 0x45, 0x02, 0x45, 0x07, 0x45, 0x02, 0x45, 0x07, 0x45,
+    0x02, 0x45, 0x07, 0x45, 0x02, 0x46, 0x05, 0x46, 0x03, 0x46, 0x02, 0x47, 0x05, 0x4F, 0x07, 0x4D,
+    0x09, 0x4B, 0x08, 0x4F, 0x05, 0x51, 0x03, 0x48, 0x02, 0x47, 0x02, 0x46, 0x05, 0x47, 0x00, 0x46,
+    0x07, 0x46, 0x00, 0x46, 0x07, 0x46, 0x00, 0x46, 0x08, 0x4D, 0x08, 0x4D, 0x08, 0x4D, 0x07, 0x46,
+    0x00, 0x46, 0x07, 0x46, 0x00, 0x47, 0x05, 0x47, 0x01, 0x48, 0x02, 0x48, 0x01, 0x53, 0x03, 0x51,
+    0x05, 0x4F, 0x08, 0x4C, 0x0B, 0x48, 0x06, 0x06, 0x48, 0x0C, 0x4C, 0x09, 0x4E, 0x07, 0x50, 0x05,
+    0x52, 0x04, 0x52, 0x03, 0x48, 0x02, 0x48, 0x02, 0x46, 0x05, 0x47, 0x02, 0x46, 0x06, 0x47, 0x00,
+    0x47, 0x07, 0x46, 0x00, 0x46, 0x08, 0x46, 0x00, 0x46, 0x08, 0x46, 0x00, 0x47, 0x07, 0x46, 0x01,
+    0x46, 0x06, 0x47, 0x01, 0x47, 0x05, 0x48, 0x00, 0x48, 0x02, 0x4A, 0x01, 0x55, 0x01, 0x55, 0x02,
+    0x54, 0x03, 0x53, 0x04, 0x49, 0x00, 0x46, 0x07, 0x46, 0x01, 0x46, 0x10, 0x46, 0x10, 0x46, 0x10,
+    0x46, 0x02, 0x45, 0x06, 0x47, 0x01, 0x46, 0x06, 0x46, 0x02, 0x47, 0x04, 0x47, 0x03, 0x47, 0x02,
+    0x48, 0x03, 0x52, 0x05, 0x50, 0x06, 0x50, 0x07, 0x4E, 0x09, 0x4B, 0x0D, 0x47, 0x08, 0x7F, 0x7F,
+    0x57, 0x0F, 0x47, 0x0F, 0x47, 0x0F, 0x47, 0x0F, 0x47, 0x0F, 0x47, 0x0F, 0x47, 0x0F, 0x47, 0x0F,
+    0x55, 0x01, 0x55, 0x01, 0x55, 0x01, 0x55, 0x01, 0x55, 0x01, 0x55, 0x01, 0x47, 0x0F, 0x47, 0x0F,
+    0x47, 0x0F, 0x47, 0x0F, 0x47, 0x0F, 0x47, 0x0F, 0x47, 0x0F, 0x47, 0x0F, 0x47, 0x0F, 0x47, 0x0F,
+    0x47, 0x0F, 0x47, 0x0F, 0x47, 0x0F, 0x47, 0x0F, 0x47, 0x0F, 0x0A, 0x4A, 0x13, 0x4E, 0x0F, 0x52,
+    0x0C, 0x55, 0x09, 0x57, 0x07, 0x58, 0x06, 0x4A, 0x04, 0x4A, 0x05, 0x48, 0x08, 0x49, 0x03, 0x48,
+    0x0B, 0x47, 0x02, 0x48, 0x0D, 0x47, 0x01, 0x47, 0x0E, 0x47, 0x01, 0x47, 0x0F, 0x47, 0x00, 0x46,
+    0x10, 0x4F, 0x10, 0x4F, 0x11, 0x4E, 0x11, 0x4D, 0x12, 0x4D, 0x12, 0x4D, 0x12, 0x4D, 0x12, 0x4D,
+    0x12, 0x4E, 0x11, 0x4E, 0x11, 0x4E, 0x10, 0x47, 0x00, 0x46, 0x10, 0x47, 0x00, 0x47, 0x0F, 0x47,
+    0x00, 0x47, 0x0E, 0x47, 0x01, 0x48, 0x0C, 0x48, 0x02, 0x48, 0x0B, 0x47, 0x03, 0x49, 0x08, 0x49,
+    0x04, 0x4A, 0x04, 0x4A, 0x06, 0x59, 0x07, 0x57, 0x09, 0x55, 0x0B, 0x52, 0x0F, 0x4F, 0x12, 0x4A,
+    0x0A, 0x06, 0x4A, 0x0A, 0x4E, 0x07, 0x50, 0x05, 0x52, 0x03, 0x53, 0x03, 0x47, 0x03, 0x47, 0x02,
+    0x46, 0x06, 0x46, 0x04, 0x44, 0x07, 0x45, 0x11, 0x46, 0x0E, 0x48, 0x0A, 0x4C, 0x06, 0x50, 0x04,
+    0x52, 0x03, 0x53, 0x02, 0x4C, 0x00, 0x46, 0x01, 0x49, 0x04, 0x45, 0x02, 0x46, 0x07, 0x45, 0x02,
+    0x46, 0x07, 0x45, 0x01, 0x46, 0x07, 0x46, 0x01, 0x47, 0x06, 0x46, 0x01, 0x47, 0x05, 0x47, 0x02,
+    0x47, 0x02, 0x4A, 0x01, 0x55, 0x02, 0x54, 0x02, 0x4D, 0x00, 0x45, 0x03, 0x4B, 0x01, 0x46, 0x04,
+    0x47, 0x03, 0x46, 0x10, 0x46, 0x10, 0x46, 0x10, 0x46, 0x10, 0x46, 0x10, 0x46, 0x10, 0x46, 0x10,
+    0x46, 0x10, 0x46, 0x06, 0x46, 0x02, 0x46, 0x04, 0x4A, 0x00, 0x46, 0x03, 0x53, 0x02, 0x54, 0x01,
+    0x55, 0x00, 0x49, 0x02, 0x49, 0x00, 0x47, 0x05, 0x48, 0x00, 0x46, 0x07, 0x4F, 0x08, 0x4D, 0x09,
+    0x4D, 0x09, 0x4D, 0x09, 0x4D, 0x0A, 0x4C, 0x0A, 0x4C, 0x0A, 0x4C, 0x09, 0x4D, 0x09, 0x4D, 0x09,
+    0x4E, 0x08, 0x46, 0x00, 0x46, 0x07, 0x47, 0x00, 0x47, 0x05, 0x48, 0x01, 0x48, 0x02, 0x49, 0x01,
+    0x55, 0x02, 0x54, 0x03, 0x4C, 0x00, 0x45, 0x04, 0x4A, 0x01, 0x45, 0x06, 0x46, 0x03, 0x45, 0x07,
+    0x47, 0x0D, 0x4B, 0x0A, 0x4E, 0x07, 0x50, 0x05, 0x51, 0x04, 0x48, 0x02, 0x47, 0x03, 0x46, 0x05,
+    0x47, 0x01, 0x46, 0x07, 0x46, 0x01, 0x46, 0x07, 0x46, 0x01, 0x46, 0x08, 0x45, 0x01, 0x46, 0x08,
+    0x46, 0x00, 0x7F, 0x65, 0x11, 0x46, 0x10, 0x46, 0x10, 0x46, 0x10, 0x47, 0x06, 0x44, 0x04, 0x46,
+    0x06, 0x46, 0x02, 0x48, 0x02, 0x48, 0x03, 0x52, 0x04, 0x51, 0x06, 0x4F, 0x09, 0x4C, 0x0C, 0x48,
+    0x06, 0x69, 0x14, 0x7F, 0x7F, 0x75, 0x7F, 0x7F, 0x7F, 0x74,
+};
+
+const RleGlyph Inter_48Glyphs[] PROGMEM = {
+    { 0, 32, 0, 0, 16, 0, 0 },  // 'space'
+    { 0, 37, 38, 36, 45, 3, 4 },  // '%'
+    { 185, 45, 13, 6, 19, 4, 24 },  // '-'
+    { 187, 46, 7, 7, 16, 4, 32 },  // '.'
+    { 188, 48, 23, 35, 29, 3, 4 },  // '0'
+    { 295, 49, 15, 35, 29, 5, 4 },  // '1'
+    { 361, 50, 24, 35, 29, 2, 4 },  // '2'
+    { 436, 51, 23, 35, 29, 3, 4 },  // '3'
+    { 523, 52, 25, 35, 29, 2, 4 },  // '4'
+    { 608, 53, 23, 35, 29, 3, 4 },  // '5'
+    { 689, 54, 23, 35, 29, 3, 4 },  // '6'
+    { 784, 55, 23, 35, 29, 3, 4 },  // '7'
+    { 846, 56, 23, 35, 29, 3, 4 },  // '8'
+    { 951, 57, 24, 35, 29, 2, 4 },  // '9'
+    { 1054, 70, 24, 35, 32, 4, 4 },  // 'F'
+    { 1114, 79, 33, 37, 40, 3, 3 },  // 'O'
+    { 1217, 97, 24, 27, 29, 2, 12 },  // 'a'
+    { 1299, 100, 24, 35, 32, 3, 4 },  // 'd'
+    { 1391, 101, 24, 27, 29, 2, 12 },  // 'e'
+    { 1457, 105, 7, 35, 16, 4, 4 },  // 'i'
+    { 1462, 108, 7, 35, 16, 4, 4 },  // 'l'
+};
+
+const RleFont Inter_48 PROGMEM = {
+    Inter_48Data,
+    Inter_48Glyphs,
+    21, 68, 0, 68
+};
+
+#endif // RLE_INTER_48_H
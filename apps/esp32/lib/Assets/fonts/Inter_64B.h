@@ -0,0 +1,105 @@
+// Inter Font - 64px Bold (Weight 700) (1-bpp source)
+// Generated by scripts/fontgen.py: 2026-10-19
+// Charset: 11 characters, 1139 bytes RLE
+
+#ifndef RLE_INTER_64B_H
+#define RLE_INTER_64B_H
+
+#include "RleFont.h"
+
+const uint8_t Inter_64BData[] PROGMEM = {
+    0x09, 0x48, 0x12, 0x4C, 0x0E, 0x50, 0x0B, 0x52, 0x09, 0x54, 0x07, 0x56, 0x06, 0x56, 0x05, 0x58,
+    0x04, 0x4A, 0x02, 0x4A, 0x03, 0x49, 0x06, 0x49, 0x02, 0x49, 0x06, 0x49, 0x02, 0x48, 0x08, 0x48,
+    0x02, 0x48, 0x08, 0x49, 0x00, 0x49, 0x08, 0x49, 0x00, 0x49, 0x09, 0x48, 0x00, 0x48, 0x0A, 0x48,
+    0x00, 0x48, 0x0A, 0x48, 0x00, 0x48, 0x0A, 0x48, 0x00, 0x48, 0x0A, 0x48, 0x00, 0x48, 0x0A, 0x48,
+    0x00, 0x48, 0x0A, 0x52, 0x0A, 0x52, 0x0A, 0x52, 0x0A, 0x52, 0x0A, 0x52, 0x0A, 0x52, 0x0A, 0x52,
+    0x0A, 0x48, 0x00, 0x48, 0x0A, 0x48, 0x00, 0x48, 0x0A, 0x48, 0x00, 0x48, 0x0A, 0x48, 0x00, 0x48,
+    0x0A, 0x48, 0x00, 0x49, 0x09, 0x48, 0x00, 0x49, 0x08, 0x49, 0x00, 0x49, 0x08, 0x49, 0x01, 0x48,
+    0x08, 0x48, 0x02, 0x49, 0x06, 0x49, 0x02, 0x49, 0x06, 0x49, 0x03, 0x4A, 0x02, 0x4A, 0x04, 0x58,
+    0x05, 0x56, 0x06, 0x56, 0x07, 0x54, 0x09, 0x52, 0x0B, 0x50, 0x0E, 0x4C, 0x12, 0x48, 0x0A, 0x0C,
+    0x46, 0x0B, 0x47, 0x0B, 0x47, 0x0A, 0x48, 0x09, 0x49, 0x09, 0x49, 0x08, 0x4A, 0x06, 0x4C, 0x05,
+    0x4D, 0x04, 0x4E, 0x02, 0x50, 0x00, 0x7F, 0x58, 0x00, 0x50, 0x02, 0x4F, 0x03, 0x4E, 0x04, 0x4C,
+    0x06, 0x4A, 0x08, 0x48, 0x0A, 0x48, 0x0A, 0x48, 0x0A, 0x48, 0x0A, 0x48, 0x0A, 0x48, 0x0A, 0x48,
+    0x0A, 0x48, 0x0A, 0x48, 0x0A, 0x48, 0x0A, 0x48, 0x0A, 0x48, 0x0A, 0x48, 0x0A, 0x48, 0x0A, 0x48,
+    0x0A, 0x48, 0x0A, 0x48, 0x0A, 0x48, 0x0A, 0x48, 0x0A, 0x48, 0x0A, 0x48, 0x0A, 0x48, 0x0A, 0x48,
+    0x0A, 0x48, 0x0A, 0x48, 0x0A, 0x48, 0x09, 0x4A, 0x11, 0x4F, 0x0C, 0x52, 0x0A, 0x55, 0x07, 0x57,
+    0x05, 0x58, 0x05, 0x59, 0x03, 0x5B, 0x02, 0x4B, 0x03, 0x4B, 0x01, 0x4A, 0x07, 0x49, 0x01, 0x49,
+    0x08, 0x49, 0x01, 0x48, 0x0A, 0x48, 0x01, 0x48, 0x0A, 0x48, 0x00, 0x49, 0x0A, 0x48, 0x03, 0x46,
+    0x0A, 0x48, 0x15, 0x48, 0x15, 0x48, 0x14, 0x49, 0x14, 0x48, 0x14, 0x49, 0x13, 0x49, 0x14, 0x49,
+    0x13, 0x49, 0x12, 0x4A, 0x12, 0x4B, 0x11, 0x4B, 0x11, 0x4B, 0x11, 0x4B, 0x11, 0x4A, 0x12, 0x4A,
+    0x12, 0x4A, 0x12, 0x4A, 0x12, 0x4A, 0x12, 0x4A, 0x12, 0x4A, 0x13, 0x49, 0x13, 0x49, 0x13, 0x5C,
+    0x01, 0x5C, 0x00, 0x5D, 0x00, 0x7F, 0x7F, 0x78, 0x09, 0x49, 0x12, 0x4D, 0x0E, 0x51, 0x0B, 0x53,
+    0x09, 0x55, 0x08, 0x56, 0x06, 0x58, 0x04, 0x59, 0x04, 0x4A, 0x03, 0x4B, 0x03, 0x48, 0x07, 0x49,
+    0x02, 0x49, 0x07, 0x49, 0x02, 0x48, 0x09, 0x48, 0x02, 0x48, 0x09, 0x48, 0x06, 0x44, 0x09, 0x48,
+    0x14, 0x49, 0x14, 0x48, 0x14, 0x49, 0x12, 0x4A, 0x0F, 0x4D, 0x10, 0x4C, 0x11, 0x4B, 0x12, 0x4A,
+    0x13, 0x4D, 0x10, 0x4E, 0x0F, 0x4F, 0x0E, 0x40, 0x04, 0x4A, 0x15, 0x49, 0x15, 0x48, 0x15, 0x49,
+    0x14, 0x49, 0x15, 0x48, 0x15, 0x48, 0x03, 0x44, 0x0C, 0x51, 0x0C, 0x52, 0x0A, 0x49, 0x00, 0x48,
+    0x0A, 0x49, 0x00, 0x49, 0x08, 0x4A, 0x00, 0x4A, 0x06, 0x4A, 0x02, 0x4B, 0x02, 0x4C, 0x02, 0x5A,
+    0x04, 0x59, 0x04, 0x58, 0x06, 0x56, 0x08, 0x54, 0x0B, 0x51, 0x0D, 0x4E, 0x11, 0x4A, 0x09, 0x12,
+    0x48, 0x17, 0x48, 0x16, 0x49, 0x15, 0x4A, 0x15, 0x4A, 0x14, 0x4B, 0x13, 0x4C, 0x13, 0x4C, 0x12,
+    0x4D, 0x11, 0x4E, 0x10, 0x4F, 0x10, 0x4F, 0x0F, 0x50, 0x0E, 0x51, 0x0E, 0x47, 0x00, 0x48, 0x0D,
+    0x47, 0x01, 0x48, 0x0C, 0x48, 0x01, 0x48, 0x0B, 0x48, 0x02, 0x48, 0x0B, 0x47, 0x03, 0x48, 0x0A,
+    0x47, 0x04, 0x48, 0x09, 0x48, 0x04, 0x48, 0x09, 0x47, 0x05, 0x48, 0x08, 0x47, 0x06, 0x48, 0x07,
+    0x48, 0x06, 0x48, 0x06, 0x48, 0x07, 0x48, 0x06, 0x47, 0x08, 0x48, 0x05, 0x48, 0x08, 0x48, 0x04,
+    0x48, 0x09, 0x48, 0x04, 0x7F, 0x7F, 0x7F, 0x7F, 0x47, 0x12, 0x48, 0x17, 0x48, 0x17, 0x48, 0x17,
+    0x48, 0x17, 0x48, 0x17, 0x48, 0x17, 0x48, 0x17, 0x48, 0x17, 0x48, 0x04, 0x04, 0x57, 0x06, 0x57,
+    0x06, 0x57, 0x05, 0x58, 0x05, 0x58, 0x05, 0x58, 0x05, 0x58, 0x05, 0x58, 0x05, 0x58, 0x04, 0x48,
+    0x15, 0x48, 0x15, 0x48, 0x15, 0x47, 0x16, 0x47, 0x16, 0x47, 0x15, 0x48, 0x00, 0x48, 0x0B, 0x54,
+    0x09, 0x56, 0x07, 0x57, 0x06, 0x58, 0x04, 0x5A, 0x03, 0x5B, 0x02, 0x5B, 0x02, 0x4B, 0x03, 0x4C,
+    0x01, 0x48, 0x08, 0x4A, 0x03, 0x45, 0x0A, 0x49, 0x15, 0x49, 0x14, 0x49, 0x14, 0x49, 0x15, 0x48,
+    0x15, 0x48, 0x02, 0x45, 0x0C, 0x51, 0x0B, 0x52, 0x0B, 0x53, 0x0A, 0x48, 0x00, 0x4A, 0x08, 0x49,
+    0x01, 0x4A, 0x06, 0x4A, 0x01, 0x4B, 0x03, 0x4B, 0x03, 0x5A, 0x03, 0x59, 0x05, 0x57, 0x07, 0x55,
+    0x09, 0x53, 0x0B, 0x51, 0x0E, 0x4D, 0x12, 0x49, 0x0A, 0x0A, 0x49, 0x11, 0x4D, 0x0D, 0x51, 0x0A,
+    0x53, 0x08, 0x55, 0x06, 0x56, 0x05, 0x58, 0x04, 0x58, 0x03, 0x4B, 0x03, 0x4A, 0x02, 0x49, 0x06,
+    0x49, 0x01, 0x49, 0x08, 0x48, 0x01, 0x49, 0x08, 0x48, 0x01, 0x48, 0x0A, 0x45, 0x03, 0x48, 0x13,
+    0x49, 0x13, 0x49, 0x13, 0x49, 0x13, 0x48, 0x03, 0x47, 0x08, 0x48, 0x01, 0x4B, 0x06, 0x48, 0x00,
+    0x4E, 0x04, 0x59, 0x03, 0x5A, 0x02, 0x5B, 0x01, 0x5B, 0x01, 0x5C, 0x00, 0x4D, 0x02, 0x4B, 0x00,
+    0x4B, 0x06, 0x55, 0x08, 0x53, 0x0A, 0x52, 0x0A, 0x52, 0x0A, 0x52, 0x0B, 0x51, 0x0B, 0x51, 0x0A,
+    0x48, 0x00, 0x48, 0x0A, 0x48, 0x00, 0x49, 0x09, 0x48, 0x00, 0x49, 0x09, 0x48, 0x01, 0x49, 0x07,
+    0x49, 0x01, 0x4B, 0x03, 0x4A, 0x03, 0x59, 0x03, 0x58, 0x05, 0x57, 0x06, 0x55, 0x08, 0x53, 0x0A,
+    0x51, 0x0D, 0x4D, 0x11, 0x49, 0x08, 0x7F, 0x7F, 0x7F, 0x6E, 0x00, 0x5B, 0x14, 0x48, 0x13, 0x48,
+    0x13, 0x48, 0x14, 0x47, 0x14, 0x48, 0x13, 0x48, 0x14, 0x47, 0x14, 0x48, 0x14, 0x47, 0x14, 0x48,
+    0x13, 0x48, 0x14, 0x48, 0x13, 0x48, 0x14, 0x48, 0x14, 0x47, 0x14, 0x48, 0x14, 0x47, 0x14, 0x48,
+    0x14, 0x48, 0x14, 0x47, 0x14, 0x48, 0x14, 0x48, 0x14, 0x47, 0x14, 0x48, 0x14, 0x48, 0x14, 0x48,
+    0x14, 0x47, 0x14, 0x48, 0x14, 0x48, 0x14, 0x48, 0x14, 0x48, 0x14, 0x48, 0x14, 0x47, 0x15, 0x47,
+    0x15, 0x47, 0x15, 0x47, 0x0F, 0x08, 0x4A, 0x10, 0x4E, 0x0C, 0x52, 0x09, 0x54, 0x07, 0x56, 0x05,
+    0x58, 0x04, 0x58, 0x03, 0x4B, 0x02, 0x4B, 0x02, 0x49, 0x06, 0x49, 0x02, 0x48, 0x08, 0x48, 0x02,
+    0x48, 0x08, 0x48, 0x02, 0x47, 0x0A, 0x47, 0x02, 0x47, 0x0A, 0x47, 0x02, 0x47, 0x0A, 0x47, 0x02,
+    0x48, 0x08, 0x48, 0x02, 0x48, 0x08, 0x48, 0x03, 0x48, 0x06, 0x48, 0x04, 0x4A, 0x02, 0x4A, 0x05,
+    0x56, 0x07, 0x54, 0x09, 0x52, 0x0B, 0x50, 0x0B, 0x53, 0x07, 0x56, 0x05, 0x58, 0x04, 0x4A, 0x02,
+    0x4B, 0x02, 0x49, 0x06, 0x49, 0x02, 0x48, 0x08, 0x49, 0x00, 0x48, 0x0A, 0x48, 0x00, 0x48, 0x0A,
+    0x48, 0x00, 0x48, 0x0B, 0x51, 0x0B, 0x50, 0x0C, 0x51, 0x0B, 0x51, 0x0B, 0x51, 0x0A, 0x52, 0x0A,
+    0x48, 0x00, 0x49, 0x08, 0x49, 0x00, 0x4A, 0x06, 0x4A, 0x01, 0x4B, 0x03, 0x4A, 0x02, 0x5A, 0x03,
+    0x58, 0x05, 0x56, 0x07, 0x54, 0x09, 0x52, 0x0C, 0x4E, 0x10, 0x4A, 0x09, 0x09, 0x49, 0x12, 0x4D,
+    0x0E, 0x50, 0x0C, 0x53, 0x09, 0x55, 0x07, 0x56, 0x06, 0x58, 0x05, 0x59, 0x03, 0x4B, 0x02, 0x4B,
+    0x03, 0x49, 0x06, 0x4A, 0x01, 0x49, 0x08, 0x49, 0x01, 0x48, 0x0A, 0x48, 0x01, 0x48, 0x0A, 0x49,
+    0x00, 0x48, 0x0A, 0x49, 0x00, 0x48, 0x0B, 0x48, 0x00, 0x48, 0x0B, 0x48, 0x00, 0x48, 0x0B, 0x48,
+    0x00, 0x48, 0x0A, 0x54, 0x09, 0x54, 0x09, 0x4A, 0x00, 0x49, 0x07, 0x4B, 0x00, 0x4B, 0x03, 0x4D,
+    0x00, 0x5D, 0x01, 0x5C, 0x02, 0x5B, 0x02, 0x5B, 0x03, 0x5A, 0x04, 0x4E, 0x00, 0x49, 0x06, 0x4B,
+    0x01, 0x49, 0x08, 0x47, 0x03, 0x48, 0x15, 0x48, 0x15, 0x48, 0x14, 0x49, 0x14, 0x49, 0x03, 0x46,
+    0x09, 0x49, 0x01, 0x48, 0x09, 0x48, 0x02, 0x48, 0x08, 0x49, 0x02, 0x49, 0x06, 0x4A, 0x03, 0x4A,
+    0x02, 0x4B, 0x04, 0x59, 0x04, 0x58, 0x06, 0x56, 0x08, 0x54, 0x0A, 0x52, 0x0C, 0x50, 0x0E, 0x4D,
+    0x12, 0x49, 0x0B,
+};
+
+const RleGlyph Inter_64BGlyphs[] PROGMEM = {
+    { 0, 32, 0, 0, 20, 0, 0 },  // 'space'
+    { 0, 48, 30, 47, 38, 4, 5 },  // '0'
+    { 143, 49, 20, 46, 38, 6, 5 },  // '1'
+    { 230, 50, 31, 46, 38, 3, 5 },  // '2'
+    { 328, 51, 31, 47, 38, 3, 5 },  // '3'
+    { 447, 52, 33, 45, 38, 2, 6 },  // '4'
+    { 556, 53, 31, 46, 38, 4, 6 },  // '5'
+    { 665, 54, 30, 47, 38, 4, 5 },  // '6'
+    { 790, 55, 30, 45, 38, 4, 6 },  // '7'
+    { 869, 56, 30, 47, 38, 4, 5 },  // '8'
+    { 1004, 57, 31, 47, 38, 3, 5 },  // '9'
+};
+
+const RleFont Inter_64B PROGMEM = {
+    Inter_64BData,
+    Inter_64BGlyphs,
+    11, 90, 0, 90
+};
+
+#endif // RLE_INTER_64B_H
@@ -0,0 +1,35 @@
+#ifndef RLE_FONT_H
+#define RLE_FONT_H
+
+#include <pgmspace.h> // For PROGMEM
+#include <stdint.h>
+
+// 4-bpp RLE-Schrift, erzeugt von scripts/fontgen.py (Decoder: lib/UI/RleFontRenderer)
+//
+// Jede Glyphe ist auf ihre Tinten-Box beschnitten; xOffset/yOffset zählen wie bei GFXfont
+// ab dem Cursor. Die Pixel laufen zeilenweise durch die Box, Läufe dürfen Zeilen überspannen:
+//
+//   00nnnnnn            n+1 transparente Pixel
+//   01nnnnnn            n+1 deckende Pixel (Coverage 15)
+//   10nnnnnn c c ...    n+1 Pixel mit Coverage 0..15, zwei pro Byte (high nibble zuerst)
+
+struct RleGlyph {
+    uint32_t offset;     // Start in RleFont::data
+    uint16_t codepoint;
+    uint8_t width;
+    uint8_t height;
+    uint8_t xAdvance;
+    int8_t xOffset;
+    int8_t yOffset;
+};
+
+struct RleFont {
+    const uint8_t* data;
+    const RleGlyph* glyphs;  // aufsteigend nach codepoint
+    uint16_t glyphCount;
+    uint8_t yAdvance;
+    int8_t ascent;           // max(-yOffset) der Quellschrift, wie glyph_ab in TFT_eSPI
+    int8_t descent;          // max(height + yOffset), wie glyph_bb (für BL/BC/BR_DATUM)
+};
+
+#endif // RLE_FONT_H
@@ -2,6 +2,17 @@
 #include "DisplayDriver.h"
 #include "TFT_eSPI_Driver.h"
 
+namespace {
+    constexpr uint8_t CMD_VSCRDEF = 0x33;    // Vertical Scrolling Definition
+    constexpr uint8_t CMD_VSCRSADD = 0x37;   // Vertical Scroll Start Address
+    constexpr uint16_t GATE_LINES = 320;     // ST7789 RAM, das 280er Panel sitzt mittig (Offset 20)
+
+    void writeData16(TFT_eSPI& tft, uint16_t v) {
+        tft.writedata(v >> 8);
+        tft.writedata(v & 0xFF);
+    }
+}
+
 DisplayDriver::DisplayDriver(uint16_t width, uint16_t height,
                                std::unique_ptr<ITFTDriver> tftDriver,
                                std::unique_ptr<IBacklightController> backlightController)
@@ -15,10 +26,11 @@ DisplayDriver::~DisplayDriver() {}
 
 void DisplayDriver::init() {
     tft->init();
-    tft->setRotation(1);
+    tft->setRotation(orientation);
     backlight->init();
 
     tft->fillScreen(backgroundColor);
+    defineScrollArea();
 
     TFT_eSPI& tft_spi = static_cast<TFT_eSPI_Driver*>(tft.get())->getTFT();
     
@@ -31,6 +43,30 @@ void DisplayDriver::setOrientation(uint8_t orientation) {
 }
 
 
+void DisplayDriver::defineScrollArea() {
+    // Scrollbereich = die sichtbaren Gate-Zeilen (im Querformat die Breite), Rest oben/unten fix
+    const uint16_t top = (GATE_LINES - width) / 2;
+    TFT_eSPI& t = getTFT();
+    t.writecommand(CMD_VSCRDEF);
+    writeData16(t, top);
+    writeData16(t, width);
+    writeData16(t, GATE_LINES - width - top);
+    scrollOffset = 1;  // erzwingt VSCRSADD
+    scrollTo(0);
+}
+
+void DisplayDriver::scrollTo(uint16_t dx) {
+    dx %= width;
+    if (dx == scrollOffset) return;
+    scrollOffset = dx;
+
+    // Rotation 3 läuft die Gate-Zeilen rückwärts ab
+    const uint16_t line = orientation == 3 ? (width - dx) % width : dx;
+    TFT_eSPI& t = getTFT();
+    t.writecommand(CMD_VSCRSADD);
+    writeData16(t, (GATE_LINES - width) / 2 + line);
+}
+
 void DisplayDriver::clear() {
     tft->fillScreen(backgroundColor);
 }
@@ -29,11 +29,20 @@ public:
     void setOrientation(uint8_t orientation);
     uint8_t getOrientation() const { return orientation; }
 
+    // ST7789 Hardware-Scroll (VSCRDEF/VSCRSADD). Gescrollt wird entlang der Gate-Zeilen,
+    // im Querformat also horizontal: scrollTo(dx) zeigt an Spalte i den RAM-Inhalt von Spalte i+dx.
+    // Gezeichnet wird weiter in RAM-Koordinaten, der Scroll ändert nur die Anzeige.
+    void scrollTo(uint16_t dx);
+    uint16_t getScroll() const { return scrollOffset; }
+
 private:
     std::unique_ptr<ITFTDriver> tft;
     std::unique_ptr<IBacklightController> backlight;
     uint16_t backgroundColor = 0x00;
     uint16_t width;
     uint16_t height;
-    uint8_t orientation;
+    uint8_t orientation = 1;
+    uint16_t scrollOffset = 0;
+
+    void defineScrollArea();
 };
@@ -1,86 +1,103 @@
 #include "RotaryEncoder.h"
 
-RotaryEncoder* RotaryEncoder::instance = nullptr;
+// Zähler bleibt weit weg von den Limits, bei denen der PCNT auf 0 springt
+static constexpr int16_t COUNT_LIMIT = 16000;
 
-RotaryEncoder::RotaryEncoder(uint8_t pinCLK, uint8_t pinDT, uint8_t pinSW)
-: _pinCLK(pinCLK), _pinDT(pinDT), _pinSW(pinSW) {}
+RotaryEncoder::RotaryEncoder(uint8_t pinA, uint8_t pinB, pcnt_unit_t unit)
+: _pinA(pinA), _pinB(pinB), _unit(unit) {}
 
-void RotaryEncoder::begin() {
-  instance = this;
+bool RotaryEncoder::begin() {
+  // Kanal 0: Flanken auf A, Richtung aus B
+  pcnt_config_t cfg = {};
+  cfg.pulse_gpio_num = _pinA;
+  cfg.ctrl_gpio_num = _pinB;
+  cfg.channel = PCNT_CHANNEL_0;
+  cfg.unit = _unit;
+  cfg.pos_mode = PCNT_COUNT_DEC;
+  cfg.neg_mode = PCNT_COUNT_INC;
+  cfg.lctrl_mode = PCNT_MODE_REVERSE;
+  cfg.hctrl_mode = PCNT_MODE_KEEP;
+  cfg.counter_h_lim = INT16_MAX;
+  cfg.counter_l_lim = INT16_MIN;
+  if (pcnt_unit_config(&cfg) != ESP_OK) return false;
 
-  pinMode(_pinCLK, INPUT_PULLUP);
-  pinMode(_pinDT,  INPUT_PULLUP);
+  // Kanal 1: Flanken auf B, Richtung aus A
+  cfg.pulse_gpio_num = _pinB;
+  cfg.ctrl_gpio_num = _pinA;
+  cfg.channel = PCNT_CHANNEL_1;
+  cfg.pos_mode = PCNT_COUNT_INC;
+  cfg.neg_mode = PCNT_COUNT_DEC;
+  if (pcnt_unit_config(&cfg) != ESP_OK) return false;
 
-  if (_pinSW != 255) {
-    pinMode(_pinSW, INPUT_PULLUP);
-  }
+  // Filter zählt APB-Takte (80 MHz), das Register hat 10 Bit
+  pcnt_set_filter_value(_unit, min<uint32_t>(_filterNs * 80 / 1000, 1023));
+  pcnt_filter_enable(_unit);
 
-  // Initialen Zustand lesen
-  _lastCLK = digitalRead(_pinCLK);
-  _lastDT = digitalRead(_pinDT);
+  pcnt_counter_pause(_unit);
+  pcnt_counter_clear(_unit);
+  pcnt_counter_resume(_unit);
 
-  attachInterrupt(digitalPinToInterrupt(_pinCLK), isr, CHANGE);
+  _lastCount = 0;
+  _residual = 0;
+  _running = true;
+  return true;
 }
 
-void IRAM_ATTR RotaryEncoder::isr() {
-  if (instance) {
-    instance->handleRotation();
-  }
-}
+RotaryEncoder::Turn RotaryEncoder::update(uint32_t now) {
+  Turn turn;
+  if (!_running) return turn;
 
-void RotaryEncoder::handleRotation() {
-  static unsigned long lastInterruptTime = 0;
-  unsigned long interruptTime = micros();
-  
-  // Debounce: Ignoriere Interrupts die schneller als 1ms aufeinander folgen
-  if (interruptTime - lastInterruptTime < 1000) {
-    return;
-  }
-  
-  bool currentCLK = digitalRead(_pinCLK);
-  bool currentDT = digitalRead(_pinDT);
-  
-  // Nur auf Zustandswechsel von CLK reagieren
-  if (currentCLK != _lastCLK) {
-    // Wenn CLK und DT unterschiedlich sind -> CW
-    // Wenn CLK und DT gleich sind -> CCW
-    if (currentCLK != currentDT) {
-      _position++;
-    } else {
-      _position--;
-    }
-    _rotated = true;
+  int16_t count = 0;
+  pcnt_get_counter_value(_unit, &count);
+  int16_t delta = count - _lastCount;
+  _lastCount = count;
+
+  if (count > COUNT_LIMIT || count < -COUNT_LIMIT) {
+    // Flanken zwischen Lesen und Löschen gehen verloren - Mikrosekunden, alle paar tausend Rastungen
+    pcnt_counter_clear(_unit);
+    _lastCount = 0;
   }
-  
-  _lastCLK = currentCLK;
-  _lastDT = currentDT;
-  lastInterruptTime = interruptTime;
-}
 
-void RotaryEncoder::update() {
-  // aktuell leer, vorbereitet für Acceleration / Filtering
-}
+  if (_reversed) delta = -delta;
+  _residual += delta;
+  const int detents = _residual / _stepsPerDetent;
+  if (!detents) return turn;
+  _residual -= detents * _stepsPerDetent;
+  _position += detents;
 
-int RotaryEncoder::getPosition() {
-  noInterrupts();
-  int pos = _position;
-  interrupts();
-  return pos;
+  turn.detents = detents;
+  turn.step = stepFor(detents, now);
+  return turn;
 }
 
-bool RotaryEncoder::isPressed() {
-  if (_pinSW == 255) return false;
+uint8_t RotaryEncoder::stepFor(int detents, uint32_t now) {
+  const int8_t dir = detents > 0 ? 1 : -1;
+  const uint32_t n = abs(detents);
+  const uint32_t dt = now - _lastDetentMs;
+  _lastDetentMs = now;
+
+  if (dir != _lastDir || dt > ACCEL_RESET_MS) {
+    _lastDir = dir;
+    _rate = 0;
+    return 1;
+  }
+
+  // Rate dieses Schritts, mit der vorigen gemittelt (ein Ausreisser beschleunigt nicht sofort)
+  const uint32_t rate = n * 1000 / (dt ? dt : 1);
+  _rate = (_rate + min<uint32_t>(rate, 1000)) / 2;
 
-  bool current = digitalRead(_pinSW);
-  bool pressed = (_lastButtonState == HIGH && current == LOW);
-  _lastButtonState = current;
+  if (_rate <= _minRate) return 1;
+  if (_rate >= _maxRate) return _maxStep;
+  return 1 + (_rate - _minRate) * (_maxStep - 1) / (_maxRate - _minRate);
+}
 
-  if (pressed) delay(30); // simples Debounce
-  return pressed;
+void RotaryEncoder::setAcceleration(uint8_t minRate, uint8_t maxRate, uint8_t maxStep) {
+  _minRate = minRate;
+  _maxRate = maxRate > minRate ? maxRate : minRate + 1;
+  _maxStep = maxStep ? maxStep : 1;
 }
 
-void RotaryEncoder::reset(int value) {
-  noInterrupts();
+void RotaryEncoder::reset(int32_t value) {
   _position = value;
-  interrupts();
-}
\ No newline at end of file
+  _residual = 0;
+}
@@ -1,30 +1,57 @@
 #pragma once
 #include <Arduino.h>
+#include <driver/pcnt.h>
 
+// Quadratur-Dekodierung im Pulse-Counter (PCNT) statt per ISR: beide Kanäle zählen
+// jede Flanke (x4), der Glitch-Filter verwirft Pulse unter filterNs. Prellen hebt sich
+// bei x4 von selbst auf (+1/-1 auf derselben Spur), es braucht also keinen Software-Debounce.
+// update() pollt den Zähler - keine Interrupts, keine Arbeit ausserhalb des Loops.
+//
+// Beschleunigung: aus der Drehrate (Rastungen/s, geglättet) wird eine Schrittweite pro
+// Rastung, 1 unterhalb minRate, linear bis maxStep ab maxRate. Richtungswechsel oder
+// eine Pause > ACCEL_RESET_MS fangen wieder bei 1 an.
 class RotaryEncoder {
 public:
-  RotaryEncoder(uint8_t pinCLK, uint8_t pinDT, uint8_t pinSW = 255);
-  
-  void begin();
-  void update();
-  
-  int getPosition();
-  bool isPressed();
-  void reset(int value = 0);
+  struct Turn {
+    int detents = 0;     // Vorzeichen = Richtung (+ = im Uhrzeigersinn)
+    uint8_t step = 1;    // Schrittweite pro Rastung
+  };
+
+  RotaryEncoder(uint8_t pinA, uint8_t pinB, pcnt_unit_t unit = PCNT_UNIT_0);
+
+  bool begin();
+  Turn update(uint32_t now);
+
+  int32_t getPosition() const { return _position; }
+  void reset(int32_t value = 0);
+
+  void setStepsPerDetent(uint8_t steps) { _stepsPerDetent = steps ? steps : 1; }
+  void setGlitchFilterNs(uint32_t ns) { _filterNs = ns; }
+  void setAcceleration(uint8_t minRate, uint8_t maxRate, uint8_t maxStep);
+  void setReversed(bool reversed) { _reversed = reversed; }
+
+  static constexpr uint32_t ACCEL_RESET_MS = 250;
 
 private:
-  uint8_t _pinCLK;
-  uint8_t _pinDT;
-  uint8_t _pinSW;
+  uint8_t _pinA;
+  uint8_t _pinB;
+  pcnt_unit_t _unit;
+  bool _running = false;
+  bool _reversed = false;
+
+  uint8_t _stepsPerDetent = 4;
+  uint32_t _filterNs = 10000;  // max. 12.7 µs (1023 Takte)
 
-  volatile int _position = 0;
-  volatile bool _rotated = false;
-  volatile bool _lastCLK = LOW;
-  volatile bool _lastDT = LOW;
+  int16_t _lastCount = 0;
+  int16_t _residual = 0;       // Zählschritte seit der letzten vollen Rastung
+  int32_t _position = 0;       // Rastungen
 
-  bool _lastButtonState = HIGH;
+  uint8_t _minRate = 6;
+  uint8_t _maxRate = 30;
+  uint8_t _maxStep = 5;
+  uint32_t _lastDetentMs = 0;
+  int8_t _lastDir = 0;
+  uint16_t _rate = 0;          // Rastungen/s, geglättet
 
-  static RotaryEncoder* instance;
-  static void IRAM_ATTR isr();
-  void handleRotation();
-};
\ No newline at end of file
+  uint8_t stepFor(int detents, uint32_t now);
+};
@@ -12,9 +12,12 @@ IRTempSensor::IRTempSensor(uint8_t sda_pin, uint8_t scl_pin, uint16_t readInterv
       ITemperatureSensor(readIntervalMs) {}
 
 bool IRTempSensor::begin(float emissivity) {
-    if (!mlx.begin()) {
-        errorCount++;
-        return false;
+    {
+        I2cBus::Transaction tx(I2cBus::Priority::CONFIG);
+        if (!tx || !mlx.begin()) {
+            errorCount++;
+            return false;
+        }
     }
 
     delay(100);
@@ -26,6 +29,10 @@ bool IRTempSensor::begin(float emissivity) {
 }
 
 float IRTempSensor::read() {
+    // Sensor-Priorität: wartet höchstens SENSOR_WAIT_MS, sonst zählt es als Fehl-Read
+    I2cBus::Transaction tx(I2cBus::Priority::SENSOR);
+    if (!tx) return NAN;
+
      if (emissivityJustChanged) {
         if (millis() - emissivityChangeTime < STABILIZATION_TIME_MS) {
             // Während Stabilisierung: Dummy-Reads ohne Rückgabe
@@ -37,11 +44,12 @@ float IRTempSensor::read() {
         }
     }
     
-    float objTemp = mlx.readObjectTempC();
-    float ambTemp = mlx.readAmbientTempC();
-    lastAmbient = ambTemp;
+    float objTemp = readTemp(tx, true);
+    if (isnan(objTemp)) return NAN;
+    float ambTemp = readTemp(tx, false);
+    if (!isnan(ambTemp)) lastAmbient = ambTemp;
     
-    if (ambientCorrectionEnabled) {
+    if (ambientCorrectionEnabled && !isnan(ambTemp)) {
         float ambientRatio = ambTemp / referenceAmbient;
         float factor = 1.0f + (ambientRatio - 1.0f) * ambientCorrectionCoeff;
         objTemp *= factor;
@@ -52,30 +60,64 @@ float IRTempSensor::read() {
     return objTemp; 
 }
 
+float IRTempSensor::readTemp(I2cBus::Transaction& tx, bool object) {
+    for (uint8_t attempt = 0; ; attempt++) {
+        const float t = object ? mlx.readObjectTempC() : mlx.readAmbientTempC();
+        if (t > NO_ACK_TEMP) return t;
+        if (attempt >= READ_RETRIES) {
+            tx.fail();
+            return NAN;
+        }
+        tx.retry();
+    }
+}
+
 
 bool IRTempSensor::setEmissivity(float emissivity) {
     if (emissivity < 0.1 || emissivity > 1.0) return false; 
     
+    // Jeder Schritt ist eine eigene CONFIG-Transaktion, die Wartezeiten dazwischen
+    // laufen ohne Bus - Sensor-Reads und Buttons anderer Tasks kommen durch
+    float current;
+    {
+        I2cBus::Transaction tx(I2cBus::Priority::CONFIG);
+        if (!tx) return false;
+        current = mlx.readEmissivity();
+    }
+
     // Prüfen ob Änderung überhaupt nötig ist
-    float current = mlx.readEmissivity();
     if (abs(current - emissivity) < 0.01) {
         return true; // Bereits richtig eingestellt
     }
     
-    // EEPROM-Write durchführen
-    mlx.writeEmissivity(emissivity);   
+    // EEPROM-Write durchführen (Erase + Write, die Lib wartet intern 2x 10 ms -
+    // der MLX antwortet währenddessen ohnehin nicht)
+    {
+        I2cBus::Transaction tx(I2cBus::Priority::CONFIG);
+        if (!tx) return false;
+        mlx.writeEmissivity(emissivity);
+    }
     delay(10); // EEPROM Write Zeit abwarten
     
-    if (!mlx.begin()) {
-        return false;
+    {
+        I2cBus::Transaction tx(I2cBus::Priority::CONFIG);
+        if (!tx || !mlx.begin()) {
+            if (tx) tx.fail();
+            return false;
+        }
     }
     
     delay(100);
     
     // Ausgiebig stabilisieren: Mehrere Dummy-Reads
     for(int i = 0; i < 10; i++) { 
-        mlx.readObjectTempC();
-        mlx.readAmbientTempC(); 
+        {
+            I2cBus::Transaction tx(I2cBus::Priority::CONFIG);
+            if (tx) {
+                mlx.readObjectTempC();
+                mlx.readAmbientTempC(); 
+            }
+        }
         delay(50); 
     }
     
@@ -84,11 +126,15 @@ bool IRTempSensor::setEmissivity(float emissivity) {
     emissivityChangeTime = millis();
     
     // Verifizieren
+    I2cBus::Transaction tx(I2cBus::Priority::CONFIG);
+    if (!tx) return false;
     float verify = mlx.readEmissivity();
     return abs(verify - emissivity) < 0.01; 
 }
 
 float IRTempSensor::getEmissivity() {
+    I2cBus::Transaction tx(I2cBus::Priority::CONFIG);
+    if (!tx) return NAN;
     return mlx.readEmissivity();
 }
 
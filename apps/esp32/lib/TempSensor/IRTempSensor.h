@@ -3,6 +3,7 @@
 #include <Adafruit_MLX90614.h>
 #include "ITemperatureSensor.h"
 #include "Calibration.h"
+#include "I2cBus.h"
 
 class IRTempSensor: public ITemperatureSensor {
 public:
@@ -25,6 +26,11 @@ public:
 private:
     Adafruit_MLX90614 mlx;
 
+    // Die Lib liefert bei NACK/Timeout Rohwert 0 = -273.15 °C
+    static constexpr float NO_ACK_TEMP = -273.0f;
+    static constexpr uint8_t READ_RETRIES = 1;
+    float readTemp(I2cBus::Transaction& tx, bool object);
+
     uint8_t sdaPin;
     uint8_t sclPin;
 
@@ -0,0 +1,73 @@
+#pragma once
+
+#include "SurfaceSink.h"
+
+// Pusht nur den Teil jeder Surface, der in [x0, x1) liegt (Teilfenster per pushSprite(sx, sy, sw, sh)).
+// Für Screen-Transitions: der eingehende Screen wird spaltenweise nachgezogen statt komplett neu gepusht.
+//
+// Mit record() merkt sich der Sink jede Surface des Frames; replay() schiebt danach das nächste
+// Spaltenfenster aus denselben Sprites nach, ohne neu zu rendern. Das geht nur, solange die Sprites
+// bis dahin unverändert im Pool liegen - pusht ein Frame dieselbe Pool-Surface zweimal (gleiche
+// Größe) oder mehr als MAX_RECORDS Surfaces, ist replayable() false und der Aufrufer rendert neu.
+class ClipSink : public ISurfaceSink {
+public:
+  static constexpr uint8_t MAX_RECORDS = 8;
+
+  void setColumns(int16_t x0, int16_t x1) {
+    _x0 = x0;
+    _x1 = x1;
+  }
+
+  void push(TFT_eSprite* sprite, int16_t x, int16_t y) override {
+    if (!sprite) return;
+    if (_recording) {
+      for (uint8_t i = 0; i < _count; i++) {
+        if (_records[i].sprite == sprite) _replayable = false;
+      }
+      if (_count < MAX_RECORDS) _records[_count++] = {sprite, x, y};
+      else _replayable = false;
+    }
+    pushWindow(sprite, x, y);
+  }
+
+  void record(bool en) {
+    _recording = en;
+    if (en) {
+      _count = 0;
+      _replayable = true;
+    }
+  }
+  bool replayable() const { return _replayable && _count > 0; }
+
+  // Aufgezeichnete Surfaces im aktuellen Spaltenfenster erneut pushen
+  void replay() {
+    for (uint8_t i = 0; i < _count; i++) pushWindow(_records[i].sprite, _records[i].x, _records[i].y);
+  }
+
+  const PushStats& stats() const { return _stats; }
+  void resetStats() { _stats = PushStats(); }
+
+private:
+  struct Record {
+    TFT_eSprite* sprite;
+    int16_t x;
+    int16_t y;
+  };
+
+  void pushWindow(TFT_eSprite* sprite, int16_t x, int16_t y) {
+    const int16_t left = x > _x0 ? x : _x0;
+    const int16_t right = x + sprite->width() < _x1 ? x + sprite->width() : _x1;
+    if (left >= right) return;
+
+    _stats.add(right - left, sprite->height());
+    sprite->pushSprite(left, y, left - x, 0, right - left, sprite->height());
+  }
+
+  int16_t _x0 = 0;
+  int16_t _x1 = 0;
+  PushStats _stats;
+  Record _records[MAX_RECORDS] = {};
+  uint8_t _count = 0;
+  bool _recording = false;
+  bool _replayable = false;
+};
@@ -0,0 +1,163 @@
+#include "FramebufferSink.h"
+
+#include <new>
+#include <string.h>
+
+namespace {
+
+uint32_t crc32Update(uint32_t crc, const uint8_t* data, size_t len) {
+  crc = ~crc;
+  while (len--) {
+    crc ^= *data++;
+    for (uint8_t k = 0; k < 8; k++) crc = (crc >> 1) ^ (0xEDB88320u & (0u - (crc & 1)));
+  }
+  return ~crc;
+}
+
+void putBE32(uint8_t* p, uint32_t v) {
+  p[0] = v >> 24;
+  p[1] = v >> 16;
+  p[2] = v >> 8;
+  p[3] = v;
+}
+
+// PNG-Chunk, der stückweise geschrieben wird (CRC läuft mit)
+class ChunkWriter {
+public:
+  ChunkWriter(const FramebufferSink::Writer& out, const char* type, uint32_t len) : _out(out) {
+    uint8_t head[8];
+    putBE32(head, len);
+    memcpy(head + 4, type, 4);
+    _out(head, 8);
+    _crc = crc32Update(0, head + 4, 4);
+  }
+  void write(const uint8_t* data, size_t len) {
+    _crc = crc32Update(_crc, data, len);
+    _out(data, len);
+  }
+  void end() {
+    uint8_t tail[4];
+    putBE32(tail, _crc);
+    _out(tail, 4);
+  }
+
+private:
+  const FramebufferSink::Writer& _out;
+  uint32_t _crc = 0;
+};
+
+}  // namespace
+
+FramebufferSink::FramebufferSink(uint16_t width, uint16_t height, bool allocate) : _w(width), _h(height) {
+  if (allocate) _fb = new (std::nothrow) uint16_t[(size_t)width * height];
+  clear();
+}
+
+FramebufferSink::~FramebufferSink() {
+  delete[] _fb;
+}
+
+void FramebufferSink::clear(uint16_t color) {
+  if (!_fb) return;
+  for (size_t i = 0; i < (size_t)_w * _h; i++) _fb[i] = color;
+}
+
+uint16_t FramebufferSink::pixel(int16_t x, int16_t y) const {
+  if (!_fb || x < 0 || y < 0 || x >= _w || y >= _h) return 0;
+  return _fb[(size_t)y * _w + x];
+}
+
+void FramebufferSink::push(TFT_eSprite* sprite, int16_t x, int16_t y) {
+  if (!sprite) return;
+  const int16_t sw = sprite->width();
+  const int16_t sh = sprite->height();
+
+  // Wie TFT_eSPI::pushImage(): nur der sichtbare Ausschnitt geht über den Bus
+  const int16_t x0 = x < 0 ? 0 : x;
+  const int16_t y0 = y < 0 ? 0 : y;
+  const int16_t x1 = x + sw > _w ? _w : x + sw;
+  const int16_t y1 = y + sh > _h ? _h : y + sh;
+  if (x0 >= x1 || y0 >= y1) return;
+  _stats.add(x1 - x0, y1 - y0);
+
+  if (_fb) {
+    const bool paletted = sprite->getColorDepth() == 4;
+    for (int16_t py = y0; py < y1; py++) {
+      uint16_t* dst = _fb + (size_t)py * _w;
+      for (int16_t px = x0; px < x1; px++) {
+        dst[px] = paletted ? sprite->getPaletteColor(sprite->readPixelValue(px - x, py - y))
+                           : sprite->readPixel(px - x, py - y);
+      }
+    }
+  }
+
+  if (_passthrough) sprite->pushSprite(x, y);
+}
+
+uint32_t FramebufferSink::checksum() const {
+  if (!_fb) return 0;
+  return crc32Update(0, reinterpret_cast<const uint8_t*>(_fb), (size_t)_w * _h * sizeof(uint16_t));
+}
+
+bool FramebufferSink::writePNG(const Writer& out) const {
+  if (!_fb || !out) return false;
+
+  static const uint8_t SIGNATURE[8] = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+  out(SIGNATURE, sizeof(SIGNATURE));
+
+  uint8_t ihdr[13];
+  putBE32(ihdr, _w);
+  putBE32(ihdr + 4, _h);
+  ihdr[8] = 8;   // Bit-Tiefe
+  ihdr[9] = 2;   // RGB
+  ihdr[10] = 0;  // Deflate
+  ihdr[11] = 0;  // Filter
+  ihdr[12] = 0;  // kein Interlace
+  ChunkWriter head(out, "IHDR", sizeof(ihdr));
+  head.write(ihdr, sizeof(ihdr));
+  head.end();
+
+  // zlib: Header + pro Zeile ein Stored-Block (5 Byte Kopf) + Adler32
+  const uint32_t rowLen = 1 + (uint32_t)_w * 3;
+  const uint32_t idatLen = 2 + (uint32_t)_h * (5 + rowLen) + 4;
+  uint8_t* row = new (std::nothrow) uint8_t[rowLen];
+  if (!row) return false;
+
+  ChunkWriter idat(out, "IDAT", idatLen);
+  static const uint8_t ZLIB_HEADER[2] = {0x78, 0x01};
+  idat.write(ZLIB_HEADER, sizeof(ZLIB_HEADER));
+
+  uint32_t adlerA = 1, adlerB = 0;
+  for (uint16_t y = 0; y < _h; y++) {
+    const uint8_t block[5] = {
+        (uint8_t)(y + 1 == _h ? 1 : 0),
+        (uint8_t)(rowLen & 0xFF), (uint8_t)(rowLen >> 8),
+        (uint8_t)(~rowLen & 0xFF), (uint8_t)((~rowLen >> 8) & 0xFF),
+    };
+    idat.write(block, sizeof(block));
+
+    row[0] = 0;  // Filter: None
+    const uint16_t* src = _fb + (size_t)y * _w;
+    for (uint16_t x = 0; x < _w; x++) {
+      const uint16_t c = src[x];
+      row[1 + x * 3] = ((c >> 11) & 0x1F) * 255 / 31;
+      row[2 + x * 3] = ((c >> 5) & 0x3F) * 255 / 63;
+      row[3 + x * 3] = (c & 0x1F) * 255 / 31;
+    }
+    for (uint32_t i = 0; i < rowLen; i++) {
+      adlerA = (adlerA + row[i]) % 65521;
+      adlerB = (adlerB + adlerA) % 65521;
+    }
+    idat.write(row, rowLen);
+  }
+  delete[] row;
+
+  uint8_t adler[4];
+  putBE32(adler, (adlerB << 16) | adlerA);
+  idat.write(adler, sizeof(adler));
+  idat.end();
+
+  ChunkWriter tail(out, "IEND", 0);
+  tail.end();
+  return true;
+}
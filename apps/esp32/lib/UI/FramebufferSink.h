@@ -0,0 +1,51 @@
+#pragma once
+
+#include <functional>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "SurfaceSink.h"
+
+// Headless-Panel: Surfaces landen als RGB565 in einem Speicher-Framebuffer statt per SPI.
+// Für Render-Benchmarks ohne SPI-Anteil und Golden-Image-Vergleiche (checksum(), writePNG()).
+//
+// Passt der Framebuffer nicht in den Heap (280x240 = 134 kB, auf dem ESP32 ohne PSRAM meist
+// zu viel), läuft der Sink im Zählmodus weiter: die PushStats stimmen, es gibt nur kein Bild.
+// Auf dem Host (test/test_render_bench, TFT_eSprite-Attrappe) gibt es den Framebuffer immer.
+class FramebufferSink : public ISurfaceSink {
+public:
+  using Writer = std::function<void(const uint8_t* data, size_t len)>;
+
+  FramebufferSink(uint16_t width, uint16_t height, bool allocate = true);
+  ~FramebufferSink() override;
+
+  FramebufferSink(const FramebufferSink&) = delete;
+  FramebufferSink& operator=(const FramebufferSink&) = delete;
+
+  void push(TFT_eSprite* sprite, int16_t x, int16_t y) override;
+
+  // Zusätzlich an den eigentlichen Panel-Pfad durchreichen
+  void setPassthrough(bool en) { _passthrough = en; }
+
+  bool hasBuffer() const { return _fb != nullptr; }
+  uint16_t width() const { return _w; }
+  uint16_t height() const { return _h; }
+  uint16_t pixel(int16_t x, int16_t y) const;
+  void clear(uint16_t color = 0);
+
+  const PushStats& stats() const { return _stats; }
+  void resetStats() { _stats = PushStats(); }
+
+  // CRC32 über den Framebuffer - stabiler Fingerabdruck für Golden-Images
+  uint32_t checksum() const;
+
+  // 24-bit PNG (unkomprimierte Deflate-Blöcke, eine Zeile pro Block)
+  bool writePNG(const Writer& out) const;
+
+private:
+  uint16_t _w;
+  uint16_t _h;
+  uint16_t* _fb = nullptr;
+  bool _passthrough = false;
+  PushStats _stats;
+};
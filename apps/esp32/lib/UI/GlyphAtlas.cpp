@@ -0,0 +1,163 @@
+#include "GlyphAtlas.h"
+#include "RleFontRenderer.h"
+
+#include <new>
+#include <string.h>
+
+using namespace ui;
+
+const GlyphAtlas::Face* GlyphAtlas::faceFor(Text::Size size) const {
+  for (uint8_t i = 0; i < _faceCount; i++) {
+    if (_faces[i].size == size) return &_faces[i];
+  }
+  return nullptr;
+}
+
+bool GlyphAtlas::build(Text::Size size, const char* charset) {
+  const RleFont* font = Text::getFontForSize(size);
+  if (!font || !charset) return false;
+
+  Face* face = const_cast<Face*>(faceFor(size));
+  if (!face) {
+    if (_faceCount >= MAX_FACES) return false;
+    face = &_faces[_faceCount++];
+    face->size = size;
+    face->font = font;
+  }
+
+  bool ok = true;
+  for (const char* p = charset; *p; p++) {
+    const uint8_t idx = (uint8_t)*p - FIRST_CHAR;
+    if (idx >= CHAR_COUNT || face->tiles[idx]) continue;
+    face->tiles[idx] = rasterize(font, *p);
+    ok &= face->tiles[idx] != nullptr;
+  }
+  return ok;
+}
+
+GlyphAtlas::Tile* GlyphAtlas::rasterize(const RleFont* font, char c) {
+  RleGlyph g;
+  if (!RleFontRenderer::glyph(font, (uint8_t)c, g)) return nullptr;
+
+  Tile* t = new (std::nothrow) Tile();
+  if (!t) return nullptr;
+  t->width = g.width;
+  t->stride = (g.width + 1) >> 1;
+  t->height = g.height;
+  t->advance = g.xAdvance;
+  t->xOffset = g.xOffset;
+  t->yOffset = g.yOffset;
+  if (!g.width || !g.height) return t;  // Leerzeichen: nur Vorschub
+
+  const size_t size = (size_t)t->stride * t->height;
+  t->data = new (std::nothrow) uint8_t[size];
+  if (!t->data) {
+    delete t;
+    return nullptr;
+  }
+  memset(t->data, 0, size);
+
+  RleFontRenderer::decode(font, g, [t](uint8_t x, uint8_t y, uint8_t len, uint8_t coverage) {
+    if (coverage < RleFontRenderer::INK_THRESHOLD) return;
+    uint8_t* row = t->data + y * t->stride;
+    for (uint8_t px = x; px < x + len; px++) row[px >> 1] |= (px & 1) ? 0x0F : 0xF0;
+  });
+
+  _bytes += sizeof(Tile) + size;
+  return t;
+}
+
+void GlyphAtlas::release() {
+  for (uint8_t i = 0; i < _faceCount; i++) {
+    for (auto& tile : _faces[i].tiles) {
+      if (!tile) continue;
+      delete[] tile->data;
+      delete tile;
+      tile = nullptr;
+    }
+    _faces[i] = Face();
+  }
+  _faceCount = 0;
+  _bytes = 0;
+}
+
+bool GlyphAtlas::draw(TFT_eSprite* sprite, std::string_view str, const Text::Config& config) const {
+  if (!_enabled || !sprite || str.empty()) return false;
+  if (sprite->getColorDepth() != 4) return false;
+  if (config.size == Text::Size::xxl) return false;  // textSize 2, nicht im Atlas
+
+  const Face* face = faceFor(config.size);
+  if (!face) return false;
+
+  // Nur zeichnen, wenn jedes Zeichen vorgerastert ist - sonst komplett über den RLE-Renderer
+  int32_t width = 0;
+  for (size_t i = 0; i < str.size() && str[i] != '\0'; i++) {
+    const uint8_t idx = (uint8_t)str[i] - FIRST_CHAR;
+    if (idx >= CHAR_COUNT || !face->tiles[idx]) return false;
+    width += face->tiles[idx]->advance;
+  }
+
+  int32_t x = config.x;
+  int32_t y = config.y;
+  const int16_t ascent = (int8_t)pgm_read_byte(&face->font->ascent);
+  const int16_t descent = (int8_t)pgm_read_byte(&face->font->descent);
+  if (!RleFontRenderer::applyDatum(sprite->getTextDatum(), width, ascent, descent, x, y)) return false;
+
+  const uint8_t color = config.color & 0x0F;
+  for (size_t i = 0; i < str.size() && str[i] != '\0'; i++) {
+    const Tile& t = *face->tiles[(uint8_t)str[i] - FIRST_CHAR];
+    if (t.data) blit(sprite, t, x + t.xOffset, y + t.yOffset, color);
+    x += t.advance;
+  }
+  return true;
+}
+
+void GlyphAtlas::blit(TFT_eSprite* sprite, const Tile& t, int32_t x, int32_t y, uint8_t color) {
+  const int32_t sw = sprite->width();
+  const int32_t sh = sprite->height();
+
+  int32_t row0 = y < 0 ? -y : 0;
+  int32_t rows = t.height;
+  if (y + rows > sh) rows = sh - y;
+  if (row0 >= rows || x >= sw || x + t.width <= 0) return;
+
+  uint8_t* buf = (uint8_t*)sprite->getPointer();
+
+  // Langsamer Pfad: horizontal angeschnitten oder ungerade Sprite-Breite
+  if (!buf || (sw & 1) || x < 0 || x + t.width > sw) {
+    for (int32_t r = row0; r < rows; r++) {
+      const uint8_t* src = t.data + r * t.stride;
+      for (uint8_t px = 0; px < t.width; px++) {
+        const uint8_t nib = (px & 1) ? (src[px >> 1] & 0x0F) : (src[px >> 1] >> 4);
+        if (nib) sprite->drawPixel(x + px, y + r, color);
+      }
+    }
+    return;
+  }
+
+  // 4-bpp Sprite: 2 Pixel pro Byte, high nibble = gerades x (wie TFT_eSprite::drawPixel)
+  const uint8_t pair = (color << 4) | color;
+  const int32_t lineBytes = sw >> 1;
+
+  for (int32_t r = row0; r < rows; r++) {
+    const uint8_t* src = t.data + r * t.stride;
+    uint8_t* dst = buf + (y + r) * lineBytes + (x >> 1);
+
+    if ((x & 1) == 0) {
+      for (uint8_t i = 0; i < t.stride; i++) {
+        const uint8_t m = src[i];
+        if (m) dst[i] = (dst[i] & ~m) | (pair & m);
+      }
+    } else {
+      // Um ein Nibble versetzt: high nibble der Kachel -> low nibble von dst[i], low -> high von dst[i + 1]
+      for (uint8_t i = 0; i < t.stride; i++) {
+        const uint8_t m = src[i];
+        if (!m) continue;
+        const uint8_t hi = m >> 4;
+        const uint8_t lo = m << 4;
+        if (hi) dst[i] = (dst[i] & ~hi) | (pair & hi);
+        if (lo) dst[i + 1] = (dst[i + 1] & ~lo) | (pair & lo);
+      }
+    }
+  }
+}
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <TFT_eSPI.h>
+#include <string_view>
+
+#include "Text.hpp"
+#include "fonts/RleFont.h"
+
+namespace ui {
+
+// Vorgerasterte Glyphen für die heißen Zahlenfelder (Timer, IR, Limit).
+//
+// Die RLE-Glyphen werden einmalig beim Boot in 4-bpp-Kacheln (Nibble 0xF = Tinte) entpackt.
+// Text::draw() fragt zuerst den Atlas; liegen Größe und alle Zeichen im Atlas, wird direkt
+// in den Sprite-Puffer geblittet statt jede Glyphe neu zu dekodieren.
+class GlyphAtlas {
+public:
+  static GlyphAtlas& instance() {
+    static GlyphAtlas atlas;
+    return atlas;
+  }
+
+  // Rastert `charset` für `size` vor. Mehrfachaufrufe ergänzen fehlende Zeichen.
+  bool build(Text::Size size, const char* charset);
+  void release();
+
+  // true, wenn der String komplett aus dem Atlas gezeichnet wurde.
+  bool draw(TFT_eSprite* sprite, std::string_view str, const Text::Config& config) const;
+
+  void setEnabled(bool en) { _enabled = en; }
+  bool isEnabled() const { return _enabled; }
+  size_t bytesUsed() const { return _bytes; }
+
+private:
+  GlyphAtlas() = default;
+
+  static constexpr uint8_t FIRST_CHAR = 32;
+  static constexpr uint8_t CHAR_COUNT = 95;  // ' ' .. '~'
+  static constexpr uint8_t MAX_FACES = 4;
+
+  struct Tile {
+    uint8_t* data = nullptr;  // Zeilen à stride Bytes, 2 Pixel pro Byte, high nibble = gerades x
+    uint8_t width = 0;
+    uint8_t stride = 0;
+    uint8_t height = 0;
+    uint8_t advance = 0;
+    int8_t xOffset = 0;
+    int8_t yOffset = 0;
+  };
+
+  struct Face {
+    Text::Size size = Text::Size::md;
+    const RleFont* font = nullptr;
+    Tile* tiles[CHAR_COUNT] = {};
+  };
+
+  const Face* faceFor(Text::Size size) const;
+  Tile* rasterize(const RleFont* font, char c);
+  static void blit(TFT_eSprite* sprite, const Tile& t, int32_t x, int32_t y, uint8_t color);
+
+  Face _faces[MAX_FACES];
+  uint8_t _faceCount = 0;
+  size_t _bytes = 0;
+  bool _enabled = true;
+};
+
+};
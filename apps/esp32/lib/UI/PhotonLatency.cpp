@@ -0,0 +1,88 @@
+#include "PhotonLatency.h"
+
+void PhotonLatency::Histogram::add(uint32_t us) {
+  uint8_t b = 0;
+  while (b < BUCKETS - 1 && us > BUCKET_MS[b] * 1000u) b++;
+  if (counts[b] < UINT16_MAX) counts[b]++;
+  samples++;
+  sumUs += us;
+  if (us > maxUs) maxUs = us;
+}
+
+uint16_t PhotonLatency::Histogram::percentileMs(uint8_t p) const {
+  uint32_t n = 0;
+  for (uint8_t b = 0; b < BUCKETS; b++) n += counts[b];
+  if (!n) return 0;
+
+  const uint32_t target = (n * p + 99) / 100;
+  uint32_t seen = 0;
+  for (uint8_t b = 0; b < BUCKETS - 1; b++) {
+    seen += counts[b];
+    if (seen >= target) return BUCKET_MS[b];
+  }
+  return 0;
+}
+
+void PhotonLatency::inputBegin(uint32_t eventUs, uint8_t type, uint8_t screen, uint32_t nowUs) {
+  if (pendingCount >= PENDING) {
+    droppedCount++;
+    return;
+  }
+  // Ohne Zeitstempel (Event nicht aus der Queue) zählt ab dem Handler
+  pending[pendingCount++] = {eventUs ? eventUs : nowUs, nowUs, 0, type, screen};
+}
+
+void PhotonLatency::inputHandled(uint32_t nowUs, bool visible) {
+  // Nur das zuletzt begonnene; wurde es schon von einem synchronen Frame verbucht, ist nichts offen
+  if (!pendingCount) return;
+  Pending& p = pending[pendingCount - 1];
+  if (p.handledUs) return;
+  if (!visible) {
+    pendingCount--;
+    ignoredCount++;
+    return;
+  }
+  p.handledUs = nowUs ? nowUs : 1;
+}
+
+void PhotonLatency::frameBegin(uint32_t nowUs) {
+  if (!pendingCount || frameOpen) return;
+  frameStartUs = nowUs;
+  frameOpen = true;
+}
+
+void PhotonLatency::framePresented(uint32_t nowUs) {
+  if (!frameOpen) return;
+  frameOpen = false;
+
+  for (uint8_t i = 0; i < pendingCount; i++) {
+    const Pending& p = pending[i];
+    const uint32_t handled = p.handledUs ? p.handledUs : frameStartUs;
+    const uint32_t totalUs = nowUs - p.eventUs;
+    if (totalUs > STALE_US) {
+      staleCount++;
+      continue;
+    }
+
+    all.add(totalUs);
+    if (p.screen < MAX_SCREENS) screens[p.screen].add(totalUs);
+    if (p.type < MAX_TYPES) types[p.type].add(totalUs);
+
+    stageSums.queueUs += p.beginUs - p.eventUs;
+    stageSums.handleUs += handled - p.beginUs;
+    stageSums.waitUs += frameStartUs - handled;
+    stageSums.renderUs += nowUs - frameStartUs;
+    stageSums.samples++;
+  }
+  pendingCount = 0;
+}
+
+void PhotonLatency::reset() {
+  for (auto& h : screens) h = Histogram();
+  for (auto& h : types) h = Histogram();
+  all = Histogram();
+  stageSums = Stages();
+  droppedCount = 0;
+  staleCount = 0;
+  ignoredCount = 0;
+}
@@ -0,0 +1,91 @@
+#pragma once
+
+#include <stdint.h>
+
+// Press-to-Photon: vom Input-Ereignis (InputEvent::us) bis der Frame, der die Reaktion zeigt,
+// fertig gepusht ist. Stationen pro Event:
+//   queue  - Ereignis -> InputHandler::handleInput (Queue, Gesten, Loop-Takt)
+//   handle - InputHandler + ScreenManager::handleInput + Screen-Handler
+//   wait   - Handler fertig -> Beginn des nächsten ScreenManager::draw()
+//   render - draw() inkl. Push (Panel oder Sink)
+// Histogramme pro Screen und pro Event-Typ. Nur Zeitarithmetik, keine Arduino/TFT-Abhängigkeit:
+// Zeitpunkte kommen vom Aufrufer, damit es headless (FramebufferSink) und auf dem Host gleich läuft.
+// Nicht thread-sicher - alles im UI-Loop aufrufen (DebugServer kopiert per runInLoop und
+// serialisiert die Kopie auf seinem Task).
+class PhotonLatency {
+public:
+  static constexpr uint8_t BUCKETS = 10;
+  // Obergrenzen in ms, der letzte Bucket nimmt alles darüber
+  static constexpr uint16_t BUCKET_MS[BUCKETS - 1] = {2, 4, 8, 16, 33, 50, 100, 200, 500};
+  static constexpr uint8_t MAX_SCREENS = 12;
+  static constexpr uint8_t MAX_TYPES = 12;
+  static constexpr uint8_t PENDING = 8;
+  // Events, deren Frame erst Sekunden später kommt (Loop blockiert), nicht verbuchen
+  static constexpr uint32_t STALE_US = 2000000;
+
+  struct Histogram {
+    uint16_t counts[BUCKETS] = {};  // sättigend
+    uint32_t samples = 0;
+    uint32_t maxUs = 0;
+    uint64_t sumUs = 0;
+
+    void add(uint32_t us);
+    uint32_t avgUs() const { return samples ? sumUs / samples : 0; }
+    // Obergrenze des Buckets, in dem das p-te Perzentil liegt (ms, 0 = darüber)
+    uint16_t percentileMs(uint8_t p) const;
+  };
+
+  struct Stages {
+    uint64_t queueUs = 0;
+    uint64_t handleUs = 0;
+    uint64_t waitUs = 0;
+    uint64_t renderUs = 0;
+    uint32_t samples = 0;
+  };
+
+  static PhotonLatency& instance() {
+    static PhotonLatency latency;
+    return latency;
+  }
+
+  void inputBegin(uint32_t eventUs, uint8_t type, uint8_t screen, uint32_t nowUs);
+  // visible = Handler hat einen Redraw angefordert oder den Screen gewechselt; sonst zeigt kein
+  // Frame die Reaktion und das Event wird verworfen statt dem nächsten Frame angerechnet
+  void inputHandled(uint32_t nowUs, bool visible = true);
+  void frameBegin(uint32_t nowUs);
+  void framePresented(uint32_t nowUs);
+
+  const Histogram& byScreen(uint8_t screen) const { return screens[screen < MAX_SCREENS ? screen : 0]; }
+  const Histogram& byType(uint8_t type) const { return types[type < MAX_TYPES ? type : 0]; }
+  const Histogram& total() const { return all; }
+  const Stages& stages() const { return stageSums; }
+  uint32_t dropped() const { return droppedCount; }
+  uint32_t stale() const { return staleCount; }
+  uint32_t ignored() const { return ignoredCount; }
+
+  void reset();
+
+private:
+  PhotonLatency() = default;
+
+  struct Pending {
+    uint32_t eventUs;
+    uint32_t beginUs;
+    uint32_t handledUs;  // 0 = Handler läuft noch (z.B. Slide-Transition zeichnet synchron)
+    uint8_t type;
+    uint8_t screen;
+  };
+
+  Pending pending[PENDING];
+  uint8_t pendingCount = 0;
+  uint32_t frameStartUs = 0;
+  bool frameOpen = false;
+
+  Histogram screens[MAX_SCREENS];
+  Histogram types[MAX_TYPES];
+  Histogram all;
+  Stages stageSums;
+  uint32_t droppedCount = 0;
+  uint32_t staleCount = 0;
+  uint32_t ignoredCount = 0;
+};
@@ -1,18 +1,15 @@
 #include "RenderSurface.h"
-#include "Inter_12.h"
-#include "Inter_16.h"
-#include "Inter_18.h"
-#include "Inter_24.h"
-#include "Inter_22.h"
-#include "Inter_20b.h"
-#include "Inter_32.h"
-#include "Inter_48.h"
-#include "Inter_64b.h"
-#include "Inter_16_bold.h"
-#include "Inter_24_bold.h"
-#include "Inter_32_bold.h"
+#include "fonts/Inter_16.h"
+#include "fonts/Inter_16B.h"
+#include "fonts/Inter_18.h"
+#include "fonts/Inter_22.h"
+#include "fonts/Inter_32.h"
+#include "fonts/Inter_32B.h"
+#include "fonts/Inter_48.h"
+#include "fonts/Inter_64B.h"
 
-const GFXfont* ui::Text::getFontForSize(Text::Size ts) {
+// Subsets siehe scripts/fontgen.py
+const RleFont* ui::Text::getFontForSize(Text::Size ts) {
     switch (ts) {
         case Text::Size::xs: return &Inter_16;
         case Text::Size::sm: return &Inter_18;
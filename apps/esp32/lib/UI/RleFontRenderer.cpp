@@ -0,0 +1,155 @@
+#include "RleFontRenderer.h"
+
+#include <string.h>
+
+using namespace ui;
+
+namespace {
+
+// Horizontale Spans direkt in den 4-bpp Puffer (2 Pixel pro Byte, high nibble = gerades x)
+class SpanTarget {
+public:
+  SpanTarget(TFT_eSprite* sprite, uint16_t color) : _sprite(sprite), _color(color) {
+    _w = sprite->width();
+    _h = sprite->height();
+    if (sprite->getColorDepth() == 4 && !(_w & 1)) _buf = (uint8_t*)sprite->getPointer();
+    const uint8_t c = color & 0x0F;
+    _nibble = c;
+    _pair = (c << 4) | c;
+  }
+
+  void span(int32_t x, int32_t y, int32_t len) {
+    if (y < 0 || y >= _h) return;
+    if (x < 0) {
+      len += x;
+      x = 0;
+    }
+    if (x + len > _w) len = _w - x;
+    if (len <= 0) return;
+
+    if (!_buf) {
+      _sprite->drawFastHLine(x, y, len, _color);
+      return;
+    }
+
+    uint8_t* row = _buf + y * (_w >> 1);
+    if (x & 1) {
+      row[x >> 1] = (row[x >> 1] & 0xF0) | _nibble;
+      x++;
+      len--;
+    }
+    memset(row + (x >> 1), _pair, len >> 1);
+    if (len & 1) {
+      x += len - 1;
+      row[x >> 1] = (row[x >> 1] & 0x0F) | (_nibble << 4);
+    }
+  }
+
+private:
+  TFT_eSprite* _sprite;
+  uint16_t _color;
+  uint8_t* _buf = nullptr;
+  int32_t _w = 0;
+  int32_t _h = 0;
+  uint8_t _nibble = 0;
+  uint8_t _pair = 0;
+};
+
+}  // namespace
+
+bool RleFontRenderer::glyph(const RleFont* font, uint16_t codepoint, RleGlyph& out) {
+  const RleGlyph* glyphs = (const RleGlyph*)pgm_read_dword(&font->glyphs);
+  int32_t lo = 0;
+  int32_t hi = (int32_t)pgm_read_word(&font->glyphCount) - 1;
+  while (lo <= hi) {
+    const int32_t mid = (lo + hi) / 2;
+    const uint16_t cp = pgm_read_word(&glyphs[mid].codepoint);
+    if (cp == codepoint) {
+      memcpy_P(&out, &glyphs[mid], sizeof(RleGlyph));
+      return true;
+    }
+    if (cp < codepoint) lo = mid + 1;
+    else hi = mid - 1;
+  }
+  return false;
+}
+
+uint16_t RleFontRenderer::nextCodepoint(std::string_view str, size_t& i) {
+  const uint8_t c = str[i++];
+  if (c < 0x80) return c;
+
+  // UTF-8 (2 und 3 Byte), kaputte Folgen werden als einzelnes Byte übersprungen
+  uint8_t extra = (c & 0xE0) == 0xC0 ? 1 : (c & 0xF0) == 0xE0 ? 2 : 0;
+  if (!extra || i + extra > str.size()) return 0;
+  uint16_t cp = c & (extra == 1 ? 0x1F : 0x0F);
+  while (extra--) {
+    const uint8_t cc = str[i];
+    if ((cc & 0xC0) != 0x80) return 0;
+    cp = (cp << 6) | (cc & 0x3F);
+    i++;
+  }
+  return cp;
+}
+
+int32_t RleFontRenderer::textWidth(const RleFont* font, std::string_view str, uint8_t scale) {
+  if (!font) return 0;
+  int32_t width = 0;
+  RleGlyph g;
+  for (size_t i = 0; i < str.size() && str[i] != '\0';) {
+    if (glyph(font, nextCodepoint(str, i), g)) width += g.xAdvance;
+  }
+  return width * scale;
+}
+
+bool RleFontRenderer::applyDatum(uint8_t datum, int32_t width, int16_t ascent, int16_t descent,
+                                 int32_t& x, int32_t& y) {
+  // Free Fonts: drawString() schiebt den Cursor um glyph_ab auf die Baseline; die Bottom-Datums
+  // ziehen zusätzlich glyph_bb ab (Unterlängen wie 'y' enden auf y), die Baseline-Datums nicht
+  const int16_t bottom = ascent + descent;
+  int32_t dx = 0;
+  int32_t dy = ascent;
+  switch (datum) {
+    case TL_DATUM: break;
+    case TC_DATUM: dx = -width / 2; break;
+    case TR_DATUM: dx = -width; break;
+    case ML_DATUM: dy -= ascent / 2; break;
+    case MC_DATUM: dx = -width / 2; dy -= ascent / 2; break;
+    case MR_DATUM: dx = -width; dy -= ascent / 2; break;
+    case BL_DATUM: dy -= bottom; break;
+    case BC_DATUM: dx = -width / 2; dy -= bottom; break;
+    case BR_DATUM: dx = -width; dy -= bottom; break;
+    case L_BASELINE: dy = 0; break;
+    case C_BASELINE: dx = -width / 2; dy = 0; break;
+    case R_BASELINE: dx = -width; dy = 0; break;
+    default: return false;
+  }
+  x += dx;
+  y += dy;
+  return true;
+}
+
+void RleFontRenderer::drawString(TFT_eSprite* sprite, const RleFont* font, std::string_view str,
+                                 int32_t x, int32_t y, uint16_t color, uint8_t scale) {
+  if (!sprite || !font || str.empty()) return;
+
+  const int16_t ascent = (int8_t)pgm_read_byte(&font->ascent) * scale;
+  const int16_t descent = (int8_t)pgm_read_byte(&font->descent) * scale;
+  if (!applyDatum(sprite->getTextDatum(), textWidth(font, str, scale), ascent, descent, x, y)) {
+    applyDatum(TL_DATUM, 0, ascent, descent, x, y);
+  }
+
+  SpanTarget target(sprite, color);
+  RleGlyph g;
+  for (size_t i = 0; i < str.size() && str[i] != '\0';) {
+    if (!glyph(font, nextCodepoint(str, i), g)) continue;
+
+    const int32_t gx = x + g.xOffset * scale;
+    const int32_t gy = y + g.yOffset * scale;
+    decode(font, g, [&](uint8_t px, uint8_t py, uint8_t len, uint8_t coverage) {
+      if (coverage < INK_THRESHOLD) return;
+      if (scale == 1) target.span(gx + px, gy + py, len);
+      else sprite->fillRect(gx + px * scale, gy + py * scale, len * scale, scale, color);
+    });
+    x += g.xAdvance * scale;
+  }
+}
@@ -0,0 +1,73 @@
+#pragma once
+
+#include <TFT_eSPI.h>
+#include <string_view>
+
+#include "fonts/RleFont.h"
+
+namespace ui {
+
+// Zeichnet RleFont-Glyphen (scripts/fontgen.py) direkt in Sprites.
+// Datum- und Breitenrechnung entsprechen TFT_eSPI::drawString() für Free Fonts.
+class RleFontRenderer {
+public:
+  // Palette-Sprites kennen kein Alpha: ab dieser Coverage gilt ein Pixel als Tinte
+  static constexpr uint8_t INK_THRESHOLD = 8;
+
+  static bool glyph(const RleFont* font, uint16_t codepoint, RleGlyph& out);
+  static uint16_t nextCodepoint(std::string_view str, size_t& i);
+  static int32_t textWidth(const RleFont* font, std::string_view str, uint8_t scale = 1);
+
+  // Verschiebt x/y gemäß TFT_eSPI-Datum; false bei unbekanntem Datum.
+  // BL/BC/BR = Unterkante (ascent + descent), L/C/R_BASELINE = Baseline
+  static bool applyDatum(uint8_t datum, int32_t width, int16_t ascent, int16_t descent, int32_t& x, int32_t& y);
+
+  static void drawString(TFT_eSprite* sprite, const RleFont* font, std::string_view str,
+                         int32_t x, int32_t y, uint16_t color, uint8_t scale = 1);
+
+  // Dekodiert eine Glyphe: fn(x, y, len, coverage) für jeden nicht-transparenten Lauf.
+  // Deckende Läufe werden an Zeilengrenzen geteilt, Literale kommen einzeln.
+  template <typename Fn>
+  static void decode(const RleFont* font, const RleGlyph& g, Fn&& fn) {
+    if (!g.width || !g.height) return;
+    const uint8_t* p = (const uint8_t*)pgm_read_dword(&font->data) + g.offset;
+    uint8_t x = 0;
+    uint8_t y = 0;
+    auto advance = [&](uint8_t n) {
+      x += n;
+      while (x >= g.width) {
+        x -= g.width;
+        y++;
+      }
+    };
+
+    while (y < g.height) {
+      const uint8_t op = pgm_read_byte(p++);
+      uint8_t n = (op & 0x3F) + 1;
+      switch (op >> 6) {
+        case 0:
+          advance(n);
+          break;
+        case 1:
+          while (n && y < g.height) {
+            const uint8_t len = n < g.width - x ? n : g.width - x;
+            fn(x, y, len, 15);
+            advance(len);
+            n -= len;
+          }
+          break;
+        default:
+          for (uint8_t k = 0; k < n; k++) {
+            const uint8_t b = pgm_read_byte(p + (k >> 1));
+            const uint8_t c = (k & 1) ? (b & 0x0F) : (b >> 4);
+            if (c) fn(x, y, 1, c);
+            advance(1);
+          }
+          p += (n + 1) >> 1;
+          break;
+      }
+    }
+  }
+};
+
+};
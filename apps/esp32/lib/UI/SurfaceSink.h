@@ -0,0 +1,26 @@
+#pragma once
+
+#include <TFT_eSPI.h>
+
+// Ziel für fertig gerenderte Surfaces. Ohne Sink pusht SurfaceFactory direkt per SPI aufs Panel.
+class ISurfaceSink {
+public:
+  virtual ~ISurfaceSink() = default;
+  virtual void push(TFT_eSprite* sprite, int16_t x, int16_t y) = 0;
+};
+
+// Zähler für alles, was Richtung Panel geht
+struct PushStats {
+  // Adressfenster pro Push: CASET (1+4) + RASET (1+4) + RAMWR (1)
+  static constexpr uint8_t WINDOW_BYTES = 11;
+
+  uint32_t pushes = 0;
+  uint32_t pixels = 0;
+  uint32_t bytes = 0;  // SPI-Bytes inkl. Adressfenster, Pixel als RGB565
+
+  void add(uint32_t w, uint32_t h) {
+    pushes++;
+    pixels += w * h;
+    bytes += WINDOW_BYTES + w * h * 2;
+  }
+};
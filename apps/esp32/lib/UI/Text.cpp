@@ -1,13 +1,13 @@
 #include "Text.hpp"
+#include "GlyphAtlas.h"
+#include "RleFontRenderer.h"
 
 using namespace ui;
 
 void Text::draw(TFT_eSprite* sprite, std::string_view str, Config config) {
   if (!sprite) return;
+  if (GlyphAtlas::instance().draw(sprite, str, config)) return;
 
-  sprite->setTextColor(config.color);
-  sprite->setFreeFont(getFontForSize(config.size));
-  sprite->setTextSize(config.size != Size::xxl ? 1 : 2);
-
-  sprite->drawString(str.data(), config.x, config.y);
+  RleFontRenderer::drawString(sprite, getFontForSize(config.size), str, config.x, config.y, config.color,
+                              config.size != Size::xxl ? 1 : 2);
 }
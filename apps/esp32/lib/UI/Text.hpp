@@ -1,6 +1,7 @@
 #pragma once
 
 #include <TFT_eSPI.h>
+#include "fonts/RleFont.h"
 #include <string>
 #include <string_view>
 
@@ -52,9 +53,7 @@ public:
   
   
   static void draw(TFT_eSprite* sprite, std::string_view str, Config config);
-
-private:
-  static const GFXfont* getFontForSize(Size ts);
+  static const RleFont* getFontForSize(Size ts);
 
 };
 };
@@ -0,0 +1,266 @@
+#!/usr/bin/env python3
+"""
+Font-Asset-Pipeline: Inter-Schriften -> subsettete 4-bpp RLE-Header (lib/Assets/fonts)
+
+Quelle ist pro Schrift entweder
+  - eine TTF/OTF (mit --ttf-dir und Pillow): 16 Coverage-Stufen
+  - der bisherige GFXfont-Header aus scripts/fonts/ (1-bpp, Coverage nur 0/15)
+
+Die eingecheckten Header stammen aus den GFX-Quellen, sind also 1-bpp ohne Antialiasing
+(Kopfzeile "1-bpp source"). Auch aus einer TTF wird auf den 4-bpp Palette-Sprites nicht
+geblendet: RleFontRenderer::INK_THRESHOLD macht aus der Coverage wieder Tinte/keine Tinte.
+
+Jede Glyphe wird auf ihre Tinten-Box beschnitten und zeilenweise lauflängenkodiert.
+Format siehe lib/Assets/fonts/RleFont.h, Decoder: lib/UI/RleFontRenderer.
+
+Aufruf:
+    python scripts/fontgen.py                   # alle Schriften aus FONTS neu erzeugen
+    python scripts/fontgen.py --ttf-dir ~/Inter # aus den TTFs rastern
+    python scripts/fontgen.py --check           # nur Größen ausgeben, nichts schreiben
+
+Nach dem Ändern eines Zeichensatzes (z.B. neuer Text in bxl) Skript neu laufen lassen
+und die erzeugten Header mit einchecken.
+"""
+
+import argparse
+import datetime
+import re
+import sys
+from pathlib import Path
+
+ROOT = Path(__file__).resolve().parent.parent
+GFX_DIR = Path(__file__).resolve().parent / "fonts"
+OUT_DIR = ROOT / "lib" / "Assets" / "fonts"
+
+ASCII = "".join(chr(c) for c in range(32, 127))
+
+# Name, GFX-Quelle, TTF-Datei, Pixelgröße, Zeichensatz
+# Zeichensätze = was die Firmware mit dieser Größe tatsächlich zeichnet (Text::Size in Klammern).
+# Eine Schrift, die von Größen mit beliebigem Text genutzt wird, braucht den vollen ASCII-Satz.
+FONTS = [
+    ("Inter_16", "Inter_16.h", "Inter-Regular.ttf", 16, ASCII),                       # xs
+    ("Inter_16B", "Inter_16_bold.h", "Inter-SemiBold.ttf", 16, ASCII),               # bsm
+    ("Inter_18", "Inter_18.h", "Inter-Regular.ttf", 18, ASCII),                       # sm
+    ("Inter_22", "Inter_22.h", "Inter-Regular.ttf", 22, ASCII),                       # md, bmd
+    ("Inter_32", "Inter_32.h", "Inter-Regular.ttf", 32, ASCII),                       # lg, xl, xxl
+    ("Inter_32B", "Inter_32_bold.h", "Inter-SemiBold.ttf", 32, ASCII),               # blg
+    ("Inter_48", "Inter_48.h", "Inter-SemiBold.ttf", 48, " %-.0123456789FOadeil"),    # bxl (Temps, "OFF", "Failed")
+    ("Inter_64B", "Inter_64b.h", "Inter-Bold.ttf", 64, " 0123456789"),                # bxxl (Timer)
+]
+
+MAX_RUN = 64
+
+
+# ---------------------------------------------------------------------------
+# Quellen
+# ---------------------------------------------------------------------------
+
+class Glyph:
+    def __init__(self, cp, width, height, advance, x_off, y_off, coverage):
+        self.cp = cp
+        self.width = width
+        self.height = height
+        self.advance = advance
+        self.x_off = x_off
+        self.y_off = y_off
+        self.coverage = coverage  # Zeilen x Spalten, 0..15
+
+
+def load_gfx(path):
+    """Liest einen Adafruit-GFX-Header (Bitmaps, Glyphs, GFXfont)."""
+    src = path.read_text(encoding="utf-8")
+    bitmap_src = re.search(r"Bitmaps\[\]\s*PROGMEM\s*=\s*\{(.*?)\};", src, re.S).group(1)
+    data = bytes(int(x, 16) for x in re.findall(r"0x[0-9A-Fa-f]{2}", bitmap_src))
+    glyph_src = re.search(r"Glyphs\[\]\s*PROGMEM\s*=\s*\{(.*?)\};", src, re.S).group(1)
+    entries = re.findall(r"\{\s*(-?\d+),\s*(-?\d+),\s*(-?\d+),\s*(-?\d+),\s*(-?\d+),\s*(-?\d+)\s*\}", glyph_src)
+    font = re.search(r"GFXfont\s+\w+\s+PROGMEM\s*=\s*\{.*?,.*?,\s*(\w+),\s*(\w+),\s*(\d+)\s*\}", src, re.S)
+    first, y_advance = int(font.group(1), 0), int(font.group(3))
+
+    glyphs = {}
+    for i, entry in enumerate(entries):
+        offset, w, h, adv, xo, yo = (int(v) for v in entry)
+        rows, bit = [], 0
+        for _ in range(h):
+            row = []
+            for _ in range(w):
+                byte = data[offset + (bit >> 3)]
+                row.append(15 if byte & (0x80 >> (bit & 7)) else 0)
+                bit += 1
+            rows.append(row)
+        glyphs[first + i] = Glyph(first + i, w, h, adv, xo, yo, rows)
+    return glyphs, y_advance
+
+
+def load_ttf(path, px, charset):
+    """Rastert mit Pillow im Zellen-Layout der GFX-Header: yOffset ab Zellenoberkante."""
+    from PIL import Image, ImageDraw, ImageFont
+
+    font = ImageFont.truetype(str(path), px)
+    ascent, descent = font.getmetrics()
+    y_advance = ascent + descent
+    glyphs = {}
+    for ch in charset:
+        advance = int(round(font.getlength(ch)))
+        width = max(advance, 1) + px  # Überhang links/rechts zulassen
+        img = Image.new("L", (width, y_advance), 0)
+        ImageDraw.Draw(img).text((px // 2, 0), ch, font=font, fill=255)
+        rows = [[img.getpixel((x, y)) * 15 // 255 for x in range(width)] for y in range(y_advance)]
+        glyphs[ord(ch)] = Glyph(ord(ch), width, y_advance, advance, -(px // 2), 0, rows)
+    return glyphs, y_advance
+
+
+# ---------------------------------------------------------------------------
+# Beschneiden + RLE
+# ---------------------------------------------------------------------------
+
+def trim(g):
+    ink = [(x, y) for y, row in enumerate(g.coverage) for x, c in enumerate(row) if c]
+    if not ink:
+        return Glyph(g.cp, 0, 0, g.advance, 0, 0, [])
+    x0, x1 = min(x for x, _ in ink), max(x for x, _ in ink)
+    y0, y1 = min(y for _, y in ink), max(y for _, y in ink)
+    rows = [row[x0:x1 + 1] for row in g.coverage[y0:y1 + 1]]
+    return Glyph(g.cp, x1 - x0 + 1, y1 - y0 + 1, g.advance, g.x_off + x0, g.y_off + y0, rows)
+
+
+def encode(g):
+    """00nnnnnn = n+1 transparent, 01nnnnnn = n+1 deckend, 10nnnnnn + Nibbles = n+1 Coverage-Literale."""
+    pixels = [c for row in g.coverage for c in row]
+    out = bytearray()
+    i = 0
+    while i < len(pixels):
+        c = pixels[i]
+        if c in (0, 15):
+            n = 1
+            while i + n < len(pixels) and pixels[i + n] == c and n < MAX_RUN:
+                n += 1
+            out.append((0x40 if c else 0x00) | (n - 1))
+            i += n
+            continue
+        n = 1
+        while i + n < len(pixels) and pixels[i + n] not in (0, 15) and n < MAX_RUN:
+            n += 1
+        out.append(0x80 | (n - 1))
+        lit = pixels[i:i + n] + [0] * (n & 1)
+        out.extend((lit[k] << 4) | lit[k + 1] for k in range(0, len(lit), 2))
+        i += n
+    return bytes(out)
+
+
+def decode(data, count):
+    """Referenz-Decoder für die Selbstprüfung."""
+    out, i = [], 0
+    while len(out) < count:
+        op, n = data[i] >> 6, (data[i] & 0x3F) + 1
+        i += 1
+        if op == 0:
+            out += [0] * n
+        elif op == 1:
+            out += [15] * n
+        else:
+            for k in range(n):
+                b = data[i + (k >> 1)]
+                out.append(b >> 4 if k & 1 == 0 else b & 0x0F)
+            i += (n + 1) >> 1
+    return out
+
+
+# ---------------------------------------------------------------------------
+# Ausgabe
+# ---------------------------------------------------------------------------
+
+def c_array(data, indent="    ", per_line=16):
+    lines = []
+    for k in range(0, len(data), per_line):
+        lines.append(indent + ", ".join(f"0x{b:02X}" for b in data[k:k + per_line]) + ",")
+    return "\n".join(lines)
+
+
+def render_header(name, title, glyphs, y_advance, ascent, descent, data):
+    guard = f"RLE_{name.upper()}_H"
+    rows = []
+    for g, offset in glyphs:
+        label = "space" if g.cp == 32 else ("\\\\" if g.cp == 92 else chr(g.cp))
+        rows.append(f"    {{ {offset}, {g.cp}, {g.width}, {g.height}, {g.advance}, {g.x_off}, {g.y_off} }},  // '{label}'")
+    return f"""// {title}
+// Generated by scripts/fontgen.py: {datetime.date.today().isoformat()}
+// Charset: {len(glyphs)} characters, {len(data)} bytes RLE
+
+#ifndef {guard}
+#define {guard}
+
+#include "RleFont.h"
+
+const uint8_t {name}Data[] PROGMEM = {{
+{c_array(data)}
+}};
+
+const RleGlyph {name}Glyphs[] PROGMEM = {{
+{chr(10).join(rows)}
+}};
+
+const RleFont {name} PROGMEM = {{
+    {name}Data,
+    {name}Glyphs,
+    {len(glyphs)}, {y_advance}, {ascent}, {descent}
+}};
+
+#endif // {guard}
+"""
+
+
+def build(entry, ttf_dir):
+    name, gfx_file, ttf_file, px, charset = entry
+    source = None
+    if ttf_dir and (ttf_dir / ttf_file).exists():
+        try:
+            glyphs, y_advance = load_ttf(ttf_dir / ttf_file, px, charset)
+            source = f"Inter Font - {px}px ({ttf_file}, 4-bpp coverage)"
+        except ImportError:
+            print("Pillow fehlt, nutze GFX-Quelle", file=sys.stderr)
+    if source is None:
+        glyphs, y_advance = load_gfx(GFX_DIR / gfx_file)
+        first_line = (GFX_DIR / gfx_file).read_text(encoding="utf-8").splitlines()[0].lstrip("/ ")
+        source = f"{first_line} (1-bpp source)"
+
+    missing = [ch for ch in charset if ord(ch) not in glyphs]
+    if missing:
+        raise SystemExit(f"{name}: Zeichen fehlen in der Quelle: {''.join(missing)!r}")
+
+    # TFT_eSPI glyph_ab / glyph_bb: max. Höhe über bzw. unter der Baseline über alle Quell-Glyphen
+    ascent = max(0, max(-g.y_off for g in glyphs.values()))
+    descent = max(0, max(g.height + g.y_off for g in glyphs.values()))
+
+    data = bytearray()
+    table = []
+    for cp in sorted({ord(ch) for ch in charset}):
+        g = trim(glyphs[cp])
+        enc = encode(g)
+        assert decode(enc, g.width * g.height) == [c for row in g.coverage for c in row], f"{name} {chr(cp)}"
+        table.append((g, len(data)))
+        data += enc
+    return name, source, table, y_advance, ascent, descent, bytes(data)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--ttf-dir", type=Path, help="Verzeichnis mit Inter-*.ttf (braucht Pillow)")
+    parser.add_argument("--check", action="store_true", help="nur Größen ausgeben")
+    args = parser.parse_args()
+
+    OUT_DIR.mkdir(parents=True, exist_ok=True)
+    total = 0
+    for entry in FONTS:
+        name, title, table, y_advance, ascent, descent, data = build(entry, args.ttf_dir)
+        # Flash: RLE-Daten + Glyph-Tabelle (12 Byte pro Eintrag) + RleFont
+        size = len(data) + 12 * len(table) + 12
+        total += size
+        print(f"{name:10s} {len(table):3d} glyphs  {size:6d} bytes")
+        if not args.check:
+            (OUT_DIR / f"{name}.h").write_text(
+                render_header(name, title, table, y_advance, ascent, descent, data), encoding="utf-8")
+    print(f"{'total':10s}              {total:6d} bytes")
+
+
+if __name__ == "__main__":
+    main()
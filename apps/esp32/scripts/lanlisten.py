@@ -0,0 +1,340 @@
+#!/usr/bin/env python3
+"""
+Empfänger für die LAN-Telemetrie (driver/net/LanLink.h) mit Latenzmessung.
+
+Hört auf die Multicast-Gruppe, dekodiert die LanPacket-Frames und misst:
+  - Rate, Lücken in seq, Neustarts (bootId)
+  - Laufzeitschwankung: Empfangszeit - Geräte-ms, relativ zum kleinsten Versatz (one-way, ohne Uhrabgleich)
+  - mit --key: Round-Trip per authentifiziertem "ping" an den Steuerport (p50/p95/p99)
+
+    python scripts/lanlisten.py                               # nur Telemetrie
+    python scripts/lanlisten.py --key change-me --duration 60 # + RTT
+    python scripts/lanlisten.py --key change-me --cmd '{"cmd":"burst","ms":5000}'
+
+LAN_KEY steht in include/credentials.h. Die Geräteadresse kommt aus dem ersten Paket
+(oder --device). Ohne Gerät: --selftest spielt ein Gerät auf localhost nach.
+"""
+
+import argparse
+import hashlib
+import hmac
+import json
+import os
+import socket
+import struct
+import sys
+import threading
+import time
+
+GROUP = "239.72.66.1"
+TELEMETRY_PORT = 47411
+CONTROL_PORT = 47412
+FORMAT = 1
+
+# LanPacket, little-endian, gepackt
+PACKET = struct.Struct("<2sBBIIIhhHBBH")
+# LanControlHeader ohne Tag (HMAC-Eingabe), Tag = 16 Byte
+CONTROL = struct.Struct("<2sBBII")
+TAG_LEN = 16
+
+FLAGS = {0x01: "heating", 0x02: "zvs", 0x04: "locked", 0x08: "control"}
+
+
+def decode(data):
+    if len(data) != PACKET.size:
+        return None
+    magic, version, flags, boot, seq, ms, temp, raw, limit, power, cycle, timer = PACKET.unpack(data)
+    if magic != b"HB" or version != FORMAT:
+        return None
+    return {
+        "flags": flags, "boot": boot, "seq": seq, "ms": ms,
+        "temp": temp / 10, "raw": raw / 10, "limit": limit,
+        "power": power, "cycle": cycle, "timer": timer,
+    }
+
+
+def control_frame(key, boot, counter, payload):
+    head = CONTROL.pack(b"HC", FORMAT, 0, boot, counter)
+    body = json.dumps(payload, separators=(",", ":")).encode()
+    tag = hmac.new(key, head + body, hashlib.sha256).digest()[:TAG_LEN]
+    return head + tag + body
+
+
+def percentile(values, p):
+    if not values:
+        return float("nan")
+    s = sorted(values)
+    return s[min(len(s) - 1, int(round(p / 100 * (len(s) - 1))))]
+
+
+class Listener:
+    def __init__(self, args):
+        self.args = args
+        self.key = args.key.encode() if args.key else None
+        self.lock = threading.Lock()
+        self.device = args.device
+        self.boot = None
+        self.packets = 0
+        self.gaps = 0
+        self.reboots = 0
+        self.last_seq = None
+        self.offsets = []       # host_ms - device_ms
+        self.rtts = []
+        self.pending = {}       # ping id -> Sendezeit
+        self.counter = 0
+        self.acks = []
+        self.last = None
+
+        self.rx = socket.socket(socket.AF_INET, socket.SOCK_DGRAM, socket.IPPROTO_UDP)
+        self.rx.setsockopt(socket.SOL_SOCKET, socket.SO_REUSEADDR, 1)
+        self.rx.bind(("", args.port))
+        if not args.group.startswith("127."):
+            mreq = struct.pack("4s4s", socket.inet_aton(args.group), socket.inet_aton(args.iface))
+            self.rx.setsockopt(socket.IPPROTO_IP, socket.IP_ADD_MEMBERSHIP, mreq)
+        self.rx.settimeout(0.2)
+
+        self.ctl = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+        self.ctl.settimeout(0.2)
+
+    def on_packet(self, data, addr, now_ms):
+        p = decode(data)
+        if not p:
+            return
+        with self.lock:
+            if self.device is None:
+                self.device = addr[0]
+            if p["boot"] != self.boot:
+                if self.boot is not None:
+                    self.reboots += 1
+                self.boot = p["boot"]
+                self.last_seq = None
+                self.offsets.clear()   # neue millis()-Basis
+            if self.last_seq is not None and p["seq"] > self.last_seq + 1:
+                self.gaps += p["seq"] - self.last_seq - 1
+            self.last_seq = p["seq"]
+            self.packets += 1
+            self.offsets.append(now_ms - p["ms"])
+            self.last = p
+
+    def next_counter(self):
+        # Streng steigend, auch über Neustarts des Listeners hinweg (Zeitbasis)
+        self.counter = max(self.counter + 1, int(time.time() * 1000) & 0xFFFFFFFF)
+        return self.counter
+
+    def send(self, payload):
+        with self.lock:
+            device, boot = self.device, self.boot
+        if not self.key or device is None or boot is None:
+            return False
+        frame = control_frame(self.key, boot, self.next_counter(), payload)
+        self.ctl.sendto(frame, (device, self.args.ctl))
+        return True
+
+    def ping(self, n):
+        pid = "p%d" % n
+        t0 = time.perf_counter()
+        if not self.send({"cmd": "ping", "id": pid}):
+            return
+        self.pending[pid] = t0
+
+    def drain_acks(self):
+        while True:
+            try:
+                data, _ = self.ctl.recvfrom(512)
+            except (socket.timeout, BlockingIOError):
+                return
+            t1 = time.perf_counter()
+            try:
+                ack = json.loads(data)
+            except ValueError:
+                continue
+            t0 = self.pending.pop(ack.get("id"), None)
+            if t0 is not None:
+                self.rtts.append((t1 - t0) * 1000)
+            else:
+                self.acks.append(ack)
+                print("ack:", json.dumps(ack))
+
+    def run(self, duration, on_tick=None):
+        stop = threading.Event()
+
+        def receive():
+            while not stop.is_set():
+                try:
+                    data, addr = self.rx.recvfrom(256)
+                except socket.timeout:
+                    continue
+                except OSError:
+                    return
+                self.on_packet(data, addr, time.time() * 1000)
+
+        t = threading.Thread(target=receive, daemon=True)
+        t.start()
+        start = time.time()
+        next_ping = start
+        next_report = start + self.args.report
+        sent_cmd = False
+        n = 0
+        while time.time() - start < duration:
+            now = time.time()
+            if self.args.cmd and not sent_cmd and self.send(json.loads(self.args.cmd) | {"id": "cli%d" % int(now)}):
+                sent_cmd = True
+            if self.key and now >= next_ping:
+                n += 1
+                self.ping(n)
+                next_ping = now + self.args.ping_interval
+            if self.key:
+                self.drain_acks()
+            else:
+                time.sleep(0.2)
+            if now >= next_report:
+                self.report()
+                next_report = now + self.args.report
+            if on_tick:
+                on_tick()
+        stop.set()
+        t.join(1)
+        if self.key:
+            self.drain_acks()
+        self.report(final=True)
+
+    def report(self, final=False):
+        with self.lock:
+            base = min(self.offsets) if self.offsets else 0
+            jitter = [o - base for o in self.offsets]
+            last = self.last
+            line = "pkts %d gaps %d reboots %d" % (self.packets, self.gaps, self.reboots)
+        if jitter:
+            line += " | one-way +p50 %.1f p95 %.1f max %.1f ms" % (
+                percentile(jitter, 50), percentile(jitter, 95), max(jitter))
+        if self.rtts:
+            line += " | rtt p50 %.1f p95 %.1f p99 %.1f ms (n=%d, lost %d)" % (
+                percentile(self.rtts, 50), percentile(self.rtts, 95), percentile(self.rtts, 99),
+                len(self.rtts), len(self.pending))
+        if last and not final:
+            flags = ",".join(name for bit, name in FLAGS.items() if last["flags"] & bit) or "-"
+            line += " | %.1f°C (raw %.1f) limit %d power %d%% cycle %d [%s]" % (
+                last["temp"], last["raw"], last["limit"], last["power"], last["cycle"], flags)
+        print(("summary: " if final else "") + line)
+
+
+class FakeDevice:
+    """Spiegelt LanLink: Telemetrie mit Rate-Cap, HMAC + bootId + Counter, Ack per Unicast."""
+
+    def __init__(self, key, port, ctl_port, hz=10):
+        self.key = key
+        self.boot = int.from_bytes(os.urandom(4), "little") | 1
+        self.port = port
+        self.hz = hz
+        self.seq = 0
+        self.last_counter = 0
+        self.stats = {"authFailed": 0, "replayed": 0, "executed": 0}
+        self.start = time.time()
+        self.sock = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+        self.sock.bind(("127.0.0.1", ctl_port))
+        self.sock.settimeout(0.01)
+        self.stop = threading.Event()
+
+    def ms(self):
+        return int((time.time() - self.start) * 1000) & 0xFFFFFFFF
+
+    def authenticate(self, frame):
+        if len(frame) <= CONTROL.size + TAG_LEN:
+            return None
+        head, tag, body = frame[:CONTROL.size], frame[CONTROL.size:CONTROL.size + TAG_LEN], frame[CONTROL.size + TAG_LEN:]
+        magic, version, _, boot, counter = CONTROL.unpack(head)
+        if magic != b"HC" or version != FORMAT or boot != self.boot:
+            return None
+        mac = hmac.new(self.key, head + body, hashlib.sha256).digest()[:TAG_LEN]
+        if not hmac.compare_digest(mac, tag):
+            return None
+        return counter, body
+
+    def loop(self):
+        next_send = time.time()
+        while not self.stop.is_set():
+            if time.time() >= next_send:
+                self.seq += 1
+                pkt = PACKET.pack(b"HB", FORMAT, 0x08, self.boot, self.seq, self.ms(),
+                                  1874, 1812, 200, 100, 1, 12)
+                self.sock.sendto(pkt, ("127.0.0.1", self.port))
+                next_send += 1 / self.hz
+            try:
+                frame, addr = self.sock.recvfrom(256)
+            except socket.timeout:
+                continue
+            res = self.authenticate(frame)
+            if res is None:
+                self.stats["authFailed"] += 1
+                continue
+            counter, body = res
+            if counter <= self.last_counter:
+                self.stats["replayed"] += 1
+                continue
+            self.last_counter = counter
+            doc = json.loads(body)
+            ack = {"type": "cmdAck", "id": doc.get("id"), "ok": True}
+            if doc.get("cmd") == "ping":
+                ack["ms"] = self.ms()
+            else:
+                self.stats["executed"] += 1
+            self.sock.sendto(json.dumps(ack).encode(), addr)
+
+
+def selftest(args):
+    key = b"selftest-key"
+    args.key = key.decode()
+    args.group = "127.0.0.1"
+    args.device = "127.0.0.1"
+    args.ctl = 47499
+    dev = FakeDevice(key, args.port, args.ctl)
+    threading.Thread(target=dev.loop, daemon=True).start()
+    lis = Listener(args)
+
+    # Replay und falscher Schlüssel müssen abgewiesen werden
+    state = {"done": False}
+
+    def attacks():
+        if state["done"] or lis.boot is None:
+            return
+        state["done"] = True
+        good = control_frame(key, lis.boot, lis.next_counter(), {"cmd": "stop", "id": "s1"})
+        lis.ctl.sendto(good, ("127.0.0.1", args.ctl))
+        lis.ctl.sendto(good, ("127.0.0.1", args.ctl))   # Replay
+        bad = control_frame(b"wrong", lis.boot, lis.next_counter(), {"cmd": "start", "id": "s2"})
+        lis.ctl.sendto(bad, ("127.0.0.1", args.ctl))
+        stale = control_frame(key, lis.boot ^ 1, lis.next_counter(), {"cmd": "start", "id": "s3"})
+        lis.ctl.sendto(stale, ("127.0.0.1", args.ctl))  # alte bootId
+
+    lis.run(3, on_tick=attacks)
+    dev.stop.set()
+    ok = (lis.packets >= 20 and lis.gaps == 0 and len(lis.rtts) >= 2
+          and dev.stats == {"authFailed": 2, "replayed": 1, "executed": 1}
+          and [a.get("id") for a in lis.acks] == ["s1"])
+    print("selftest:", "ok" if ok else "FAILED", dev.stats)
+    return ok
+
+
+def main():
+    parser = argparse.ArgumentParser(description="LAN-Telemetrie/-Steuerung der Heizbox")
+    parser.add_argument("--group", default=GROUP)
+    parser.add_argument("--port", type=int, default=TELEMETRY_PORT)
+    parser.add_argument("--ctl", type=int, default=CONTROL_PORT, help="Steuerport (mDNS TXT ctl)")
+    parser.add_argument("--iface", default="0.0.0.0", help="lokale IP für den Multicast-Join")
+    parser.add_argument("--device", help="Geräte-IP (sonst Absender des ersten Pakets)")
+    parser.add_argument("--key", help="LAN_KEY aus credentials.h, aktiviert ping/--cmd")
+    parser.add_argument("--cmd", help='Befehl als JSON, z.B. \'{"cmd":"setTemp","temp":200}\'')
+    parser.add_argument("--ping-interval", type=float, default=0.5)
+    parser.add_argument("--report", type=float, default=5, help="Sekunden zwischen Zwischenständen")
+    parser.add_argument("--duration", type=float, default=30)
+    parser.add_argument("--selftest", action="store_true", help="gegen ein simuliertes Gerät auf localhost")
+    args = parser.parse_args()
+
+    if args.selftest:
+        args.report = 1
+        sys.exit(0 if selftest(args) else 1)
+    Listener(args).run(args.duration)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,193 @@
+#!/usr/bin/env python3
+"""
+Dekodiert Deferred-Logs (LOG_DEFERRED, siehe include/utils/Logger.h) mit Hilfe der firmware.elf.
+
+Der ESP32 speichert nur die Adressen von Typ- und Format-Literal plus die Rohargumente;
+die Strings selbst stehen in der ELF (.flash.rodata). Die ELF muss exakt zum Build passen:
+Dump und WebSocket-Records tragen die ersten 8 Byte des ELF-SHA256 (Build-ID), passt sie
+nicht zur angegebenen ELF, bricht das Skript ab (--force dekodiert trotzdem).
+
+    python scripts/logdecode.py .pio/build/esp32dev/firmware.elf dump.bin
+    python scripts/logdecode.py .pio/build/esp32dev/firmware.elf --url http://192.168.1.50/api/log/bin
+    python scripts/logdecode.py .pio/build/esp32dev/firmware.elf --hex 3f2a...:0b9c0118...   # logs-Tabelle (log_type 'bin')
+"""
+
+import argparse
+import hashlib
+import re
+import struct
+import sys
+import urllib.request
+
+ARG_UINT, ARG_INT, ARG_FLOAT, ARG_PTR = range(4)
+BUILD_ID_BYTES = 8
+
+# %[flags][width][.precision][length]conversion
+SPEC_RE = re.compile(r"%([-+ #0]*)(\d+|\*)?(\.\d+)?(hh|h|ll|l|z|j|t|L)?([diouxXcsfFeEgGaApn%])")
+
+
+class Elf:
+    """Minimaler ELF32-Leser (nur Section-Header), kommt ohne pyelftools aus."""
+
+    def __init__(self, path):
+        with open(path, "rb") as f:
+            self.data = f.read()
+        if self.data[:4] != b"\x7fELF" or self.data[4] != 1:
+            raise ValueError(f"{path}: keine ELF32-Datei")
+        # Wie esptool elf2image (--elf-sha256-offset) es in esp_app_desc_t::app_elf_sha256 schreibt
+        self.build_id = hashlib.sha256(self.data).digest()[:BUILD_ID_BYTES]
+        shoff, = struct.unpack_from("<I", self.data, 0x20)
+        shentsize, shnum = struct.unpack_from("<HH", self.data, 0x2E)
+        self.sections = []
+        for i in range(shnum):
+            _, sh_type, _, addr, offset, size = struct.unpack_from("<IIIIII", self.data, shoff + i * shentsize)
+            # SHT_PROGBITS mit Adresse: Inhalt liegt in der Datei
+            if sh_type == 1 and addr:
+                self.sections.append((addr, offset, size))
+
+    def string(self, addr):
+        for start, offset, size in self.sections:
+            if start <= addr < start + size:
+                begin = offset + addr - start
+                end = self.data.index(b"\0", begin)
+                return self.data[begin:end].decode("utf-8", errors="replace")
+        return None
+
+
+class Reader:
+    def __init__(self, data):
+        self.data = data
+        self.pos = 0
+
+    def done(self):
+        return self.pos >= len(self.data)
+
+    def u8(self):
+        if self.pos >= len(self.data):
+            raise ValueError("unerwartetes Ende des Records")
+        b = self.data[self.pos]
+        self.pos += 1
+        return b
+
+    def u32(self):
+        return self.u8() | self.u8() << 8 | self.u8() << 16 | self.u8() << 24
+
+    def varint(self):
+        value = 0
+        for shift in range(0, 35, 7):
+            b = self.u8()
+            value |= (b & 0x7F) << shift
+            if not b & 0x80:
+                return value
+        raise ValueError("varint zu lang")
+
+
+def to_signed(v):
+    return v - (1 << 32) if v & 0x80000000 else v
+
+
+def render(elf, fmt, args):
+    args = list(args)
+
+    def conv(m):
+        flags, width, precision, _, c = m.groups()
+        if c == "%":
+            return "%"
+        if not args:
+            return "?"
+        tag, value = args.pop(0)
+        spec = "%" + (flags or "") + (width or "") + (precision or "")
+        if tag == ARG_FLOAT:
+            value = struct.unpack("<f", struct.pack("<I", value))[0]
+            return (spec + (c if c in "fFeEgGaA" else "g")) % value
+        if c == "s":
+            text = elf.string(value) if tag == ARG_PTR else None
+            return (spec + "s") % (text if text is not None else f"<0x{value:08x}>")
+        if c == "p":
+            return f"0x{value:08x}"
+        if tag == ARG_INT:
+            value = (value >> 1) ^ -(value & 1)
+        elif c in "di":
+            value = to_signed(value)
+        if c in "fFeEgGaA":
+            return (spec + c) % value
+        if c == "c":
+            return chr(value & 0xFF)
+        return (spec + ("d" if c in "diu" else c)) % value
+
+    return SPEC_RE.sub(conv, fmt)
+
+
+def decode_record(elf, rec):
+    r = Reader(rec)
+    ts = r.varint()
+    fmt_addr = r.u32()
+    type_addr = r.u32()
+    args = []
+    while not r.done():
+        tag = r.u8()
+        args.append((tag, r.varint()))
+    fmt = elf.string(fmt_addr)
+    log_type = elf.string(type_addr) or "?"
+    if fmt is None:
+        return ts, log_type, f"<fmt 0x{fmt_addr:08x} nicht in der ELF - falscher Build?> {args}"
+    return ts, log_type, render(elf, fmt, args)
+
+
+def split_records(data):
+    """[u8 len][Record]... -> Liste von Records"""
+    records = []
+    pos = 0
+    while pos < len(data):
+        n = data[pos]
+        records.append(data[pos + 1:pos + 1 + n])
+        pos += 1 + n
+    return records
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Heizbox Deferred-Logs dekodieren")
+    parser.add_argument("elf", help="firmware.elf des laufenden Builds")
+    parser.add_argument("dump", nargs="?", help="Datei aus /api/log/bin")
+    parser.add_argument("--url", help="/api/log/bin direkt vom Gerät laden")
+    parser.add_argument("--hex", help="Records als <build>:<hex> (WebSocket, logs-Tabelle)")
+    parser.add_argument("--force", action="store_true", help="auch bei abweichender Build-ID dekodieren")
+    args = parser.parse_args()
+
+    elf = Elf(args.elf)
+    if args.hex:
+        build, _, records = args.hex.rpartition(":")
+        build_id = bytes.fromhex(build) if build else None
+        data = bytes.fromhex(records)
+    else:
+        if args.url:
+            with urllib.request.urlopen(args.url, timeout=10) as resp:
+                data = resp.read()
+        elif args.dump:
+            with open(args.dump, "rb") as f:
+                data = f.read()
+        else:
+            parser.error("dump, --url oder --hex angeben")
+        if data[:2] != b"HL" or data[2] != 2:
+            sys.exit("Kein Deferred-Log-Dump (Header 'HL' v2 erwartet)")
+        build_id = data[3:3 + BUILD_ID_BYTES]
+        data = data[3 + BUILD_ID_BYTES:]
+
+    if build_id is None:
+        print("Warnung: keine Build-ID, ELF kann nicht geprüft werden", file=sys.stderr)
+    elif build_id != elf.build_id:
+        msg = f"Build-ID {build_id.hex()} passt nicht zur ELF ({elf.build_id.hex()})"
+        if not args.force:
+            sys.exit(msg + " - richtige firmware.elf angeben oder --force")
+        print("Warnung: " + msg, file=sys.stderr)
+
+    for rec in split_records(data):
+        try:
+            ts, log_type, text = decode_record(elf, rec)
+            print(f"{ts:>10} [{log_type}] {text}")
+        except ValueError as e:
+            print(f"{'?':>10} [?] kaputter Record ({e}): {rec.hex()}")
+
+
+if __name__ == "__main__":
+    main()
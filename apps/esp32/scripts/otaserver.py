@@ -0,0 +1,171 @@
+#!/usr/bin/env python3
+"""
+Lokaler Stand-in für firmware.json + Image, um den FirmwareUpdater ohne Backend zu testen.
+
+Liefert /firmware.json (inkl. size und sha256) und das Image mit Range-Support. Zum Testen
+von Resume und Verifikation lassen sich Abbrüche und kaputte Bytes einstreuen:
+
+    python scripts/otaserver.py .pio/build/esp32dev/firmware.bin --version 9.9.9
+    python scripts/otaserver.py firmware.bin --drop-every 200000     # Verbindung alle 200 kB kappen
+    python scripts/otaserver.py firmware.bin --no-range              # Server ohne Range (200 statt 206)
+    python scripts/otaserver.py firmware.bin --corrupt 4096          # ein Byte kippen -> SHA-256 mismatch
+
+In der credentials.h dann API_ENDPOINT auf "http://<host-ip>:8080" setzen.
+Ohne Gerät: --selftest lädt mit Abbrüchen per Range und prüft den Hash wie die Firmware.
+Den Resume/Verify-Automat der Firmware selbst prüft test/test_firmware_updater (pio test -e native).
+"""
+
+import argparse
+import hashlib
+import http.client
+import json
+import re
+import sys
+import threading
+from http.server import BaseHTTPRequestHandler, ThreadingHTTPServer
+
+RANGE_RE = re.compile(r"bytes=(\d+)-(\d*)$")
+
+
+def make_handler(image, manifest, args):
+    sent_total = [0]  # über alle Requests, für --drop-every
+
+    class Handler(BaseHTTPRequestHandler):
+        protocol_version = "HTTP/1.0"
+
+        def log_message(self, fmt, *a):
+            if not args.quiet:
+                sys.stderr.write("%s %s\n" % (self.address_string(), fmt % a))
+
+        def do_HEAD(self):
+            self.do_GET(body=False)
+
+        def do_GET(self, body=True):
+            if self.path == "/firmware.json":
+                data = json.dumps(manifest).encode()
+                self.send_response(200)
+                self.send_header("Content-Type", "application/json")
+                self.send_header("Content-Length", str(len(data)))
+                self.end_headers()
+                if body:
+                    self.wfile.write(data)
+                return
+            if self.path != manifest["url"]:
+                self.send_error(404)
+                return
+
+            start, end = 0, len(image) - 1
+            m = RANGE_RE.match(self.headers.get("Range", ""))
+            if m and not args.no_range:
+                start = int(m.group(1))
+                if m.group(2):
+                    end = min(int(m.group(2)), end)
+                if start > end:
+                    self.send_response(416)
+                    self.send_header("Content-Range", "bytes */%d" % len(image))
+                    self.end_headers()
+                    return
+                self.send_response(206)
+                self.send_header("Content-Range", "bytes %d-%d/%d" % (start, end, len(image)))
+            else:
+                self.send_response(200)
+            self.send_header("Content-Type", "application/octet-stream")
+            self.send_header("Content-Length", str(end - start + 1))
+            self.send_header("Accept-Ranges", "none" if args.no_range else "bytes")
+            self.end_headers()
+            if not body:
+                return
+
+            pos = start
+            while pos <= end:
+                chunk = image[pos:min(pos + 4096, end + 1)]
+                if args.drop_every:
+                    budget = args.drop_every - sent_total[0] % args.drop_every
+                    if len(chunk) >= budget:
+                        self.wfile.write(chunk[:budget])
+                        sent_total[0] += budget
+                        self.log_message("drop at %d", pos + budget)
+                        self.close_connection = True
+                        return
+                self.wfile.write(chunk)
+                sent_total[0] += len(chunk)
+                pos += len(chunk)
+
+    return Handler
+
+
+def selftest(port, manifest):
+    """Lädt wie FirmwareUpdater::fetch(): ab Offset weiter, bei 200 den Anfang überspringen."""
+    sha = hashlib.sha256()
+    written = 0
+    attempts = 0
+    while written < manifest["size"]:
+        conn = http.client.HTTPConnection("127.0.0.1", port, timeout=5)
+        headers = {"Range": "bytes=%d-" % written} if written else {}
+        conn.request("GET", manifest["url"], headers=headers)
+        resp = conn.getresponse()
+        skip = written if resp.status == 200 else 0
+        if resp.status not in (200, 206):
+            sys.exit("selftest: HTTP %d" % resp.status)
+        before = written
+        while written < manifest["size"]:
+            try:
+                data = resp.read(1024)
+            except (http.client.IncompleteRead, ConnectionError):
+                break
+            if not data:
+                break
+            if skip:
+                n = min(skip, len(data))
+                skip -= n
+                data = data[n:]
+            sha.update(data)
+            written += len(data)
+        conn.close()
+        attempts = 1 if written > before else attempts + 1
+        if attempts > 5:
+            sys.exit("selftest: no progress at %d" % written)
+        if written < manifest["size"]:
+            print("selftest: resume at %d" % written)
+    ok = sha.hexdigest() == manifest["sha256"]
+    print("selftest: %d bytes, sha256 %s" % (written, "ok" if ok else "MISMATCH"))
+    return ok
+
+
+def main():
+    parser = argparse.ArgumentParser(description="firmware.json/Image-Server für OTA-Tests")
+    parser.add_argument("image", help="firmware.bin")
+    parser.add_argument("--version", default="99.0.0", help="Version in firmware.json (höher als die laufende)")
+    parser.add_argument("--port", type=int, default=8080)
+    parser.add_argument("--drop-every", type=int, default=0, metavar="BYTES", help="Verbindung nach je BYTES kappen")
+    parser.add_argument("--no-range", action="store_true", help="Range-Header ignorieren")
+    parser.add_argument("--corrupt", type=int, metavar="OFFSET", help="Byte an OFFSET kippen (Hash bleibt der des Originals)")
+    parser.add_argument("--selftest", action="store_true", help="einmal lokal laden und prüfen, dann beenden")
+    parser.add_argument("--quiet", action="store_true")
+    args = parser.parse_args()
+
+    with open(args.image, "rb") as f:
+        image = bytearray(f.read())
+    manifest = {
+        "version": args.version,
+        "url": "/firmware-%s.bin" % args.version,
+        "size": len(image),
+        "sha256": hashlib.sha256(image).hexdigest(),
+    }
+    if args.corrupt is not None:
+        image[args.corrupt] ^= 0xFF
+    image = bytes(image)
+
+    server = ThreadingHTTPServer(("", args.port), make_handler(image, manifest, args))
+    print(json.dumps(manifest, indent=2))
+    if args.selftest:
+        threading.Thread(target=server.serve_forever, daemon=True).start()
+        ok = selftest(server.server_address[1], manifest)
+        server.shutdown()
+        sys.exit(0 if ok != (args.corrupt is not None) else 1)
+    print("Serving on :%d" % args.port)
+    server.serve_forever()
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,482 @@
+#!/usr/bin/env python3
+"""
+Lokaler Stand-in für das Backend (/ws) plus Szenario-Runner, um WebSocketManager ohne
+Cloudflare zu belasten. Keine Abhängigkeiten außer der Standardbibliothek.
+
+Spricht dasselbe Protokoll wie DeviceStatus.ts: hello/bin-Aushandlung, Acks
+({"success":true,"seq":n}), JSON- und Binär-Telemetrie (TelemetryCodec v1), Log-Batches.
+
+    python scripts/wsmock.py --port 80                          # nur mitschneiden
+    python scripts/wsmock.py --port 80 --scenario all --device http://192.168.1.50
+
+Die Firmware verbindet sich immer auf Port 80 (NetworkConfig::BACKEND_WS_URL auf die IP
+des Rechners setzen, z.B. "ws://192.168.1.20/ws"). Mit --device werden vor/nach jeder
+Phase die Queue-Zähler aus /api/status gelesen (wsQueue, log, outbox).
+
+Szenarien (--scenario, kommagetrennt oder "all"):
+    idle     Baseline: nur empfangen und acken
+    burst    sessionData-Bursts an das Gerät (--burst N Nachrichten alle --burst-every s)
+    slow     langsamer Konsument: --slow s lang nichts vom Socket lesen (TCP-Fenster läuft voll)
+    cut      Verbindung mitten in einem Frame abbrechen, Reconnect-Zeit messen
+    json     Binärformat ablehnen (hello bin=0), JSON-Pfad messen
+"""
+
+import argparse
+import asyncio
+import base64
+import hashlib
+import json
+import struct
+import sys
+import time
+import urllib.request
+from collections import Counter
+
+WS_GUID = "258EAFA5-E914-47DA-95CA-C5AB0DC11B85"
+OP_CONT, OP_TEXT, OP_BIN, OP_CLOSE, OP_PING, OP_PONG = 0x0, 0x1, 0x2, 0x8, 0x9, 0xA
+
+TELEMETRY_VERSION = 1
+RECORD_NAMES = {1: "heartbeat", 2: "statusUpdate", 3: "heatCycleCompleted", 4: "sessionUpdate",
+                5: "tempReading", 6: "tempBatch", 8: "logRecords"}
+
+
+# ============================================================================
+# Binär-Telemetrie (Spiegel von apps/backend/src/utils/telemetry.ts, nur zum Zählen)
+# ============================================================================
+
+class Reader:
+    def __init__(self, data):
+        self.data = data
+        self.pos = 0
+
+    def u8(self):
+        if self.pos >= len(self.data):
+            raise ValueError("unexpected end of frame")
+        b = self.data[self.pos]
+        self.pos += 1
+        return b
+
+    def varint(self):
+        value = 0
+        for shift in range(0, 35, 7):
+            b = self.u8()
+            value |= (b & 0x7F) << shift
+            if not b & 0x80:
+                return value
+        raise ValueError("varint too long")
+
+    def skip(self, n):
+        for _ in range(n):
+            self.u8()
+
+
+def decode_frame(data):
+    """-> Liste (typ, seq|None); wirft ValueError bei kaputten Frames"""
+    r = Reader(data)
+    if r.u8() != TELEMETRY_VERSION:
+        raise ValueError("unsupported version")
+    out = []
+    seq = None
+    while r.pos < len(data):
+        t = r.u8()
+        if t == 7:  # EVENT_META: seq, at, dann der eigentliche Record
+            seq = r.varint()
+            r.varint()
+            continue
+        if t == 1:
+            pass
+        elif t == 2:
+            r.u8()
+        elif t == 3:
+            r.varint()
+            r.u8()
+        elif t == 4:
+            r.varint()
+            r.varint()
+        elif t == 5:
+            r.u8()
+            r.varint()
+            r.varint()
+        elif t == 6:
+            count = r.varint()
+            r.varint()
+            for _ in range(count):
+                flags = r.u8()
+                if flags & 0x08:
+                    r.u8()
+                r.varint()
+                r.varint()
+                r.varint()
+        elif t == 8:
+            r.skip(r.varint())
+        else:
+            raise ValueError("unknown record type %d" % t)
+        out.append((RECORD_NAMES[t], seq))
+        seq = None
+    return out
+
+
+# ============================================================================
+# Minimaler RFC-6455-Server
+# ============================================================================
+
+class ConnectionClosed(Exception):
+    pass
+
+
+class Connection:
+    def __init__(self, reader, writer, path):
+        self.reader = reader
+        self.writer = writer
+        self.path = path
+        self.opened = time.monotonic()
+
+    async def recv(self):
+        """-> (opcode, payload) einer vollständigen Nachricht; Ping wird beantwortet"""
+        message = bytearray()
+        message_op = None
+        while True:
+            try:
+                head = await self.reader.readexactly(2)
+                fin, op = head[0] & 0x80, head[0] & 0x0F
+                masked, n = head[1] & 0x80, head[1] & 0x7F
+                if n == 126:
+                    n, = struct.unpack(">H", await self.reader.readexactly(2))
+                elif n == 127:
+                    n, = struct.unpack(">Q", await self.reader.readexactly(8))
+                mask = await self.reader.readexactly(4) if masked else b"\0\0\0\0"
+                payload = bytearray(await self.reader.readexactly(n))
+            except (asyncio.IncompleteReadError, ConnectionError):
+                raise ConnectionClosed()
+            for i in range(n):
+                payload[i] ^= mask[i & 3]
+
+            if op == OP_PING:
+                await self.send(bytes(payload), OP_PONG)
+                continue
+            if op == OP_PONG:
+                continue
+            if op == OP_CLOSE:
+                raise ConnectionClosed()
+            if op != OP_CONT:
+                message_op = op
+            message += payload
+            if fin:
+                return message_op, bytes(message)
+
+    @staticmethod
+    def frame(payload, op):
+        n = len(payload)
+        if n < 126:
+            head = struct.pack(">BB", 0x80 | op, n)
+        elif n < 65536:
+            head = struct.pack(">BBH", 0x80 | op, 126, n)
+        else:
+            head = struct.pack(">BBQ", 0x80 | op, 127, n)
+        return head + payload
+
+    async def send(self, payload, op=OP_TEXT):
+        if isinstance(payload, str):
+            payload = payload.encode()
+        try:
+            self.writer.write(self.frame(payload, op))
+            await self.writer.drain()
+        except ConnectionError:
+            raise ConnectionClosed()
+
+    async def send_json(self, obj):
+        await self.send(json.dumps(obj, separators=(",", ":")))
+
+    def cut_mid_frame(self, payload):
+        """Header + halber Payload, dann RST-artig schließen"""
+        data = self.frame(payload.encode(), OP_TEXT)
+        self.writer.write(data[:len(data) // 2])
+        self.writer.transport.abort()
+
+
+async def handshake(reader, writer):
+    request = await reader.readuntil(b"\r\n\r\n")
+    lines = request.decode(errors="replace").split("\r\n")
+    path = lines[0].split(" ")[1] if " " in lines[0] else "/"
+    headers = {}
+    for line in lines[1:]:
+        if ":" in line:
+            k, v = line.split(":", 1)
+            headers[k.strip().lower()] = v.strip()
+    key = headers.get("sec-websocket-key")
+    if not key:
+        writer.write(b"HTTP/1.1 400 Bad Request\r\nContent-Length: 0\r\n\r\n")
+        await writer.drain()
+        writer.close()
+        return None
+    accept = base64.b64encode(hashlib.sha1((key + WS_GUID).encode()).digest()).decode()
+    writer.write(("HTTP/1.1 101 Switching Protocols\r\n"
+                  "Upgrade: websocket\r\nConnection: Upgrade\r\n"
+                  "Sec-WebSocket-Accept: %s\r\n\r\n" % accept).encode())
+    await writer.drain()
+    return Connection(reader, writer, path)
+
+
+# ============================================================================
+# Mock-Backend
+# ============================================================================
+
+class Stats:
+    def __init__(self):
+        self.reset()
+
+    def reset(self):
+        self.started = time.monotonic()
+        self.frames = 0
+        self.bytes = 0
+        self.types = Counter()
+        self.acked = 0
+        self.bad = 0
+
+    def report(self):
+        dt = max(time.monotonic() - self.started, 1e-6)
+        types = ", ".join("%s=%d" % kv for kv in sorted(self.types.items()))
+        return "%.1fs  %d frames (%.1f/s)  %d B (%.0f B/s)  acks=%d bad=%d  [%s]" % (
+            dt, self.frames, self.frames / dt, self.bytes, self.bytes / dt, self.acked, self.bad, types)
+
+
+class MockBackend:
+    def __init__(self, args):
+        self.args = args
+        self.conn = None
+        self.connected = asyncio.Event()
+        self.stats = Stats()
+        self.accept_binary = True
+        self.paused = asyncio.Event()
+        self.paused.set()
+        self.closed_at = None
+        self.reconnects = []
+        self.session = {"clicks": 0, "caps": 0, "consumption": 0.0, "consumptionTotal": 0.0,
+                        "consumptionYesterday": 0.0}
+
+    async def handle(self, reader, writer):
+        conn = await handshake(reader, writer)
+        if not conn:
+            return
+        if self.closed_at is not None:
+            self.reconnects.append(conn.opened - self.closed_at)
+            log("reconnect after %.2fs (%s)" % (self.reconnects[-1], conn.path))
+        else:
+            log("connected %s" % conn.path)
+        if self.conn:
+            self.conn.writer.close()
+        self.conn = conn
+        self.connected.set()
+
+        try:
+            await conn.send_json({"type": "statusUpdate", "isOn": True, "isHeating": False})
+            await conn.send_json({"type": "sessionData", **self.session})
+            while True:
+                await self.paused.wait()
+                op, payload = await conn.recv()
+                await self.on_message(conn, op, payload)
+        except ConnectionClosed:
+            pass
+        finally:
+            if self.conn is conn:
+                self.conn = None
+                self.connected.clear()
+                self.closed_at = time.monotonic()
+                log("disconnected")
+            conn.writer.close()
+
+    async def on_message(self, conn, op, payload):
+        self.stats.frames += 1
+        self.stats.bytes += len(payload)
+        if op == OP_BIN:
+            try:
+                records = decode_frame(payload)
+            except ValueError as e:
+                self.stats.bad += 1
+                log("bad binary frame: %s" % e)
+                return
+            for name, seq in records:
+                self.stats.types[name] += 1
+                if seq is not None or name != "logRecords":
+                    await self.ack(conn, seq)
+            return
+
+        try:
+            msg = json.loads(payload)
+        except ValueError:
+            self.stats.bad += 1
+            return
+        if "logs" in msg or "t" in msg:
+            self.stats.types["logs"] += 1
+            return
+        kind = msg.get("type", "?")
+        self.stats.types[kind] += 1
+        if kind == "hello":
+            bin_version = TELEMETRY_VERSION if self.accept_binary and msg.get("bin") == TELEMETRY_VERSION else 0
+            await conn.send_json({"type": "hello", "bin": bin_version})
+            return
+        if kind == "heatCycleCompleted":
+            self.session["clicks"] += 1
+            self.session["caps"] += msg.get("cycle", 1) == 1
+            await conn.send_json({"type": "sessionData", **self.session})
+        await self.ack(conn, msg.get("seq"))
+
+    async def ack(self, conn, seq):
+        self.stats.acked += 1
+        await conn.send_json({"success": True, "seq": seq} if seq is not None else {"success": True})
+
+    # ------------------------------------------------------------------------
+    # Szenarien
+    # ------------------------------------------------------------------------
+
+    async def phase(self, name, coro):
+        await self.connected.wait()
+        before = device_stats(self.args.device)
+        self.stats.reset()
+        log("--- %s" % name)
+        await coro
+        log("    %s" % self.stats.report())
+        after = device_stats(self.args.device)
+        if before and after:
+            log("    device: %s" % diff_device(before, after))
+
+    async def disconnected(self):
+        while self.connected.is_set():
+            await asyncio.sleep(0.05)
+
+    async def idle(self):
+        await asyncio.sleep(self.args.duration)
+
+    async def burst(self):
+        end = time.monotonic() + self.args.duration
+        sent = 0
+        while time.monotonic() < end:
+            conn = self.conn
+            if conn:
+                try:
+                    for _ in range(self.args.burst):
+                        self.session["consumption"] = round(self.session["consumption"] + 0.01, 2)
+                        await conn.send_json({"type": "sessionData", **self.session})
+                        sent += 1
+                except ConnectionClosed:
+                    pass
+            await asyncio.sleep(self.args.burst_every)
+        log("    sent %d sessionData" % sent)
+
+    async def slow(self):
+        self.paused.clear()
+        log("    not reading for %.1fs" % self.args.slow)
+        await asyncio.sleep(self.args.slow)
+        self.paused.set()
+        await asyncio.sleep(self.args.duration)
+
+    async def cut(self):
+        for i in range(self.args.cuts):
+            await self.connected.wait()
+            await asyncio.sleep(2)
+            if self.conn:
+                log("    cut %d/%d mid-frame" % (i + 1, self.args.cuts))
+                self.conn.cut_mid_frame(json.dumps({"type": "sessionData", **self.session}))
+                await self.disconnected()
+            try:
+                await asyncio.wait_for(self.connected.wait(), timeout=self.args.reconnect_timeout)
+            except asyncio.TimeoutError:
+                log("    no reconnect within %ds" % self.args.reconnect_timeout)
+                return
+        if self.reconnects:
+            recent = self.reconnects[-self.args.cuts:]
+            log("    reconnect min/avg/max %.2f/%.2f/%.2fs" % (
+                min(recent), sum(recent) / len(recent), max(recent)))
+
+    async def json_only(self):
+        # Neue Aushandlung erzwingen: Verbindung schließen, beim nächsten hello bin=0
+        self.accept_binary = False
+        if self.conn:
+            self.conn.writer.transport.abort()
+            await self.disconnected()
+        await asyncio.wait_for(self.connected.wait(), timeout=self.args.reconnect_timeout)
+        self.stats.reset()
+        await asyncio.sleep(self.args.duration)
+        self.accept_binary = True
+
+    async def run(self, scenarios):
+        table = {"idle": self.idle, "burst": self.burst, "slow": self.slow, "cut": self.cut, "json": self.json_only}
+        log("waiting for device...")
+        for name in scenarios:
+            await self.phase(name, table[name]())
+        if self.conn:
+            self.conn.writer.close()
+            await self.disconnected()
+
+
+# ============================================================================
+# Gerätezähler aus dem DebugServer
+# ============================================================================
+
+def device_stats(url):
+    if not url:
+        return None
+    try:
+        with urllib.request.urlopen(url.rstrip("/") + "/api/status", timeout=3) as resp:
+            return json.load(resp)
+    except (OSError, ValueError) as e:
+        log("    device status failed: %s" % e)
+        return None
+
+
+def diff_device(before, after):
+    parts = []
+    for prio, q in after.get("wsQueue", {}).items():
+        b = before.get("wsQueue", {}).get(prio, {})
+        parts.append("%s sent+%d coalesced+%d dropped+%d" % (
+            prio, q.get("sent", 0) - b.get("sent", 0), q.get("coalesced", 0) - b.get("coalesced", 0),
+            q.get("dropped", 0) - b.get("dropped", 0)))
+    for key in ("dropped", "wsDropped"):
+        delta = after.get("log", {}).get(key, 0) - before.get("log", {}).get(key, 0)
+        parts.append("log.%s+%d" % (key, delta))
+    parts.append("outbox.pending=%d" % after.get("outbox", {}).get("pending", 0))
+    parts.append("heap=%skB" % after.get("heap", "?"))
+    return ", ".join(parts)
+
+
+def log(text):
+    print("%8.1f %s" % (time.monotonic() - START, text), flush=True)
+
+
+START = time.monotonic()
+
+
+async def main():
+    parser = argparse.ArgumentParser(description="Mock-Backend und Lastgenerator für das Geräte-WebSocket-Protokoll")
+    parser.add_argument("--port", type=int, default=8080, help="Firmware nutzt Port 80")
+    parser.add_argument("--scenario", default="", help="idle,burst,slow,cut,json oder all (leer = nur mitschneiden)")
+    parser.add_argument("--device", help="http://<ip> des Geräts für Queue-Zähler")
+    parser.add_argument("--duration", type=float, default=20, help="Sekunden pro Phase")
+    parser.add_argument("--burst", type=int, default=20, help="sessionData pro Burst")
+    parser.add_argument("--burst-every", type=float, default=0.5)
+    parser.add_argument("--slow", type=float, default=15, help="Sekunden ohne Lesen")
+    parser.add_argument("--cuts", type=int, default=3)
+    parser.add_argument("--reconnect-timeout", type=int, default=60)
+    args = parser.parse_args()
+
+    scenarios = [s for s in args.scenario.split(",") if s]
+    if scenarios == ["all"]:
+        scenarios = ["idle", "burst", "slow", "cut", "json"]
+
+    backend = MockBackend(args)
+    server = await asyncio.start_server(backend.handle, "", args.port)
+    log("listening on :%d" % args.port)
+    async with server:
+        if not scenarios:
+            while True:
+                await asyncio.sleep(args.duration)
+                if backend.conn:
+                    log(backend.stats.report())
+        await backend.run(scenarios)
+
+
+if __name__ == "__main__":
+    try:
+        asyncio.run(main())
+    except KeyboardInterrupt:
+        sys.exit(0)
@@ -5,26 +5,30 @@
 #include "ui/DeviceUI.h"
 #include "heater/HeaterController.h"
 #include "driver/Audio.h"
+#include "driver/I2cBus.h"
 #include "services/DebugServer.h"
+#include "services/TelemetryStream.h"
+#include "utils/Logger.h"
 
-#include <Wire.h>
 #include <utility>
 
 #include <SysModule.h>
 #include <Task.h>
 
-Device::Device(): heater(), ui(heater), network() {
+Device::Device(): heater(), ui(heater), network(), commands(heater) {
 }
 
 void Device::setup() {
     Serial.begin(115200);
-    Wire.begin(HardwareConfig::SDA_PIN, HardwareConfig::SCL_PIN);
+    logBegin();
+    I2cBus::instance().begin(HardwareConfig::SDA_PIN, HardwareConfig::SCL_PIN);
 
     if (!DebugFlags::LOG_BOOT) disableModuleLogging();
 
     initNVS();
     network.init(WIFI_SSID, WIFI_PASSWORD, NetworkConfig::HOSTNAME);
     heater.init();
+    commands.init();
     ui.init();
 
     StateBinder::bindAll(&ui, &heater);
@@ -59,11 +63,13 @@ void Device::setup() {
 }
 
 void Device::loop() {
+    const uint32_t start = micros();
     heater.update();
     network.update();
     ui.update();
 
     DebugServer::instance().update();
+    TelemetryStream::instance().onLoop(micros() - start);
 }
 
 
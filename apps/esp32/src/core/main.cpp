@@ -5,6 +5,7 @@
 // For safe mode
 #include "credentials.h"
 #include "driver/net/WiFiManager.h"
+#include "utils/Logger.h"
 #include <ArduinoOTA.h>
 
 Device device;
@@ -12,6 +13,7 @@ Device device;
 
 void safeMode() {
     Serial.begin(115200);
+    logBegin();
     Serial.println("Entering safe mode for OTA update...");
 
     pinMode(HardwareConfig::STATUS_LED_PIN, OUTPUT);
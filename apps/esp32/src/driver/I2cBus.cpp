@@ -0,0 +1,122 @@
+#include "driver/I2cBus.h"
+
+I2cBus& I2cBus::instance() {
+    static I2cBus instance;
+    return instance;
+}
+
+void I2cBus::begin(uint8_t sda, uint8_t scl) {
+    Wire.begin(sda, scl, CLOCK_HZ);
+    Wire.setTimeOut(TIMEOUT_MS);
+    if (!mutex) mutex = xSemaphoreCreateMutex();
+    windowStart = millis();
+}
+
+const char* I2cBus::priorityName(Priority prio) {
+    switch (prio) {
+        case Priority::SENSOR: return "sensor";
+        case Priority::INPUT: return "input";
+        case Priority::CONFIG: return "config";
+        default: return "?";
+    }
+}
+
+uint16_t I2cBus::utilisation() const {
+    // Ohne Transaktionen rollt das Fenster nicht weiter - dann ist der Bus eben frei
+    if (millis() - windowStart >= 2 * WINDOW_MS) return 0;
+    return utilPermille;
+}
+
+bool I2cBus::acquire(Priority prio) {
+    if (!mutex) return true;  // vor begin(): Setup, nur ein Task
+    const uint32_t t0 = micros();
+    bool ok = false;
+
+    switch (prio) {
+        case Priority::SENSOR:
+            portENTER_CRITICAL(&mux);
+            sensorWaiting++;
+            portEXIT_CRITICAL(&mux);
+            ok = xSemaphoreTake(mutex, pdMS_TO_TICKS(SENSOR_WAIT_MS)) == pdTRUE;
+            portENTER_CRITICAL(&mux);
+            sensorWaiting--;
+            portEXIT_CRITICAL(&mux);
+            break;
+
+        case Priority::INPUT:
+            // Nie warten: ein verschobener Port-Read holt der nächste Loop nach
+            ok = !sensorWaiting && xSemaphoreTake(mutex, 0) == pdTRUE;
+            break;
+
+        default: {
+            const uint32_t started = millis();
+            while (millis() - started < CONFIG_WAIT_MS) {
+                if (sensorWaiting) {
+                    vTaskDelay(1);
+                    continue;
+                }
+                if (xSemaphoreTake(mutex, 1) == pdTRUE) {
+                    ok = true;
+                    break;
+                }
+            }
+            break;
+        }
+    }
+
+    const uint32_t waited = micros() - t0;
+    portENTER_CRITICAL(&mux);
+    Stats& s = stats_[(uint8_t)prio];
+    if (!ok) s.deferred++;
+    else if (waited > s.maxWaitUs) s.maxWaitUs = waited;
+    portEXIT_CRITICAL(&mux);
+    return ok;
+}
+
+void I2cBus::release(Priority prio, uint32_t heldUs) {
+    const uint32_t now = millis();
+    portENTER_CRITICAL(&mux);
+    Stats& s = stats_[(uint8_t)prio];
+    s.transactions++;
+    s.busyUs += heldUs;
+    if (heldUs > s.maxHoldUs) s.maxHoldUs = heldUs;
+
+    windowBusyUs += heldUs;
+    const uint32_t elapsed = now - windowStart;
+    if (elapsed >= WINDOW_MS) {
+        // busyUs / (elapsed * 1000) * 1000
+        utilPermille = min<uint32_t>(windowBusyUs / elapsed, 1000);
+        windowBusyUs = 0;
+        windowStart = now;
+    }
+    portEXIT_CRITICAL(&mux);
+
+    if (mutex) xSemaphoreGive(mutex);
+}
+
+void I2cBus::count(Priority prio, uint32_t Stats::*field) {
+    portENTER_CRITICAL(&mux);
+    stats_[(uint8_t)prio].*field += 1;
+    portEXIT_CRITICAL(&mux);
+}
+
+// ============================================================================
+// Transaction
+// ============================================================================
+
+I2cBus::Transaction::Transaction(Priority prio) : prio(prio) {
+    held = I2cBus::instance().acquire(prio);
+    start = micros();
+}
+
+I2cBus::Transaction::~Transaction() {
+    if (held) I2cBus::instance().release(prio, micros() - start);
+}
+
+void I2cBus::Transaction::retry() {
+    I2cBus::instance().count(prio, &Stats::retries);
+}
+
+void I2cBus::Transaction::fail() {
+    I2cBus::instance().count(prio, &Stats::errors);
+}
@@ -12,7 +12,6 @@ ZVSDriver::ZVSDriver(uint8_t mosfetPin, uint8_t statusLedPin)
       currentPhase(Phase::OFF_IDLE),
       phaseStartTime(0),
       tempMeasureCallback(nullptr),
-      phaseChangeCallback(nullptr),
       tempMeasureCalled(false)
 {
     memset(&stats, 0, sizeof(stats));
@@ -144,7 +143,7 @@ void ZVSDriver::onTempMeasure(TempMeasureCallback callback) {
 }
 
 void ZVSDriver::onPhaseChange(PhaseChangeCallback callback) {
-    phaseChangeCallback = callback;
+    if (callback) phaseChangeCallbacks.push_back(std::move(callback));
 }
 
 
@@ -215,5 +214,5 @@ void ZVSDriver::transitionPhase(Phase newPhase) {
     currentPhase = newPhase;
     phaseStartTime = millis();
 
-    if (phaseChangeCallback) phaseChangeCallback(newPhase);
+    for (auto& callback : phaseChangeCallbacks) callback(newPhase);
 }
\ No newline at end of file
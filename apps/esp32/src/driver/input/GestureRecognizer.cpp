@@ -0,0 +1,72 @@
+#include "driver/input/GestureRecognizer.h"
+
+void GestureRecognizer::feed(const InputEvent& event, const Emit& emit) {
+    if (event.type == ROTARY_CW || event.type == ROTARY_CCW) {
+        emit(event);
+        return;
+    }
+
+    Button& b = buttons[event.button];
+    switch (event.type) {
+        case PRESS:
+            press(event, emit);
+            return;
+
+        case PRESSED:
+        case RELEASE:
+            b.down = false;
+            if (b.consumed) {
+                b.consumed = false;
+                return;
+            }
+            emit(event);
+            if (event.type == RELEASE) {
+                b.lastClickUs = 0;
+                return;
+            }
+            if (b.lastClickUs && event.us - b.lastClickUs <= timing.doubleClickMs * 1000u) {
+                b.lastClickUs = 0;
+                emit({DOUBLE_CLICK, event.button, 0, event.us});
+            } else {
+                b.lastClickUs = event.us;
+            }
+            return;
+
+        default:
+            if (!b.consumed) emit(event);
+            return;
+    }
+}
+
+void GestureRecognizer::press(const InputEvent& event, const Emit& emit) {
+    Button& b = buttons[event.button];
+    b.down = true;
+    b.consumed = false;
+    b.tier = 0;
+    b.downUs = event.us;
+
+    for (uint8_t i = 0; i <= ROTARY_ENCODER; i++) {
+        Button& other = buttons[i];
+        if (i == event.button || !other.down || other.consumed) continue;
+        if (event.us - other.downUs > timing.chordMs * 1000u) continue;
+
+        other.consumed = true;
+        b.consumed = true;
+        other.lastClickUs = 0;
+        b.lastClickUs = 0;
+        emit({CHORD, event.button, mask((InputButton)i) | mask(event.button), event.us});
+        return;
+    }
+    emit(event);
+}
+
+void GestureRecognizer::tick(uint32_t nowUs, const Emit& emit) {
+    for (uint8_t i = 0; i <= ROTARY_ENCODER; i++) {
+        Button& b = buttons[i];
+        if (!b.down || b.consumed) continue;
+        while (b.tier < LONG_PRESS_TIERS && nowUs - b.downUs >= timing.longPressMs[b.tier] * 1000u) {
+            b.tier++;
+            emit({LONG_PRESS, (InputButton)i, b.tier, b.downUs + timing.longPressMs[b.tier - 1] * 1000u});
+        }
+    }
+}
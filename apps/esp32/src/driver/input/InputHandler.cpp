@@ -1,12 +1,18 @@
 #include "driver/input/InputHandler.h"
 #include "utils/Logger.h"
 #include "core/DeviceState.h"
+#include "PhotonLatency.h"
 
 InputHandler::InputHandler(ScreenManager& screenManager)
     : screenManager(screenManager)
 {}
 
 void InputHandler::handleInput(InputEvent event) {
+    // Press-to-Photon: ab hier bis zum Ende des nächsten draw()
+    auto& latency = PhotonLatency::instance();
+    const ScreenType screenBefore = screenManager.getCurrentScreenType();
+    latency.inputBegin(event.us, event.type, (uint8_t)screenBefore, micros());
+
     /*auto& ds = DeviceState::instance();
     if (ds.display.flipOrientation) {
         switch (event.button) {
@@ -18,13 +24,7 @@ void InputHandler::handleInput(InputEvent event) {
         }
     }*/
 
-    const char* typeStr = (event.type == PRESS) ? "PRESS" :
-                     (event.type == PRESSED) ? "PRESSED" :
-                     (event.type == RELEASE) ? "RELEASE" : 
-                     (event.type == HOLD) ? "HOLD" :
-                     (event.type == HOLD_ONCE) ? "HOLD_ONCE" :
-                     (event.type == ROTARY_CW) ? "ROTARY_CW" :
-                     (event.type == ROTARY_CCW) ? "ROTARY_CCW" : "UNKNOWN";
+    const char* typeStr = inputEventTypeName(event.type);
 
     const char* btnStr = (event.button == UP) ? "UP" :
                     (event.button == DOWN) ? "DOWN" :
@@ -37,20 +37,19 @@ void InputHandler::handleInput(InputEvent event) {
     Serial.printf("Input: %s %s\n", btnStr, typeStr);
     if (debug) logPrint("Input", "%s %s\n", btnStr, typeStr);
 
-    // Handle global shortcuts
-    if (handleGlobalShortcuts(event)) return;
-
-    // Pass to screen manager
-    screenManager.handleInput(event);
+    // Handle global shortcuts, else pass to screen manager
+    if (!handleGlobalShortcuts(event)) screenManager.handleInput(event);
+    // Nur verbuchen, wenn ein Frame die Reaktion zeigt: Redraw angefordert oder Screen gewechselt
+    latency.inputHandled(micros(), screenManager.isDirty() || screenManager.getCurrentScreenType() != screenBefore);
 }
 
 bool InputHandler::handleGlobalShortcuts(InputEvent event) {
     const ScreenType currentScreen = screenManager.getCurrentScreenType();
 
     if (event.button == CENTER && event.type == HOLD_ONCE) {
-        ScreenType targetType = (currentScreen == ScreenType::FIRE)
-            ? ScreenType::MAIN_MENU : ScreenType::FIRE;
-        screenManager.switchScreen(targetType);
+        const bool toMenu = currentScreen == ScreenType::FIRE;
+        screenManager.switchScreen(toMenu ? ScreenType::MAIN_MENU : ScreenType::FIRE,
+                                   toMenu ? ScreenTransition::SLIDE_LEFT : ScreenTransition::SLIDE_RIGHT);
         return true;
     }
 
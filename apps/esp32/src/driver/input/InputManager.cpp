@@ -1,6 +1,7 @@
 #include "driver/input/InputManager.h"
 #include <Arduino.h>
 #include "Config.h"
+#include "driver/I2cBus.h"
 
 const InputManager::ButtonConfig InputManager::BUTTON_PINS[InputManager::NUM_BUTTONS] = {
     {7, ROTARY_ENCODER, ButtonSources::PCF},
@@ -12,48 +13,101 @@ const InputManager::ButtonConfig InputManager::BUTTON_PINS[InputManager::NUM_BUT
     {HardwareConfig::FIRE_BUTTON_PIN, FIRE, ButtonSources::ESP32_GPIO},
 };
 
-InputManager::InputManager(): callback(nullptr) {}
+InputStats InputManager::stats_;
 
-void InputManager::onTurn(long value) {
-    if (callback) callback({ROTARY_CW, ROTARY_ENCODER});
-}
+InputManager::InputManager(): callback(nullptr) {}
 
 void InputManager::setup() {
     // PCF8574 MIT expliziten I2C-Pins konstruieren!
     // Default-Ctor setzt _sda/_scl nicht -> begin() ruft Wire.begin(0,0)
     // -> I2C-Treiber re-init mit Muell-Pins -> Heap-Corruption + Panic
-    pcf8574 = new PCF8574(0x20, HardwareConfig::SDA_PIN, HardwareConfig::SCL_PIN);
-    pcf8574->begin();
+    pcf8574 = new PCF8574(InputConfig::PCF8574::ADDRESS, HardwareConfig::SDA_PIN, HardwareConfig::SCL_PIN);
+    {
+        I2cBus::Transaction tx(I2cBus::Priority::CONFIG);
+        pcf8574->begin();
+    }
 
     rotaryEncoder = new RotaryEncoder(InputConfig::RotaryEncoder::CLK, InputConfig::RotaryEncoder::DT);
-	rotaryEncoder->setEncoderType( EncoderType::HAS_PULLUP );
-	rotaryEncoder->setBoundaries( 1, 2, false );
-    rotaryEncoder->onTurned([ this ](long value) { 
-        if (callback) callback({ value  == 1 ? ROTARY_CCW : ROTARY_CW, ROTARY_ENCODER}); 
-    });
-    rotaryEncoder->begin();
+    rotaryEncoder->setStepsPerDetent(InputConfig::RotaryEncoder::STEPS_PER_DETENT);
+    rotaryEncoder->setGlitchFilterNs(InputConfig::RotaryEncoder::GLITCH_FILTER_NS);
+    rotaryEncoder->setAcceleration(InputConfig::RotaryEncoder::ACCEL_MIN_RATE,
+                                   InputConfig::RotaryEncoder::ACCEL_MAX_RATE,
+                                   InputConfig::RotaryEncoder::ACCEL_MAX_STEP);
+    if (!rotaryEncoder->begin()) Serial.println("⚠️ Rotary encoder: PCNT setup failed");
 
     for (uint8_t i = 0; i < NUM_BUTTONS; i++) {
         if (BUTTON_PINS[i].source == ButtonSources::PCF) pcf8574->pinMode(BUTTON_PINS[i].pin, INPUT);
         if (BUTTON_PINS[i].source == ButtonSources::ESP32_GPIO) pinMode(BUTTON_PINS[i].pin, INPUT_PULLUP);
     }
 
+    // INT ist Open-Drain und bleibt LOW, bis der Port gelesen wird.
+    // Achtung: Pin 25 ist auch HardwareConfig::SPEAKER_PIN (Audio ist deaktiviert).
+    pinMode(InputConfig::PCF8574::INT_PIN, INPUT_PULLUP);
+    attachInterruptArg(digitalPinToInterrupt(InputConfig::PCF8574::INT_PIN), onPcfInterrupt, this, FALLING);
+    readPcf(millis());
+
     Serial.println("🎮 InputManager initialized (PCF8574 + Rotary Encoder)");
 }
 
 
+void IRAM_ATTR InputManager::onPcfInterrupt(void* arg) {
+    auto* self = static_cast<InputManager*>(arg);
+    if (!self->pcfEdgeUs) self->pcfEdgeUs = micros();
+    self->pcfDirty = true;
+}
+
+void InputManager::pcfInterrupt() {
+    pcfDirty = true;
+}
+
+void InputManager::readPcf(uint32_t now) {
+    // Bus belegt oder Sensor wartet: pcfDirty bleibt stehen, der nächste Loop liest
+    I2cBus::Transaction tx(I2cBus::Priority::INPUT);
+    if (!tx) return;
+
+    pcfDirty = false;  // vor dem Lesen: eine Flanke währenddessen löst erneut aus
+    lastPcfRead = now;
+    // Direkt ein Byte statt pcf8574->digitalReadAll() (die Lib puffert Flanken bis zum
+    // nächsten Lesen). Ohne Antwort bleibt der letzte Zustand - keine Phantom-Presses.
+    const uint32_t edgeUs = pcfEdgeUs;
+    pcfEdgeUs = 0;
+    for (uint8_t attempt = 0; ; attempt++) {
+        if (Wire.requestFrom(InputConfig::PCF8574::ADDRESS, (uint8_t)1) == 1) {
+            pcfPort = Wire.read();
+            pcfPortUs = edgeUs ? edgeUs : micros();
+            return;
+        }
+        if (attempt >= 1) {
+            tx.fail();
+            return;
+        }
+        tx.retry();
+    }
+}
+
 void InputManager::update() {
     const uint32_t now = millis();
+    const uint32_t nowUs = micros();
+
+    // Ein Byte statt einer Transaktion pro Button: nur bei INT-Flanke, noch anliegendem
+    // INT (verpasste Flanke) oder als Fallback-Poll - der Bus bleibt frei für den MLX90614
+    if (pcfDirty || digitalRead(InputConfig::PCF8574::INT_PIN) == LOW ||
+        now - lastPcfRead >= InputConfig::PCF8574::UPDATE_MS) {
+        readPcf(now);
+    }
 
     // --- Normale Buttons ---
     for (uint8_t i = 0; i < NUM_BUTTONS; i++) {
         const auto& cfg = BUTTON_PINS[i];
         bool isLow;
+        uint32_t edgeUs;
 
         if (cfg.source == ButtonSources::PCF) {
-            isLow = pcf8574->digitalRead(cfg.pin, true) == LOW;
+            isLow = !(pcfPort & (1 << cfg.pin));
+            edgeUs = pcfPortUs;
         } else {
             isLow = digitalRead(cfg.pin) == LOW;
+            edgeUs = nowUs;
         }
 
         const bool wasPressed = isPressed(i);
@@ -65,7 +119,7 @@ void InputManager::update() {
             setHoldSent(i, false);
             pressTimes[i] = now;
             lastDebounce[i] = now;
-            if (callback) callback({PRESS, cfg.button});
+            push({PRESS, cfg.button, 0, edgeUs});
 
         } else if (!isLow && wasPressed) {
             // --- RELEASE ---
@@ -73,11 +127,7 @@ void InputManager::update() {
             lastDebounce[i] = now;
 
             // RELEASE nur senden, wenn HOLD getriggert wurde
-            if (isHoldSent(i) && callback) {
-               callback({RELEASE, cfg.button});
-            } else if (callback) {
-                callback({PRESSED, cfg.button});
-            }
+            push({isHoldSent(i) ? RELEASE : PRESSED, cfg.button, 0, edgeUs});
 
             // Reset Hold-Flag, damit erneutes Halten wieder funktioniert
             setHoldSent(i, false);
@@ -85,16 +135,66 @@ void InputManager::update() {
             // --- HOLD ---
             setHoldSent(i, true);
             lastHoldStep[i] = now;
-            if (callback) callback({HOLD_ONCE, cfg.button});
-            if (callback) callback({HOLD, cfg.button});
+            push({HOLD_ONCE, cfg.button, 0, nowUs});
+            push({HOLD, cfg.button, 0, nowUs});
         } else if (isLow && wasPressed && isHoldSent(i)) {
             // --- HOLDING ---
             if (now - lastHoldStep[i] >= InputConfig::HOLDING_INTERVAL_MS) {
                 lastHoldStep[i] = now;
-                if (callback) callback({HOLD, cfg.button});
+                push({HOLD, cfg.button, 0, nowUs});
             }
         }
     }
+
+    // --- Encoder: PCNT pollen, ein Event pro Rastung, value = Schrittweite ---
+    const auto turn = rotaryEncoder->update(now);
+    for (int n = abs(turn.detents); n > 0; n--) {
+        push({turn.detents > 0 ? ROTARY_CW : ROTARY_CCW, ROTARY_ENCODER, turn.step, nowUs});
+    }
+
+    // Zustellen: Roh-Events durch den Gesten-Erkenner, dann an den Handler
+    const auto emit = [this](const InputEvent& event) { dispatch(event); };
+    InputEvent event;
+    while (pop(event)) recognizer.feed(event, emit);
+    recognizer.tick(micros(), emit);
+}
+
+void InputManager::push(const InputEvent& event) {
+    portENTER_CRITICAL(&queueMux);
+    if (queueCount < InputConfig::QUEUE_SIZE) {
+        queue[(queueHead + queueCount) % InputConfig::QUEUE_SIZE] = event;
+        queueCount++;
+    } else {
+        stats_.dropped++;
+    }
+    portEXIT_CRITICAL(&queueMux);
+}
+
+bool InputManager::pop(InputEvent& event) {
+    portENTER_CRITICAL(&queueMux);
+    const bool ok = queueCount > 0;
+    if (ok) {
+        event = queue[queueHead];
+        queueHead = (queueHead + 1) % InputConfig::QUEUE_SIZE;
+        queueCount--;
+    }
+    portEXIT_CRITICAL(&queueMux);
+    return ok;
+}
+
+void InputManager::dispatch(const InputEvent& event) {
+    const uint32_t start = micros();
+    const uint32_t latency = start - event.us;
+    stats_.events++;
+    if (event.type >= CHORD) stats_.gestures++;
+    stats_.latencyLastUs = latency;
+    stats_.latencySumUs += latency;
+    if (latency > stats_.latencyMaxUs) stats_.latencyMaxUs = latency;
+
+    if (callback) callback(event);
+
+    const uint32_t handler = micros() - start;
+    if (handler > stats_.handlerMaxUs) stats_.handlerMaxUs = handler;
 }
 
 void InputManager::setCallback(EventCallback cb) {
@@ -0,0 +1,204 @@
+#include "driver/net/LanLink.h"
+#include "heater/HeaterState.h"
+#include "heater/HeaterCycle.h"
+#include "core/DeviceState.h"
+#include "utils/Logger.h"
+#include "credentials.h"
+
+#include <WiFi.h>
+#include <ESPmDNS.h>
+#include <mbedtls/md.h>
+
+// Gemeinsamer Schlüssel für die LAN-Steuerung; fehlt er, gibt es nur Telemetrie
+#ifndef LAN_KEY
+#define LAN_KEY ""
+#endif
+
+LanLink& LanLink::instance() {
+    static LanLink instance;
+    return instance;
+}
+
+void LanLink::begin(uint16_t httpPort) {
+    if (running) return;
+    key = LAN_KEY;
+    keyLen = strlen(key);
+    bootId_ = esp_random() | 1;
+
+    if (!udp.begin(CONTROL_PORT)) {
+        logPrint("lan", "LAN: UDP bind :%u failed", CONTROL_PORT);
+        return;
+    }
+    running = true;
+
+    // mDNS läuft bereits (ArduinoOTA.begin mit Hostname), hier nur der eigene Service
+    char group[16], port[6], ctl[6], fmt[4];
+    snprintf(group, sizeof(group), "%u.%u.%u.%u", MCAST_GROUP[0], MCAST_GROUP[1], MCAST_GROUP[2], MCAST_GROUP[3]);
+    snprintf(port, sizeof(port), "%u", TELEMETRY_PORT);
+    snprintf(ctl, sizeof(ctl), "%u", CONTROL_PORT);
+    snprintf(fmt, sizeof(fmt), "%u", FORMAT);
+    if (MDNS.addService("heizbox", "tcp", httpPort)) {
+        MDNS.addServiceTxt("heizbox", "tcp", "mcast", group);
+        MDNS.addServiceTxt("heizbox", "tcp", "port", port);
+        MDNS.addServiceTxt("heizbox", "tcp", "ctl", ctl);
+        MDNS.addServiceTxt("heizbox", "tcp", "fmt", fmt);
+        MDNS.addServiceTxt("heizbox", "tcp", "auth", controlEnabled() ? "hmac-sha256" : "none");
+    } else {
+        logPrint("lan", "LAN: mDNS service not registered");
+    }
+
+    logPrint("lan", "LAN telemetry -> %s:%u, control :%u (%s)", group, TELEMETRY_PORT, CONTROL_PORT,
+             controlEnabled() ? "hmac" : "off");
+}
+
+void LanLink::update() {
+    if (!running || !WiFi.isConnected()) return;
+    const uint32_t now = millis();
+    pollControl(now);
+    sendTelemetry(now);
+}
+
+void LanLink::onCommand(CommandHandler handler) {
+    commandHandler = handler;
+}
+
+// ============================================================================
+// Telemetrie - ein festes Paket pro Sample, Multicast, ohne Abo
+// ============================================================================
+
+void LanLink::sendTelemetry(uint32_t now) {
+    auto& hs = HeaterState::instance();
+    const bool heating = hs.isHeating;
+    if (now - lastSent < 1000u / (heating ? TELEMETRY_HZ : IDLE_HZ)) return;
+    lastSent = now;
+
+    LanPacket p;
+    p.magic[0] = 'H';
+    p.magic[1] = 'B';
+    p.version = FORMAT;
+    p.flags = (heating ? FLAG_HEATING : 0)
+            | (hs.zvsOn ? FLAG_ZVS : 0)
+            | (DeviceState::instance().locked ? FLAG_LOCKED : 0)
+            | (controlEnabled() ? FLAG_CONTROL : 0);
+    p.bootId = bootId_;
+    p.seq = ++seq;
+    p.ms = now;
+    p.tempDeci = hs.temp * 10;
+    p.tempRawDeci = hs.tempIRRaw * 10;
+    p.tempLimit = hs.tempLimit;
+    p.power = hs.power;
+    p.cycle = HeaterCycle::current();
+    p.timerSec = hs.timer;
+
+    const IPAddress group(MCAST_GROUP[0], MCAST_GROUP[1], MCAST_GROUP[2], MCAST_GROUP[3]);
+    if (udp.beginPacket(group, TELEMETRY_PORT)) {
+        udp.write(reinterpret_cast<const uint8_t*>(&p), sizeof(p));
+        if (udp.endPacket()) {
+            stats_.sent++;
+            return;
+        }
+    }
+    stats_.sendErrors++;
+}
+
+// ============================================================================
+// Steuerung - HMAC + Replay-Schutz, dann derselbe Pfad wie WS-Befehle
+// ============================================================================
+
+void LanLink::pollControl(uint32_t now) {
+    // Wenige Pakete pro Loop, der Rest wartet im lwIP-Puffer
+    for (uint8_t i = 0; i < 4; i++) {
+        const int len = udp.parsePacket();
+        if (len <= 0) return;
+
+        if (now - controlWindow >= 1000) {
+            controlWindow = now;
+            controlInWindow = 0;
+        }
+        if (controlInWindow >= CONTROL_PER_SEC) {
+            stats_.rateLimited++;
+            udp.flush();
+            continue;
+        }
+        controlInWindow++;
+
+        if (!controlEnabled() || len <= (int)sizeof(LanControlHeader) || len > (int)CONTROL_MAX) {
+            stats_.authFailed++;
+            udp.flush();
+            continue;
+        }
+        const int n = udp.read(rx, sizeof(rx));
+        if (n != len) {
+            stats_.authFailed++;
+            continue;
+        }
+
+        LanControlHeader hdr;
+        memcpy(&hdr, rx, sizeof(hdr));
+        const uint8_t* body = rx + sizeof(hdr);
+        const size_t bodyLen = n - sizeof(hdr);
+        if (!authenticate(hdr, body, bodyLen)) {
+            stats_.authFailed++;
+            continue;
+        }
+        if (hdr.counter <= lastCounter) {
+            stats_.replayed++;
+            continue;
+        }
+        lastCounter = hdr.counter;
+        stats_.control++;
+
+        arena.reset();
+        JsonDocument doc(&arena);
+        if (deserializeJson(doc, body, bodyLen, DeserializationOption::NestingLimit(3))) {
+            reply(JsonVariantConst(), "bad json", false);
+            continue;
+        }
+        const char* cmd = doc["cmd"] | "";
+        if (strcmp(cmd, "ping") == 0) {
+            reply(doc["id"], nullptr, true);
+            continue;
+        }
+        reply(doc["id"], commandHandler ? commandHandler(doc) : "no handler", false);
+    }
+}
+
+bool LanLink::authenticate(const LanControlHeader& hdr, const uint8_t* body, size_t len) {
+    if (hdr.magic[0] != 'H' || hdr.magic[1] != 'C' || hdr.version != FORMAT) return false;
+    if (hdr.bootId != bootId_) return false;
+
+    // HMAC über Kopf (bis vor das Tag) und JSON
+    uint8_t mac[32];
+    const mbedtls_md_info_t* info = mbedtls_md_info_from_type(MBEDTLS_MD_SHA256);
+    mbedtls_md_context_t ctx;
+    mbedtls_md_init(&ctx);
+    bool ok = mbedtls_md_setup(&ctx, info, 1) == 0
+        && mbedtls_md_hmac_starts(&ctx, reinterpret_cast<const uint8_t*>(key), keyLen) == 0
+        && mbedtls_md_hmac_update(&ctx, reinterpret_cast<const uint8_t*>(&hdr), offsetof(LanControlHeader, tag)) == 0
+        && mbedtls_md_hmac_update(&ctx, body, len) == 0
+        && mbedtls_md_hmac_finish(&ctx, mac) == 0;
+    mbedtls_md_free(&ctx);
+    if (!ok) return false;
+
+    // Konstante Laufzeit, kein früher Abbruch beim ersten falschen Byte
+    uint8_t diff = 0;
+    for (size_t i = 0; i < sizeof(hdr.tag); i++) diff |= mac[i] ^ hdr.tag[i];
+    return diff == 0;
+}
+
+void LanLink::reply(JsonVariantConst id, const char* error, bool withMs) {
+    JsonDocument doc(&arena);
+    doc["type"] = "cmdAck";
+    doc["id"] = id;
+    doc["ok"] = error == nullptr;
+    if (error) doc["error"] = error;
+    if (withMs) doc["ms"] = millis();
+
+    char out[128];
+    const size_t len = serializeJson(doc, out, sizeof(out));
+    if (len >= sizeof(out)) return;
+    if (udp.beginPacket(udp.remoteIP(), udp.remotePort())) {
+        udp.write(reinterpret_cast<const uint8_t*>(out), len);
+        udp.endPacket();
+    }
+}
@@ -6,12 +6,15 @@
 #include "core/EventBus.h"
 #include "SysModule.h"
 #include "driver/net/WebSocketManager.h"
+#include "driver/net/WsOutbox.h"
+#include "driver/net/LanLink.h"
 
 Network::Network() : wifi(), ota(), initialized(false), pendingUpdateCheck(false) {}
 
 void Network::init(const char* ssid, const char* password, const char* hostname) {
     auto booted = SysModules::booting("net");
     setupWifi(ssid, password, hostname);
+    WsOutbox::instance().begin();
     WebSocketManager& ws = WebSocketManager::instance();
 
     // Setup WebSocket
@@ -50,10 +53,11 @@ void Network::init(const char* ssid, const char* password, const char* hostname)
 void Network::update() {
     wifi.update();
     WebSocketManager::instance().update();
+    LanLink::instance().update();
     ota.handle();
     firmwareUpdater.update();
 
-    // Deferred Firmware-Check im Loop-Kontext (grosser Stack)
+    // Deferred Firmware-Check: stößt nur den Update-Task an
     if (pendingUpdateCheck) {
         pendingUpdateCheck = false;
         firmwareUpdater.checkNow();
@@ -70,6 +74,8 @@ void Network::setupWifi(const char* ssid, const char* password, const char* host
             // OTA erst JETZT starten - ArduinoOTA braucht verbundenes WiFi,
             // sonst bindet der Server auf ein Interface ohne IP (Port 3232 bleibt zu)
             ota.setup();
+            // Nach ota.setup(): ArduinoOTA startet mDNS, LanLink hängt _heizbox._tcp an (DebugServer :80)
+            LanLink::instance().begin(80);
             initialized = true;
             // Firmware-Check deferred in update() (HTTP im Event-Callback = Stack-Overflow)
             pendingUpdateCheck = true;
@@ -86,7 +92,7 @@ void Network::handleWebSocketMessage(const char* type, const JsonDocument& doc)
         if (!doc["consumptionTotal"].isNull()) {
             ds.consumption.today.set(doc["consumptionTotal"].as<float>());
         }
-        if (!doc["consumptionTotal"].isNull()) {
+        if (!doc["consumptionYesterday"].isNull()) {
             ds.consumption.yesterday.set(doc["consumptionYesterday"].as<float>());
         }
     }
@@ -0,0 +1,109 @@
+#include "driver/net/TelemetryCodec.h"
+#include "driver/net/WsMessages.h"
+#include "utils/Logger.h"
+
+#include <math.h>
+#include <type_traits>
+
+// batchBytesMax() rechnet mit int16-Deltas
+static_assert(std::is_same<decltype(WsTempSample::rawDeci), int16_t>::value &&
+                  std::is_same<decltype(WsTempSample::calDeci), int16_t>::value,
+              "TelemetryCodec::batchBytesMax() an die Breite der Sample-Felder anpassen");
+
+namespace TelemetryCodec {
+
+void Writer::u8(uint8_t v) {
+    if (_len >= _cap) {
+        _ok = false;
+        return;
+    }
+    _buf[_len++] = v;
+}
+
+void Writer::varint(uint32_t v) {
+    while (v >= 0x80) {
+        u8((v & 0x7F) | 0x80);
+        v >>= 7;
+    }
+    u8(v);
+}
+
+int32_t toDeci(float celsius) {
+    return (int32_t)lroundf(celsius * 10.0f);
+}
+
+bool encodeRecord(Writer& w, const WsPendingMsg& msg) {
+    if (msg.seq) {
+        w.u8((uint8_t)WsMsgType::EVENT_META);
+        w.varint(msg.seq);
+        w.varint(msg.at);
+    }
+    switch (msg.type) {
+        case WsMsgType::HEARTBEAT:
+            w.u8((uint8_t)msg.type);
+            break;
+        case WsMsgType::STATUS_UPDATE:
+            w.u8((uint8_t)msg.type);
+            w.u8((msg.isOn ? FLAG_ON : 0) | (msg.isHeating ? FLAG_HEATING : 0));
+            break;
+        case WsMsgType::HEAT_CYCLE_COMPLETED:
+            w.u8((uint8_t)msg.type);
+            w.varint(msg.durationSec);
+            w.u8(msg.cycle);
+            break;
+        case WsMsgType::SESSION_UPDATE:
+            w.u8((uint8_t)msg.type);
+            w.zigzag(msg.clicks);
+            w.zigzag(msg.caps);
+            break;
+        case WsMsgType::TEMP_READING: {
+            const int32_t raw = toDeci(msg.tempRaw);
+            w.u8((uint8_t)msg.type);
+            w.u8(msg.isHeating ? FLAG_HEATING : 0);
+            w.zigzag(raw);
+            w.zigzag(toDeci(msg.tempCalibrated) - raw);
+            break;
+        }
+        default:
+            return false;
+    }
+    return w.ok();
+}
+
+bool encodeTempBatch(Writer& w, const WsTempSample* samples, uint8_t count, uint32_t now) {
+    if (!count) return false;
+    w.u8((uint8_t)WsMsgType::TEMP_BATCH);
+    w.varint(count);
+    w.varint(now - samples[0].ms);
+
+    const WsTempSample* prev = nullptr;
+    for (uint8_t i = 0; i < count; i++) {
+        const WsTempSample& s = samples[i];
+        const bool powerChanged = !prev || prev->power != s.power;
+        w.u8((s.isHeating ? FLAG_HEATING : 0) | (s.zvsOn ? FLAG_ZVS : 0) | (powerChanged ? FLAG_POWER : 0));
+        if (powerChanged) w.u8(s.power);
+        w.varint(prev ? s.ms - prev->ms : 0);
+        w.zigzag(s.rawDeci - (prev ? prev->rawDeci : 0));
+        w.zigzag(s.calDeci - s.rawDeci);
+        prev = &s;
+    }
+    return w.ok();
+}
+
+bool encodeLogRecords(Writer& w, const uint8_t* buildId, const uint8_t* records, size_t len) {
+    if (!len) return false;
+    w.u8((uint8_t)WsMsgType::LOG_RECORDS);
+    for (size_t i = 0; i < LOG_BUILD_ID_BYTES; i++) w.u8(buildId[i]);
+    w.varint(len);
+    for (size_t i = 0; i < len; i++) w.u8(records[i]);
+    return w.ok();
+}
+
+size_t encode(const WsPendingMsg& msg, uint8_t* buf, size_t cap) {
+    Writer w(buf, cap);
+    w.u8(VERSION);
+    if (!encodeRecord(w, msg)) return 0;
+    return w.size();
+}
+
+}  // namespace TelemetryCodec
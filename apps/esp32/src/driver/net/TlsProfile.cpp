@@ -0,0 +1,42 @@
+#include "driver/net/TlsProfile.h"
+#include "credentials.h"
+
+namespace TlsProfile {
+
+namespace {
+Stats stats_;
+}
+
+const char* pinnedCA() {
+#ifdef BACKEND_CA_PEM
+    return BACKEND_CA_PEM;
+#else
+    return nullptr;
+#endif
+}
+
+bool heapAllows() {
+    return ESP.getMaxAllocHeap() >= MIN_FREE_BLOCK;
+}
+
+void configure(WiFiClientSecure& client) {
+    if (const char* ca = pinnedCA()) client.setCACert(ca);
+    else client.setInsecure();
+}
+
+void recordConnected(uint32_t heapBefore) {
+    stats_.handshakes++;
+    const uint32_t now = ESP.getFreeHeap();
+    stats_.lastCost = heapBefore > now ? heapBefore - now : 0;
+    if (stats_.lastCost > stats_.peakCost) stats_.peakCost = stats_.lastCost;
+}
+
+void recordHeapFallback() {
+    stats_.heapFallbacks++;
+}
+
+const Stats& stats() {
+    return stats_;
+}
+
+}  // namespace TlsProfile
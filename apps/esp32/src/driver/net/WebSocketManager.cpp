@@ -1,4 +1,7 @@
 #include "driver/net/WebSocketManager.h"
+#include "driver/net/TelemetryCodec.h"
+#include "driver/net/WsOutbox.h"
+#include "driver/net/TlsProfile.h"
 #include "utils/Logger.h"
 
 WebSocketManager& WebSocketManager::instance() {
@@ -10,9 +13,10 @@ void WebSocketManager::init(const char* url, const char* deviceId, const char* c
     String urlStr(url);
     urlStr.trim();
 
-    // "wss://" oder "ws://" Prefix strippen (plain WS Port 80, kein TLS - RAM-Limit)
+    state.wantTls = false;
     if (urlStr.startsWith("wss://")) {
         urlStr = urlStr.substring(6);
+        state.wantTls = true;
     } else if (urlStr.startsWith("ws://")) {
         urlStr = urlStr.substring(5);
     }
@@ -25,17 +29,34 @@ void WebSocketManager::init(const char* url, const char* deviceId, const char* c
     pathStr += "?deviceId=" + String(deviceId) + "&type=" + String(clientType);
 
     // Sichere Kopien in char-Puffer (vermeidet self-assignment-Bug von String.c_str())
-    char hostBuf[96];
-    char pathBuf[160];
-    hostStr.toCharArray(hostBuf, sizeof(hostBuf));
-    pathStr.toCharArray(pathBuf, sizeof(pathBuf));
-
-    logPrint("ws", "WebSocket connecting to: %s%s", hostBuf, pathBuf);
-    
-    // Kein TLS: ws:// auf Port 80. Cloudflare redirectet, aber kein Crash.
-    webSocket.begin(hostBuf, 80, pathBuf);
+    hostStr.toCharArray(host, sizeof(host));
+    pathStr.toCharArray(path, sizeof(path));
+
+    // wss:// nur mit gepinnter CA und genug Heap, sonst plain ws:// auf Port 80 (RAM-Limit)
+    state.tls = state.wantTls && TlsProfile::pinnedCA() && TlsProfile::heapAllows();
+    state.tlsSwitchMs = millis();
+    if (state.wantTls && !state.tls) {
+        if (TlsProfile::pinnedCA()) TlsProfile::recordHeapFallback();
+        logPrint("ws", "WebSocket: %s, using ws://", TlsProfile::pinnedCA() ? "heap too low for TLS" : "no pinned CA");
+    }
+
+    logPrint("ws", "WebSocket connecting to: %s://%s%s", state.tls ? "wss" : "ws", host, path);
     webSocket.onEvent(onWebSocketEvent);
-    webSocket.setReconnectInterval(5000);
+    begin();
+}
+
+void WebSocketManager::begin() {
+    state.heapBeforeConnect = ESP.getFreeHeap();
+    if (state.tls) {
+        webSocket.beginSslWithCA(host, 443, path, TlsProfile::pinnedCA());
+        webSocket.setReconnectInterval(TLS_RECONNECT_MS);
+        webSocket.enableHeartbeat(TLS_PING_MS, TLS_PONG_TIMEOUT_MS, 2);
+    } else {
+        // Plain ws:// auf Port 80. Cloudflare redirectet, aber kein Crash.
+        webSocket.begin(host, 80, path);
+        webSocket.setReconnectInterval(RECONNECT_MS);
+        webSocket.disableHeartbeat();
+    }
 }
 
 void WebSocketManager::update() {
@@ -43,16 +64,58 @@ void WebSocketManager::update() {
 
     // Puffer leeren - NUR hier im Loop-Kontext (grosser Stack) JSON bauen/senden
     if (state.connected) {
+        // Binärformat anbieten; bis zur Bestätigung bleibt alles JSON
+        if (state.helloPending) {
+            state.helloPending = false;
+            char hello[40];
+            int len = snprintf(hello, sizeof(hello), "{\"type\":\"hello\",\"bin\":%u}", TelemetryCodec::VERSION);
+            webSocket.sendTXT(hello, len);
+        }
+
         flushQueue();
+        if (batchDue(millis())) flushBatch(millis());
+
+        // Log-Zeilen, vom Drain-Task gesammelt
+        static char logFrame[LOG_WS_BATCH_BYTES + 48];
+        if (size_t len = logTakeWsBatch(logFrame, sizeof(logFrame), millis())) webSocket.sendTXT(logFrame, len);
+        if (state.binary) flushLogRecords(millis());
+
+        // Outbox-Replay (rate-limitiert, ein Event in flight)
+        WsPendingMsg event;
+        if (WsOutbox::instance().nextForSend(event, millis())) send(event);
 
         // Auto heartbeat
         if (millis() - state.lastHeartbeat >= HEARTBEAT_INTERVAL_MS) {
+            state.lastHeartbeat = millis();
             sendHeartbeat();
         }
     } else {
-        // Nicht connected: Queue verwerfen, keine Stale-Messages ansammeln
-        pendingHead = 0;
-        pendingCount = 0;
+        // Nicht connected: Queue verwerfen, keine Stale-Messages ansammeln.
+        // Kritische Events liegen in der Outbox (Flash) und werden nach dem Reconnect nachgeliefert.
+        queueClear();
+        batchCount = 0;
+        logTakeWsBatch(nullptr, 0, millis());
+        logTakeWsRecords(nullptr, 0, millis());
+
+        // Heap reicht nicht für den nächsten Handshake: vorerst ws://, statt an Allokationsfehlern
+        // im Handshake zu scheitern. Ein kurzer Einbruch soll nicht dauerhaft TLS kosten - nach
+        // TLS_RETRY_MS und mit wieder genug Heap versucht der nächste Reconnect wss://.
+        const uint32_t now = millis();
+        if (state.tls && !TlsProfile::heapAllows()) {
+            state.tls = false;
+            state.tlsSwitchMs = now;
+            TlsProfile::recordHeapFallback();
+            logPrint("ws", "WebSocket: heap too low for TLS (%u), using ws://", (unsigned)ESP.getMaxAllocHeap());
+            webSocket.disconnect();
+            begin();
+        } else if (!state.tls && state.wantTls && TlsProfile::pinnedCA() &&
+                   now - state.tlsSwitchMs >= TLS_RETRY_MS && TlsProfile::heapAllows()) {
+            state.tls = true;
+            state.tlsSwitchMs = now;
+            logPrint("ws", "WebSocket: heap ok (%u), retrying wss://", (unsigned)ESP.getMaxAllocHeap());
+            webSocket.disconnect();
+            begin();
+        }
     }
 }
 
@@ -60,23 +123,76 @@ void WebSocketManager::update() {
 // Queue (puffert Messages, KEIN JSON/Send im Aufrufer-Kontext!)
 // ============================================================================
 
+WsPriority WebSocketManager::priorityOf(WsMsgType type) {
+    switch (type) {
+        case WsMsgType::HEAT_CYCLE_COMPLETED: return WsPriority::CRITICAL;
+        case WsMsgType::STATUS_UPDATE:
+        case WsMsgType::SESSION_UPDATE: return WsPriority::STATE;
+        default: return WsPriority::TELEMETRY;
+    }
+}
+
+// Nur der letzte Stand zählt: ein neuer statusUpdate/heartbeat ersetzt den wartenden
+bool WebSocketManager::coalesces(WsMsgType type) {
+    return type == WsMsgType::STATUS_UPDATE || type == WsMsgType::HEARTBEAT;
+}
+
+const char* WebSocketManager::priorityName(WsPriority prio) {
+    switch (prio) {
+        case WsPriority::CRITICAL: return "critical";
+        case WsPriority::STATE: return "state";
+        case WsPriority::TELEMETRY: return "telemetry";
+        default: return "?";
+    }
+}
+
 bool WebSocketManager::queuePush(const WsPendingMsg& msg) {
-    if (pendingCount >= PENDING_MAX) {
-        logPrint("ws", "WS queue full, dropping msg");
-        return false;
+    const WsPriority prio = priorityOf(msg.type);
+    PendingQueue& q = pendingQueues[(uint8_t)prio];
+
+    if (coalesces(msg.type)) {
+        for (uint8_t i = 0; i < q.count; i++) {
+            WsPendingMsg& queued = q.msgs[(q.head + i) % PENDING_PER_CLASS];
+            if (queued.type != msg.type) continue;
+            queued = msg;  // Position bleibt, Inhalt wird aktuell
+            q.stats.coalesced++;
+            return true;
+        }
+    }
+
+    if (q.count >= PENDING_PER_CLASS) {
+        q.stats.dropped++;
+        if (prio != WsPriority::TELEMETRY) {
+            logPrint("ws", "WS queue full (%s), dropping msg", priorityName(prio));
+            return false;
+        }
+        // Telemetrie: ältesten Wert opfern, der neue ist aussagekräftiger
+        q.head = (q.head + 1) % PENDING_PER_CLASS;
+        q.count--;
     }
-    uint8_t idx = (pendingHead + pendingCount) % PENDING_MAX;
-    pending[idx] = msg;
-    pendingCount++;
+
+    q.msgs[(q.head + q.count) % PENDING_PER_CLASS] = msg;
+    q.count++;
+    q.stats.queued++;
     return true;
 }
 
 bool WebSocketManager::queuePop(WsPendingMsg& msg) {
-    if (pendingCount == 0) return false;
-    msg = pending[pendingHead];
-    pendingHead = (pendingHead + 1) % PENDING_MAX;
-    pendingCount--;
-    return true;
+    for (auto& q : pendingQueues) {
+        if (q.count == 0) continue;
+        msg = q.msgs[q.head];
+        q.head = (q.head + 1) % PENDING_PER_CLASS;
+        q.count--;
+        return true;
+    }
+    return false;
+}
+
+void WebSocketManager::queueClear() {
+    for (auto& q : pendingQueues) {
+        q.head = 0;
+        q.count = 0;
+    }
 }
 
 // ============================================================================
@@ -98,10 +214,14 @@ bool WebSocketManager::sendStatusUpdate(bool isOn, bool isHeating) {
 }
 
 bool WebSocketManager::sendHeatCycleCompleted(uint32_t durationSec, uint8_t cycle) {
+    // 0 s (kurzer Druck, Pause, Timeout) lehnt das Backend ab - gar nicht erst in die Outbox
+    if (durationSec == 0) return false;
     WsPendingMsg msg;
     msg.type = WsMsgType::HEAT_CYCLE_COMPLETED;
     msg.durationSec = durationSec;
     msg.cycle = cycle;
+    // Abrechnungsrelevant: über die Outbox (Flash + Ack), nur ohne Dateisystem direkt
+    if (WsOutbox::instance().isAvailable() && WsOutbox::instance().enqueue(msg)) return true;
     return queuePush(msg);
 }
 
@@ -122,6 +242,72 @@ bool WebSocketManager::sendTempReading(float tempRaw, float tempCalibrated, bool
     return queuePush(msg);
 }
 
+// ============================================================================
+// Telemetrie-Batch - Samples sammeln statt ein Frame pro Messwert
+// ============================================================================
+
+bool WebSocketManager::sendTempSample(const WsTempSample& sample) {
+    if (batchCount >= BATCH_CAPACITY) {
+        logPrint("ws", "Telemetry batch full, dropping sample");
+        return false;
+    }
+    batch[batchCount++] = sample;
+    return true;
+}
+
+void WebSocketManager::setBatchPolicy(const BatchPolicy& policy) {
+    batchPolicy = policy;
+    batchPolicy.maxSamples = constrain(policy.maxSamples, 1, BATCH_CAPACITY);
+}
+
+bool WebSocketManager::batchDue(uint32_t now) const {
+    if (!batchCount) return false;
+    return batchCount >= batchPolicy.maxSamples || now - batch[0].ms >= batchPolicy.maxAgeMs;
+}
+
+bool WebSocketManager::flushBatch(uint32_t now) {
+    if (!state.connected || !batchCount) return false;
+
+    if (state.binary) {
+        uint8_t buffer[1 + TelemetryCodec::batchBytesMax(BATCH_CAPACITY)];
+        TelemetryCodec::Writer w(buffer, sizeof(buffer));
+        w.u8(TelemetryCodec::VERSION);
+        sendFrame(buffer, TelemetryCodec::encodeTempBatch(w, batch, batchCount, now) ? w.size() : 0, "tempBatch");
+    } else {
+        // JSON-Fallback: gleiche Struktur wie der Binär-Decoder im Backend
+        JsonDocument doc;
+        doc["type"] = "tempBatch";
+        doc["age"] = now - batch[0].ms;
+        JsonArray samples = doc["samples"].to<JsonArray>();
+        for (uint8_t i = 0; i < batchCount; i++) {
+            const WsTempSample& s = batch[i];
+            JsonObject o = samples.add<JsonObject>();
+            o["t"] = s.ms - batch[0].ms;
+            o["tempRaw"] = s.rawDeci / 10.0f;
+            o["tempCalibrated"] = s.calDeci / 10.0f;
+            o["power"] = s.power;
+            o["zvsOn"] = s.zvsOn;
+            o["isHeating"] = s.isHeating;
+        }
+        String out;
+        serializeJson(doc, out);
+        webSocket.sendTXT(out);
+    }
+
+    batchCount = 0;
+    return true;
+}
+
+void WebSocketManager::flushLogRecords(uint32_t now) {
+    uint8_t records[LOG_WS_BIN_BYTES];
+    const size_t len = logTakeWsRecords(records, sizeof(records), now);
+    if (!len) return;
+    uint8_t buffer[LOG_WS_BIN_BYTES + LOG_BUILD_ID_BYTES + 8];
+    TelemetryCodec::Writer w(buffer, sizeof(buffer));
+    w.u8(TelemetryCodec::VERSION);
+    sendFrame(buffer, TelemetryCodec::encodeLogRecords(w, logBuildId(), records, len) ? w.size() : 0, "logRecords");
+}
+
 // ============================================================================
 // Flush - NUR aus update() aufrufen (Loop-Task, ~8KB Stack)
 // ============================================================================
@@ -133,41 +319,70 @@ bool WebSocketManager::flushQueue() {
     bool any = false;
     while (queuePop(msg)) {
         any = true;
-        JsonDocument doc;
-        switch (msg.type) {
-            case WsMsgType::HEARTBEAT:
-                doc["type"] = "heartbeat";
-                doc["isOn"] = true;
-                break;
-            case WsMsgType::STATUS_UPDATE:
-                doc["type"] = "statusUpdate";
-                doc["isOn"] = msg.isOn;
-                doc["isHeating"] = msg.isHeating;
-                break;
-            case WsMsgType::HEAT_CYCLE_COMPLETED:
-                doc["type"] = "heatCycleCompleted";
-                doc["duration"] = msg.durationSec;
-                doc["cycle"] = msg.cycle;
-                break;
-            case WsMsgType::SESSION_UPDATE:
-                doc["type"] = "sessionUpdate";
-                doc["clicks"] = msg.clicks;
-                doc["caps"] = msg.caps;
-                break;
-            case WsMsgType::TEMP_READING:
-                doc["type"] = "tempReading";
-                doc["tempRaw"] = msg.tempRaw;
-                doc["tempCalibrated"] = msg.tempCalibrated;
-                doc["isHeating"] = msg.isHeating;
-                break;
-            default:
-                continue;
-        }
-        sendJson(doc);
+        if (send(msg)) pendingQueues[(uint8_t)priorityOf(msg.type)].stats.sent++;
     }
     return any;
 }
 
+bool WebSocketManager::send(const WsPendingMsg& msg) {
+    if (state.binary) return sendBinary(msg);
+    JsonDocument doc;
+    return buildJson(msg, doc) && sendJson(doc);
+}
+
+bool WebSocketManager::buildJson(const WsPendingMsg& msg, JsonDocument& doc) {
+    switch (msg.type) {
+        case WsMsgType::HEARTBEAT:
+            doc["type"] = "heartbeat";
+            doc["isOn"] = true;
+            break;
+        case WsMsgType::STATUS_UPDATE:
+            doc["type"] = "statusUpdate";
+            doc["isOn"] = msg.isOn;
+            doc["isHeating"] = msg.isHeating;
+            break;
+        case WsMsgType::HEAT_CYCLE_COMPLETED:
+            doc["type"] = "heatCycleCompleted";
+            doc["duration"] = msg.durationSec;
+            doc["cycle"] = msg.cycle;
+            break;
+        case WsMsgType::SESSION_UPDATE:
+            doc["type"] = "sessionUpdate";
+            doc["clicks"] = msg.clicks;
+            doc["caps"] = msg.caps;
+            break;
+        case WsMsgType::TEMP_READING:
+            doc["type"] = "tempReading";
+            doc["tempRaw"] = msg.tempRaw;
+            doc["tempCalibrated"] = msg.tempCalibrated;
+            doc["isHeating"] = msg.isHeating;
+            break;
+        default:
+            return false;
+    }
+    if (msg.seq) {
+        doc["seq"] = msg.seq;
+        if (msg.at) doc["at"] = msg.at;
+    }
+    return true;
+}
+
+bool WebSocketManager::sendBinary(const WsPendingMsg& msg) {
+    uint8_t buffer[32];
+    return sendFrame(buffer, TelemetryCodec::encode(msg, buffer, sizeof(buffer)), "record");
+}
+
+bool WebSocketManager::sendFrame(uint8_t* buf, size_t len, const char* what) {
+    if (!len) {
+        encoded.failed++;
+        logPrint("ws", "WS %s encode failed, frame dropped (%lu total)", what, (unsigned long)encoded.failed);
+        return false;
+    }
+    encoded.frames++;
+    webSocket.sendBIN(buf, len);
+    return true;
+}
+
 bool WebSocketManager::sendJson(const JsonDocument& doc) {
     if (!state.connected) {
         return false;
@@ -189,7 +404,11 @@ void WebSocketManager::handleEvent(WStype_t type, uint8_t* payload, size_t lengt
         case WStype_CONNECTED: {
             Serial.printf("[WS] Connected to server\n");
             state.connected = true;
+            state.binary = false;
+            state.helloPending = true;
             state.lastHeartbeat = millis();
+            if (state.tls) TlsProfile::recordConnected(state.heapBeforeConnect);
+            WsOutbox::instance().onConnected();
             // Kein sendStatusUpdate hier - wird ueber Queue in update() geflusht
             if (connectionCallback) connectionCallback(true);
             break;
@@ -197,23 +416,15 @@ void WebSocketManager::handleEvent(WStype_t type, uint8_t* payload, size_t lengt
         case WStype_DISCONNECTED: {
             Serial.printf("[WS] Disconnected from server\n");
             state.connected = false;
+            state.binary = false;
+            state.heapBeforeConnect = ESP.getFreeHeap();
             if (connectionCallback) connectionCallback(false);
             break;
         }
-        case WStype_TEXT: {
+        case WStype_TEXT:
             if (payload == nullptr || length == 0) break;
-            JsonDocument doc;
-            DeserializationError err = deserializeJson(doc, payload, length);
-            if (err) {
-                Serial.printf("[WS] JSON parse error: %s\n", err.c_str());
-                break;
-            }
-            const char* typeStr = doc["type"] | "";
-            if (messageCallback && typeStr[0] != '\0') {
-                messageCallback(typeStr, doc);
-            }
+            handleText(payload, length);
             break;
-        }
         case WStype_ERROR:
             Serial.printf("[WS] Error\n");
             break;
@@ -226,6 +437,85 @@ void WebSocketManager::handleEvent(WStype_t type, uint8_t* payload, size_t lengt
     }
 }
 
+// Nur diese Felder landen im Dokument - alles andere überspringt der Parser ohne Allokation
+const JsonDocument& WebSocketManager::inboundFilter() {
+    static JsonDocument filter;
+    if (filter.isNull()) {
+        filter["type"] = true;
+        filter["seq"] = true;
+        filter["success"] = true;
+        filter["reason"] = true;
+        filter["bin"] = true;
+        // sessionData/sessionUpdate
+        filter["consumption"] = true;
+        filter["consumptionTotal"] = true;
+        filter["consumptionYesterday"] = true;
+        // cmd (services/RemoteCommands.h)
+        filter["id"] = true;
+        filter["cmd"] = true;
+        filter["temp"] = true;
+        filter["preset"] = true;
+        filter["ms"] = true;
+        JsonObject point = filter["points"].add<JsonObject>();  // gilt für jedes Element
+        point["ir"] = true;
+        point["temp"] = true;
+    }
+    return filter;
+}
+
+void WebSocketManager::handleText(const uint8_t* payload, size_t length) {
+    inbound.frames++;
+
+    // Arena erst nach dem Ende des vorigen Dokuments zurücksetzen (doc ist lokal)
+    inboundArena.reset();
+    JsonDocument doc(&inboundArena);
+    DeserializationError err = deserializeJson(doc, payload, length,
+        DeserializationOption::Filter(inboundFilter()),
+        DeserializationOption::NestingLimit(INBOUND_NESTING));
+    if (inboundArena.peak() > inbound.arenaPeak) inbound.arenaPeak = inboundArena.peak();
+    if (err) {
+        inbound.rejected++;
+        logPrint("ws", "WS inbound rejected (%u bytes): %s", (unsigned)length, err.c_str());
+        return;
+    }
+
+    // Outbox-Ack: {"success":true,"seq":n}. "reason":"invalid" ist endgültig (Validierung) - das
+    // Event ebenfalls verwerfen, sonst blockiert es die Outbox; nur DB-Fehler werden wiederholt.
+    if (!doc["seq"].isNull()) {
+        const uint32_t seq = doc["seq"].as<uint32_t>();
+        if (doc["success"] | false) {
+            WsOutbox::instance().ack(seq);
+        } else if (strcmp(doc["reason"] | "", "invalid") == 0) {
+            logPrint("ws", "Outbox event #%lu rejected as invalid, dropping", (unsigned long)seq);
+            WsOutbox::instance().ack(seq);
+        }
+        return;
+    }
+    const char* typeStr = doc["type"] | "";
+    if (strcmp(typeStr, "hello") == 0) {
+        state.binary = (doc["bin"] | 0) == TelemetryCodec::VERSION;
+        logPrint("ws", "Telemetrie-Format: %s", state.binary ? "binary" : "json");
+        return;
+    }
+    if (strcmp(typeStr, "cmd") == 0) {
+        if (commandCallback) commandCallback(doc);
+        return;
+    }
+    if (messageCallback && typeStr[0] != '\0') {
+        messageCallback(typeStr, doc);
+    }
+}
+
+void WebSocketManager::sendCommandAck(JsonVariantConst id, const char* error) {
+    if (!state.connected) return;
+    JsonDocument doc;
+    doc["type"] = "cmdAck";
+    doc["id"] = id;
+    doc["ok"] = error == nullptr;
+    if (error) doc["error"] = error;
+    sendJson(doc);
+}
+
 void WebSocketManager::onMessage(MessageCallback callback) {
     messageCallback = callback;
 }
@@ -234,6 +524,59 @@ void WebSocketManager::onConnectionChange(ConnectionCallback callback) {
     connectionCallback = callback;
 }
 
+void WebSocketManager::onCommand(CommandCallback callback) {
+    commandCallback = callback;
+}
+
 void WebSocketManager::onWebSocketEvent(WStype_t type, uint8_t* payload, size_t length) {
     WebSocketManager::instance().handleEvent(type, payload, length);
 }
+
+// ============================================================================
+// Encode-Benchmark (Debug-API) - gleiche Messages durch beide Pfade
+// ============================================================================
+
+WebSocketManager::EncodeBench WebSocketManager::benchmarkEncoding(uint16_t iterations) {
+    WsPendingMsg samples[5];
+    samples[0].type = WsMsgType::HEARTBEAT;
+    samples[1].type = WsMsgType::STATUS_UPDATE;
+    samples[1].isOn = true;
+    samples[1].isHeating = true;
+    samples[2].type = WsMsgType::HEAT_CYCLE_COMPLETED;
+    samples[2].durationSec = 94;
+    samples[2].cycle = 2;
+    samples[3].type = WsMsgType::SESSION_UPDATE;
+    samples[3].clicks = 12;
+    samples[3].caps = 3;
+    samples[4].type = WsMsgType::TEMP_READING;
+    samples[4].tempRaw = 187.4f;
+    samples[4].tempCalibrated = 193.1f;
+    samples[4].isHeating = true;
+
+    EncodeBench r;
+    r.iterations = iterations;
+    r.messages = sizeof(samples) / sizeof(samples[0]);
+
+    char json[256];
+    uint32_t start = micros();
+    for (uint16_t i = 0; i < iterations; i++) {
+        for (const auto& msg : samples) {
+            JsonDocument doc;
+            buildJson(msg, doc);
+            size_t len = serializeJson(doc, json, sizeof(json));
+            if (i == 0) r.jsonBytes += len;
+        }
+    }
+    r.jsonUs = micros() - start;
+
+    uint8_t bin[32];
+    start = micros();
+    for (uint16_t i = 0; i < iterations; i++) {
+        for (const auto& msg : samples) {
+            size_t len = TelemetryCodec::encode(msg, bin, sizeof(bin));
+            if (i == 0) r.binaryBytes += len;
+        }
+    }
+    r.binaryUs = micros() - start;
+    return r;
+}
@@ -1,5 +1,6 @@
 // src/WiFiManager.cpp
 #include "driver/net/WiFiManager.h"
+#include "utils/Logger.h"
 
 WiFiManager* WiFiManager::instance = nullptr;
 
@@ -7,68 +8,145 @@ WiFiManager::WiFiManager()
     : connectionCallback(nullptr),
       lastStatusCheck(0)
 {
-    state.lastStatus = WL_IDLE_STATUS;
-    state.lastReconnectAttempt = 0;
-    state.reconnectCount = 0;
+    state.link = WiFiLinkState::CONNECTING;
+    state.since = 0;
+    state.retry = 0;
+    state.downSince = 0;
     state.notifiedConnected = false;
-    state.reconnectEnabled = true;  // Reconnect kann deaktivert werden
     instance = this;
 }
 
+const char* WiFiManager::linkStateName(WiFiLinkState s) {
+    switch (s) {
+        case WiFiLinkState::CONNECTING: return "connecting";
+        case WiFiLinkState::CONNECTED:  return "connected";
+        case WiFiLinkState::BACKOFF:    return "backoff";
+    }
+    return "?";
+}
+
 void WiFiManager::init(const char* ssid, const char* password, const char* hostname) {
+    strlcpy(ssid_, ssid, sizeof(ssid_));
+    strlcpy(password_, password, sizeof(password_));
+
     WiFi.setHostname(hostname);
     WiFi.onEvent(onWiFiEvent);
-    WiFi.begin(ssid, password);
-    Serial.printf("WiFi connecting to: %s\n", ssid);
+    // Reconnect macht der Zustandsautomat - der Core-Reconnect läuft im Event-Task
+    WiFi.setAutoReconnect(false);
+    WiFi.begin(ssid_, password_);
+    state.link = WiFiLinkState::CONNECTING;
+    state.since = millis();
+    logPrint("wifi", "WiFi connecting to: %s", ssid_);
 }
 
 void WiFiManager::update() {
     const uint32_t now = millis();
-    
-    // Status check alle 1s
-    if (now - lastStatusCheck >= STATUS_CHECK_INTERVAL_MS) {
-        checkStatus();
+
+    // Disconnect-Event sofort auswerten, sonst Status-Check alle 1s
+    if (eventDisconnected || now - lastStatusCheck >= STATUS_CHECK_INTERVAL_MS) {
+        checkStatus(now);
         lastStatusCheck = now;
     }
 }
 
-void WiFiManager::checkStatus() {
-    const wl_status_t currentStatus = WiFi.status();
-    
-    // Status-Änderung erkannt
-    if (currentStatus != state.lastStatus) {
-        state.lastStatus = currentStatus;
-        
-        if (currentStatus == WL_CONNECTED) {
-            // Connected
-            if (!state.notifiedConnected && connectionCallback) {
-                connectionCallback(true);
-                state.notifiedConnected = true;
+void WiFiManager::checkStatus(uint32_t now) {
+    const bool up = WiFi.status() == WL_CONNECTED;
+    const bool dropped = eventDisconnected;
+    eventDisconnected = false;
+
+    switch (state.link) {
+        case WiFiLinkState::CONNECTED:
+            if (!up || dropped) onDisconnected(now);
+            else sampleRssi();
+            break;
+
+        case WiFiLinkState::CONNECTING:
+            if (up) {
+                onConnected(now);
+            } else if (dropped && eventReason != WIFI_REASON_ASSOC_LEAVE) {
+                // Versuch abgelehnt (kein AP, Auth, ...): nicht auf den Timeout warten.
+                // ASSOC_LEAVE stammt vom disconnect() in reconnect() selbst.
+                stats_.lastReason = eventReason;
+                scheduleRetry(now);
+            } else if (now - state.since >= CONNECT_TIMEOUT_MS) {
+                logPrint("wifi", "WiFi connect timeout (status %d)", (int)WiFi.status());
+                scheduleRetry(now);
             }
-            state.reconnectCount = 0;  // Reset bei Erfolg
-            Serial.printf("WiFi connected: %s (RSSI: %d dBm)\n",
-                         WiFi.localIP().toString().c_str(), WiFi.RSSI());
-        } else {
-            // Disconnected
-            if (state.notifiedConnected && connectionCallback) {
-                connectionCallback(false);
-                state.notifiedConnected = false;
+            break;
+
+        case WiFiLinkState::BACKOFF:
+            if (up) {
+                onConnected(now);
+            } else if (now - state.since >= stats_.backoffMs) {
+                stats_.attempts++;
+                state.link = WiFiLinkState::CONNECTING;
+                state.since = now;
+                // reconnect() nutzt die Config im Treiber; begin() nur falls der STA-Modus weg ist
+                if (!WiFi.reconnect()) WiFi.begin(ssid_, password_);
             }
-            handleDisconnection();
-        }
+            break;
     }
 }
 
-void WiFiManager::handleDisconnection() {
-    // Nach erstem Disconnect: Reconnect komplett stoppen
-    // Verhindert Heap-Corruption durch WiFi-Event-Loop
-    if (!state.reconnectEnabled) {
-        return;  // Bereits deaktiviert
+void WiFiManager::onConnected(uint32_t now) {
+    state.link = WiFiLinkState::CONNECTED;
+    state.since = now;
+    state.retry = 0;
+    stats_.connects++;
+    stats_.backoffMs = 0;
+    stats_.connectedSinceMs = now ? now : 1;
+    stats_.rssiAvg = WiFi.RSSI();
+    sampleRssi();
+    if (state.downSince) {
+        stats_.totalDownMs += now - state.downSince;
+        state.downSince = 0;
+    }
+
+    logPrint("wifi", "WiFi connected: %s (RSSI: %d dBm)", WiFi.localIP().toString().c_str(), stats_.rssi);
+    if (!state.notifiedConnected && connectionCallback) {
+        state.notifiedConnected = true;
+        connectionCallback(true);
     }
-    
-    Serial.println("WiFi: Disconnect detected, disabling auto-reconnect");
-    state.reconnectEnabled = false;  // Kein Reconnect mehr
-    // WiFi bleibt aktiv, aber reconnectet nicht mehr
+}
+
+void WiFiManager::onDisconnected(uint32_t now) {
+    const uint32_t up = now - stats_.connectedSinceMs;
+    if (up > stats_.longestUpMs) stats_.longestUpMs = up;
+    stats_.connectedSinceMs = 0;
+    stats_.disconnects++;
+    stats_.lastReason = eventReason;
+    state.downSince = now ? now : 1;
+
+    logPrint("wifi", "WiFi disconnected after %lus (reason %u)", (unsigned long)(up / 1000), stats_.lastReason);
+    if (state.notifiedConnected && connectionCallback) {
+        state.notifiedConnected = false;
+        connectionCallback(false);
+    }
+    scheduleRetry(now);
+}
+
+void WiFiManager::scheduleRetry(uint32_t now) {
+    // Exponentiell bis BACKOFF_MAX_MS, plus/minus Jitter
+    const uint8_t shift = state.retry < 6 ? state.retry : 6;
+    uint32_t delayMs = BACKOFF_BASE_MS << shift;
+    if (delayMs > BACKOFF_MAX_MS) delayMs = BACKOFF_MAX_MS;
+    const uint32_t jitter = delayMs * BACKOFF_JITTER_PCT / 100;
+    delayMs = delayMs - jitter + random(2 * jitter + 1);
+    if (state.retry < UINT8_MAX) state.retry++;
+
+    state.link = WiFiLinkState::BACKOFF;
+    state.since = now;
+    stats_.backoffMs = delayMs;
+    logPrint("wifi", "WiFi retry %u in %lums", state.retry, (unsigned long)delayMs);
+}
+
+void WiFiManager::sampleRssi() {
+    const int8_t rssi = WiFi.RSSI();
+    if (!rssi) return;  // 0 = kein Wert
+    stats_.rssi = rssi;
+    if (!stats_.rssiMin || rssi < stats_.rssiMin) stats_.rssiMin = rssi;
+    if (rssi > stats_.rssiMax) stats_.rssiMax = rssi;
+    stats_.rssiAvg += RSSI_ALPHA * (rssi - stats_.rssiAvg);
 }
 
 void WiFiManager::onConnectionChange(ConnectionCallback callback) {
@@ -76,28 +154,16 @@ void WiFiManager::onConnectionChange(ConnectionCallback callback) {
 }
 
 bool WiFiManager::isConnected() const {
-    return state.lastStatus == WL_CONNECTED;
+    return state.link == WiFiLinkState::CONNECTED;
 }
 
-void WiFiManager::onWiFiEvent(WiFiEvent_t event) {
+// Läuft im WiFi-Event-Task: nur Flags setzen, keine Callbacks (Heap-Corruption beim Reconnect)
+void WiFiManager::onWiFiEvent(WiFiEvent_t event, WiFiEventInfo_t info) {
+    if (!instance) return;
     switch (event) {
-        case ARDUINO_EVENT_WIFI_STA_START:
-            Serial.println("WiFi started");
-            break;
-        case ARDUINO_EVENT_WIFI_STA_CONNECTED:
-            Serial.println("WiFi connected");
-            break;
-        case ARDUINO_EVENT_WIFI_STA_GOT_IP:
-            Serial.println("Got IP: ");
-            if (instance && instance->connectionCallback) {
-                instance->connectionCallback(true);
-            }
-            break;
         case ARDUINO_EVENT_WIFI_STA_DISCONNECTED:
-            Serial.println("WiFi disconnected");
-            if (instance && instance->connectionCallback) {
-                instance->connectionCallback(false);
-            }
+            instance->eventReason = info.wifi_sta_disconnected.reason;
+            instance->eventDisconnected = true;
             break;
         default:
             break;
@@ -0,0 +1,278 @@
+#include "driver/net/WsOutbox.h"
+#include "utils/Logger.h"
+
+#include <LittleFS.h>
+#include <rom/crc.h>
+#include <stddef.h>
+#include <time.h>
+
+namespace {
+    constexpr const char* LOG_PATH = "/outbox.log";
+    constexpr const char* ACK_PATH = "/outbox.ack";
+    constexpr uint8_t FLAG_ON = 0x01;
+    constexpr uint8_t FLAG_HEATING = 0x02;
+    constexpr time_t VALID_EPOCH = 1700000000;   // davor: noch keine NTP-Zeit
+}
+
+WsOutbox& WsOutbox::instance() {
+    static WsOutbox instance;
+    return instance;
+}
+
+void WsOutbox::begin() {
+    if (task) return;
+    queue = xQueueCreate(QUEUE_LEN, sizeof(WsPendingMsg));
+    if (!queue) {
+        failed = true;
+        return;
+    }
+    // Niedrige Priorität: Flash-Erase darf dauern, der Loop läuft weiter
+    xTaskCreatePinnedToCore(taskEntry, "outbox", 4096, this, 1, &task, APP_CPU_NUM);
+}
+
+// ============================================================================
+// Loop-Seite - nur RAM, kein Flash
+// ============================================================================
+
+bool WsOutbox::enqueue(WsPendingMsg msg) {
+    if (failed || !queue) return false;
+    const time_t now = time(nullptr);
+    msg.at = now > VALID_EPOCH ? (uint32_t)now : 0;
+    msg.seq = 0;
+    if (xQueueSend(queue, &msg, 0) != pdTRUE) {
+        portENTER_CRITICAL(&mux);
+        stats_.dropped++;
+        portEXIT_CRITICAL(&mux);
+        logPrint("ws", "Outbox queue full, dropping event");
+        return false;
+    }
+    return true;
+}
+
+bool WsOutbox::nextForSend(WsPendingMsg& out, uint32_t now) {
+    bool ok = false;
+    portENTER_CRITICAL(&mux);
+    if (hasNext && now - lastSend >= REPLAY_INTERVAL_MS && (!sentAt || now - sentAt >= ACK_TIMEOUT_MS)) {
+        if (sentAt) stats_.resent++;
+        out = next;
+        sentAt = now ? now : 1;
+        lastSend = now;
+        ok = true;
+    }
+    portEXIT_CRITICAL(&mux);
+    return ok;
+}
+
+void WsOutbox::ack(uint32_t seq) {
+    bool matched = false;
+    portENTER_CRITICAL(&mux);
+    if (hasNext && next.seq == seq) {
+        ackedSeq = seq;
+        hasNext = false;
+        sentAt = 0;
+        stats_.acked++;
+        matched = true;
+    }
+    portEXIT_CRITICAL(&mux);
+    if (matched && task) xTaskNotifyGive(task);
+}
+
+void WsOutbox::onConnected() {
+    // Nach Reconnect sofort erneut senden statt auf den Ack-Timeout zu warten
+    portENTER_CRITICAL(&mux);
+    sentAt = 0;
+    portEXIT_CRITICAL(&mux);
+}
+
+WsOutbox::Stats WsOutbox::stats() const {
+    portENTER_CRITICAL(&mux);
+    Stats s = stats_;
+    portEXIT_CRITICAL(&mux);
+    return s;
+}
+
+// ============================================================================
+// Writer-Task - alle Flash-Zugriffe
+// ============================================================================
+
+void WsOutbox::taskEntry(void* arg) {
+    static_cast<WsOutbox*>(arg)->run();
+}
+
+void WsOutbox::run() {
+    if (!mount()) {
+        failed = true;
+        logPrint("ws", "Outbox: LittleFS nicht verfügbar, Events gehen direkt raus");
+        vTaskDelete(nullptr);
+        return;
+    }
+
+    for (;;) {
+        // Aufwachen per Ack-Notify oder spätestens nach FLUSH_INTERVAL_MS
+        ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(FLUSH_INTERVAL_MS));
+        appendQueued();
+        persistAck();
+        loadNext();
+    }
+}
+
+bool WsOutbox::mount() {
+    if (!LittleFS.begin(true, "/littlefs", 5, "spiffs")) return false;
+
+    if (File f = LittleFS.open(ACK_PATH, "r")) {
+        f.read(reinterpret_cast<uint8_t*>(&persistedAck), sizeof(persistedAck));
+        f.close();
+    }
+
+    // Log einmal durchgehen: höchste seq und erstes unbestätigtes Record finden
+    uint32_t maxSeq = persistedAck;
+    uint32_t pending = 0;
+    bool foundStart = false;
+    if (File f = LittleFS.open(LOG_PATH, "r")) {
+        FlashRecord r;
+        size_t offset = 0;
+        while (f.read(reinterpret_cast<uint8_t*>(&r), sizeof(r)) == sizeof(r)) {
+            const bool valid = crc32_le(0, reinterpret_cast<const uint8_t*>(&r), offsetof(FlashRecord, crc)) == r.crc;
+            if (valid && r.seq > maxSeq) maxSeq = r.seq;
+            if (valid && r.seq > persistedAck) {
+                pending++;
+                if (!foundStart) {
+                    readOffset = offset;
+                    foundStart = true;
+                }
+            }
+            offset += sizeof(r);
+        }
+        if (!foundStart) readOffset = offset;
+        f.close();
+    }
+    nextSeq = maxSeq + 1;
+
+    portENTER_CRITICAL(&mux);
+    ackedSeq = persistedAck;
+    stats_.mounted = true;
+    stats_.pending = pending;
+    portEXIT_CRITICAL(&mux);
+
+    if (pending) logPrint("ws", "Outbox: %u Events aus dem Flash warten auf Replay", pending);
+    return true;
+}
+
+void WsOutbox::appendQueued() {
+    WsPendingMsg msg;
+    if (!uxQueueMessagesWaiting(queue)) return;
+
+    File f = LittleFS.open(LOG_PATH, "a");
+    if (!f) return;
+
+    uint32_t stored = 0;
+    uint32_t dropped = 0;
+    while (xQueueReceive(queue, &msg, 0) == pdTRUE) {
+        if (f.size() + sizeof(FlashRecord) > MAX_LOG_BYTES) {
+            dropped++;
+            continue;
+        }
+        msg.seq = nextSeq++;
+        FlashRecord r = toFlash(msg);
+        if (f.write(reinterpret_cast<const uint8_t*>(&r), sizeof(r)) == sizeof(r)) stored++;
+        else dropped++;
+    }
+    f.close();
+
+    if (dropped) logPrint("ws", "Outbox voll, %u Events verworfen", dropped);
+    portENTER_CRITICAL(&mux);
+    stats_.stored += stored;
+    stats_.pending += stored;
+    stats_.dropped += dropped;
+    portEXIT_CRITICAL(&mux);
+}
+
+void WsOutbox::persistAck() {
+    portENTER_CRITICAL(&mux);
+    const uint32_t acked = ackedSeq;
+    portEXIT_CRITICAL(&mux);
+    if (acked == persistedAck) return;
+
+    if (File f = LittleFS.open(ACK_PATH, "w")) {
+        f.write(reinterpret_cast<const uint8_t*>(&acked), sizeof(acked));
+        f.close();
+    }
+    persistedAck = acked;
+    readOffset = nextOffset;
+
+    // Alles bestätigt: Log verwerfen statt endlos anzuhängen
+    File f = LittleFS.open(LOG_PATH, "r");
+    const bool drained = !f || readOffset >= f.size();
+    if (f) f.close();
+    if (drained) {
+        LittleFS.remove(LOG_PATH);
+        readOffset = nextOffset = 0;
+    }
+
+    portENTER_CRITICAL(&mux);
+    if (stats_.pending) stats_.pending--;
+    portEXIT_CRITICAL(&mux);
+}
+
+void WsOutbox::loadNext() {
+    portENTER_CRITICAL(&mux);
+    const bool busy = hasNext;
+    portEXIT_CRITICAL(&mux);
+    if (busy) return;
+
+    File f = LittleFS.open(LOG_PATH, "r");
+    if (!f) return;
+    f.seek(readOffset);
+
+    FlashRecord r;
+    WsPendingMsg msg;
+    size_t offset = readOffset;
+    bool found = false;
+    while (f.read(reinterpret_cast<uint8_t*>(&r), sizeof(r)) == sizeof(r)) {
+        offset += sizeof(r);
+        // Kaputte oder schon bestätigte Records überspringen
+        if (r.seq > persistedAck && fromFlash(r, msg)) {
+            found = true;
+            break;
+        }
+        readOffset = offset;
+    }
+    f.close();
+    if (!found) return;
+
+    nextOffset = offset;
+    portENTER_CRITICAL(&mux);
+    next = msg;
+    hasNext = true;
+    sentAt = 0;
+    portEXIT_CRITICAL(&mux);
+}
+
+WsOutbox::FlashRecord WsOutbox::toFlash(const WsPendingMsg& msg) {
+    FlashRecord r = {};
+    r.seq = msg.seq;
+    r.at = msg.at;
+    r.durationSec = msg.durationSec;
+    r.clicks = msg.clicks;
+    r.caps = msg.caps;
+    r.type = (uint8_t)msg.type;
+    r.cycle = msg.cycle;
+    r.flags = (msg.isOn ? FLAG_ON : 0) | (msg.isHeating ? FLAG_HEATING : 0);
+    r.crc = crc32_le(0, reinterpret_cast<const uint8_t*>(&r), offsetof(FlashRecord, crc));
+    return r;
+}
+
+bool WsOutbox::fromFlash(const FlashRecord& r, WsPendingMsg& out) {
+    if (crc32_le(0, reinterpret_cast<const uint8_t*>(&r), offsetof(FlashRecord, crc)) != r.crc) return false;
+    out = WsPendingMsg();
+    out.type = (WsMsgType)r.type;
+    out.seq = r.seq;
+    out.at = r.at;
+    out.durationSec = r.durationSec;
+    out.clicks = r.clicks;
+    out.caps = r.caps;
+    out.cycle = r.cycle;
+    out.isOn = r.flags & FLAG_ON;
+    out.isHeating = r.flags & FLAG_HEATING;
+    return true;
+}
@@ -7,6 +7,7 @@
 #include "SysModule.h"
 #include "driver/Audio.h"
 #include "driver/net/WebSocketManager.h"
+#include "core/DeviceState.h"
 
 HeaterController::HeaterController()
     : BaseClass("HeaterController"),
@@ -43,7 +44,7 @@ void HeaterController::init() {
 void HeaterController::transitionTo(State newState) {
     if (state == newState) return;
 
-    Serial.printf("🔥 State: %d -> %d\n", static_cast<int>(state), static_cast<int>(newState));
+    LOG_DEFERRED("heat", "🔥 State: %d -> %d", static_cast<int>(state), static_cast<int>(newState));
     state = newState;
 }
 
@@ -100,17 +101,23 @@ void HeaterController::update() {
     
     updateTemperature();
 
-    // Temp-Readings ans Backend loggen (RAW + kalibriert) für Analyse
-    // Während Heizen jede Sekunde, sonst alle 5s (Raumtemp-Baseline)
+    // Temp-Samples ans Backend loggen (RAW + kalibriert + ZVS-Phase + Leistung) für Analyse
+    // Während Heizen mit 10 Hz, sonst alle 5s (Raumtemp-Baseline). WebSocketManager sammelt
+    // die Samples und schickt sie gebündelt (BatchPolicy), nicht ein Frame pro Sample.
     // MUSS vor der State-Weiche stehen - der HEATING-Zweig returned sonst früh
-    uint32_t interval = (state == State::HEATING) ? 1000 : 5000;
+    const bool burst = telemetryBurstUntil && (int32_t)(telemetryBurstUntil - millis()) > 0;
+    uint32_t interval = (state == State::HEATING || burst)
+        ? TelemetryConfig::SAMPLE_INTERVAL_HEATING_MS : TelemetryConfig::SAMPLE_INTERVAL_IDLE_MS;
     if (millis() - lastTempReadingSent >= interval) {
-        WebSocketManager::instance().sendTempReading(
-            static_cast<float>(hs.tempIRRaw),
-            static_cast<float>(hs.temp),
-            state == State::HEATING
-        );
-        lastTempReadingSent = millis();
+        WsTempSample sample;
+        sample.ms = millis();
+        sample.rawDeci = hs.tempIRRaw * 10;
+        sample.calDeci = hs.temp * 10;
+        sample.power = hs.power;
+        sample.zvsOn = hs.zvsOn;
+        sample.isHeating = state == State::HEATING;
+        WebSocketManager::instance().sendTempSample(sample);
+        lastTempReadingSent = sample.ms;
     }
 
     if (state == State::HEATING) {
@@ -124,7 +131,7 @@ void HeaterController::update() {
         if (millis() - heatStartTime >= HeaterConfig::TEMP_STALL_MIN_HEAT_MS &&
             millis() - stallWindowStart >= HeaterConfig::TEMP_STALL_WINDOW_MS) {
             if (hs.temp + HeaterConfig::TEMP_STALL_FALL_DELTA <= stallWindowStartTemp) {
-                logPrint("log", "🔥 Vape removed (temp %u -> %u), stopping", stallWindowStartTemp, static_cast<unsigned int>(hs.temp));
+                LOG_DEFERRED("heat", "🔥 Vape removed (temp %u -> %u), stopping", stallWindowStartTemp, static_cast<unsigned int>(hs.temp));
                 stopHeating(true);
                 return;
             }
@@ -174,6 +181,22 @@ void HeaterController::updateTemperature() {
     }
 }
 
+const char* HeaterController::startInterlock() const {
+    auto& hs = HeaterState::instance();
+    if (DeviceState::instance().locked) return "locked";
+    if (state == State::ERROR) return "heater error";
+    if (state == State::HEATING) return "already heating";
+    if (hs.temp == 0) return "no temperature reading";
+    // Ohne Cutoff (MAX_TEMPERATURE) nur per Hand am Gerät, FIRE gehalten
+    if (hs.tempLimit >= HeaterConfig::MAX_TEMPERATURE) return "no cutoff limit";
+    if (Safety::checkFailed()) return "safety check failed";
+    return nullptr;
+}
+
+void HeaterController::requestTelemetryBurst(uint32_t ms) {
+    telemetryBurstUntil = ms ? (millis() + ms) | 1 : 0;
+}
+
 void HeaterController::setAutoStopTime(uint32_t time) {
     autoStopTime = time;
 }
@@ -200,19 +223,19 @@ int16_t HeaterController::markIRClick(uint16_t actualTemp) {
     // If actualTemp matches one of the stored actuals, use that slot. Otherwise pick an empty slot (A first).
     if (actualTemp == hs.irCalActualA) {
         returnVal = hs.irCalMeasuredA.set(measured);
-        Serial.printf("IR click stored in A: measured=%u actual=%u\n", measured, actualTemp);
+        LOG_DEFERRED("heat", "IR click stored in A: measured=%u actual=%u", measured, actualTemp);
     } else if (actualTemp == hs.irCalActualB) {
         returnVal = hs.irCalMeasuredB.set(measured);
-        Serial.printf("IR click stored in B: measured=%u actual=%u\n", measured, actualTemp);
+        LOG_DEFERRED("heat", "IR click stored in B: measured=%u actual=%u", measured, actualTemp);
     } else {
         if (hs.irCalMeasuredA == 0) {
             returnVal = hs.irCalMeasuredA.set(measured);
             hs.irCalActualA.set(actualTemp);
-            Serial.printf("IR click stored in A (new actual): measured=%u actual=%u\n", measured, actualTemp);
+            LOG_DEFERRED("heat", "IR click stored in A (new actual): measured=%u actual=%u", measured, actualTemp);
         } else {
             returnVal = hs.irCalMeasuredB.set(measured);
             hs.irCalActualB.set(actualTemp);
-            Serial.printf("IR click stored in B (new actual): measured=%u actual=%u\n", measured, actualTemp);
+            LOG_DEFERRED("heat", "IR click stored in B (new actual): measured=%u actual=%u", measured, actualTemp);
         }
     }
 
@@ -242,8 +265,8 @@ void HeaterController::computeIRCalibration() {
     hs.irCalSlope.set(slope);
     hs.irCalOffset.set(offset);
 
-    Serial.printf("IR calibration computed: slope=%.6f offset=%.2f (mA=%u,aA=%u mB=%u,aB=%u)\n",
-                  slope, offset, mA, aA, mB, aB);
+    LOG_DEFERRED("heat", "IR calibration computed: slope=%.6f offset=%.2f (mA=%u,aA=%u mB=%u,aB=%u)",
+                 slope, offset, mA, aA, mB, aB);
 }
 
 void HeaterController::clearIRCalibration() {
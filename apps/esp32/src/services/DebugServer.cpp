@@ -1,13 +1,28 @@
 #include "services/DebugServer.h"
 #include "utils/Logger.h"
 #include "driver/net/WebSocketManager.h"
+#include "driver/net/WsOutbox.h"
+#include "driver/net/WiFiManager.h"
+#include "driver/net/LanLink.h"
+#include "driver/net/TlsProfile.h"
+#include "driver/I2cBus.h"
+#include "driver/input/InputManager.h"
 #include "core/DeviceState.h"
 #include "heater/HeaterState.h"
 #include "Config.h"
+#include "ui/base/RenderBench.h"
+#include "ui/base/ScreenTransition.h"
+#include "PhotonLatency.h"
+#include "utils/JsonStream.h"
+#include "services/TelemetryStream.h"
+#include "services/FirmwareUpdater.h"
 
 #include <WiFi.h>
 #include <Update.h>
 #include <WiFiClientSecure.h>
+#include <memory>
+#include <new>
+#include <optional>
 #include "utils/Logger.h"
 
 static const char* PAGE_HTML PROGMEM = R"rawliteral(
@@ -31,7 +46,7 @@ button.danger{background:#c62828}
 </head>
 <body>
 <h1>🔥 Heizbox Debug <span id="ver" style="font-size:12px;color:#888"></span></h1>
-<div id="status"><b>Firmware</b><span id="s_fw">-</span><b>WiFi</b><span id="s_wifi">-</span><b>IP</b><span id="s_ip">-</span><b>RSSI</b><span id="s_rssi">-</span><b>WebSocket</b><span id="s_ws">-</span><b>Uptime</b><span id="s_up">-</span><b>Heap</b><span id="s_heap">-</span><b>Backend</b><span id="s_be">-</span></div>
+<div id="status"><b>Firmware</b><span id="s_fw">-</span><b>WiFi</b><span id="s_wifi">-</span><b>IP</b><span id="s_ip">-</span><b>RSSI</b><span id="s_rssi">-</span><b>WebSocket</b><span id="s_ws">-</span><b>Uptime</b><span id="s_up">-</span><b>Heap</b><span id="s_heap">-</span><b>Backend</b><span id="s_be">-</span><b>Live</b><span id="s_live">-</span></div>
 <button onclick="restart()">🔄 Neustart</button>
 <div style="margin-bottom:12px">
 <button onclick="checkUpdate()">\u2b06 Update checken</button>
@@ -44,7 +59,7 @@ button.danger{background:#c62828}
 </div>
 <div id="log">Lade Log...</div>
 <script>
-let lastTs = 0;
+let nextSeq = 0;
 async function refresh(){
   try{
     const r = await fetch('/api/status'); const s = await r.json();
@@ -58,9 +73,9 @@ async function refresh(){
     document.getElementById('s_be').textContent = s.backend;
   }catch(e){}
   try{
-    const r = await fetch('/api/log?since=' + lastTs); const j = await r.json();
+    const r = await fetch('/api/log?seq=' + nextSeq); const j = await r.json();
     const el = document.getElementById('log');
-    if(j.since !== undefined) lastTs = j.since;
+    if(j.next !== undefined) nextSeq = j.next;
     if(j.lines){ for(const l of j.lines){
       const div = document.createElement('div');
       div.innerHTML = '<span class="ln">' + l.ts + '</span><span class="t-' + (l.t||'log') + '">' + esc(l.m) + '</span>';
@@ -99,8 +114,18 @@ async function saveSettings(){
     else loadSettings();
   }catch(e){ alert('Speichern fehlgeschlagen'); }
 }
+function live(){
+  const es = new EventSource('/api/stream?hz=5');
+  es.addEventListener('telemetry', (e) => {
+    const d = JSON.parse(e.data);
+    document.getElementById('s_live').textContent = d.temp + '°C (IR ' + d.tempRaw + ') ' + d.dTdt.toFixed(1) + '°C/s, '
+      + (d.heating ? '🔥 ' + d.power + '%' + (d.zvs ? ' ZVS' : '') : 'aus') + ', Loop ' + d.loopUs + '/' + d.loopMaxUs + ' µs';
+  });
+  es.onerror = () => { document.getElementById('s_live').textContent = '-'; };
+}
 setInterval(refresh, 2000);
 refresh();
+live();
 loadSettings();
 </script>
 </body>
@@ -111,98 +136,521 @@ void DebugServer::init() {
     server.on("/", HTTP_GET, [this]() { handleRoot(); });
     server.on("/api/status", HTTP_GET, [this]() { handleApiStatus(); });
     server.on("/api/log", HTTP_GET, [this]() { handleApiLog(); });
+    server.on("/api/stream", HTTP_GET, [this]() { handleApiStream(); });
+    server.on("/api/log/level", HTTP_POST, [this]() { handleApiLogLevel(); });
+    server.on("/api/log/bin", HTTP_GET, [this]() { handleApiLogBin(); });
     server.on("/api/restart", HTTP_POST, [this]() {
         server.send(200, "application/json", "{\"ok\":true}");
         delay(100);
         ESP.restart();
     });
-    server.on("/api/nettest", HTTP_GET, [this]() {
-        handleApiNetTest();
-    });
+    server.on("/api/nettest", HTTP_GET, [this]() { handleApiNetTest(); });
+    server.on("/api/nettest", HTTP_POST, [this]() { handleApiNetTestStart(); });
     server.on("/api/settings", HTTP_GET, [this]() { handleApiSettingsGet(); });
-    server.on("/api/settings", HTTP_POST, [this]() { handleApiSettingsPost(); });
-    server.on("/api/update", HTTP_POST, [this]() { handleApiUpdate(); });
+    onLoop("/api/settings", HTTP_POST, &DebugServer::handleApiSettingsPost);
+    onLoop("/api/update", HTTP_POST, &DebugServer::handleApiUpdate);
     server.on("/api/ota", HTTP_POST,
         [this]() { handleApiOtaDone(); },
         [this]() { handleApiOtaUpload(); });
+    server.on("/api/bench", HTTP_GET, [this]() { handleApiBench(); });
+    server.on("/api/bench/telemetry", HTTP_GET, [this]() { handleApiBenchTelemetry(); });
+    server.on("/api/screenshot", HTTP_GET, [this]() { handleApiScreenshot(); });
+    server.on("/api/latency", HTTP_GET, [this]() { handleApiLatency(); });
     server.onNotFound([this]() { handleNotFound(); });
     server.begin();
+
+    loopDone_ = xSemaphoreCreateBinary();
+    xTaskCreatePinnedToCore(taskEntry, "debugSrv", TASK_STACK, this, TASK_PRIORITY, &task_, PRO_CPU_NUM);
     logPrint("boot", "🔧 DebugServer auf Port 80 gestartet");
 }
 
+void DebugServer::taskEntry(void* arg) {
+    auto* self = static_cast<DebugServer*>(arg);
+    for (;;) {
+        self->server.handleClient();
+        TelemetryStream::instance().pump();
+        vTaskDelay(pdMS_TO_TICKS(2));
+    }
+}
+
 void DebugServer::update() {
-    server.handleClient();
+    portENTER_CRITICAL(&mux_);
+    const std::function<void()>* call = loopCall_;
+    loopCall_ = nullptr;
+    portEXIT_CRITICAL(&mux_);
+    if (!call) return;
+    (*call)();
+    xSemaphoreGive(loopDone_);
+}
+
+bool DebugServer::runInLoop(const std::function<void()>& fn) {
+    portENTER_CRITICAL(&mux_);
+    loopCall_ = &fn;
+    portEXIT_CRITICAL(&mux_);
+    if (xSemaphoreTake(loopDone_, pdMS_TO_TICKS(LOOP_CALL_TIMEOUT_MS)) == pdTRUE) return true;
+
+    // Timeout: zurückziehen, solange der Loop den Aufruf noch nicht übernommen hat
+    portENTER_CRITICAL(&mux_);
+    const bool pending = loopCall_ == &fn;
+    if (pending) loopCall_ = nullptr;
+    portEXIT_CRITICAL(&mux_);
+    if (!pending) xSemaphoreTake(loopDone_, portMAX_DELAY);  // läuft gerade, fn lebt auf unserem Stack
+    return !pending;
+}
+
+// Route, deren Handler im Loop-Kontext läuft (UI, Display, State-Observer)
+void DebugServer::onLoop(const char* uri, HTTPMethod method, void (DebugServer::*handler)()) {
+    server.on(uri, method, [this, handler]() {
+        if (!runInLoop([this, handler]() { (this->*handler)(); })) {
+            server.send(503, "application/json", "{\"ok\":false,\"error\":\"loop busy\"}");
+        }
+    });
 }
 
 void DebugServer::handleRoot() {
     server.send_P(200, "text/html", PAGE_HTML);
 }
 
+// Chunked-Antwort: der Writer sendet direkt in BUFFER_SIZE-Stücken, kein Gesamt-String im Heap
+void DebugServer::sendJson(const std::function<void(JsonStream&)>& fill) {
+    server.setContentLength(CONTENT_LENGTH_UNKNOWN);
+    server.send(200, "application/json", "");
+    {
+        JsonStream json([this](const char* data, size_t len) { server.sendContent(data, len); });
+        fill(json);
+    }
+    server.sendContent("");
+}
+
 void DebugServer::handleApiStatus() {
-    auto& ws = WebSocketManager::instance();
+    sendJson([](JsonStream& json) {
+        auto& ws = WebSocketManager::instance();
+        char uptime[16];
+        snprintf(uptime, sizeof(uptime), "%lus", (unsigned long)(millis() / 1000));
+
+        json.beginObject()
+            .field("firmware", FIRMWARE_VERSION)
+            .field("wifi", WiFi.status() == WL_CONNECTED ? "connected" : "disconnected")
+            .field("ip", WiFi.localIP().toString())
+            .field("rssi", WiFi.RSSI())
+            .field("ws", ws.isConnected())
+            .field("uptime", uptime)
+            .field("heap", ESP.getFreeHeap() / 1024)
+            .field("freeSketch", ESP.getFreeSketchSpace())
+            .field("backend", NetworkConfig::BACKEND_WS_URL);
+
+        if (const WiFiManager* wifi = WiFiManager::active()) {
+            const WiFiStats& w = wifi->stats();
+            json.beginObject("wifiLink")
+                .field("state", WiFiManager::linkStateName(wifi->linkState()))
+                .field("connects", w.connects)
+                .field("disconnects", w.disconnects)
+                .field("attempts", w.attempts)
+                .field("lastReason", w.lastReason)
+                .field("backoffMs", w.backoffMs)
+                .field("upSec", w.connectedSinceMs ? (millis() - w.connectedSinceMs) / 1000 : 0)
+                .field("longestUpSec", w.longestUpMs / 1000)
+                .field("downSec", w.totalDownMs / 1000)
+                .field("rssiAvg", w.rssiAvg, 1)
+                .field("rssiMin", w.rssiMin)
+                .field("rssiMax", w.rssiMax)
+                .endObject();
+        }
+
+        const auto outbox = WsOutbox::instance().stats();
+        json.beginObject("outbox")
+            .field("mounted", outbox.mounted)
+            .field("pending", outbox.pending)
+            .field("stored", outbox.stored)
+            .field("acked", outbox.acked)
+            .field("resent", outbox.resent)
+            .field("dropped", outbox.dropped)
+            .endObject();
+
+        json.beginObject("wsQueue");
+        for (uint8_t i = 0; i < (uint8_t)WsPriority::COUNT; i++) {
+            const auto prio = (WsPriority)i;
+            const auto& q = ws.queueStats(prio);
+            json.beginObject(WebSocketManager::priorityName(prio))
+                .field("queued", q.queued)
+                .field("sent", q.sent)
+                .field("coalesced", q.coalesced)
+                .field("dropped", q.dropped)
+                .endObject();
+        }
+        json.endObject();
+
+        const auto& lan = LanLink::instance();
+        json.beginObject("lan")
+            .field("running", lan.isRunning())
+            .field("control", lan.controlEnabled())
+            .field("sent", lan.stats().sent)
+            .field("sendErrors", lan.stats().sendErrors)
+            .field("commands", lan.stats().control)
+            .field("authFailed", lan.stats().authFailed)
+            .field("replayed", lan.stats().replayed)
+            .field("rateLimited", lan.stats().rateLimited)
+            .endObject();
+
+        const auto& tls = TlsProfile::stats();
+        json.beginObject("tls")
+            .field("active", ws.isTls())
+            .field("pinned", TlsProfile::pinnedCA() != nullptr)
+            .field("handshakes", tls.handshakes)
+            .field("heapFallbacks", tls.heapFallbacks)
+            .field("lastCost", tls.lastCost)
+            .field("peakCost", tls.peakCost)
+            .field("maxAllocHeap", ESP.getMaxAllocHeap())
+            .field("minFreeBlock", TlsProfile::MIN_FREE_BLOCK)
+            .endObject();
+
+        auto& bus = I2cBus::instance();
+        json.beginObject("i2c")
+            .field("clock", bus.clock())
+            .field("utilPermille", bus.utilisation());
+        for (uint8_t i = 0; i < (uint8_t)I2cBus::Priority::COUNT; i++) {
+            const auto prio = (I2cBus::Priority)i;
+            const auto& b = bus.stats(prio);
+            json.beginObject(I2cBus::priorityName(prio))
+                .field("transactions", b.transactions)
+                .field("errors", b.errors)
+                .field("retries", b.retries)
+                .field("deferred", b.deferred)
+                .field("busyUs", b.busyUs)
+                .field("maxHoldUs", b.maxHoldUs)
+                .field("maxWaitUs", b.maxWaitUs)
+                .endObject();
+        }
+        json.endObject();
+
+        const auto& input = InputManager::stats();
+        json.beginObject("input")
+            .field("events", input.events)
+            .field("gestures", input.gestures)
+            .field("dropped", input.dropped)
+            .field("latencyLastUs", input.latencyLastUs)
+            .field("latencyAvgUs", input.events ? (uint32_t)(input.latencySumUs / input.events) : 0u)
+            .field("latencyMaxUs", input.latencyMaxUs)
+            .field("handlerMaxUs", input.handlerMaxUs)
+            .endObject();
+
+        const auto& in = ws.inboundStats();
+        json.beginObject("wsInbound")
+            .field("frames", in.frames)
+            .field("rejected", in.rejected)
+            .field("arenaPeak", in.arenaPeak)
+            .field("arenaSize", (uint32_t)WebSocketManager::inboundBudget())
+            .endObject();
+
+        const auto& enc = ws.encodeStats();
+        json.beginObject("wsEncode")
+            .field("frames", enc.frames)
+            .field("failed", enc.failed)
+            .endObject();
+
+        const LogStats log = logStats();
+        const float cyclesPerUs = ESP.getCpuFreqMHz();
+        json.beginObject("log")
+            .field("calls", log.calls)
+            .field("dropped", log.dropped)
+            .field("wsDropped", log.wsDropped)
+            .field("avgUs", log.avgCycles / cyclesPerUs, 1)
+            .field("maxUs", log.maxCycles / cyclesPerUs, 1)
+            .beginObject("levels");
+        for (uint8_t i = 0; i < (uint8_t)LogSink::COUNT; i++) {
+            json.field(logSinkName((LogSink)i), logLevelName(logSinkLevel((LogSink)i)));
+        }
+        json.endObject().endObject();
+
+        auto& stream = TelemetryStream::instance();
+        json.beginObject("stream")
+            .field("clients", stream.clientCount())
+            .field("connects", stream.stats().connects)
+            .field("events", stream.stats().events)
+            .field("dropped", stream.stats().dropped)
+            .endObject();
+
+        json.endObject();
+    });
+}
+
+// Server-Sent Events: /api/stream?hz=10. Der Socket wird an TelemetryStream übergeben,
+// WebServer antwortet selbst nicht und gibt nur seine Kopie des Clients frei.
+void DebugServer::handleApiStream() {
+    const uint8_t hz = server.hasArg("hz") ? constrain(server.arg("hz").toInt(), 1, TelemetryStream::MAX_HZ) : 10;
+    if (!TelemetryStream::instance().addClient(server.client(), hz)) {
+        server.send(503, "application/json", "{\"error\":\"too many stream clients\"}");
+    }
+}
+
+// Pagination per seq: /api/log?seq=<next der letzten Antwort>&limit=64
+void DebugServer::handleApiLog() {
+    const uint32_t seq = strtoul(server.arg("seq").c_str(), nullptr, 10);
+    const uint16_t limit = server.hasArg("limit") ? constrain(server.arg("limit").toInt(), 1, LOG_RING_SIZE) : LOG_RING_SIZE;
+    sendJson([seq, limit](JsonStream& json) {
+        json.beginObject();
+        logRingWrite(json, seq, limit);
+        json.endObject();
+    });
+}
+
+// Deferred-Logs roh, dekodieren mit: scripts/logdecode.py firmware.elf --url http://<ip>/api/log/bin
+void DebugServer::handleApiLogBin() {
+    std::unique_ptr<uint8_t[]> buf(new (std::nothrow) uint8_t[LOG_BIN_RING_BYTES + LOG_BIN_DUMP_HEADER]);
+    if (!buf) {
+        server.send(503, "application/json", "{\"ok\":false,\"error\":\"no memory\"}");
+        return;
+    }
+    const size_t len = logBinRingDump(buf.get(), LOG_BIN_RING_BYTES + LOG_BIN_DUMP_HEADER);
+    server.setContentLength(len);
+    server.send(200, "application/octet-stream", "");
+    server.sendContent(reinterpret_cast<const char*>(buf.get()), len);
+}
+
+// Sink-Level setzen: POST /api/log/level sink=ws&level=warn
+void DebugServer::handleApiLogLevel() {
+    const String sinkArg = server.arg("sink");
+    const String levelArg = server.arg("level");
+    int sink = -1;
+    int level = -1;
+    for (uint8_t i = 0; i < (uint8_t)LogSink::COUNT; i++) {
+        if (sinkArg == logSinkName((LogSink)i)) sink = i;
+    }
+    for (uint8_t i = 0; i <= (uint8_t)LogLevel::ERROR; i++) {
+        if (levelArg == logLevelName((LogLevel)i)) level = i;
+    }
+    if (sink < 0 || level < 0) {
+        server.send(400, "application/json", "{\"ok\":false,\"error\":\"unknown sink or level\"}");
+        return;
+    }
+    logSetSinkLevel((LogSink)sink, (LogLevel)level);
+    server.send(200, "application/json", "{\"ok\":true}");
+}
+
+// Render-Benchmark: /api/bench?frames=30&headless=1. Läuft in Scheiben zu BENCH_FRAMES_PER_LOOP
+// Frames je Loop-Durchlauf, der Server-Task wartet dazwischen; während des Heizens abgelehnt.
+void DebugServer::handleApiBench() {
+    uint16_t frames = server.hasArg("frames") ? constrain(server.arg("frames").toInt(), 1, 500) : 30;
+    bool headless = server.arg("headless") == "1";
+    auto& bench = RenderBench::instance();
+
+    const char* error = nullptr;
+    if (!runInLoop([&]() {
+            if (HeaterState::instance().isHeating) error = "heating";
+            else if (!bench.begin(frames, headless)) error = "ui not ready";
+        })) {
+        error = "loop busy";
+    }
+    if (error) {
+        server.send(strcmp(error, "heating") == 0 ? 409 : 503, "application/json",
+                    String("{\"ok\":false,\"error\":\"") + error + "\"}");
+        return;
+    }
+
+    bool done = false;
+    while (!done) {
+        if (!runInLoop([&]() { done = bench.step(BENCH_FRAMES_PER_LOOP); })) {
+            runInLoop([&]() { bench.cancel(); });
+            server.send(503, "application/json", "{\"ok\":false,\"error\":\"loop busy\"}");
+            return;
+        }
+    }
+    server.send(200, "application/json", RenderBench::toJson(bench.report()));
+}
+
+static void writeHistogram(JsonStream& json, const char* key, const PhotonLatency::Histogram& h) {
+    json.beginObject(key)
+        .field("samples", h.samples)
+        .field("avgUs", h.avgUs())
+        .field("maxUs", h.maxUs)
+        .field("p50Ms", h.percentileMs(50))
+        .field("p95Ms", h.percentileMs(95))
+        .beginArray("counts");
+    for (uint8_t b = 0; b < PhotonLatency::BUCKETS; b++) json.value(h.counts[b]);
+    json.endArray().endObject();
+}
+
+// Press-to-Photon-Histogramme: /api/latency[?reset=1] (reset nach der Ausgabe).
+// Buckets: Obergrenzen in "bucketsMs", der letzte Zähler ist alles darüber; pXX = 0 heißt darüber.
+// Im Loop nur kopieren (und ggf. zurücksetzen), serialisiert und gesendet wird auf dem Server-Task.
+void DebugServer::handleApiLatency() {
+    const bool reset = server.arg("reset") == "1";
+    std::optional<PhotonLatency> snapshot;
+    if (!runInLoop([&snapshot, reset]() {
+            snapshot.emplace(PhotonLatency::instance());
+            if (reset) PhotonLatency::instance().reset();
+        })) {
+        server.send(503, "application/json", "{\"ok\":false,\"error\":\"loop busy\"}");
+        return;
+    }
+
+    sendJson([&snapshot](JsonStream& json) {
+        const PhotonLatency& lat = *snapshot;
+        const auto& st = lat.stages();
+        const uint32_t n = st.samples ? st.samples : 1;
+
+        json.beginObject().beginArray("bucketsMs");
+        for (uint8_t b = 0; b < PhotonLatency::BUCKETS - 1; b++) json.value(PhotonLatency::BUCKET_MS[b]);
+        json.endArray()
+            .field("dropped", lat.dropped())
+            .field("stale", lat.stale())
+            .field("ignored", lat.ignored())
+            .beginObject("stagesAvgUs")
+                .field("queue", (uint32_t)(st.queueUs / n))
+                .field("handle", (uint32_t)(st.handleUs / n))
+                .field("wait", (uint32_t)(st.waitUs / n))
+                .field("render", (uint32_t)(st.renderUs / n))
+                .endObject();
+        writeHistogram(json, "total", lat.total());
+
+        json.beginObject("screens");
+        for (uint8_t i = 0; i < PhotonLatency::MAX_SCREENS; i++) {
+            if (lat.byScreen(i).samples) writeHistogram(json, screenTypeName((ScreenType)i), lat.byScreen(i));
+        }
+        json.endObject().beginObject("events");
+        for (uint8_t i = 0; i < PhotonLatency::MAX_TYPES; i++) {
+            if (lat.byType(i).samples) writeHistogram(json, inputEventTypeName((InputEventType)i), lat.byType(i));
+        }
+        json.endObject().endObject();
+    });
+}
+
+// Telemetrie-Encoding JSON vs. Binär: /api/bench/telemetry?n=200
+void DebugServer::handleApiBenchTelemetry() {
+    uint16_t n = server.hasArg("n") ? constrain(server.arg("n").toInt(), 1, 2000) : 200;
+    auto r = WebSocketManager::benchmarkEncoding(n);
+    const uint32_t count = (uint32_t)r.iterations * r.messages;
+
     String json = "{";
-    json += "\"firmware\":\"" + String(FIRMWARE_VERSION) + "\",";
-    json += "\"wifi\":\"" + String(WiFi.status() == WL_CONNECTED ? "connected" : "disconnected") + "\",";
-    json += "\"ip\":\"" + WiFi.localIP().toString() + "\",";
-    json += "\"rssi\":" + String(WiFi.RSSI()) + ",";
-    json += "\"ws\":" + String(ws.isConnected() ? "true" : "false") + ",";
-    json += "\"uptime\":\"" + String(millis() / 1000) + "s\",";
-    json += "\"heap\":" + String(ESP.getFreeHeap() / 1024) + ",";
-    json += "\"freeSketch\":" + String(ESP.getFreeSketchSpace()) + ",";
-    json += "\"backend\":\"" + String(NetworkConfig::BACKEND_WS_URL) + "\"";
+    json += "\"iterations\":" + String(r.iterations) + ",";
+    json += "\"messages\":" + String(r.messages) + ",";
+    json += "\"active\":\"" + String(WebSocketManager::instance().isBinary() ? "binary" : "json") + "\",";
+    json += "\"json\":{\"usPerMsg\":" + String((float)r.jsonUs / count, 2)
+          + ",\"bytesPerMsg\":" + String((float)r.jsonBytes / r.messages, 1) + "},";
+    json += "\"binary\":{\"usPerMsg\":" + String((float)r.binaryUs / count, 2)
+          + ",\"bytesPerMsg\":" + String((float)r.binaryBytes / r.messages, 1) + "}";
     json += "}";
     server.send(200, "application/json", json);
 }
 
-void DebugServer::handleApiLog() {
-    uint32_t since = server.arg("since").toInt();
-    String json = logRingJson(since);
-    server.send(200, "application/json", json);
+// Rendern im Loop, PNG-Encoding und Senden danach auf dem Server-Task
+void DebugServer::handleApiScreenshot() {
+    std::unique_ptr<FramebufferSink> shot;
+    if (!runInLoop([&shot]() { shot = RenderBench::instance().capture(); })) {
+        server.send(503, "application/json", "{\"ok\":false,\"error\":\"loop busy\"}");
+        return;
+    }
+    if (!shot) {
+        server.send(503, "application/json", "{\"ok\":false,\"error\":\"no framebuffer memory\"}");
+        return;
+    }
+    server.setContentLength(CONTENT_LENGTH_UNKNOWN);
+    server.send(200, "image/png", "");
+    shot->writePNG([this](const uint8_t* data, size_t len) {
+        server.sendContent(reinterpret_cast<const char*>(data), len);
+    });
+    server.sendContent("");
+}
+
+// Netzwerk-Diagnose als Hintergrund-Job: POST startet, GET pollt das Ergebnis
+void DebugServer::handleApiNetTestStart() {
+    bool start = false;
+    portENTER_CRITICAL(&mux_);
+    if (netTestState_ != JobState::RUNNING) {
+        netTestState_ = JobState::RUNNING;
+        start = true;
+    }
+    portEXIT_CRITICAL(&mux_);
+    if (start && xTaskCreatePinnedToCore(netTestEntry, "nettest", 8192, this, 1, nullptr, PRO_CPU_NUM) != pdPASS) {
+        netTestState_ = JobState::IDLE;
+        server.send(503, "application/json", "{\"ok\":false,\"error\":\"no task\"}");
+        return;
+    }
+    server.send(202, "application/json", "{\"ok\":true,\"state\":\"running\"}");
 }
 
 void DebugServer::handleApiNetTest() {
-    String result = "{";
+    portENTER_CRITICAL(&mux_);
+    const JobState state = netTestState_;
+    const NetTestResult r = netTest_;
+    portEXIT_CRITICAL(&mux_);
+
+    sendJson([state, &r](JsonStream& json) {
+        json.beginObject().field("state", state == JobState::DONE ? "done" : state == JobState::RUNNING ? "running" : "idle");
+        if (state == JobState::DONE) {
+            json.field("dns", r.dns)
+                .field("ip", r.ip)
+                .field("tcp443", r.tcp443)
+                .field("tls", r.tls)
+                .field("tlsErr", r.tlsErr)
+                .field("tlsPinned", r.pinned)
+                .field("tlsMs", r.tlsMs)
+                .field("tlsHeap", r.tlsHeap)
+                .field("http", r.http)
+                .field("ms", r.durationMs);
+        }
+        json.endObject();
+    });
+}
+
+void DebugServer::netTestEntry(void* arg) {
+    auto* self = static_cast<DebugServer*>(arg);
+    const uint32_t start = millis();
+    NetTestResult r;
+
     // 1. DNS
     IPAddress ip;
-    bool dnsOk = WiFi.hostByName("box.hzbx.de", ip);
-    result += "\"dns\":" + String(dnsOk ? "true" : "false");
-    result += ",\"ip\":\"" + (dnsOk ? ip.toString() : String("fail")) + "\"";
+    r.dns = WiFi.hostByName("box.hzbx.de", ip);
+    strlcpy(r.ip, r.dns ? ip.toString().c_str() : "fail", sizeof(r.ip));
 
     // 2. TCP-Connect
     WiFiClient probe;
-    bool tcpOk = probe.connect(ip, 443);
-    result += ",\"tcp443\":" + String(tcpOk ? "true" : "false");
-    if (tcpOk) probe.stop();
+    r.tcp443 = r.dns && probe.connect(ip, 443);
+    if (r.tcp443) probe.stop();
 
-    // 3. TLS-Handshake
+    // 3. TLS-Handshake mit dem Profil des WebSockets, Heap-Kosten der Session messen
     WiFiClientSecure tls;
-    tls.setInsecure();
-    bool tlsOk = tls.connect("box.hzbx.de", 443);
-    result += ",\"tls\":" + String(tlsOk ? "true" : "false");
-    if (tlsOk) {
-        result += ",\"tlsErr\":\"\"";
+    TlsProfile::configure(tls);
+    r.pinned = TlsProfile::pinnedCA() != nullptr;
+    const uint32_t heapBefore = ESP.getFreeHeap();
+    const uint32_t handshakeStart = millis();
+    r.tls = tls.connect("box.hzbx.de", 443);
+    r.tlsMs = millis() - handshakeStart;
+    if (r.tls) {
+        const uint32_t heapAfter = ESP.getFreeHeap();
+        r.tlsHeap = heapBefore > heapAfter ? heapBefore - heapAfter : 0;
         tls.stop();
-    } else {
-        result += ",\"tlsErr\":\"" + String(tls.lastError(nullptr, 0)) + "\"";
     }
+    else tls.lastError(r.tlsErr, sizeof(r.tlsErr));
 
     // 4. HTTP GET auf box.hzbx.de (ohne WS)
     WiFiClientSecure http;
-    http.setInsecure();
+    TlsProfile::configure(http);
     if (http.connect("box.hzbx.de", 443)) {
         http.print("GET /health HTTP/1.1\r\nHost: box.hzbx.de\r\nConnection: close\r\n\r\n");
         String resp = http.readStringUntil('\n');
-        result += ",\"http\":\"" + resp + "\"";
+        resp.trim();
+        strlcpy(r.http, resp.c_str(), sizeof(r.http));
         http.stop();
     } else {
-        result += ",\"http\":\"fail\"";
+        strlcpy(r.http, "fail", sizeof(r.http));
     }
+    r.durationMs = millis() - start;
 
-    result += "}";
-    server.send(200, "application/json", result);
+    portENTER_CRITICAL(&self->mux_);
+    self->netTest_ = r;
+    self->netTestState_ = JobState::DONE;
+    portEXIT_CRITICAL(&self->mux_);
+    logPrint("api", "nettest fertig in %u ms", (unsigned)r.durationMs);
+    vTaskDelete(nullptr);
 }
 
 void DebugServer::handleApiOtaDone() {
+    if (otaBusy_) {
+        otaBusy_ = false;
+        server.send(409, "application/json", "{\"ok\":false,\"error\":\"firmware update in progress\"}");
+        return;
+    }
     if (otaTooBig_) {
         otaTooBig_ = false;
         logPrint("ota", "OTA abgebrochen: Datei zu gross");
@@ -211,6 +659,7 @@ void DebugServer::handleApiOtaDone() {
     }
     if (Update.hasError()) {
         logPrint("ota", "OTA failed: %s", Update.errorString());
+        releaseOtaClaim();
         server.send(500, "text/plain", String("OTA failed: ") + Update.errorString());
     } else {
         logPrint("ota", "OTA via DebugServer erfolgreich, reboot");
@@ -223,12 +672,22 @@ void DebugServer::handleApiOtaDone() {
 void DebugServer::handleApiOtaUpload() {
     HTTPUpload& upload = server.upload();
     if (upload.status == UPLOAD_FILE_START) {
+        otaTooBig_ = false;
+        otaBusy_ = false;
+        // Update ist global - nicht parallel zum Hintergrund-Update des FirmwareUpdaters schreiben
+        otaClaimed_ = FirmwareUpdater::claimFlash();
+        if (!otaClaimed_) {
+            logPrint("ota", "OTA Upload abgelehnt: Firmware-Update läuft");
+            otaBusy_ = true;
+            return;
+        }
         logPrint("ota", "OTA Start: %s", upload.filename.c_str());
         // totalSize ist bei multipart im ESP32-Core oft 0 -> max annehmen, echte Groesse tracken
         if (upload.totalSize > ESP.getFreeSketchSpace()) {
             logPrint("ota", "OTA size %u > freeSketch %u, abort", upload.totalSize, ESP.getFreeSketchSpace());
             Update.abort();
             otaTooBig_ = true;
+            releaseOtaClaim();
             return;
         }
         otaReceived_ = 0;
@@ -237,49 +696,63 @@ void DebugServer::handleApiOtaUpload() {
             logPrint("ota", "Update.begin failed: %s", Update.errorString());
         }
     } else if (upload.status == UPLOAD_FILE_WRITE) {
-        if (otaTooBig_) return;
+        if (otaTooBig_ || otaBusy_) return;
         otaReceived_ += upload.currentSize;
         if (otaReceived_ > ESP.getFreeSketchSpace()) {
             logPrint("ota", "OTA empfangene Bytes %u > freeSketch %u, abort", otaReceived_, ESP.getFreeSketchSpace());
             Update.abort();
             otaTooBig_ = true;
+            releaseOtaClaim();
             return;
         }
         if (Update.write(upload.buf, upload.currentSize) != upload.currentSize) {
             logPrint("ota", "Update.write failed: %s", Update.errorString());
         }
     } else if (upload.status == UPLOAD_FILE_END) {
+        if (otaBusy_) return;
         if (otaTooBig_) { logPrint("ota", "OTA aborted (too big)"); return; }
         if (otaReceived_ == 0) {
             logPrint("ota", "OTA leer, abort");
             Update.abort();
+            releaseOtaClaim();
             server.send(400, "application/json", "{\"ok\":false,\"error\":\"empty upload\"}");
             return;
         }
         if (!Update.end(true)) {
             logPrint("ota", "Update.end failed: %s", Update.errorString());
+            releaseOtaClaim();
         }
+        // Erfolg: Claim bleibt bis zum Neustart in handleApiOtaDone()
     } else if (upload.status == UPLOAD_FILE_ABORTED) {
+        if (otaBusy_) return;
         Update.abort();
+        releaseOtaClaim();
         logPrint("ota", "OTA aborted");
     }
 }
 
+void DebugServer::releaseOtaClaim() {
+    if (!otaClaimed_) return;
+    otaClaimed_ = false;
+    FirmwareUpdater::releaseFlash();
+}
+
 void DebugServer::handleApiSettingsGet() {
-    auto& ds = DeviceState::instance();
-    auto& hs = HeaterState::instance();
-    String json = "{";
-    json += "\"brightness\":" + String(ds.display.brightness.get()) + ",";
-    json += "\"idleBrightness\":" + String(ds.display.idleBrightness.get()) + ",";
-    json += "\"irSlope\":" + String(hs.irCalSlope.get(), 4) + ",";
-    json += "\"irOffset\":" + String(hs.irCalOffset.get(), 2) + ",";
-    json += "\"irCorrection\":" + String(hs.irCorrection.get()) + ",";
-    json += "\"irMeasuredA\":" + String(hs.irCalMeasuredA.get()) + ",";
-    json += "\"irMeasuredB\":" + String(hs.irCalMeasuredB.get()) + ",";
-    json += "\"irActualA\":" + String(hs.irCalActualA.get()) + ",";
-    json += "\"irActualB\":" + String(hs.irCalActualB.get());
-    json += "}";
-    server.send(200, "application/json", json);
+    sendJson([](JsonStream& json) {
+        auto& ds = DeviceState::instance();
+        auto& hs = HeaterState::instance();
+        json.beginObject()
+            .field("brightness", ds.display.brightness.get())
+            .field("idleBrightness", ds.display.idleBrightness.get())
+            .field("irSlope", hs.irCalSlope.get(), 4)
+            .field("irOffset", hs.irCalOffset.get(), 2)
+            .field("irCorrection", hs.irCorrection.get())
+            .field("irMeasuredA", hs.irCalMeasuredA.get())
+            .field("irMeasuredB", hs.irCalMeasuredB.get())
+            .field("irActualA", hs.irCalActualA.get())
+            .field("irActualB", hs.irCalActualB.get())
+            .endObject();
+    });
 }
 
 void DebugServer::handleApiSettingsPost() {
@@ -0,0 +1,98 @@
+#include "services/FirmwareDownload.h"
+#include "utils/Logger.h"  // logPrint
+
+#include <mbedtls/sha256.h>
+#include <string.h>
+
+namespace {
+constexpr int HTTP_OK = 200;
+constexpr int HTTP_PARTIAL_CONTENT = 206;
+}  // namespace
+
+const char* FirmwareDownload::resultName(Result r) {
+    switch (r) {
+        case Result::OK:           return "ok";
+        case Result::DOWNLOAD:     return "download";
+        case Result::HTTP:         return "http";
+        case Result::WRITE:        return "flash write";
+        case Result::SHA_MISMATCH: return "SHA-256 mismatch";
+    }
+    return "?";
+}
+
+FirmwareDownload::Result FirmwareDownload::run(size_t size, const uint8_t* sha256) {
+    written_ = 0;
+    retries_ = 0;
+    fatal_ = Result::OK;
+
+    mbedtls_sha256_context sha;
+    mbedtls_sha256_init(&sha);
+    mbedtls_sha256_starts(&sha, 0);
+
+    // attempts zählt Versuche in Folge ohne ein einziges neues Byte
+    uint8_t attempts = 0;
+    Fetch f;
+    for (;;) {
+        const size_t before = written_;
+        f = fetch(size, &sha);
+        if (f != Fetch::RETRY) break;
+
+        attempts = written_ > before ? 1 : attempts + 1;
+        if (attempts > MAX_RETRIES) break;
+        retries_++;
+        logPrint("warn", "Firmware download interrupted at %u/%u, retry %u", written_, size, attempts);
+        source_.backoff(attempts);
+    }
+
+    uint8_t digest[32];
+    mbedtls_sha256_finish(&sha, digest);
+    mbedtls_sha256_free(&sha);
+
+    if (f == Fetch::FATAL) return fatal_;
+    if (f != Fetch::DONE) return Result::DOWNLOAD;
+    if (sha256 && memcmp(digest, sha256, sizeof(digest)) != 0) return Result::SHA_MISMATCH;
+    return Result::OK;
+}
+
+// Ein Request ab written_. RETRY = Verbindung weg/abgelaufen, nochmal ab dem neuen Offset.
+FirmwareDownload::Fetch FirmwareDownload::fetch(size_t size, mbedtls_sha256_context* sha) {
+    const int code = source_.open(written_);
+    size_t skip = 0;
+    if (code == HTTP_PARTIAL_CONTENT) {
+        // passt
+    } else if (code == HTTP_OK) {
+        // Server ignoriert Range: bereits geschriebene Bytes verwerfen
+        skip = written_;
+    } else {
+        logPrint("error", "Firmware download HTTP %d", code);
+        source_.close();
+        if (code >= 400 && code < 500) {
+            fatal_ = Result::HTTP;
+            return Fetch::FATAL;
+        }
+        return Fetch::RETRY;
+    }
+
+    while (written_ < size) {
+        size_t want = bufSize_;
+        if (skip) want = skip < want ? skip : want;
+        else want = size - written_ < want ? size - written_ : want;
+        const int n = source_.read(buf_, want);
+        if (n <= 0) break;
+
+        if (skip) {
+            skip -= n;
+            continue;
+        }
+        if (!target_.write(buf_, n)) {
+            source_.close();
+            fatal_ = Result::WRITE;
+            return Fetch::FATAL;
+        }
+        mbedtls_sha256_update(sha, buf_, n);
+        written_ += n;
+        target_.progress(written_, size);
+    }
+    source_.close();
+    return written_ >= size ? Fetch::DONE : Fetch::RETRY;
+}
@@ -1,4 +1,5 @@
 #include "services/FirmwareUpdater.h"
+#include "services/FirmwareDownload.h"
 #include "core/EventBus.h"
 #include "utils/Logger.h"  // logPrint
 #include "Config.h"
@@ -8,9 +9,33 @@
 #include <WiFiClientSecure.h>
 #include <Update.h>
 #include <ArduinoJson.h>
+#include <new>
+
+std::atomic<bool> FirmwareUpdater::flashClaimed_{false};
 
 FirmwareUpdater::FirmwareUpdater() {}
 
+bool FirmwareUpdater::claimFlash() {
+    bool expected = false;
+    return flashClaimed_.compare_exchange_strong(expected, true);
+}
+
+void FirmwareUpdater::releaseFlash() {
+    flashClaimed_ = false;
+}
+
+const char* FirmwareUpdater::stateName(OtaState s) {
+    switch (s) {
+        case OtaState::IDLE:        return "idle";
+        case OtaState::CHECKING:    return "checking";
+        case OtaState::DOWNLOADING: return "downloading";
+        case OtaState::VERIFYING:   return "verifying";
+        case OtaState::DONE:        return "done";
+        case OtaState::FAILED:      return "failed";
+    }
+    return "?";
+}
+
 int FirmwareUpdater::parseVersionPart(const String& v, int index) {
     int start = 0;
     for (int i = 0; i < index; i++) {
@@ -23,28 +48,111 @@ int FirmwareUpdater::parseVersionPart(const String& v, int index) {
     return v.substring(start, end).toInt();
 }
 
-bool FirmwareUpdater::checkVersion() {
+bool FirmwareUpdater::parseHex(const char* hex, uint8_t* out, size_t len) {
+    if (!hex || strlen(hex) != len * 2) return false;
+    for (size_t i = 0; i < len; i++) {
+        char byte[3] = { hex[i * 2], hex[i * 2 + 1], 0 };
+        char* end;
+        out[i] = (uint8_t)strtoul(byte, &end, 16);
+        if (*end) return false;
+    }
+    return true;
+}
+
+// HTTP braucht WiFiClient, HTTPS braucht WiFiClientSecure
+std::unique_ptr<WiFiClient> FirmwareUpdater::makeClient(const String& url) {
+    if (url.startsWith("https")) {
+        auto secure = std::make_unique<WiFiClientSecure>();
+        // Backend-CA nicht für API_ENDPOINT pinnen (anderer Host möglich); das Image prüft SHA-256
+        secure->setInsecure();
+        return secure;
+    }
+    return std::make_unique<WiFiClient>();
+}
+
+// ============================================================================
+// Loop-Seite
+// ============================================================================
+
+bool FirmwareUpdater::checkNow(bool force) {
+    if (isUpdating()) return false;
+    const uint32_t now = millis();
+    if (!force && lastCheck && now - lastCheck < MIN_CHECK_GAP_MS) return false;
+    lastCheck = now;
+
+    // Läuft gerade ein Upload über /api/ota, erst nach dem nächsten Intervall wieder
+    if (!claimFlash()) {
+        logPrint("ota", "OTA upload in progress, firmware check skipped");
+        return false;
+    }
+    if (!task_) {
+        // Eigener Task statt Loop: Download + Flash dauern Minuten, der Loop läuft weiter
+        if (xTaskCreatePinnedToCore(taskEntry, "fwUpdate", TASK_STACK, this, 1, &task_, APP_CPU_NUM) != pdPASS) {
+            task_ = nullptr;
+            releaseFlash();
+            logPrint("error", "Firmware task could not be started");
+            return false;
+        }
+    }
+    state_ = OtaState::CHECKING;
+    xTaskNotifyGive(task_);
+    return true;
+}
+
+void FirmwareUpdater::update() {
+    if (isUpdating() || flashClaimed()) return;
+    if (millis() - lastCheck >= CHECK_INTERVAL_MS) checkNow();
+}
+
+// ============================================================================
+// Update-Task
+// ============================================================================
+
+void FirmwareUpdater::taskEntry(void* arg) {
+    auto* self = static_cast<FirmwareUpdater*>(arg);
+    for (;;) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        self->run();
+    }
+}
+
+void FirmwareUpdater::run() {
+    logPrint("log", "Checking firmware...");
+    Manifest m;
+    if (!checkVersion(m)) {
+        if (state_ == OtaState::CHECKING) state_ = OtaState::IDLE;
+        releaseFlash();
+        return;
+    }
+    if (!download(m)) {
+        releaseFlash();
+        return;
+    }
+
+    logPrint("log", "OTA done (%u bytes), rebooting...", m.size);
+    state_ = OtaState::DONE;
+    EventBus::instance().publish(Event{EventType::OTA_UPDATE_FINISHED, nullptr});
+    delay(500);
+    ESP.restart();
+}
+
+void FirmwareUpdater::fail(const char* reason) {
+    logPrint("error", "Firmware update failed: %s", reason);
+    state_ = OtaState::FAILED;
+    EventBus::instance().publish(Event{EventType::OTA_UPDATE_FAILED, nullptr});
+}
+
+bool FirmwareUpdater::checkVersion(Manifest& m) {
     // Failover: erst API_ENDPOINT (firmware.hzbx.de), bei Fehler backend.hzbx.de (Transitional-Host)
     // loest das Problem von Boxen mit alter credentials.h (API_ENDPOINT zeigt auf toten Host)
     const char* hosts[] = { API_ENDPOINT, "http://backend.hzbx.de" };
-    String remote, binUrl;
-    size_t size = 0;
     int usedHost = -1;
 
     for (int i = 0; i < 2; i++) {
-        // HTTP braucht WiFiClient, HTTPS braucht WiFiClientSecure
         String url = String(hosts[i]) + "/firmware.json";
-        bool useTls = url.startsWith("https");
-        std::unique_ptr<WiFiClient> clientPtr;
-        if (useTls) {
-            auto secure = std::make_unique<WiFiClientSecure>();
-            secure->setInsecure();
-            clientPtr = std::move(secure);
-        } else {
-            clientPtr = std::make_unique<WiFiClient>();
-        }
+        auto client = makeClient(url);
         HTTPClient http;
-        http.begin(*clientPtr, url);
+        http.begin(*client, url);
         http.setTimeout(10000);
         http.setConnectTimeout(5000);
 
@@ -57,21 +165,22 @@ bool FirmwareUpdater::checkVersion() {
                 logPrint("error", "Firmware JSON parse failed");
                 continue;
             }
-            remote = doc["version"] | "";
-            binUrl = String(hosts[i]) + doc["url"].as<String>();
-            size = doc["size"] | (size_t)0;
+            m.version = doc["version"] | "";
+            m.url = String(hosts[i]) + doc["url"].as<String>();
+            m.size = doc["size"] | (size_t)0;
+            m.hasSha = parseHex(doc["sha256"] | "", m.sha256, sizeof(m.sha256));
             usedHost = i;
-            if (!remote.isEmpty()) break;
+            if (!m.version.isEmpty()) break;
         } else {
             logPrint("warn", "Firmware check %s HTTP %d", hosts[i], code);
             http.end();
         }
     }
-    if (usedHost < 0 || remote.isEmpty()) return false;
+    if (usedHost < 0 || m.version.isEmpty()) return false;
 
-    int rmaj = parseVersionPart(remote, 0);
-    int rmin = parseVersionPart(remote, 1);
-    int rpat = parseVersionPart(remote, 2);
+    int rmaj = parseVersionPart(m.version, 0);
+    int rmin = parseVersionPart(m.version, 1);
+    int rpat = parseVersionPart(m.version, 2);
 
     String local = String(FIRMWARE_VERSION);
     int lmaj = parseVersionPart(local, 0);
@@ -87,98 +196,131 @@ bool FirmwareUpdater::checkVersion() {
         return false;
     }
 
-    logPrint("log", "New firmware available: %s (local %s)", remote.c_str(), local.c_str());
+    logPrint("log", "New firmware available: %s (local %s)", m.version.c_str(), local.c_str());
+    if (!m.hasSha) logPrint("warn", "firmware.json without sha256, only the image check protects this update");
 
-    if (size == 0) {
+    if (m.size == 0) {
         // Falls size fehlt: HEAD-Request für Content-Length
-        WiFiClientSecure headClient;
-        headClient.setInsecure();
+        auto client = makeClient(m.url);
         HTTPClient head;
-        head.begin(headClient, binUrl);
+        head.begin(*client, m.url);
         head.setTimeout(10000);
         head.sendRequest("HEAD");
-        size = head.getSize();
+        m.size = head.getSize() > 0 ? head.getSize() : 0;
         head.end();
     }
-
-    return downloadAndFlash(binUrl.c_str(), size);
+    if (m.size == 0) {
+        fail("unknown firmware size");
+        return false;
+    }
+    return true;
 }
 
-bool FirmwareUpdater::downloadAndFlash(const char* url, size_t size) {
-    updating = true;
-    EventBus::instance().publish(Event{EventType::OTA_UPDATE_STARTED, nullptr});
+namespace {
 
-    WiFiClient client;  // HTTP, kein TLS noetig
-    HTTPClient http;
-    http.begin(client, url);
-    http.setTimeout(30000);
-    http.setConnectTimeout(5000);
-    http.setFollowRedirects(HTTPC_STRICT_FOLLOW_REDIRECTS);
-    http.useHTTP10(true); // kein Chunked Encoding beim Streaming
-
-    int code = http.GET();
-    if (code != HTTP_CODE_OK) {
-        logPrint("error", "Firmware download failed HTTP %d", code);
-        EventBus::instance().publish(Event{EventType::OTA_UPDATE_FAILED, nullptr});
-        updating = false;
-        http.end();
-        return false;
+// Ein GET pro open(); Range ab dem Offset, bei Stall oder Verbindungsende liefert read() 0
+class HttpSource : public IFirmwareSource {
+public:
+    HttpSource(const String& url, uint32_t stallMs, uint32_t backoffMs)
+        : url_(url), stallMs_(stallMs), backoffMs_(backoffMs) {}
+
+    int open(size_t offset) override {
+        client_ = FirmwareUpdater::makeClient(url_);
+        http_.begin(*client_, url_);
+        http_.setTimeout(stallMs_);
+        http_.setConnectTimeout(5000);
+        http_.setFollowRedirects(HTTPC_STRICT_FOLLOW_REDIRECTS);
+        http_.useHTTP10(true); // kein Chunked Encoding beim Streaming
+        if (offset) http_.addHeader("Range", "bytes=" + String(offset) + "-");
+        return http_.GET();
     }
 
-    if (size == 0) size = http.getSize();
-    if (size == 0) {
-        logPrint("error", "Unknown firmware size, aborting");
-        EventBus::instance().publish(Event{EventType::OTA_UPDATE_FAILED, nullptr});
-        updating = false;
-        http.end();
-        return false;
+    int read(uint8_t* buf, size_t len) override {
+        WiFiClient* stream = http_.getStreamPtr();
+        if (!stream) return 0;
+        const uint32_t start = millis();
+        for (;;) {
+            const int avail = stream->available();
+            if (avail > 0) return stream->read(buf, min((size_t)avail, len));
+            if (!stream->connected() || millis() - start > stallMs_) return 0;
+            vTaskDelay(pdMS_TO_TICKS(5));
+        }
     }
 
-    if (!Update.begin(size)) {
-        logPrint("error", "Update.begin failed: %s", Update.errorString());
-        EventBus::instance().publish(Event{EventType::OTA_UPDATE_FAILED, nullptr});
-        updating = false;
-        http.end();
+    void close() override {
+        http_.end();
+        client_.reset();
+    }
+
+    void backoff(uint8_t attempt) override { vTaskDelay(pdMS_TO_TICKS(backoffMs_ * attempt)); }
+
+private:
+    const String& url_;
+    uint32_t stallMs_;
+    uint32_t backoffMs_;
+    std::unique_ptr<WiFiClient> client_;
+    HTTPClient http_;
+};
+
+class UpdateTarget : public IFirmwareTarget {
+public:
+    explicit UpdateTarget(FirmwareUpdater& updater) : updater_(updater) {}
+
+    bool write(const uint8_t* buf, size_t len) override {
+        if (Update.write(const_cast<uint8_t*>(buf), len) == len) return true;
+        logPrint("error", "Update write failed: %s", Update.errorString());
         return false;
     }
 
-    WiFiClient* stream = http.getStreamPtr();
-    size_t written = Update.writeStream(*stream);
+    void progress(size_t written, size_t total) override { updater_.progress(written, total); }
 
-    if (written != size) {
-        logPrint("error", "Update write incomplete: %u/%u", written, size);
+private:
+    FirmwareUpdater& updater_;
+};
+
+}  // namespace
+
+bool FirmwareUpdater::download(const Manifest& m) {
+    state_ = OtaState::DOWNLOADING;
+    lastPercent_ = 0;
+    EventBus::instance().publish(Event{EventType::OTA_UPDATE_STARTED, nullptr});
+
+    if (!Update.begin(m.size)) {
+        logPrint("error", "Update.begin failed: %s", Update.errorString());
+        fail("no OTA partition");
+        return false;
     }
 
-    if (Update.end()) {
-        logPrint("log", "OTA done (%u bytes), rebooting...", written);
-        EventBus::instance().publish(Event{EventType::OTA_UPDATE_FINISHED, nullptr});
-        http.end();
-        delay(500);
-        ESP.restart();
-        return true;
-    } else {
-        logPrint("error", "Update.end failed: %s", Update.errorString());
-        EventBus::instance().publish(Event{EventType::OTA_UPDATE_FAILED, nullptr});
+    std::unique_ptr<uint8_t[]> buf(new (std::nothrow) uint8_t[CHUNK_SIZE]);
+    if (!buf) {
+        Update.abort();
+        fail("out of memory");
+        return false;
     }
 
-    updating = false;
-    http.end();
-    return false;
-}
+    HttpSource source(m.url, STALL_TIMEOUT_MS, RETRY_BACKOFF_MS);
+    UpdateTarget target(*this);
+    FirmwareDownload dl(source, target, buf.get(), CHUNK_SIZE);
+    const FirmwareDownload::Result result = dl.run(m.size, m.hasSha ? m.sha256 : nullptr);
+    state_ = OtaState::VERIFYING;
 
-bool FirmwareUpdater::checkNow(bool force) {
-    if (updating) return false;
-    lastCheck = millis();
-    logPrint("log", "Checking firmware...");
-    checkVersion();
+    if (result != FirmwareDownload::Result::OK) {
+        Update.abort();
+        fail(FirmwareDownload::resultName(result));
+        return false;
+    }
+    if (!Update.end()) {
+        logPrint("error", "Update.end failed: %s", Update.errorString());
+        fail("image check");
+        return false;
+    }
     return true;
 }
 
-void FirmwareUpdater::update() {
-    if (updating) return;
-    uint32_t now = millis();
-    if (now - lastCheck >= CHECK_INTERVAL_MS) {
-        lastCheck = now;
-        checkVersion();
-    }
+void FirmwareUpdater::progress(size_t written, size_t total) {
+    const uint8_t percent = (uint64_t)written * 100 / total;
+    if (percent < lastPercent_ + PROGRESS_STEP && percent != 100) return;
+    lastPercent_ = percent;
+    EventBus::instance().publish(EventType::OTA_UPDATE_PROGRESS,
+                                 OtaProgressData{(uint32_t)written, (uint32_t)total, percent});
 }
@@ -0,0 +1,124 @@
+#include "services/RemoteCommands.h"
+#include "heater/HeaterController.h"
+#include "heater/HeaterState.h"
+#include "heater/Presets.h"
+#include "driver/net/WebSocketManager.h"
+#include "driver/net/LanLink.h"
+#include "Config.h"
+#include "utils/Logger.h"
+
+RemoteCommands::RemoteCommands(HeaterController& heater) : heater(heater) {}
+
+void RemoteCommands::init() {
+    WebSocketManager::instance().onCommand([this](const JsonDocument& doc) {
+        WebSocketManager::instance().sendCommandAck(doc["id"], run(doc));
+    });
+    LanLink::instance().onCommand([this](const JsonDocument& doc) {
+        return run(doc);
+    });
+}
+
+const char* RemoteCommands::run(const JsonDocument& doc) {
+    JsonVariantConst idVar = doc["id"];
+    stats_.received++;
+
+    // id als String oder Zahl, normalisiert für den Duplikat-Check
+    char id[sizeof(Recent::id)];
+    if (idVar.is<const char*>()) strlcpy(id, idVar.as<const char*>(), sizeof(id));
+    else if (idVar.is<uint32_t>()) snprintf(id, sizeof(id), "%lu", (unsigned long)idVar.as<uint32_t>());
+    else id[0] = '\0';
+
+    if (!id[0]) {
+        stats_.rejected++;
+        return "missing id";
+    }
+
+    if (const Recent* r = find(id)) {
+        stats_.duplicates++;
+        return r->error;
+    }
+
+    const char* cmd = doc["cmd"] | "";
+    const char* error = execute(cmd, doc);
+    if (error) {
+        stats_.rejected++;
+        logPrint("cmd", "cmd %s (%s) rejected: %s", cmd, id, error);
+    } else {
+        stats_.executed++;
+        logPrint("cmd", "cmd %s (%s) ok", cmd, id);
+    }
+    remember(id, error);
+    return error;
+}
+
+const char* RemoteCommands::execute(const char* cmd, const JsonDocument& doc) {
+    auto& hs = HeaterState::instance();
+
+    if (strcmp(cmd, "setTemp") == 0) {
+        const int temp = doc["temp"] | 0;
+        if (temp <= 0 || temp > HeaterConfig::MAX_TEMPERATURE) return "temp out of range";
+        hs.tempLimit.set(temp);
+        return nullptr;
+    }
+    if (strcmp(cmd, "setPreset") == 0) {
+        const int preset = doc["preset"] | -1;
+        if (preset < 0 || preset >= (int)(sizeof(TempPresets) / sizeof(TempPresets[0]))) return "preset out of range";
+        Presets::setPreset(preset);
+        if (hs.mode == HeaterMode::PRESET) hs.tempLimit.set(Presets::getPresetTemp(preset));
+        return nullptr;
+    }
+    if (strcmp(cmd, "start") == 0) {
+        if (const char* blocked = heater.startInterlock()) return blocked;
+        heater.startHeating();
+        return nullptr;
+    }
+    if (strcmp(cmd, "stop") == 0) {
+        // Wie FIRE loslassen: pausieren, der Zyklus endet über den Pause-Timeout
+        heater.stopHeating(false);
+        return nullptr;
+    }
+    if (strcmp(cmd, "calibrate") == 0) {
+        return calibrate(doc["points"].as<JsonArrayConst>());
+    }
+    if (strcmp(cmd, "burst") == 0) {
+        const uint32_t ms = doc["ms"] | 0;
+        if (!ms || ms > BURST_MAX_MS) return "ms out of range";
+        heater.requestTelemetryBurst(ms);
+        return nullptr;
+    }
+    return "unknown cmd";
+}
+
+// Die IR-Kalibrierung ist zweipunktig (HeaterController::computeIRCalibration)
+const char* RemoteCommands::calibrate(JsonArrayConst points) {
+    if (points.size() != 2) return "need 2 points";
+    const uint16_t irA = points[0]["ir"] | 0;
+    const uint16_t tempA = points[0]["temp"] | 0;
+    const uint16_t irB = points[1]["ir"] | 0;
+    const uint16_t tempB = points[1]["temp"] | 0;
+    if (!irA || !irB || !tempA || !tempB) return "invalid point";
+    if (irA == irB) return "points identical";
+    if (heater.isHeating()) return "heating";
+
+    auto& hs = HeaterState::instance();
+    hs.irCalMeasuredA.set(irA);
+    hs.irCalActualA.set(tempA);
+    hs.irCalMeasuredB.set(irB);
+    hs.irCalActualB.set(tempB);
+    heater.computeIRCalibration();
+    return nullptr;
+}
+
+const RemoteCommands::Recent* RemoteCommands::find(const char* id) const {
+    for (const auto& r : recent) {
+        if (r.id[0] && strcmp(r.id, id) == 0) return &r;
+    }
+    return nullptr;
+}
+
+void RemoteCommands::remember(const char* id, const char* error) {
+    Recent& r = recent[recentNext];
+    strlcpy(r.id, id, sizeof(r.id));
+    r.error = error;
+    recentNext = (recentNext + 1) % RECENT_IDS;
+}
@@ -0,0 +1,146 @@
+#include "services/TelemetryStream.h"
+#include "heater/HeaterState.h"
+#include "utils/Logger.h"
+
+TelemetryStream& TelemetryStream::instance() {
+    static TelemetryStream instance;
+    return instance;
+}
+
+// ============================================================================
+// Loop-Seite
+// ============================================================================
+
+void TelemetryStream::onLoop(uint32_t loopUs) {
+    if (!clients_) return;
+
+    loopSumUs_ += loopUs;
+    loopCount_++;
+    if (loopUs > loopMaxUs_) loopMaxUs_ = loopUs;
+
+    const uint32_t now = millis();
+    if (now - lastSample_ >= 1000 / MAX_HZ) sample(now);
+}
+
+void TelemetryStream::sample(uint32_t now) {
+    auto& hs = HeaterState::instance();
+    Snapshot s;
+    s.ms = now;
+    s.tempRaw = hs.tempIRRaw;
+    s.temp = hs.temp;
+    s.power = hs.power;
+    s.zvsOn = hs.zvsOn;
+    s.heating = hs.isHeating;
+    s.loopAvgUs = loopCount_ ? loopSumUs_ / loopCount_ : 0;
+    s.loopMaxUs = loopMaxUs_;
+
+    // dT/dt über die Sample-Abstände, leicht geglättet (der IR-Wert ist auf 1 °C gerundet)
+    if (prevMs_ && now > prevMs_) {
+        const float rate = (s.temp - prevTemp_) * 1000.0f / (now - prevMs_);
+        dTdt_ += 0.3f * (rate - dTdt_);
+    }
+    prevTemp_ = s.temp;
+    prevMs_ = now;
+    s.dTdt = dTdt_;
+
+    lastSample_ = now;
+    loopSumUs_ = 0;
+    loopCount_ = 0;
+    loopMaxUs_ = 0;
+
+    portENTER_CRITICAL(&mux_);
+    s.seq = latest_.seq + 1;
+    latest_ = s;
+    portEXIT_CRITICAL(&mux_);
+}
+
+// ============================================================================
+// Server-Task-Seite
+// ============================================================================
+
+bool TelemetryStream::addClient(WiFiClient client, uint8_t hz) {
+    for (auto& c : slots_) {
+        if (c.active) continue;
+        c.conn = client;
+        c.conn.setNoDelay(true);
+        c.intervalMs = 1000 / constrain(hz, 1, MAX_HZ);
+        c.lastSent = 0;
+        c.lastSeq = 0;
+        c.sent = 0;
+        c.dropsInRow = 0;
+        c.len = snprintf(c.buf, sizeof(c.buf),
+                         "HTTP/1.1 200 OK\r\n"
+                         "Content-Type: text/event-stream\r\n"
+                         "Cache-Control: no-cache\r\n"
+                         "Connection: keep-alive\r\n"
+                         "Access-Control-Allow-Origin: *\r\n\r\n"
+                         "retry: 2000\n\n");
+        c.active = true;
+        clients_++;
+        stats_.connects++;
+        logPrint("api", "Stream-Client verbunden (%u Hz)", (unsigned)(1000 / c.intervalMs));
+        return true;
+    }
+    return false;
+}
+
+void TelemetryStream::pump() {
+    if (!clients_) return;
+
+    portENTER_CRITICAL(&mux_);
+    const Snapshot s = latest_;
+    portEXIT_CRITICAL(&mux_);
+
+    const uint32_t now = millis();
+    char event[256];
+    size_t eventLen = 0;
+
+    for (auto& c : slots_) {
+        if (!c.active) continue;
+
+        if (s.seq != c.lastSeq && now - c.lastSent >= c.intervalMs) {
+            if (!eventLen) eventLen = formatEvent(s, event, sizeof(event));
+            if (c.len + eventLen <= sizeof(c.buf)) {
+                memcpy(c.buf + c.len, event, eventLen);
+                c.len += eventLen;
+                c.sent++;
+                c.dropsInRow = 0;
+                stats_.events++;
+            } else {
+                c.dropsInRow++;
+                stats_.dropped++;
+            }
+            c.lastSeq = s.seq;
+            c.lastSent = now;
+        }
+
+        if (!flush(c) || c.dropsInRow >= DROP_LIMIT) {
+            logPrint("api", "Stream-Client getrennt nach %u Events", (unsigned)c.sent);
+            c.conn.stop();
+            c.active = false;
+            c.len = 0;
+            clients_--;
+        }
+    }
+}
+
+// Nicht blockierend soweit möglich: nur so viel schreiben, wie der Socket gerade annimmt
+bool TelemetryStream::flush(Client& c) {
+    if (!c.conn.connected()) return false;
+    if (!c.len) return true;
+    const int written = c.conn.write(reinterpret_cast<const uint8_t*>(c.buf), c.len);
+    if (written <= 0) return c.conn.connected();
+    c.len -= written;
+    if (c.len) memmove(c.buf, c.buf + written, c.len);
+    return true;
+}
+
+size_t TelemetryStream::formatEvent(const Snapshot& s, char* out, size_t cap) {
+    const int n = snprintf(out, cap,
+        "event: telemetry\n"
+        "data: {\"seq\":%u,\"t\":%u,\"tempRaw\":%.1f,\"temp\":%.1f,\"dTdt\":%.2f,"
+        "\"zvs\":%d,\"power\":%u,\"heating\":%d,\"loopUs\":%u,\"loopMaxUs\":%u}\n\n",
+        (unsigned)s.seq, (unsigned)s.ms, s.tempRaw, s.temp, s.dTdt,
+        s.zvsOn ? 1 : 0, s.power, s.heating ? 1 : 0, (unsigned)s.loopAvgUs, (unsigned)s.loopMaxUs);
+    return n > 0 && (size_t)n < cap ? n : 0;
+}
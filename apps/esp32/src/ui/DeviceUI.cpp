@@ -7,6 +7,8 @@
 #include "heater/HeaterController.h"
 #include "utils/Logger.h"
 #include "SysModule.h"
+#include "GlyphAtlas.h"
+#include "ui/base/RenderBench.h"
 
 DeviceUI::DeviceUI(HeaterController& heater): 
     display(std::make_unique<DisplayDriver>(DisplayConfig::WIDTH, DisplayConfig::HEIGHT,
@@ -20,9 +22,15 @@ void DeviceUI::init() {
     auto booted = SysModules::booting("ui");
     display->init();
 
+    auto& atlas = ui::GlyphAtlas::instance();
+    atlas.build(ui::Text::Size::bxxl, DisplayConfig::ATLAS_TIMER_CHARS);
+    atlas.build(ui::Text::Size::bxl, DisplayConfig::ATLAS_TEMP_CHARS);
+    logPrint("ui", "Glyph-Atlas: %u bytes", atlas.bytesUsed());
+
     screens.setup(screenManager);
     screens.setupMenus(screenManager);
     screenManager.switchScreen(ScreenType::STARTUP);
+    RenderBench::instance().attach(&screenManager);
 
     input.setup();
     input.setCallback([this](InputEvent event) { inputHandler->handleInput(event); });
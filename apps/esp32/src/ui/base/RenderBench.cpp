@@ -0,0 +1,186 @@
+#include "ui/base/RenderBench.h"
+#include "ui/base/ScreenManager.h"
+#include "ui/ColorPalette.h"
+#include "heater/HeaterState.h"
+#include "FramebufferSink.h"
+#include "utils/Logger.h"
+#include "Config.h"
+
+#include <memory>
+
+namespace {
+
+const char* const SCENARIO_NAMES[RenderBench::SCENARIO_COUNT] = {
+    "fire_idle", "fire_heating", "menu", "statusbar"
+};
+
+}  // namespace
+
+bool RenderBench::begin(uint16_t frames, bool headless) {
+    if (!manager || frames == 0) return false;
+    if (running) cancel();
+
+    current = Report();
+    current.headless = headless;
+    framesPerScenario = frames;
+    frame = 0;
+    if (headless) fb.reset(new FramebufferSink(DisplayConfig::WIDTH, DisplayConfig::HEIGHT));
+    running = true;
+    return true;
+}
+
+bool RenderBench::step(uint16_t maxFrames) {
+    if (!running) return true;
+    auto& hs = HeaterState::instance();
+    if (hs.isHeating) {
+        // Zwischen zwei Scheiben wurde geheizt - die Szenarien würden den echten Zustand überschreiben
+        current.aborted = true;
+        finish();
+        return true;
+    }
+
+    UI* ui = manager->getUI();
+
+    // Zustand sichern - alles wird still gesetzt, damit weder Heizung noch WS-Listener anspringen
+    const uint32_t timer = hs.timer;
+    const uint16_t temp = hs.temp;
+    const uint16_t tempIR = hs.tempIR;
+
+    ISurfaceSink* previousSink = ui->getSink();
+    if (fb) ui->setSink(fb.get());
+
+    for (uint16_t n = 0; n < maxFrames && current.count < SCENARIO_COUNT; n++) {
+        Result& r = current.results[current.count];
+        r.name = SCENARIO_NAMES[current.count];
+
+        // Kalter Frame: State-Hashes verwerfen, sonst misst der zweite Frame nur den Cache
+        ui->invalidateAll();
+        ui->forceRedraw();
+        const PushStats before = ui->pushStats();
+
+        const uint32_t start = micros();
+        drawFrame(current.count, frame);
+        const uint32_t dt = micros() - start;
+
+        r.frames++;
+        r.totalUs += dt;
+        if (dt > r.maxUs) r.maxUs = dt;
+        r.pushes += ui->pushStats().pushes - before.pushes;
+        r.bytes += ui->pushStats().bytes - before.bytes;
+
+        if (++frame >= framesPerScenario) {
+            logPrint("ui", "Bench %s: %.1f fps, %lu us/frame (max %lu), %lu B/frame",
+                     r.name, r.fps(), r.avgUs(), r.maxUs, r.bytesPerFrame());
+            current.count++;
+            frame = 0;
+        }
+    }
+
+    const bool done = current.count == SCENARIO_COUNT;
+    if (done && fb && fb->hasBuffer()) current.checksum = fb->checksum();
+
+    ui->setSink(previousSink);
+    hs.isHeating.setSilent(false);
+    hs.timer.setSilent(timer);
+    hs.temp.setSilent(temp);
+    hs.tempIR.setSilent(tempIR);
+
+    if (done) finish();
+    return done;
+}
+
+void RenderBench::cancel() {
+    if (!running) return;
+    current.aborted = true;
+    finish();
+}
+
+void RenderBench::finish() {
+    fb.reset();
+    running = false;
+    restorePanel();
+}
+
+void RenderBench::drawFrame(uint8_t scenario, uint16_t i) {
+    UI* ui = manager->getUI();
+    auto& hs = HeaterState::instance();
+
+    auto drawScreen = [this, ui](ScreenType type, bool withStatusBar) {
+        Screen* screen = manager->getScreen(type);
+        if (!screen) return;
+        screen->setManager(manager);
+        screen->setUI(ui);
+        screen->draw();
+        if (withStatusBar) manager->getStatusBar()->draw(ui);
+    };
+
+    switch (scenario) {
+        case 0:  // fire_idle
+            hs.isHeating.setSilent(false);
+            drawScreen(ScreenType::FIRE, true);
+            break;
+        case 1:  // fire_heating
+            hs.isHeating.setSilent(true);
+            hs.timer.setSilent(i % 120);
+            hs.temp.setSilent(120 + (i * 3) % 100);
+            hs.tempIR.setSilent(124 + (i * 3) % 100);
+            drawScreen(ScreenType::FIRE, false);
+            break;
+        case 2:  // menu
+            drawScreen(ScreenType::MAIN_MENU, false);
+            break;
+        case 3:  // statusbar
+            manager->getStatusBar()->draw(ui);
+            break;
+    }
+}
+
+std::unique_ptr<FramebufferSink> RenderBench::capture() {
+    if (!manager || !manager->getCurrentScreen()) return nullptr;
+    UI* ui = manager->getUI();
+
+    std::unique_ptr<FramebufferSink> shot(new FramebufferSink(DisplayConfig::WIDTH, DisplayConfig::HEIGHT));
+    if (!shot->hasBuffer()) return nullptr;
+
+    ISurfaceSink* previousSink = ui->getSink();
+    ui->setSink(shot.get());
+    ui->invalidateAll();
+    ui->forceRedraw();
+    manager->getCurrentScreen()->draw();
+    if (manager->isStatusbarVisible()) manager->getStatusBar()->draw(ui);
+    ui->setSink(previousSink);
+
+    // Surfaces haben jetzt den Stand des Snapshots im Cache, das Panel aber nicht
+    ui->invalidateAll();
+    manager->setDirty();
+    return shot;
+}
+
+void RenderBench::restorePanel() {
+    UI* ui = manager->getUI();
+    ui->fillBackground(0, 0, DisplayConfig::WIDTH, DisplayConfig::HEIGHT);
+    ui->invalidateAll();
+    ui->forceRedraw();
+    manager->setDirty();
+}
+
+String RenderBench::toJson(const Report& report) {
+    String json = "{\"headless\":" + String(report.headless ? "true" : "false");
+    json += ",\"aborted\":" + String(report.aborted ? "true" : "false");
+    json += ",\"checksum\":" + String(report.checksum);
+    json += ",\"scenarios\":[";
+    for (uint8_t i = 0; i < report.count; i++) {
+        const Result& r = report.results[i];
+        if (i) json += ",";
+        json += "{\"name\":\"" + String(r.name) + "\"";
+        json += ",\"frames\":" + String(r.frames);
+        json += ",\"fps\":" + String(r.fps(), 1);
+        json += ",\"avgUs\":" + String(r.avgUs());
+        json += ",\"maxUs\":" + String(r.maxUs);
+        json += ",\"pushesPerFrame\":" + String(r.frames ? (float)r.pushes / r.frames : 0.0f, 1);
+        json += ",\"bytesPerFrame\":" + String(r.bytesPerFrame());
+        json += "}";
+    }
+    json += "]}";
+    return json;
+}
@@ -50,4 +50,9 @@ bool Screen::input(InputEvent event,
     return false;
 }
 
-
+bool Screen::chord(InputEvent event, std::initializer_list<InputButton> buttons) {
+    if (event.type != CHORD) return false;
+    int mask = 0;
+    for (auto b : buttons) mask |= 1 << b;
+    return event.value == mask;
+}
@@ -2,10 +2,14 @@
 #include "ui/base/ScreenManager.h"
 #include "DisplayDriver.h"
 #include "ui/base/UI.h"
+#include "ClipSink.h"
 #include "Config.h"
+#include "PhotonLatency.h"
 
 #include "driver/input/InputManager.h"
 
+#include <algorithm>
+
 ScreenManager::ScreenManager(DisplayDriver& disp, InputManager& inp)
     : display(disp),
       input(inp),
@@ -19,7 +23,7 @@ ScreenManager::ScreenManager(DisplayDriver& disp, InputManager& inp)
 // Screen Management
 // ============================================================================
 
-void ScreenManager::setScreen(Screen* newScreen) {
+void ScreenManager::setScreen(Screen* newScreen, ScreenTransition transition) {
     if (newScreen == currentScreen) return;
 
     currentScreen = newScreen;
@@ -29,15 +33,71 @@ void ScreenManager::setScreen(Screen* newScreen) {
     currentScreenType = currentScreen->getType();
     currentScreen->setManager(this);
     currentScreen->setUI(ui);
-    ui->invalidateAll();
-    ui->clear();
-        
-    currentScreen->clear();
-    currentScreen->draw();
-    //statusBar->draw(ui);
+
+    // Bei aktivem Sink (Benchmark/Headless) gibt es kein Panel zum Scrollen
+    const bool slide = (transition == ScreenTransition::SLIDE_LEFT || transition == ScreenTransition::SLIDE_RIGHT)
+        && !ui->getSink();
+    if (slide) {
+        slideIn(transition == ScreenTransition::SLIDE_LEFT);
+    } else {
+        // clear() invalidiert bereits alle Surfaces, gezeichnet wird im nächsten draw()
+        ui->clear();
+    }
 
     Serial.printf("\u2195 Screen changed to: %d\n", static_cast<int>(currentScreenType));
 }
+
+// Hardware-Scroll: das Panel schiebt das alte Bild um step Spalten weiter, die frei werdenden
+// RAM-Spalten bekommen den neuen Screen. Weil der Scroll nur die Anzeige verschiebt, liegt jede
+// neue Spalte bereits an ihrer endgültigen RAM-Position - nach einer vollen Breite steht der
+// Scroll wieder auf 0 und der Screen ist komplett, ohne Clear und ohne abschließenden Full-Push.
+// Erst malen, dann scrollen: die Spalten sind während des Malens noch am auslaufenden Rand
+// (dort verschwindet ohnehin das alte Bild) und rücken erst fertig am einlaufenden Rand ins Bild -
+// nie mit dem veralteten Inhalt des alten Screens.
+// Gerendert wird nur im ersten Schritt; danach schiebt der ClipSink die Spaltenfenster aus den
+// Pool-Sprites nach. Nur wenn der Screen eine Pool-Surface mehrfach belegt, wird pro Schritt neu gerendert.
+void ScreenManager::slideIn(bool fromRight) {
+    const uint16_t w = display.getTFTWidth();
+    const uint16_t h = display.getTFTHeight();
+    // Läuft synchron im Input-Handler (globaler Shortcut) - der Slide ist der Frame
+    const uint32_t startTime = micros();
+    PhotonLatency::instance().frameBegin(startTime);
+    ClipSink clip;
+    ui->setSink(&clip);
+
+    for (uint16_t done = 0; done < w;) {
+        const uint16_t next = std::min<uint16_t>(w, done + DisplayConfig::TRANSITION_STEP_PX);
+        const uint16_t x0 = fromRight ? done : w - next;
+        const uint16_t x1 = fromRight ? next : w - done;
+        clip.setColumns(x0, x1);
+
+        // Hintergrund nur für die neuen Spalten, keine Vollbild-Surface
+        ui->fillBackground(x0, 0, x1 - x0, h);
+        if (done && clip.replayable()) {
+            clip.replay();
+        } else {
+            clip.record(!done);
+            ui->invalidateAll();
+            ui->forceRedraw();
+            currentScreen->draw();
+            if (statusbarVisible) statusBar->draw(ui);
+            clip.record(false);
+        }
+
+        display.scrollTo(fromRight ? next : w - next);
+        done = next;
+    }
+
+    ui->setSink(nullptr);
+    dirty = false;
+    const uint32_t endTime = micros();
+    PhotonLatency::instance().framePresented(endTime);
+
+    const uint32_t slideTime = endTime - startTime;
+    frameStats.lastSlideUs = slideTime;
+    if (slideTime > frameStats.maxSlideUs) frameStats.maxSlideUs = slideTime;
+    frameStats.slides++;
+}
 void ScreenManager::registerScreen(ScreenType type, Screen* screen) {
     screens_[type] = screen;
 }
@@ -49,9 +109,9 @@ Screen* ScreenManager::getScreen(ScreenType type) {
     return nullptr;
 }
 
-void ScreenManager::switchScreen(ScreenType screenType) {
+void ScreenManager::switchScreen(ScreenType screenType, ScreenTransition transition) {
     Screen* screenToSwitch = getScreen(screenType);
-    if (screenToSwitch) setScreen(screenToSwitch);
+    if (screenToSwitch) setScreen(screenToSwitch, transition);
     else logPrint("ScreenManager", "Attempted to switch to unregistered screen type: %d", static_cast<int>(screenType));
 }
 
@@ -66,11 +126,21 @@ void ScreenManager::update() {
 void ScreenManager::draw() {
     if (!currentScreen || !dirty) return;
     const uint32_t startTime = micros();
+    auto& latency = PhotonLatency::instance();
+    latency.frameBegin(startTime);
 
     currentScreen->draw();
     if (statusbarVisible) statusBar->draw(ui);
-    const uint32_t drawTime = micros() - startTime;
+    const uint32_t endTime = micros();
+    const uint32_t drawTime = endTime - startTime;
     dirty = false;
+    // Pushes sind synchron (kein DMA): mit dem Ende von draw() ist der Frame auf dem Panel bzw. im Sink
+    latency.framePresented(endTime);
+
+    frameStats.lastUs = drawTime;
+    frameStats.avgUs = frameStats.frames ? frameStats.avgUs + ((int32_t)drawTime - (int32_t)frameStats.avgUs) / 16 : drawTime;
+    if (drawTime > frameStats.maxUs) frameStats.maxUs = drawTime;
+    frameStats.frames++;
 
     // Performance-Warnung bei langsamen Draws
     if (drawTime > 50000)Serial.printf("\u26a0 Slow draw: %lu \u00b5s\n", drawTime);
@@ -14,6 +14,19 @@ SurfaceFactory::~SurfaceFactory() {
 
 void SurfaceFactory::setDarkMode(bool dark) { _darkMode = dark; }
 
+void SurfaceFactory::fillBackground(int16_t x, int16_t y, int16_t w, int16_t h) {
+  if (w <= 0 || h <= 0) return;
+  _stats.add(w, h);
+  _tft->fillRect(x, y, w, h, (_darkMode ? heizbox_palette_dark : heizbox_palette)[COLOR_BG]);
+}
+
+void SurfaceFactory::push(RenderSurface& s, int16_t x, int16_t y) {
+  if (!s.sprite) return;
+  _stats.add(s.width(), s.height());
+  if (_sink) _sink->push(s.sprite, x, y);
+  else s.blitToScreen(x, y);
+}
+
 RenderSurface SurfaceFactory::createSurface(int16_t w, int16_t h, bool clear) {
   // Suche passenden Sprite im Pool
   for (auto it = _pool.begin(); it != _pool.end(); ++it) {
@@ -61,7 +74,7 @@ void SurfaceFactory::withSurface(int16_t w, int16_t h, int16_t targetX, int16_t
   if (!s.sprite) return;
   if (clear) s.clear();
   cb(s);
-  s.blitToScreen(targetX, targetY);
+  push(s, targetX, targetY);
   releaseSurface(s);
 }
 
@@ -80,7 +93,7 @@ void SurfaceFactory::withSurface(int16_t w, int16_t h, int16_t targetX, int16_t
   // State changed or forced redraw, render surface
   if (clear) s.clear();
   cb(s);
-  s.blitToScreen(targetX, targetY);
+  push(s, targetX, targetY);
   releaseSurface(s);
   
   // Reset force redraw flag after first use
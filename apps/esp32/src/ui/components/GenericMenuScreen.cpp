@@ -85,8 +85,8 @@ void GenericMenuScreen::handleAdjustMode(InputEvent event) {
         items_[selectedIndex_]->adjust(val);
     };
 
-        if (event.type == ROTARY_CW) adjust(10);
-    else if (event.type == ROTARY_CCW) adjust(-10);
+        if (event.type == ROTARY_CW) adjust(10 * max(1, event.value));
+    else if (event.type == ROTARY_CCW) adjust(-10 * max(1, event.value));
     else if (event.button == DOWN) adjust(-1);
     else if (event.button == UP) adjust(1);
     else if (event.button == CENTER && event.type == PRESSED) {
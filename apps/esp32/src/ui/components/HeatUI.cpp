@@ -35,11 +35,10 @@ void drawStats(RenderSurface& s, int x, int y, String label, String value) {
 
 
 void ZVSOscilloscopeUI(RenderSurface& s, ZVSDriver* zvs) {
-    static ZVSOscilloscope osc = ZVSOscilloscope(zvs, 280);
-    osc.update();
+    static ZVSOscilloscope osc(zvs);
     int h = s.height() /2;        // osc-Höhe
     int y = (s.height() - h) / 2; 
-    osc.draw(s, 0, y, h);
+    osc.draw(s, 0, y, s.width(), h);
 }
 
 void Background(RenderSurface& s, float progress, uint8_t color) {
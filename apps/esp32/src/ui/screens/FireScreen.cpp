@@ -195,7 +195,7 @@ void FireScreen::handleInput(InputEvent event) {
     auto& ds = DeviceState::instance();
     auto& hs = HeaterState::instance();
 
-    if (input(event, {FIRE}, {PRESSED, HOLD}) && input(event, {CENTER}, {PRESSED, HOLD})) {
+    if (chord(event, {FIRE, CENTER})) {
         bool locked = ds.locked.set(!ds.locked);
         static uint8_t initialBrightness;
         if (locked) initialBrightness = ds.display.brightness;
@@ -309,7 +309,8 @@ void FireScreen::handleInput(InputEvent event) {
     }
 
     if (input(event, {ROTARY_ENCODER}, {ROTARY_CW, ROTARY_CCW})) {
-        int delta = event.type == ROTARY_CW ? 1 : -1;
+        // value = Schrittweite aus der Encoder-Beschleunigung
+        int delta = (event.type == ROTARY_CW ? 1 : -1) * max(1, event.value);
         
         hs.tempLimit.set(hs.tempLimit.get() + delta);
         Audio::rotaryTurn(ROTARY_CW == event.type);
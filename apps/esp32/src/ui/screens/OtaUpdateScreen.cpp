@@ -15,6 +15,13 @@ OtaUpdateScreen::OtaUpdateScreen() {
             dirty();
         }
     );
+    EventBus::instance().subscribe<OtaProgressData>(
+        EventType::OTA_UPDATE_PROGRESS,
+        [&](const OtaProgressData& p) {
+            percent = p.percent;
+            dirty();
+        }
+    );
 }
 
 void OtaUpdateScreen::draw()
@@ -23,6 +30,11 @@ void OtaUpdateScreen::draw()
     _ui->withSurface(280, 240, 0, 0, [this](RenderSurface& s) {
         s.sprite->drawBitmap(0, 0, ota_icon, 102, 128, COLOR_TEXT_PRIMARY);
         if (hasFailed) s.text(0, 0, "Failed", ui::Text::Size::bxl, COLOR_ERROR);
+        else if (percent) {
+            char buf[8];
+            snprintf(buf, sizeof(buf), "%u%%", percent);
+            s.text(120, 50, buf, ui::Text::Size::bxl, COLOR_TEXT_PRIMARY);
+        }
     });
     //display.getTft()->setTextDatum(MC_DATUM);
     //display.drawText((display.getTFTWidth()/2) - 40, display.getTFTHeight() / 2 + 30, "Update lädt...", COLOR_TEXT_PRIMARY, 2);
@@ -0,0 +1,128 @@
+#include "utils/JsonStream.h"
+
+JsonStream& JsonStream::beginObject(const char* key) {
+    open(key, '{');
+    return *this;
+}
+
+JsonStream& JsonStream::endObject() {
+    close('}');
+    return *this;
+}
+
+JsonStream& JsonStream::beginArray(const char* key) {
+    open(key, '[');
+    return *this;
+}
+
+JsonStream& JsonStream::endArray() {
+    close(']');
+    return *this;
+}
+
+JsonStream& JsonStream::field(const char* key, const char* v) {
+    name(key);
+    if (!v) {
+        write("null", 4);
+        return *this;
+    }
+    write('"');
+    writeEscaped(v);
+    write('"');
+    return *this;
+}
+
+JsonStream& JsonStream::field(const char* key, bool v) {
+    name(key);
+    if (v) write("true", 4);
+    else write("false", 5);
+    return *this;
+}
+
+JsonStream& JsonStream::field(const char* key, float v, uint8_t decimals) {
+    name(key);
+    if (isnan(v) || isinf(v)) {
+        write("null", 4);
+        return *this;
+    }
+    char tmp[24];
+    const int n = snprintf(tmp, sizeof(tmp), "%.*f", decimals, v);
+    write(tmp, n > 0 ? n : 0);
+    return *this;
+}
+
+void JsonStream::flush() {
+    if (!len) return;
+    sink(buf, len);
+    len = 0;
+}
+
+void JsonStream::name(const char* key) {
+    if (depth && (hasItems & (1 << depth))) write(',');
+    if (depth) hasItems |= 1 << depth;
+    if (!key) return;
+    write('"');
+    writeEscaped(key);
+    write("\":", 2);
+}
+
+void JsonStream::open(const char* key, char bracket) {
+    name(key);
+    write(bracket);
+    if (depth + 1 < MAX_DEPTH) depth++;
+    hasItems &= ~(1 << depth);
+}
+
+void JsonStream::close(char bracket) {
+    write(bracket);
+    if (depth) depth--;
+}
+
+void JsonStream::number(int32_t v) {
+    char tmp[12];
+    const int n = snprintf(tmp, sizeof(tmp), "%d", (int)v);
+    write(tmp, n);
+}
+
+void JsonStream::number(uint32_t v) {
+    char tmp[12];
+    const int n = snprintf(tmp, sizeof(tmp), "%u", (unsigned)v);
+    write(tmp, n);
+}
+
+void JsonStream::write(char c) {
+    if (len >= sizeof(buf)) flush();
+    buf[len++] = c;
+}
+
+void JsonStream::write(const char* s, size_t n) {
+    while (n) {
+        if (len >= sizeof(buf)) flush();
+        const size_t chunk = n < sizeof(buf) - len ? n : sizeof(buf) - len;
+        memcpy(buf + len, s, chunk);
+        len += chunk;
+        s += chunk;
+        n -= chunk;
+    }
+}
+
+void JsonStream::writeEscaped(const char* s) {
+    for (; *s; s++) {
+        const char c = *s;
+        switch (c) {
+            case '"': write("\\\"", 2); break;
+            case '\\': write("\\\\", 2); break;
+            case '\n': write("\\n", 2); break;
+            case '\r': break;
+            case '\t': write("\\t", 2); break;
+            default:
+                if ((uint8_t)c < 0x20) {
+                    char tmp[7];
+                    snprintf(tmp, sizeof(tmp), "\\u%04x", c);
+                    write(tmp, 6);
+                } else {
+                    write(c);
+                }
+        }
+    }
+}
@@ -1,4 +1,16 @@
 #include "Logger.h"
+#include "utils/JsonStream.h"
+
+#include <atomic>
+#include <esp_idf_version.h>
+#if ESP_IDF_VERSION_MAJOR >= 5
+#include <esp_app_desc.h>
+#else
+#include <esp_ota_ops.h>
+#endif
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <soc/soc.h>
 
 size_t RingStream::write(uint8_t c) {
     Serial.write(c);
@@ -18,93 +30,539 @@ RingStream g_ringStream;
 
 // ---- Ringbuffer ----
 struct LogEntry {
+    uint32_t seq;
     uint32_t ts;
     char type[16];
     char msg[LOG_LINE_MAX];
 };
 
 static LogEntry logRing[LOG_RING_SIZE];
-static volatile uint32_t logRingHead = 0; // nächster freier Slot
-static volatile uint32_t logRingCount = 0;
+static uint32_t logRingHead = 0; // seq der nächsten Zeile, Slot = seq % LOG_RING_SIZE
+static uint32_t logRingCount = 0;
+static portMUX_TYPE logRingMux = portMUX_INITIALIZER_UNLOCKED;
 
-void logRingPush(const char* type, const char* line) {
-    uint32_t idx;
-    portMUX_TYPE mux = portMUX_INITIALIZER_UNLOCKED;
-    portENTER_CRITICAL(&mux);
-    idx = logRingHead % LOG_RING_SIZE;
-    logRing[idx].ts = millis();
-    strncpy(logRing[idx].type, type, sizeof(logRing[idx].type) - 1);
-    logRing[idx].type[sizeof(logRing[idx].type) - 1] = '\0';
-    strncpy(logRing[idx].msg, line, sizeof(logRing[idx].msg) - 1);
-    logRing[idx].msg[sizeof(logRing[idx].msg) - 1] = '\0';
+// ---- MPSC-Queue ----
+// Bounded Queue nach Vyukov: Producer reservieren per CAS einen Slot, schreiben ihn und geben
+// ihn über seq frei; der einzige Consumer ist der Drain-Task. seq wird relativ zum Slot-Index
+// gespeichert, damit die null-initialisierte Queue schon vor allen Konstruktoren gültig ist.
+struct LogRecord {
+    uint32_t ts;
+    LogLevel level;
+    uint8_t sinks;          // Bitmaske, bei Enqueue nach Sink-Level gefiltert
+    uint8_t len;            // Deferred: Länge der Argumente in msg
+    char type[14];
+    const char* typeLiteral;
+    const char* fmt;        // nullptr = msg ist fertiger Text, sonst Deferred-Argumente
+    char msg[LOG_LINE_MAX];
+};
+
+struct LogSlot {
+    std::atomic<uint32_t> seq;
+    LogRecord rec;
+};
+
+static constexpr uint32_t LOG_QUEUE_MASK = LOG_QUEUE_SLOTS - 1;
+static_assert((LOG_QUEUE_SLOTS & LOG_QUEUE_MASK) == 0, "LOG_QUEUE_SLOTS muss eine Zweierpotenz sein");
+
+static LogSlot logQueue[LOG_QUEUE_SLOTS];
+static std::atomic<uint32_t> logEnqueuePos{0};
+static uint32_t logDequeuePos = 0;     // nur Drain-Task
+static TaskHandle_t logDrainTask = nullptr;
+
+static volatile LogLevel sinkLevels[(uint8_t)LogSink::COUNT] = {
+    LogLevel::DEBUG,    // CONSOLE
+    LogLevel::DEBUG,    // RING
+    LogLevel::INFO,     // WEBSOCKET
+};
+
+static std::atomic<uint32_t> statCalls{0};
+static std::atomic<uint32_t> statDropped{0};
+static std::atomic<uint32_t> statWsDropped{0};
+static std::atomic<uint32_t> statAvgCycles{0};
+static std::atomic<uint32_t> statMaxCycles{0};
+
+static uint8_t sinkBit(LogSink sink) {
+    return 1 << (uint8_t)sink;
+}
+
+static uint8_t sinksFor(LogLevel level, uint8_t allowed) {
+    uint8_t mask = 0;
+    for (uint8_t i = 0; i < (uint8_t)LogSink::COUNT; i++) {
+        if ((allowed & (1 << i)) && level >= sinkLevels[i]) mask |= 1 << i;
+    }
+    return mask;
+}
+
+static LogRecord* logReserve(uint32_t& pos) {
+    pos = logEnqueuePos.load(std::memory_order_relaxed);
+    for (;;) {
+        LogSlot& slot = logQueue[pos & LOG_QUEUE_MASK];
+        const int32_t diff = (int32_t)(slot.seq.load(std::memory_order_acquire) + (pos & LOG_QUEUE_MASK) - pos);
+        if (diff == 0) {
+            if (logEnqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) return &slot.rec;
+        } else if (diff < 0) {
+            return nullptr;  // voll: Drain-Task hängt hinterher
+        } else {
+            pos = logEnqueuePos.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+static void logCommit(uint32_t pos) {
+    logQueue[pos & LOG_QUEUE_MASK].seq.store(pos + 1 - (pos & LOG_QUEUE_MASK), std::memory_order_release);
+}
+
+static bool logPop(LogRecord& out) {
+    const uint32_t pos = logDequeuePos;
+    LogSlot& slot = logQueue[pos & LOG_QUEUE_MASK];
+    const int32_t diff = (int32_t)(slot.seq.load(std::memory_order_acquire) + (pos & LOG_QUEUE_MASK) - (pos + 1));
+    if (diff < 0) return false;  // leer oder Producer schreibt noch
+    out = slot.rec;
+    slot.seq.store(pos + LOG_QUEUE_SLOTS - (pos & LOG_QUEUE_MASK), std::memory_order_release);
+    logDequeuePos = pos + 1;
+    return true;
+}
+
+static void logPublish(uint32_t pos) {
+    logCommit(pos);
+    // Bei Bursts nicht aufs Intervall warten: alle halbe Queue den Drain-Task wecken
+    if ((pos & (LOG_QUEUE_SLOTS / 2 - 1)) == 0 && logDrainTask && !xPortInIsrContext()) xTaskNotifyGive(logDrainTask);
+}
+
+static void logMeasure(uint32_t start) {
+    const uint32_t cycles = ESP.getCycleCount() - start;
+    // Gleitender Mittelwert (1/16); konkurrierende Updates dürfen sich überschreiben
+    const uint32_t avg = statAvgCycles.load(std::memory_order_relaxed);
+    statAvgCycles.store(avg ? avg + ((int32_t)(cycles - avg) >> 4) : cycles, std::memory_order_relaxed);
+    if (cycles > statMaxCycles.load(std::memory_order_relaxed)) statMaxCycles.store(cycles, std::memory_order_relaxed);
+}
+
+static LogRecord* logStart(const char* type, LogLevel level, uint8_t sinks, uint32_t& pos) {
+    LogRecord* r = logReserve(pos);
+    if (!r) {
+        statDropped.fetch_add(1, std::memory_order_relaxed);
+        return nullptr;
+    }
+    r->ts = millis();
+    r->level = level;
+    r->sinks = sinks;
+    r->len = 0;
+    strlcpy(r->type, type, sizeof(r->type));
+    r->typeLiteral = type;
+    r->fmt = nullptr;
+    return r;
+}
+
+static void logEnqueue(const char* type, LogLevel level, uint8_t sinks, const char* format, va_list args) {
+    uint32_t pos;
+    LogRecord* r = logStart(type, level, sinks, pos);
+    if (!r) return;
+    vsnprintf(r->msg, sizeof(r->msg), format, args);
+    logPublish(pos);
+}
+
+static void logEnqueueLine(const char* type, LogLevel level, uint8_t sinks, const char* format, ...) {
+    va_list args;
+    va_start(args, format);
+    logEnqueue(type, level, sinks, format, args);
+    va_end(args);
+}
+
+// ---- Deferred ----
+bool logDeferredBegin(const char* type, const char* format, LogDeferredSlot& slot) {
+    slot.start = ESP.getCycleCount();
+    statCalls.fetch_add(1, std::memory_order_relaxed);
+
+    const LogLevel level = logLevelOf(type);
+    const uint8_t sinks = sinksFor(level, 0xFF);
+    LogRecord* r = sinks ? logStart(type, level, sinks, slot.pos) : nullptr;
+    if (!r) {
+        logMeasure(slot.start);
+        return false;
+    }
+    r->fmt = format;
+    slot.buf = reinterpret_cast<uint8_t*>(r->msg);
+    slot.cap = sizeof(r->msg);
+    return true;
+}
+
+void logDeferredEnd(const LogDeferredSlot& slot, const TelemetryCodec::Writer& w) {
+    // Überlauf: Argumente weglassen, der Host zeigt dann nur das Format
+    logQueue[slot.pos & LOG_QUEUE_MASK].rec.len = w.ok() ? w.size() : 0;
+    logPublish(slot.pos);
+    logMeasure(slot.start);
+}
+
+class ArgReader {
+public:
+    ArgReader(const uint8_t* data, size_t len) : _data(data), _len(len) {}
+
+    bool next(uint8_t& tag, uint32_t& value) {
+        if (_pos >= _len) return false;
+        tag = _data[_pos++];
+        value = 0;
+        for (uint8_t shift = 0; shift < 35 && _pos < _len; shift += 7) {
+            const uint8_t b = _data[_pos++];
+            value |= (uint32_t)(b & 0x7F) << shift;
+            if (!(b & 0x80)) return true;
+        }
+        return false;
+    }
+
+private:
+    const uint8_t* _data;
+    size_t _len;
+    size_t _pos = 0;
+};
+
+static bool isFloatConversion(char c) {
+    return strchr("fFeEgGaA", c) != nullptr;
+}
+
+// Für Serial und den JSON-Fallback: jede Konversion einzeln mit ihrem Argument formatieren
+static void renderDeferred(const LogRecord& r, char* out, size_t cap) {
+    ArgReader args(reinterpret_cast<const uint8_t*>(r.msg), r.len);
+    size_t n = 0;
+    for (const char* p = r.fmt; *p && n + 1 < cap; p++) {
+        if (*p != '%') {
+            out[n++] = *p;
+            continue;
+        }
+        if (p[1] == '%') {
+            out[n++] = '%';
+            p++;
+            continue;
+        }
+        char spec[16];
+        size_t specLen = 0;
+        while (*p && specLen + 1 < sizeof(spec)) {
+            spec[specLen++] = *p;
+            if (strchr("diouxXcsfFeEgGaApn", *p)) break;
+            p++;
+        }
+        spec[specLen] = '\0';
+        if (!*p) break;
+        const char conv = *p;
+
+        uint8_t tag;
+        uint32_t value;
+        int written;
+        if (!args.next(tag, value) || conv == 'n') {
+            written = snprintf(out + n, cap - n, "?");
+        } else if (tag == LOG_ARG_FLOAT) {
+            float f;
+            memcpy(&f, &value, sizeof(f));
+            written = snprintf(out + n, cap - n, isFloatConversion(conv) ? spec : "%g", (double)f);
+        } else if (conv == 's') {
+            // Nur Literale aus dem Flash, Zeiger auf Laufzeitpuffer sind längst ungültig
+            const bool literal = tag == LOG_ARG_PTR && value >= SOC_DROM_LOW && value < SOC_DROM_HIGH;
+            written = snprintf(out + n, cap - n, spec, literal ? reinterpret_cast<const char*>(value) : "?");
+        } else if (conv == 'p') {
+            written = snprintf(out + n, cap - n, spec, reinterpret_cast<void*>(value));
+        } else if (isFloatConversion(conv)) {
+            written = snprintf(out + n, cap - n, spec, tag == LOG_ARG_INT ? (double)(int32_t)((value >> 1) ^ -(value & 1)) : (double)value);
+        } else if (tag == LOG_ARG_INT) {
+            written = snprintf(out + n, cap - n, spec, (int32_t)((value >> 1) ^ -(value & 1)));
+        } else {
+            written = snprintf(out + n, cap - n, spec, value);
+        }
+        if (written > 0) n += (size_t)written < cap - n ? written : cap - n - 1;
+    }
+    out[n] = '\0';
+}
+
+// Record wie im Header beschrieben; Argumente liegen schon kodiert im Slot
+static size_t deferredRecord(const LogRecord& r, uint8_t* out, size_t cap) {
+    TelemetryCodec::Writer w(out, cap);
+    w.varint(r.ts);
+    for (const uintptr_t addr : {(uintptr_t)r.fmt, (uintptr_t)r.typeLiteral}) {
+        for (uint8_t i = 0; i < 4; i++) w.u8((addr >> (8 * i)) & 0xFF);
+    }
+    for (uint8_t i = 0; i < r.len; i++) w.u8(r.msg[i]);
+    return w.ok() ? w.size() : 0;
+}
+
+// ---- Sinks (nur Drain-Task) ----
+static void ringAppend(const LogRecord& r) {
+    portENTER_CRITICAL(&logRingMux);
+    LogEntry& e = logRing[logRingHead % LOG_RING_SIZE];
+    e.seq = logRingHead;
+    e.ts = r.ts;
+    strlcpy(e.type, r.type, sizeof(e.type));
+    strlcpy(e.msg, r.msg, sizeof(e.msg));
     logRingHead++;
     if (logRingCount < LOG_RING_SIZE) logRingCount++;
-    portEXIT_CRITICAL(&mux);
-}
-
-String logRingJson(uint32_t since) {
-    String json = "{\"since\":";
-    uint32_t head = logRingHead;
-    uint32_t count = logRingCount;
-    uint32_t start = (count == LOG_RING_SIZE) ? head : 0;
-    json += String(head);
-    json += ",\"lines\":[";
-
-    bool first = true;
-    uint32_t n = (count < LOG_RING_SIZE) ? count : LOG_RING_SIZE;
-    for (uint32_t i = 0; i < n; i++) {
-        uint32_t idx = (start + i) % LOG_RING_SIZE;
-        const LogEntry& e = logRing[idx];
-        if (since > 0 && e.ts <= since) continue;
-        if (!first) json += ",";
-        first = false;
-        json += "{\"ts\":" + String(e.ts) + ",\"t\":\"";
-        json += e.type;
-        json += "\",\"m\":\"";
-        String msg = e.msg;
-        msg.replace("\\", "\\\\");
-        msg.replace("\"", "\\\"");
-        msg.replace("\n", "\\n");
-        msg.replace("\r", "");
-        json += msg;
-        json += "\"}";
-    }
-    json += "]}";
-    return json;
+    portEXIT_CRITICAL(&logRingMux);
 }
 
-// ---- Logging ----
-// Helper function for variadic arguments
-void vlogPrint(const char* type, const char* format, va_list args) {
-    WebSocketManager& ws = WebSocketManager::instance();
+static char wsBatch[LOG_WS_BATCH_BYTES];
+static size_t wsBatchLen = 0;
+static uint32_t wsBatchSince = 0;
+static portMUX_TYPE wsBatchMux = portMUX_INITIALIZER_UNLOCKED;
+
+static size_t jsonEscape(char* out, size_t cap, const char* in) {
+    size_t n = 0;
+    for (; *in && n + 2 < cap; in++) {
+        const char c = *in;
+        if (c == '"' || c == '\\') {
+            out[n++] = '\\';
+            out[n++] = c;
+        } else if (c == '\n') {
+            out[n++] = '\\';
+            out[n++] = 'n';
+        } else if ((uint8_t)c >= 0x20) {
+            out[n++] = c;
+        }
+    }
+    out[n] = '\0';
+    return n;
+}
+
+static void wsAppend(const LogRecord& r) {
+    char entry[2 * LOG_LINE_MAX + 64];
+    size_t n = snprintf(entry, sizeof(entry), "{\"ts\":%u,\"t\":\"", (unsigned)r.ts);
+    n += jsonEscape(entry + n, sizeof(entry) - n, r.type);
+    n += snprintf(entry + n, sizeof(entry) - n, "\",\"m\":\"");
+    n += jsonEscape(entry + n, sizeof(entry) - n - 2, r.msg);
+    n += snprintf(entry + n, sizeof(entry) - n, "\"}");
 
-    char loc_buf[256];
-    char web_buf[256];
+    bool stored = false;
+    portENTER_CRITICAL(&wsBatchMux);
+    if (wsBatchLen + n + 1 <= sizeof(wsBatch)) {
+        if (wsBatchLen) wsBatch[wsBatchLen++] = ',';
+        else wsBatchSince = millis();
+        memcpy(wsBatch + wsBatchLen, entry, n);
+        wsBatchLen += n;
+        stored = true;
+    }
+    portEXIT_CRITICAL(&wsBatchMux);
+    if (!stored) statWsDropped.fetch_add(1, std::memory_order_relaxed);
+}
 
-    va_list args_copy;
-    va_copy(args_copy, args);
+// Byte-Ring aus [u8 len][Record]; bei Platzmangel fliegen die ältesten Records raus
+static uint8_t binRing[LOG_BIN_RING_BYTES];
+static size_t binRingTail = 0;
+static size_t binRingUsed = 0;
 
-    // For Serial output
-    int len = vsnprintf(loc_buf, sizeof(loc_buf), format, args);
-    if (len > 0) {
-        Serial.println(loc_buf);
+static void binRingAppend(const uint8_t* rec, uint8_t len) {
+    portENTER_CRITICAL(&logRingMux);
+    while (binRingUsed && binRingUsed + len + 1 > sizeof(binRing)) {
+        const size_t drop = binRing[binRingTail] + 1;
+        binRingTail = (binRingTail + drop) % sizeof(binRing);
+        binRingUsed -= drop;
     }
+    size_t at = (binRingTail + binRingUsed) % sizeof(binRing);
+    binRing[at] = len;
+    for (uint8_t i = 0; i < len; i++) binRing[(at + 1 + i) % sizeof(binRing)] = rec[i];
+    binRingUsed += len + 1;
+    portEXIT_CRITICAL(&logRingMux);
+}
+
+static uint8_t wsRecords[LOG_WS_BIN_BYTES];
+static size_t wsRecordsLen = 0;
+static uint32_t wsRecordsSince = 0;
 
-    // For WebSocket output
-    int web_len = vsnprintf(web_buf, sizeof(web_buf), format, args_copy);
-    if (web_len > 0) {
-        // In Ringbuffer für Debug-Server
-        logRingPush(type, web_buf);
+static void wsRecordAppend(const uint8_t* rec, uint8_t len) {
+    bool stored = false;
+    portENTER_CRITICAL(&wsBatchMux);
+    if (wsRecordsLen + len + 1 <= sizeof(wsRecords)) {
+        if (!wsRecordsLen) wsRecordsSince = millis();
+        wsRecords[wsRecordsLen++] = len;
+        memcpy(wsRecords + wsRecordsLen, rec, len);
+        wsRecordsLen += len;
+        stored = true;
+    }
+    portEXIT_CRITICAL(&wsBatchMux);
+    if (!stored) statWsDropped.fetch_add(1, std::memory_order_relaxed);
+}
 
-        if (ws.isConnected()) {
-            String escaped_web_buf = web_buf;
-            escaped_web_buf.replace("\n", "\\n"); // Escape newline characters
-            String jsonPayload = "{\"t\":\"" + String(type) + "\",\"m\":\"" + escaped_web_buf + "\"}";
-            ws.webSocket.sendTXT(jsonPayload);
+static void dispatchDeferred(LogRecord& r) {
+    const bool wsBinary = WebSocketManager::instance().isBinary();
+    const bool wsText = (r.sinks & sinkBit(LogSink::WEBSOCKET)) && !wsBinary;
+
+    uint8_t rec[LOG_LINE_MAX + 16];
+    size_t recLen = 0;
+    if ((r.sinks & sinkBit(LogSink::RING)) || ((r.sinks & sinkBit(LogSink::WEBSOCKET)) && wsBinary)) {
+        recLen = deferredRecord(r, rec, sizeof(rec));
+    }
+    if (recLen && (r.sinks & sinkBit(LogSink::RING))) binRingAppend(rec, recLen);
+    if (recLen && (r.sinks & sinkBit(LogSink::WEBSOCKET)) && wsBinary) wsRecordAppend(rec, recLen);
+
+    if ((r.sinks & sinkBit(LogSink::CONSOLE)) || wsText) {
+        char text[LOG_LINE_MAX];
+        renderDeferred(r, text, sizeof(text));
+        memcpy(r.msg, text, sizeof(text));
+        if (r.sinks & sinkBit(LogSink::CONSOLE)) Serial.println(r.msg);
+        if (wsText) wsAppend(r);
+    }
+}
+
+static void logDrain(void*) {
+    LogRecord r;
+    for (;;) {
+        while (logPop(r)) {
+            if (r.fmt) {
+                dispatchDeferred(r);
+                continue;
+            }
+            if (r.sinks & sinkBit(LogSink::CONSOLE)) Serial.println(r.msg);
+            if (r.sinks & sinkBit(LogSink::RING)) ringAppend(r);
+            if (r.sinks & sinkBit(LogSink::WEBSOCKET)) wsAppend(r);
         }
+        ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(LOG_DRAIN_INTERVAL_MS));
+    }
+}
+
+void logBegin() {
+    if (logDrainTask) return;
+    xTaskCreatePinnedToCore(logDrain, "logDrain", 3072, nullptr, 1, &logDrainTask, APP_CPU_NUM);
+}
+
+size_t logTakeWsBatch(char* out, size_t cap, uint32_t now) {
+    static constexpr char PREFIX[] = "{\"logs\":[";
+    size_t len = 0;
+    portENTER_CRITICAL(&wsBatchMux);
+    const bool due = wsBatchLen && (!out || wsBatchLen >= sizeof(wsBatch) / 2 || now - wsBatchSince >= LOG_WS_FLUSH_MS);
+    if (due && out && sizeof(PREFIX) - 1 + wsBatchLen + 24 <= cap) {
+        memcpy(out, PREFIX, sizeof(PREFIX) - 1);
+        memcpy(out + sizeof(PREFIX) - 1, wsBatch, wsBatchLen);
+        len = sizeof(PREFIX) - 1 + wsBatchLen;
+    }
+    if (due) wsBatchLen = 0;
+    portEXIT_CRITICAL(&wsBatchMux);
+
+    // now erlaubt dem Backend, ts (Millis seit Boot) auf Wanduhrzeit umzurechnen
+    if (len) len += snprintf(out + len, cap - len, "],\"now\":%u}", (unsigned)now);
+    return len;
+}
+
+size_t logTakeWsRecords(uint8_t* out, size_t cap, uint32_t now) {
+    size_t len = 0;
+    portENTER_CRITICAL(&wsBatchMux);
+    const bool due = wsRecordsLen && (!out || wsRecordsLen >= sizeof(wsRecords) / 2 || now - wsRecordsSince >= LOG_WS_FLUSH_MS);
+    if (due && out && wsRecordsLen <= cap) {
+        memcpy(out, wsRecords, wsRecordsLen);
+        len = wsRecordsLen;
     }
+    if (due) wsRecordsLen = 0;
+    portEXIT_CRITICAL(&wsBatchMux);
+    return len;
+}
+
+// esptool trägt den SHA256 der ELF beim elf2image in die App-Beschreibung ein
+const uint8_t* logBuildId() {
+#if ESP_IDF_VERSION_MAJOR >= 5
+    return esp_app_get_description()->app_elf_sha256;
+#else
+    return esp_ota_get_app_description()->app_elf_sha256;
+#endif
+}
+
+size_t logBinRingDump(uint8_t* out, size_t cap) {
+    if (cap < LOG_BIN_DUMP_HEADER) return 0;
+    out[0] = 'H';
+    out[1] = 'L';
+    out[2] = 2;
+    memcpy(out + 3, logBuildId(), LOG_BUILD_ID_BYTES);
+    size_t n = LOG_BIN_DUMP_HEADER;
+    portENTER_CRITICAL(&logRingMux);
+    for (size_t i = 0; i < binRingUsed && n < cap; i++) out[n++] = binRing[(binRingTail + i) % sizeof(binRing)];
+    portEXIT_CRITICAL(&logRingMux);
+    return n;
+}
+
+// ---- Level / Stats ----
+LogLevel logLevelOf(const char* type) {
+    if (!strcmp(type, "error")) return LogLevel::ERROR;
+    if (!strcmp(type, "warn")) return LogLevel::WARN;
+    if (!strcmp(type, "lib")) return LogLevel::DEBUG;
+    return LogLevel::INFO;
+}
+
+void logSetSinkLevel(LogSink sink, LogLevel level) {
+    if (sink < LogSink::COUNT) sinkLevels[(uint8_t)sink] = level;
+}
+
+LogLevel logSinkLevel(LogSink sink) {
+    return sink < LogSink::COUNT ? sinkLevels[(uint8_t)sink] : LogLevel::ERROR;
+}
+
+const char* logLevelName(LogLevel level) {
+    switch (level) {
+        case LogLevel::DEBUG: return "debug";
+        case LogLevel::INFO: return "info";
+        case LogLevel::WARN: return "warn";
+        case LogLevel::ERROR: return "error";
+        default: return "?";
+    }
+}
+
+const char* logSinkName(LogSink sink) {
+    switch (sink) {
+        case LogSink::CONSOLE: return "serial";
+        case LogSink::RING: return "ring";
+        case LogSink::WEBSOCKET: return "ws";
+        default: return "?";
+    }
+}
+
+LogStats logStats() {
+    LogStats s;
+    s.calls = statCalls.load(std::memory_order_relaxed);
+    s.dropped = statDropped.load(std::memory_order_relaxed);
+    s.wsDropped = statWsDropped.load(std::memory_order_relaxed);
+    s.avgCycles = statAvgCycles.load(std::memory_order_relaxed);
+    s.maxCycles = statMaxCycles.load(std::memory_order_relaxed);
+    return s;
+}
+
+// ---- Debug-Ring ----
+void logRingPush(const char* type, const char* line) {
+    const uint8_t sinks = sinksFor(LogLevel::DEBUG, sinkBit(LogSink::RING));
+    if (sinks) logEnqueueLine(type, LogLevel::DEBUG, sinks, "%s", line);
+}
+
+void logRingWrite(JsonStream& json, uint32_t seq, uint16_t limit) {
+    portENTER_CRITICAL(&logRingMux);
+    const uint32_t head = logRingHead;
+    const uint32_t count = logRingCount;
+    portEXIT_CRITICAL(&logRingMux);
+
+    const uint32_t first = head - count;
+    if (seq < first || seq > head) seq = first;
+    const uint32_t end = (head - seq > limit) ? seq + limit : head;
+
+    json.field("first", first);
+    json.beginArray("lines");
+    LogEntry e;
+    for (uint32_t s = seq; s < end; s++) {
+        // Einzeln kopieren, der Drain-Task schreibt parallel
+        portENTER_CRITICAL(&logRingMux);
+        e = logRing[s % LOG_RING_SIZE];
+        portEXIT_CRITICAL(&logRingMux);
+        if (e.seq != s) continue;  // inzwischen überschrieben
+        json.beginObject()
+            .field("seq", e.seq)
+            .field("ts", e.ts)
+            .field("t", e.type)
+            .field("m", e.msg)
+            .endObject();
+    }
+    json.endArray();
+    json.field("next", end);
+}
+
+// ---- Logging ----
+// Helper function for variadic arguments
+// Aufruferseitig: ein vsnprintf in den reservierten Slot, keine Allokation, kein I/O
+void vlogPrint(const char* type, const char* format, va_list args) {
+    const uint32_t start = ESP.getCycleCount();
+    statCalls.fetch_add(1, std::memory_order_relaxed);
 
-    va_end(args_copy);
+    const LogLevel level = logLevelOf(type);
+    const uint8_t sinks = sinksFor(level, 0xFF);
+    if (sinks) logEnqueue(type, level, sinks, format, args);
+    logMeasure(start);
 }
 
 // Function to log messages to Serial and WebSocket with explicit type
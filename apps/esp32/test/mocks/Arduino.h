@@ -0,0 +1,34 @@
+#pragma once
+
+// Minimales Arduino für die Host-Tests (pio test -e native): nur was die getesteten Module
+// brauchen. Die Zeit ist simuliert, der Test stellt mock::nowMs selbst vor.
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <functional>
+#include <string>
+
+namespace mock {
+inline uint32_t nowMs = 0;
+}
+
+inline uint32_t millis() { return mock::nowMs; }
+inline uint32_t micros() { return mock::nowMs * 1000; }
+inline long random(long max) { return max > 0 ? rand() % max : 0; }
+
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+
+#if defined(__GLIBC__) && !__GLIBC_PREREQ(2, 38)
+inline size_t strlcpy(char* dst, const char* src, size_t size) {
+    const size_t len = strlen(src);
+    if (size) {
+        const size_t n = len < size - 1 ? len : size - 1;
+        memcpy(dst, src, n);
+        dst[n] = '\0';
+    }
+    return len;
+}
+#endif
+
+using String = std::string;
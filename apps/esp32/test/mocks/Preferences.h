@@ -0,0 +1,20 @@
+#pragma once
+
+// Preferences-Attrappe: kein NVS, PersistedObservable behält seine Defaults
+#include <stdint.h>
+
+class Preferences {
+public:
+    bool begin(const char*, bool = false) { return false; }
+    void end() {}
+
+    bool getBool(const char*, bool def = false) { return def; }
+    int32_t getInt(const char*, int32_t def = 0) { return def; }
+    uint32_t getUInt(const char*, uint32_t def = 0) { return def; }
+    float getFloat(const char*, float def = 0) { return def; }
+
+    size_t putBool(const char*, bool) { return 0; }
+    size_t putInt(const char*, int32_t) { return 0; }
+    size_t putUInt(const char*, uint32_t) { return 0; }
+    size_t putFloat(const char*, float) { return 0; }
+};
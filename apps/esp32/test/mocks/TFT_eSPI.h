@@ -0,0 +1,140 @@
+#pragma once
+
+// TFT_eSPI-Attrappe für die Host-Tests: nur die Teilmenge, die SurfaceFactory, RenderSurface,
+// Text/GlyphAtlas/RleFontRenderer und die Sinks benutzen. Das Panel ist ein RGB565-Speicher,
+// 4-bpp-Sprites haben dasselbe Pufferlayout wie TFT_eSprite (2 Pixel pro Byte, high nibble = gerades x).
+#include <stdint.h>
+#include <string.h>
+#include <vector>
+
+#define TFT_BLACK 0x0000
+#define TFT_WHITE 0xFFFF
+
+#define TL_DATUM 0
+#define TC_DATUM 1
+#define TR_DATUM 2
+#define ML_DATUM 3
+#define MC_DATUM 4
+#define MR_DATUM 5
+#define BL_DATUM 6
+#define BC_DATUM 7
+#define BR_DATUM 8
+#define L_BASELINE 9
+#define C_BASELINE 10
+#define R_BASELINE 11
+
+class TFT_eSPI {
+public:
+    TFT_eSPI(int16_t w = 280, int16_t h = 240) : _w(w), _h(h), _ram((size_t)w * h, 0) {}
+
+    int16_t width() const { return _w; }
+    int16_t height() const { return _h; }
+
+    void fillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color) {
+        for (int32_t py = y; py < y + h; py++)
+            for (int32_t px = x; px < x + w; px++) drawPixel(px, py, color);
+    }
+    void drawPixel(int32_t x, int32_t y, uint32_t color) {
+        if (x >= 0 && y >= 0 && x < _w && y < _h) _ram[(size_t)y * _w + x] = color;
+    }
+    uint16_t readPixel(int32_t x, int32_t y) const {
+        return x >= 0 && y >= 0 && x < _w && y < _h ? _ram[(size_t)y * _w + x] : 0;
+    }
+
+private:
+    int16_t _w;
+    int16_t _h;
+    std::vector<uint16_t> _ram;
+};
+
+class TFT_eSprite {
+public:
+    explicit TFT_eSprite(TFT_eSPI* tft) : _tft(tft) {}
+    ~TFT_eSprite() { deleteSprite(); }
+
+    void setColorDepth(int8_t bpp) { _bpp = bpp; }
+    int8_t getColorDepth() const { return _bpp; }
+
+    void* createSprite(int16_t w, int16_t h, uint8_t frames = 1) {
+        (void)frames;
+        deleteSprite();
+        _w = w;
+        _h = h;
+        _stride = _bpp == 4 ? (w + 1) >> 1 : w * 2;
+        _buf = new uint8_t[(size_t)_stride * h]();
+        return _buf;
+    }
+    void deleteSprite() {
+        delete[] _buf;
+        _buf = nullptr;
+    }
+    bool created() const { return _buf != nullptr; }
+    void* getPointer() { return _buf; }
+
+    int16_t width() const { return _buf ? _w : 0; }
+    int16_t height() const { return _buf ? _h : 0; }
+
+    void createPalette(const uint16_t* colors, uint8_t n = 16) {
+        for (uint8_t i = 0; i < n && i < 16; i++) _palette[i] = colors[i];
+    }
+    void setPaletteColor(uint8_t index, uint16_t color) { _palette[index & 0x0F] = color; }
+    uint16_t getPaletteColor(uint8_t index) const { return _palette[index & 0x0F]; }
+
+    void setTextDatum(uint8_t datum) { _datum = datum; }
+    uint8_t getTextDatum() const { return _datum; }
+
+    void drawPixel(int32_t x, int32_t y, uint32_t color) {
+        if (!_buf || x < 0 || y < 0 || x >= _w || y >= _h) return;
+        if (_bpp == 4) {
+            uint8_t& b = _buf[(size_t)y * _stride + (x >> 1)];
+            b = (x & 1) ? (b & 0xF0) | (color & 0x0F) : (b & 0x0F) | ((color & 0x0F) << 4);
+        } else {
+            uint16_t* row = reinterpret_cast<uint16_t*>(_buf + (size_t)y * _stride);
+            row[x] = color;
+        }
+    }
+    void fillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color) {
+        for (int32_t py = y; py < y + h; py++)
+            for (int32_t px = x; px < x + w; px++) drawPixel(px, py, color);
+    }
+    void drawFastHLine(int32_t x, int32_t y, int32_t w, uint32_t color) { fillRect(x, y, w, 1, color); }
+    void drawFastVLine(int32_t x, int32_t y, int32_t h, uint32_t color) { fillRect(x, y, 1, h, color); }
+    void fillSprite(uint32_t color) { fillRect(0, 0, _w, _h, color); }
+    void fillCircle(int32_t cx, int32_t cy, int32_t r, uint32_t color) {
+        for (int32_t dy = -r; dy <= r; dy++)
+            for (int32_t dx = -r; dx <= r; dx++)
+                if (dx * dx + dy * dy <= r * r) drawPixel(cx + dx, cy + dy, color);
+    }
+
+    // 4 bpp: Paletten-Index, sonst RGB565
+    uint16_t readPixelValue(int32_t x, int32_t y) const {
+        if (!_buf || x < 0 || y < 0 || x >= _w || y >= _h) return 0;
+        if (_bpp == 4) {
+            const uint8_t b = _buf[(size_t)y * _stride + (x >> 1)];
+            return (x & 1) ? (b & 0x0F) : (b >> 4);
+        }
+        return reinterpret_cast<const uint16_t*>(_buf + (size_t)y * _stride)[x];
+    }
+    uint16_t readPixel(int32_t x, int32_t y) const {
+        const uint16_t v = readPixelValue(x, y);
+        return _bpp == 4 ? _palette[v] : v;
+    }
+
+    void pushSprite(int32_t x, int32_t y) { pushSprite(x, y, 0, 0, _w, _h); }
+    bool pushSprite(int32_t tx, int32_t ty, int32_t sx, int32_t sy, int32_t sw, int32_t sh) {
+        if (!_buf || !_tft) return false;
+        for (int32_t py = 0; py < sh; py++)
+            for (int32_t px = 0; px < sw; px++) _tft->drawPixel(tx + px, ty + py, readPixel(sx + px, sy + py));
+        return true;
+    }
+
+private:
+    TFT_eSPI* _tft;
+    int8_t _bpp = 16;
+    int16_t _w = 0;
+    int16_t _h = 0;
+    int32_t _stride = 0;
+    uint8_t* _buf = nullptr;
+    uint16_t _palette[16] = {};
+    uint8_t _datum = TL_DATUM;
+};
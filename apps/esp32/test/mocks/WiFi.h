@@ -0,0 +1,61 @@
+#pragma once
+
+// WiFi-Treiber als Attrappe: der Test entscheidet, wann der Link steht (up) und löst
+// Disconnect-Events wie der Event-Task aus (drop()).
+#include <Arduino.h>
+
+enum wl_status_t {
+    WL_IDLE_STATUS = 0,
+    WL_CONNECTED = 3,
+    WL_DISCONNECTED = 6,
+};
+
+enum WiFiEvent_t {
+    ARDUINO_EVENT_WIFI_STA_DISCONNECTED = 5,
+    ARDUINO_EVENT_WIFI_STA_GOT_IP = 7,
+};
+
+struct WiFiEventInfo_t {
+    struct {
+        uint8_t reason;
+    } wifi_sta_disconnected;
+};
+
+#define WIFI_REASON_ASSOC_LEAVE 8
+
+struct IPAddress {
+    String toString() const { return "10.0.0.2"; }
+};
+
+class MockWiFi {
+public:
+    using EventHandler = void (*)(WiFiEvent_t, WiFiEventInfo_t);
+
+    bool up = false;
+    int8_t rssi = -60;
+    uint32_t begins = 0;
+    uint32_t reconnects = 0;
+    uint32_t lastAttemptMs = 0;  // begin()/reconnect(), für die simulierte Assoziation
+
+    wl_status_t status() const { return up ? WL_CONNECTED : WL_DISCONNECTED; }
+    int8_t RSSI() const { return up ? rssi : 0; }
+    IPAddress localIP() const { return IPAddress(); }
+    void setHostname(const char*) {}
+    void setAutoReconnect(bool) {}
+    void onEvent(EventHandler h) { handler = h; }
+    void begin(const char*, const char*) { begins++; lastAttemptMs = millis(); }
+    bool reconnect() { reconnects++; lastAttemptMs = millis(); return true; }
+
+    void drop(uint8_t reason) {
+        up = false;
+        if (!handler) return;
+        WiFiEventInfo_t info;
+        info.wifi_sta_disconnected.reason = reason;
+        handler(ARDUINO_EVENT_WIFI_STA_DISCONNECTED, info);
+    }
+
+private:
+    EventHandler handler = nullptr;
+};
+
+inline MockWiFi WiFi;
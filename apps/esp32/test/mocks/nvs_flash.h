@@ -0,0 +1,3 @@
+#pragma once
+
+// Von Observable.h eingebunden, auf dem Host ohne Inhalt
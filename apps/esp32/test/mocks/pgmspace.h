@@ -0,0 +1,14 @@
+#pragma once
+
+// Flash-Zugriffe auf dem Host: alles liegt im normalen Speicher
+#include <stdint.h>
+#include <string.h>
+
+#define PROGMEM
+#define pgm_read_byte(addr) (*(const uint8_t*)(addr))
+#define pgm_read_word(addr) (*(const uint16_t*)(addr))
+#define memcpy_P memcpy
+
+// Liest den Wert im eigenen Typ: RleFont legt Zeiger per pgm_read_dword ab, die auf dem Host 64 bit haben
+template <typename T>
+inline T pgm_read_dword(const T* addr) { return *addr; }
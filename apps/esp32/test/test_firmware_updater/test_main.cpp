@@ -0,0 +1,226 @@
+// Resume/Verify des Firmware-Downloads auf dem Host: pio test -e native
+//
+// FirmwareDownload gegen einen In-Process-Server mit den Fehlerbildern von scripts/otaserver.py:
+// Verbindungsabbrüche (--drop-every), Server ohne Range (--no-range, 200 statt 206) und ein
+// gekipptes Byte (--corrupt, Hash bleibt der des Originals). Dazu Stall, 4xx/5xx und Flash-Fehler.
+#include <unity.h>
+
+#include <algorithm>
+#include <vector>
+
+#include "services/FirmwareDownload.h"
+#include "../../src/services/FirmwareDownload.cpp"
+
+namespace {
+
+constexpr size_t IMAGE_SIZE = 300000;
+constexpr size_t CHUNK_SIZE = 1024;  // wie FirmwareUpdater::CHUNK_SIZE
+
+std::vector<uint8_t> makeImage() {
+    std::vector<uint8_t> image(IMAGE_SIZE);
+    srand(7);
+    for (auto& b : image) b = rand();
+    return image;
+}
+
+void sha256(const std::vector<uint8_t>& data, uint8_t* out) {
+    mbedtls_sha256_context ctx;
+    mbedtls_sha256_init(&ctx);
+    mbedtls_sha256_starts(&ctx, 0);
+    mbedtls_sha256_update(&ctx, data.data(), data.size());
+    mbedtls_sha256_finish(&ctx, out);
+    mbedtls_sha256_free(&ctx);
+}
+
+class OtaServer : public IFirmwareSource {
+public:
+    explicit OtaServer(std::vector<uint8_t> image) : image(std::move(image)) {}
+
+    std::vector<uint8_t> image;
+    std::vector<size_t> dropAt;   // Verbindung je einmal kappen, sobald diese Image-Position erreicht ist
+    bool noRange = false;
+    size_t stallFrom = SIZE_MAX;  // ab hier kommen keine Daten mehr
+    int status = 0;               // != 0: jeder Request endet mit diesem Status
+
+    std::vector<size_t> offsets;  // Range-Offset pro Request
+    std::vector<uint8_t> backoffs;
+
+    int open(size_t offset) override {
+        offsets.push_back(offset);
+        if (status) return status;
+        pos_ = noRange ? 0 : offset;
+        open_ = true;
+        return noRange || !offset ? 200 : 206;
+    }
+
+    int read(uint8_t* buf, size_t len) override {
+        if (!open_ || pos_ >= image.size() || pos_ >= stallFrom) return 0;
+        size_t n = std::min({len, (size_t)700, std::min(image.size(), stallFrom) - pos_});
+        for (auto it = dropAt.begin(); it != dropAt.end(); ++it) {
+            if (*it == pos_) {
+                dropAt.erase(it);
+                open_ = false;
+                return 0;
+            }
+            if (*it > pos_ && *it < pos_ + n) n = *it - pos_;
+        }
+        memcpy(buf, image.data() + pos_, n);
+        pos_ += n;
+        return n;
+    }
+
+    void close() override { open_ = false; }
+    void backoff(uint8_t attempt) override { backoffs.push_back(attempt); }
+
+private:
+    size_t pos_ = 0;
+    bool open_ = false;
+};
+
+class Flash : public IFirmwareTarget {
+public:
+    std::vector<uint8_t> data;
+    size_t failAt = SIZE_MAX;
+    size_t lastProgress = 0;
+
+    bool write(const uint8_t* buf, size_t len) override {
+        if (data.size() + len > failAt) return false;
+        data.insert(data.end(), buf, buf + len);
+        return true;
+    }
+    void progress(size_t written, size_t) override { lastProgress = written; }
+};
+
+struct Run {
+    FirmwareDownload::Result result;
+    uint16_t retries;
+    size_t written;
+};
+
+Run download(OtaServer& server, Flash& flash, const uint8_t* sha) {
+    uint8_t buf[CHUNK_SIZE];
+    FirmwareDownload dl(server, flash, buf, sizeof(buf));
+    const FirmwareDownload::Result result = dl.run(IMAGE_SIZE, sha);
+    return {result, dl.retries(), dl.written()};
+}
+
+}  // namespace
+
+static std::vector<uint8_t> image;
+static uint8_t imageSha[32];
+
+void setUp() {}
+void tearDown() {}
+
+void test_sha256_matches_reference() {
+    // FIPS 180-2, Beispiel "abc"
+    static const uint8_t ABC[32] = {0xba, 0x78, 0x16, 0xbf, 0x8f, 0x01, 0xcf, 0xea, 0x41, 0x41, 0x40,
+                                    0xde, 0x5d, 0xae, 0x22, 0x23, 0xb0, 0x03, 0x61, 0xa3, 0x96, 0x17,
+                                    0x7a, 0x9c, 0xb4, 0x10, 0xff, 0x61, 0xf2, 0x00, 0x15, 0xad};
+    uint8_t out[32];
+    sha256({'a', 'b', 'c'}, out);
+    TEST_ASSERT_TRUE(memcmp(out, ABC, sizeof(out)) == 0);
+}
+
+void test_clean_download() {
+    OtaServer server(image);
+    Flash flash;
+    const Run run = download(server, flash, imageSha);
+    TEST_ASSERT_TRUE(run.result == FirmwareDownload::Result::OK);
+    TEST_ASSERT_TRUE(flash.data == image);
+    TEST_ASSERT_EQUAL_UINT32(IMAGE_SIZE, run.written);
+    TEST_ASSERT_EQUAL_UINT32(1, server.offsets.size());
+    TEST_ASSERT_EQUAL_UINT32(IMAGE_SIZE, flash.lastProgress);
+}
+
+void test_drop_resumes_with_range() {
+    OtaServer server(image);
+    server.dropAt = {100000, 200000, 250001};
+    Flash flash;
+    const Run run = download(server, flash, imageSha);
+    TEST_ASSERT_TRUE(run.result == FirmwareDownload::Result::OK);
+    TEST_ASSERT_TRUE(flash.data == image);
+    TEST_ASSERT_EQUAL_UINT32(3, run.retries);
+    TEST_ASSERT_EQUAL_UINT32(4, server.offsets.size());
+    TEST_ASSERT_EQUAL_UINT32(0, server.offsets[0]);
+    TEST_ASSERT_EQUAL_UINT32(100000, server.offsets[1]);
+    TEST_ASSERT_EQUAL_UINT32(200000, server.offsets[2]);
+    TEST_ASSERT_EQUAL_UINT32(250001, server.offsets[3]);
+    // Jeder Abbruch kam nach Fortschritt: Backoff bleibt beim ersten Schritt
+    TEST_ASSERT_EQUAL_UINT32(3, server.backoffs.size());
+    TEST_ASSERT_EQUAL_UINT8(1, server.backoffs[2]);
+}
+
+void test_ignored_range_skips_written_bytes() {
+    OtaServer server(image);
+    server.noRange = true;
+    server.dropAt = {120000};
+    Flash flash;
+    const Run run = download(server, flash, imageSha);
+    TEST_ASSERT_TRUE(run.result == FirmwareDownload::Result::OK);
+    // 200 statt 206: der zweite Request kommt ab 0, die ersten 120000 Bytes werden verworfen
+    TEST_ASSERT_TRUE(flash.data == image);
+    TEST_ASSERT_EQUAL_UINT32(2, server.offsets.size());
+    TEST_ASSERT_EQUAL_UINT32(120000, server.offsets[1]);
+}
+
+void test_corrupt_byte_aborts() {
+    OtaServer server(image);
+    server.image[4096] ^= 0xFF;
+    server.dropAt = {50000};
+    Flash flash;
+    const Run run = download(server, flash, imageSha);
+    TEST_ASSERT_TRUE(run.result == FirmwareDownload::Result::SHA_MISMATCH);
+    TEST_ASSERT_EQUAL_UINT32(IMAGE_SIZE, flash.data.size());
+}
+
+void test_stall_gives_up_after_max_retries() {
+    OtaServer server(image);
+    server.stallFrom = 80000;
+    Flash flash;
+    const Run run = download(server, flash, imageSha);
+    TEST_ASSERT_TRUE(run.result == FirmwareDownload::Result::DOWNLOAD);
+    TEST_ASSERT_EQUAL_UINT32(80000, run.written);
+    // Versuch 1 hatte noch Fortschritt, danach MAX_RETRIES leere Versuche mit wachsendem Backoff
+    TEST_ASSERT_EQUAL_UINT32(FirmwareDownload::MAX_RETRIES, run.retries);
+    TEST_ASSERT_EQUAL_UINT32(FirmwareDownload::MAX_RETRIES + 1, server.offsets.size());
+    TEST_ASSERT_EQUAL_UINT8(FirmwareDownload::MAX_RETRIES, server.backoffs.back());
+}
+
+void test_client_error_is_fatal() {
+    OtaServer server(image);
+    server.status = 404;
+    Flash flash;
+    TEST_ASSERT_TRUE(download(server, flash, imageSha).result == FirmwareDownload::Result::HTTP);
+    TEST_ASSERT_EQUAL_UINT32(1, server.offsets.size());
+
+    OtaServer busy(image);
+    busy.status = 503;
+    TEST_ASSERT_TRUE(download(busy, flash, imageSha).result == FirmwareDownload::Result::DOWNLOAD);
+    TEST_ASSERT_EQUAL_UINT32(FirmwareDownload::MAX_RETRIES + 1, busy.offsets.size());
+}
+
+void test_flash_write_failure_is_fatal() {
+    OtaServer server(image);
+    Flash flash;
+    flash.failAt = 65536;
+    const Run run = download(server, flash, imageSha);
+    TEST_ASSERT_TRUE(run.result == FirmwareDownload::Result::WRITE);
+    TEST_ASSERT_EQUAL_UINT32(1, server.offsets.size());
+}
+
+int main() {
+    image = makeImage();
+    sha256(image, imageSha);
+
+    UNITY_BEGIN();
+    RUN_TEST(test_sha256_matches_reference);
+    RUN_TEST(test_clean_download);
+    RUN_TEST(test_drop_resumes_with_range);
+    RUN_TEST(test_ignored_range_skips_written_bytes);
+    RUN_TEST(test_corrupt_byte_aborts);
+    RUN_TEST(test_stall_gives_up_after_max_retries);
+    RUN_TEST(test_client_error_is_fatal);
+    RUN_TEST(test_flash_write_failure_is_fatal);
+    return UNITY_END();
+}
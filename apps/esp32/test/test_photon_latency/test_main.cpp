@@ -0,0 +1,155 @@
+// PhotonLatency auf dem Host: pio test -e native
+//
+// Synthetische Events und Frames mit festen Zeitstempeln (µs); geprüft werden Bucket-Grenzen,
+// Perzentile, die Aufteilung in Stationen und welche Events überhaupt verbucht werden.
+#include <unity.h>
+
+#include "PhotonLatency.h"
+#include "../../lib/UI/PhotonLatency.cpp"
+
+static PhotonLatency& lat = PhotonLatency::instance();
+
+// Ein Event mit Reaktion: Handler [beginUs, handledUs], Frame [frameUs, presentedUs]
+static void press(uint32_t eventUs, uint32_t beginUs, uint32_t handledUs, uint32_t frameUs, uint32_t presentedUs,
+                  uint8_t type = 1, uint8_t screen = 2) {
+    lat.inputBegin(eventUs, type, screen, beginUs);
+    lat.inputHandled(handledUs);
+    lat.frameBegin(frameUs);
+    lat.framePresented(presentedUs);
+}
+
+void setUp() {
+    lat.reset();
+}
+
+void tearDown() {}
+
+void test_bucket_bounds_are_inclusive() {
+    PhotonLatency::Histogram h;
+    h.add(2000);     // <= 2 ms
+    h.add(2001);     // <= 4 ms
+    h.add(500000);   // <= 500 ms
+    h.add(500001);   // darüber
+    TEST_ASSERT_EQUAL_UINT16(1, h.counts[0]);
+    TEST_ASSERT_EQUAL_UINT16(1, h.counts[1]);
+    TEST_ASSERT_EQUAL_UINT16(1, h.counts[PhotonLatency::BUCKETS - 2]);
+    TEST_ASSERT_EQUAL_UINT16(1, h.counts[PhotonLatency::BUCKETS - 1]);
+    TEST_ASSERT_EQUAL_UINT32(4, h.samples);
+    TEST_ASSERT_EQUAL_UINT32(500001, h.maxUs);
+    TEST_ASSERT_EQUAL_UINT32((2000 + 2001 + 500000 + 500001) / 4, h.avgUs());
+}
+
+void test_percentiles() {
+    PhotonLatency::Histogram h;
+    TEST_ASSERT_EQUAL_UINT16(0, h.percentileMs(50));  // leer
+    for (int i = 0; i < 50; i++) h.add(1000);     // Bucket <= 2 ms
+    for (int i = 0; i < 45; i++) h.add(10000);    // Bucket <= 16 ms
+    for (int i = 0; i < 5; i++) h.add(600000);    // über 500 ms
+    TEST_ASSERT_EQUAL_UINT16(2, h.percentileMs(50));
+    TEST_ASSERT_EQUAL_UINT16(16, h.percentileMs(51));
+    TEST_ASSERT_EQUAL_UINT16(16, h.percentileMs(95));
+    TEST_ASSERT_EQUAL_UINT16(0, h.percentileMs(96));  // 0 = über dem letzten Bucket
+    TEST_ASSERT_EQUAL_UINT16(0, h.percentileMs(100));
+}
+
+void test_percentile_rounds_rank_up() {
+    PhotonLatency::Histogram h;
+    h.add(1000);
+    h.add(3000);
+    h.add(3000);
+    // Rang ceil(3 * 34 / 100) = 2 liegt schon im zweiten Bucket
+    TEST_ASSERT_EQUAL_UINT16(2, h.percentileMs(33));
+    TEST_ASSERT_EQUAL_UINT16(4, h.percentileMs(34));
+}
+
+void test_counts_saturate() {
+    PhotonLatency::Histogram h;
+    for (uint32_t i = 0; i < 70000; i++) h.add(100);
+    TEST_ASSERT_EQUAL_UINT16(UINT16_MAX, h.counts[0]);
+    TEST_ASSERT_EQUAL_UINT32(70000, h.samples);
+}
+
+void test_stages_split_the_total() {
+    press(1000, 3000, 3500, 10000, 25000);
+    TEST_ASSERT_EQUAL_UINT32(1, lat.total().samples);
+    TEST_ASSERT_EQUAL_UINT32(24000, lat.total().maxUs);
+    TEST_ASSERT_EQUAL_UINT32(1, lat.byScreen(2).samples);
+    TEST_ASSERT_EQUAL_UINT32(1, lat.byType(1).samples);
+
+    const auto& st = lat.stages();
+    TEST_ASSERT_EQUAL_UINT32(1, st.samples);
+    TEST_ASSERT_EQUAL_UINT64(2000, st.queueUs);
+    TEST_ASSERT_EQUAL_UINT64(500, st.handleUs);
+    TEST_ASSERT_EQUAL_UINT64(6500, st.waitUs);
+    TEST_ASSERT_EQUAL_UINT64(15000, st.renderUs);
+}
+
+void test_invisible_event_is_not_charged() {
+    lat.inputBegin(1000, 1, 2, 1500);
+    lat.inputHandled(2000, false);
+    lat.frameBegin(50000);   // Frame aus anderem Grund (z.B. Timer)
+    lat.framePresented(60000);
+    TEST_ASSERT_EQUAL_UINT32(0, lat.total().samples);
+    TEST_ASSERT_EQUAL_UINT32(1, lat.ignored());
+
+    // Nur das sichtbare von zwei Events landet im folgenden Frame
+    lat.inputBegin(100000, 1, 2, 100500);
+    lat.inputHandled(101000, false);
+    lat.inputBegin(102000, 3, 2, 102500);
+    lat.inputHandled(103000, true);
+    lat.frameBegin(110000);
+    lat.framePresented(120000);
+    TEST_ASSERT_EQUAL_UINT32(1, lat.total().samples);
+    TEST_ASSERT_EQUAL_UINT32(0, lat.byType(1).samples);
+    TEST_ASSERT_EQUAL_UINT32(1, lat.byType(3).samples);
+    TEST_ASSERT_EQUAL_UINT32(18000, lat.total().maxUs);
+}
+
+void test_frame_inside_handler() {
+    // Slide-Transition zeichnet synchron im Handler: handled zählt ab Frame-Beginn
+    lat.inputBegin(30000, 4, 1, 31000);
+    lat.frameBegin(32000);
+    lat.framePresented(90000);
+    lat.inputHandled(91000, true);  // schon verbucht, darf nichts mehr ändern
+    TEST_ASSERT_EQUAL_UINT32(1, lat.byType(4).samples);
+    TEST_ASSERT_EQUAL_UINT32(0, lat.ignored());
+    TEST_ASSERT_EQUAL_UINT64(1000, lat.stages().handleUs);
+    TEST_ASSERT_EQUAL_UINT64(0, lat.stages().waitUs);
+    TEST_ASSERT_EQUAL_UINT64(58000, lat.stages().renderUs);
+}
+
+void test_frame_without_pending_is_ignored() {
+    lat.frameBegin(1000);
+    lat.framePresented(2000);
+    TEST_ASSERT_EQUAL_UINT32(0, lat.total().samples);
+    TEST_ASSERT_EQUAL_UINT32(0, lat.stages().samples);
+}
+
+void test_stale_and_dropped() {
+    press(200000, 200000, 200100, 200000 + PhotonLatency::STALE_US + 1, 200000 + PhotonLatency::STALE_US + 2);
+    TEST_ASSERT_EQUAL_UINT32(1, lat.stale());
+    TEST_ASSERT_EQUAL_UINT32(0, lat.total().samples);
+
+    for (uint8_t i = 0; i <= PhotonLatency::PENDING; i++) {
+        lat.inputBegin(300000 + i, 1, 2, 300000 + i);
+        lat.inputHandled(300000 + i);
+    }
+    lat.frameBegin(310000);
+    lat.framePresented(311000);
+    TEST_ASSERT_EQUAL_UINT32(1, lat.dropped());
+    TEST_ASSERT_EQUAL_UINT32(PhotonLatency::PENDING, lat.total().samples);
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_bucket_bounds_are_inclusive);
+    RUN_TEST(test_percentiles);
+    RUN_TEST(test_percentile_rounds_rank_up);
+    RUN_TEST(test_counts_saturate);
+    RUN_TEST(test_stages_split_the_total);
+    RUN_TEST(test_invisible_event_is_not_charged);
+    RUN_TEST(test_frame_inside_handler);
+    RUN_TEST(test_frame_without_pending_is_ignored);
+    RUN_TEST(test_stale_and_dropped);
+    return UNITY_END();
+}
@@ -0,0 +1,344 @@
+// Render-Benchmark und Golden-Images auf dem Host: pio test -e native
+//
+// Der echte Renderpfad (SurfaceFactory, RenderSurface, Text/GlyphAtlas/RleFontRenderer) zeichnet
+// über die TFT_eSprite-Attrappe in einen FramebufferSink. Die Szenarien sind Skripte mit dem
+// Surface-Layout von FireScreen (idle), HeatUI::render, GenericMenuScreen und StatusBar - die
+// Screen-Klassen selbst hängen an HeaterController/ZVSDriver/WebSocketManager und bleiben auf dem Gerät.
+// Dazu die Schleife aus ScreenManager::slideIn: einmal rendern, danach Spaltenfenster per ClipSink::replay().
+//
+// Mit RENDER_BENCH_PNG=<dir> landet der erste Frame jedes Szenarios als PNG im Verzeichnis.
+#include <unity.h>
+
+#include <chrono>
+#include <string>
+
+#include "../../src/ui/base/SurfaceFactory.cpp"
+#include "../../lib/UI/RenderSurface.cpp"
+#include "../../lib/UI/Text.cpp"
+#include "../../lib/UI/GlyphAtlas.cpp"
+#include "../../lib/UI/RleFontRenderer.cpp"
+#include "../../lib/UI/FramebufferSink.cpp"
+#include "ClipSink.h"
+
+namespace {
+
+constexpr uint16_t W = DisplayConfig::WIDTH;
+constexpr uint16_t H = DisplayConfig::HEIGHT;
+constexpr uint32_t WINDOW = PushStats::WINDOW_BYTES;
+
+using Scenario = void (*)(SurfaceFactory& f, uint16_t i);
+
+// HeatUI::Temperature: Label sm, Wert 24 px tiefer
+void temperature(RenderSurface& s, uint16_t ir, uint16_t limit) {
+    char buf[8];
+    s.sprite->setTextDatum(MR_DATUM);
+    snprintf(buf, sizeof(buf), "%u", ir);
+    s.text(134, 16, "IR", Text::Size::sm);
+    s.text(134, 40, buf, Text::Size::bxl);
+    s.sprite->setTextDatum(ML_DATUM);
+    snprintf(buf, sizeof(buf), "%u", limit);
+    s.text(146, 16, "Limit", Text::Size::sm);
+    s.text(146, 40, buf, Text::Size::bxl);
+}
+
+void stats(RenderSurface& s, int16_t x, const char* label, const char* value) {
+    s.text(x, 0, value, Text::Size::bmd);
+    s.text(x, 24, label, Text::Size::sm);
+}
+
+void fireIdle(SurfaceFactory& f, uint16_t i) {
+    f.withSurface(200, 60, 15, 100, [](RenderSurface& s) {
+        s.text(0, 0, "Limit");
+        s.text(0, 30, "210");
+    });
+    f.withSurface(280, 88, 0, 0, [i](RenderSurface& s) {
+        s.sprite->fillRect(0, 0, s.width(), s.height(), COLOR_BG_2);
+        temperature(s, 20 + i % 10, 210);
+    });
+    // ragt wie auf dem Gerät 16 px über den rechten Rand
+    f.withSurface(200, 50, 96, 190, [](RenderSurface& s) {
+        s.sprite->fillRect(0, 0, s.width(), s.height(), COLOR_BG_2);
+        stats(s, 0, "Session", "0.12");
+        stats(s, 72, "Heute", "0.48");
+        stats(s, 132, "Gestern", "0.30");
+    });
+}
+
+void fireHeating(SurfaceFactory& f, uint16_t i) {
+    const uint16_t temp = 120 + (i * 3) % 100;
+    f.withSurface(280, 240, 0, 0, [i, temp](RenderSurface& s) {
+        char buf[4];
+        s.sprite->setPaletteColor(15, ColorUtils::getTemperatureColor565(temp, true));
+        const int16_t fill = s.height() * temp / 210;
+        s.sprite->fillRect(0, s.height() - fill, s.width(), fill, 15);
+        temperature(s, 124 + (i * 3) % 100, 210);
+
+        snprintf(buf, sizeof(buf), "%u", i % 120);
+        s.sprite->setTextDatum(MC_DATUM);
+        s.text(s.centerX(), s.centerY(), buf, Text::Size::bxxl);
+        s.sprite->setTextDatum(ML_DATUM);
+
+        s.text(15, 188, "Limit");
+        s.text(15, 212, "210");
+    });
+}
+
+void menu(SurfaceFactory& f, uint16_t i) {
+    static const char* const TITLES[8] = {"Helligkeit", "Dark Mode", "Power", "Auto-Stop",
+                                          "Zyklus A", "Zyklus B", "IR Korrektur", "Timeout"};
+    static const char* const VALUES[8] = {"100", "On", "80", "90", "210", "225", "-3", "600"};
+    f.withSurface(280, 240, 0, 0, [i](RenderSurface& s) {
+        s.sprite->fillSprite(COLOR_BG);
+        for (uint8_t k = 0; k < 8; k++) {
+            const uint8_t color = k == i % 8 ? COLOR_TEXT_PRIMARY : COLOR_TEXT_SECONDARY;
+            s.text(10, 30 + k * 30, TITLES[k], Text::Size::sm, color);
+            s.text(200, 30 + k * 30, VALUES[k], Text::Size::md, color);
+        }
+    });
+}
+
+void statusBar(SurfaceFactory& f, uint16_t i) {
+    f.withSurface(96, 50, 0, 190, [i](RenderSurface& s) {
+        char buf[6];
+        snprintf(buf, sizeof(buf), "12:%02u", i % 60);
+        s.sprite->fillRect(0, 0, s.width(), s.height(), COLOR_BG_2);
+        s.text(8, 0, buf, Text::Size::lg);
+        s.sprite->fillRect(16, 41, 6, 6, COLOR_BLACK);
+        s.sprite->fillCircle(19, 44, 3, COLOR_SUCCESS);
+    });
+}
+
+struct Entry {
+    const char* name;
+    Scenario run;
+};
+
+const Entry SCENARIOS[] = {
+    {"fire_idle", fireIdle},
+    {"fire_heating", fireHeating},
+    {"menu", menu},
+    {"statusbar", statusBar},
+};
+
+struct Result {
+    uint32_t frames = 0;
+    uint64_t totalUs = 0;
+    uint32_t bytes = 0;
+    uint32_t checksum = 0;  // CRC32 nach dem ersten Frame
+
+    uint32_t avgUs() const { return frames ? totalUs / frames : 0; }
+    uint32_t bytesPerFrame() const { return frames ? bytes / frames : 0; }
+};
+
+Result bench(const Entry& e, uint16_t frames, bool allocate = true) {
+    TFT_eSPI tft(W, H);
+    SurfaceFactory factory(&tft);
+    FramebufferSink fb(W, H, allocate);
+    factory.setSink(&fb);
+
+    Result r;
+    for (uint16_t i = 0; i < frames; i++) {
+        const auto start = std::chrono::steady_clock::now();
+        e.run(factory, i);
+        r.totalUs += std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+        r.frames++;
+        if (i == 0) {
+            r.checksum = fb.checksum();
+            if (const char* dir = getenv("RENDER_BENCH_PNG")) {
+                if (FILE* out = fopen((std::string(dir) + "/" + e.name + ".png").c_str(), "wb")) {
+                    fb.writePNG([out](const uint8_t* data, size_t len) { fwrite(data, 1, len, out); });
+                    fclose(out);
+                }
+            }
+        }
+    }
+    r.bytes = fb.stats().bytes;
+    return r;
+}
+
+constexpr uint32_t fullPush(uint32_t w, uint32_t h) { return WINDOW + w * h * 2; }
+
+// Schleife aus ScreenManager::slideIn ohne Hardware-Scroll: jeder Schritt malt die Spalten
+// [done, next) direkt an ihre Endposition im Panel-RAM
+struct Slide {
+    uint32_t renders = 0;
+    uint64_t us = 0;
+    uint32_t bytes = 0;
+};
+
+Slide slide(TFT_eSPI& tft, const Entry& e, bool replay) {
+    SurfaceFactory factory(&tft);
+    ClipSink clip;
+    factory.setSink(&clip);
+
+    Slide r;
+    const auto start = std::chrono::steady_clock::now();
+    for (uint16_t done = 0; done < W;) {
+        const uint16_t next = std::min<uint16_t>(W, done + DisplayConfig::TRANSITION_STEP_PX);
+        clip.setColumns(done, next);
+        factory.fillBackground(done, 0, next - done, H);
+        if (replay && done && clip.replayable()) {
+            clip.replay();
+        } else {
+            clip.record(!done);
+            factory.invalidateAll();
+            factory.forceRedraw();
+            e.run(factory, 0);
+            clip.record(false);
+            r.renders++;
+        }
+        done = next;
+    }
+    r.us = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+    r.bytes = clip.stats().bytes;
+    return r;
+}
+
+bool samePanel(const TFT_eSPI& a, const TFT_eSPI& b) {
+    for (int16_t y = 0; y < H; y++)
+        for (int16_t x = 0; x < W; x++)
+            if (a.readPixel(x, y) != b.readPixel(x, y)) return false;
+    return true;
+}
+
+// Zwei Surfaces gleicher Größe teilen sich den Pool-Sprite
+void sharedSprite(SurfaceFactory& f, uint16_t) {
+    f.withSurface(120, 40, 10, 20, [](RenderSurface& s) { s.text(0, 0, "oben"); });
+    f.withSurface(120, 40, 150, 120, [](RenderSurface& s) { s.text(0, 0, "unten"); });
+}
+
+}  // namespace
+
+void setUp() {
+    GlyphAtlas::instance().setEnabled(true);
+}
+
+void tearDown() {}
+
+void test_bytes_per_frame() {
+    // Wie TFT_eSPI::pushSprite(): nur der sichtbare Teil geht über den Bus
+    TEST_ASSERT_EQUAL_UINT32(fullPush(200, 60) + fullPush(280, 88) + fullPush(W - 96, 50),
+                             bench(SCENARIOS[0], 4).bytesPerFrame());
+    TEST_ASSERT_EQUAL_UINT32(fullPush(W, H), bench(SCENARIOS[1], 4).bytesPerFrame());
+    TEST_ASSERT_EQUAL_UINT32(fullPush(W, H), bench(SCENARIOS[2], 4).bytesPerFrame());
+    TEST_ASSERT_EQUAL_UINT32(fullPush(96, 50), bench(SCENARIOS[3], 4).bytesPerFrame());
+}
+
+void test_golden_frames() {
+    // Ändert sich eins davon, die PNGs (RENDER_BENCH_PNG) ansehen und die Werte bewusst nachziehen
+    static const uint32_t GOLDEN[] = {0x996D776F, 0x83C22BCF, 0xC48B8D5A, 0x9A751F83};
+    for (uint8_t k = 0; k < 4; k++) {
+        const Result r = bench(SCENARIOS[k], 1);
+        TEST_ASSERT_EQUAL_UINT32(GOLDEN[k], r.checksum);
+    }
+}
+
+void test_atlas_matches_rle_renderer() {
+    for (uint8_t k = 0; k < 4; k++) {
+        GlyphAtlas::instance().setEnabled(true);
+        const uint32_t atlas = bench(SCENARIOS[k], 1).checksum;
+        GlyphAtlas::instance().setEnabled(false);
+        TEST_ASSERT_EQUAL_UINT32(atlas, bench(SCENARIOS[k], 1).checksum);
+    }
+}
+
+void test_counting_mode_keeps_stats() {
+    const Result full = bench(SCENARIOS[0], 3);
+    const Result counting = bench(SCENARIOS[0], 3, false);
+    TEST_ASSERT_EQUAL_UINT32(full.bytes, counting.bytes);
+    TEST_ASSERT_EQUAL_UINT32(0, counting.checksum);
+
+    FramebufferSink none(W, H, false);
+    TEST_ASSERT_FALSE(none.hasBuffer());
+    TEST_ASSERT_FALSE(none.writePNG([](const uint8_t*, size_t) {}));
+}
+
+void test_png_layout() {
+    FramebufferSink fb(W, H);
+    std::string png;
+    TEST_ASSERT_TRUE(fb.writePNG([&png](const uint8_t* data, size_t len) { png.append((const char*)data, len); }));
+
+    // Signatur + IHDR + IDAT (zlib, ein Stored-Block pro Zeile) + IEND
+    const uint32_t idat = 2 + H * (5 + 1 + W * 3) + 4;
+    TEST_ASSERT_EQUAL_UINT32(8 + (12 + 13) + (12 + idat) + 12, png.size());
+    TEST_ASSERT_TRUE(png.compare(0, 4, "\x89PNG") == 0);
+    TEST_ASSERT_TRUE(png.compare(png.size() - 8, 4, "IEND") == 0);
+}
+
+void test_slide_replays_instead_of_rerendering() {
+    const Entry shared = {"shared", sharedSprite};
+    for (const Entry& e : {SCENARIOS[0], SCENARIOS[2], shared}) {
+        TFT_eSPI direct(W, H);
+        SurfaceFactory factory(&direct);
+        factory.fillBackground(0, 0, W, H);
+        e.run(factory, 0);
+
+        TFT_eSPI rendered(W, H);
+        TFT_eSPI replayed(W, H);
+        const Slide before = slide(rendered, e, false);
+        const Slide after = slide(replayed, e, true);
+        TEST_ASSERT_TRUE(samePanel(direct, rendered));
+        TEST_ASSERT_TRUE(samePanel(direct, replayed));
+        TEST_ASSERT_EQUAL_UINT32(7, before.renders);
+        TEST_ASSERT_EQUAL_UINT32(e.run == sharedSprite ? 7 : 1, after.renders);
+        TEST_ASSERT_EQUAL_UINT32(before.bytes, after.bytes);
+    }
+}
+
+void test_bench_report() {
+    for (const Entry& e : SCENARIOS) {
+        const Result r = bench(e, 60);
+        printf("%-13s %5lu us/frame  %6.1f fps  %6lu B/frame\n", e.name, (unsigned long)r.avgUs(),
+               r.avgUs() ? 1e6 / r.avgUs() : 0.0, (unsigned long)r.bytesPerFrame());
+        TEST_ASSERT_EQUAL_UINT32(60, r.frames);
+    }
+
+    // Nur die heißen Zahlenfelder (Timer bxxl, IR/Limit bxl) ohne Push - Atlas gegen RLE-Renderer
+    TFT_eSPI tft(W, H);
+    TFT_eSprite sprite(&tft);
+    sprite.setColorDepth(4);
+    sprite.createSprite(W, H);
+    RenderSurface s(&sprite);
+    for (const bool atlas : {false, true}) {
+        GlyphAtlas::instance().setEnabled(atlas);
+        const auto start = std::chrono::steady_clock::now();
+        for (uint16_t i = 0; i < 1000; i++) {
+            char buf[4];
+            temperature(s, 124 + (i * 3) % 100, 210);
+            snprintf(buf, sizeof(buf), "%u", i % 120);
+            sprite.setTextDatum(MC_DATUM);
+            s.text(s.centerX(), s.centerY(), buf, Text::Size::bxxl);
+        }
+        const auto us = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+        printf("hot text %-5s %5.1f us/frame\n", atlas ? "atlas" : "rle", us / 1000.0);
+    }
+
+    for (const Entry& e : {SCENARIOS[0], SCENARIOS[2]}) {
+        for (const bool replay : {false, true}) {
+            uint64_t us = 0;
+            Slide r;
+            for (uint8_t n = 0; n < 20; n++) {
+                TFT_eSPI panel(W, H);
+                r = slide(panel, e, replay);
+                us += r.us;
+            }
+            printf("slide %-9s %-7s %5lu us  %lu renders  %6lu B\n", e.name, replay ? "replay" : "render",
+                   (unsigned long)(us / 20), (unsigned long)r.renders, (unsigned long)r.bytes);
+        }
+    }
+}
+
+int main() {
+    GlyphAtlas::instance().build(Text::Size::bxxl, DisplayConfig::ATLAS_TIMER_CHARS);
+    GlyphAtlas::instance().build(Text::Size::bxl, DisplayConfig::ATLAS_TEMP_CHARS);
+
+    UNITY_BEGIN();
+    RUN_TEST(test_bytes_per_frame);
+    RUN_TEST(test_golden_frames);
+    RUN_TEST(test_atlas_matches_rle_renderer);
+    RUN_TEST(test_counting_mode_keeps_stats);
+    RUN_TEST(test_png_layout);
+    RUN_TEST(test_slide_replays_instead_of_rerendering);
+    RUN_TEST(test_bench_report);
+    return UNITY_END();
+}
@@ -0,0 +1,254 @@
+// TelemetryCodec auf dem Host: pio test -e native
+//
+// Die Frames aus apps/backend/src/test/utils/telemetry.test.ts müssen Byte für Byte aus dem
+// Encoder kommen (Backend-Test = Decoder, hier = Encoder, gleiche Vektoren). TEMP_BATCH wird
+// zusätzlich mit einem kleinen Decoder zurückgelesen, und der schlimmste Fall muss genau
+// batchBytesMax() treffen.
+#include <unity.h>
+
+#include <vector>
+
+#include "driver/net/TelemetryCodec.h"
+#include "driver/net/WsMessages.h"
+#include "../../src/driver/net/TelemetryCodec.cpp"
+
+namespace {
+
+using Bytes = std::vector<uint8_t>;
+
+Bytes encode(const WsPendingMsg& msg) {
+    uint8_t buf[64];
+    const size_t len = TelemetryCodec::encode(msg, buf, sizeof(buf));
+    return Bytes(buf, buf + len);
+}
+
+Bytes encodeBatch(const std::vector<WsTempSample>& samples, uint32_t now, size_t cap) {
+    Bytes buf(cap);
+    TelemetryCodec::Writer w(buf.data(), buf.size());
+    w.u8(TelemetryCodec::VERSION);
+    if (!TelemetryCodec::encodeTempBatch(w, samples.data(), samples.size(), now)) return {};
+    buf.resize(w.size());
+    return buf;
+}
+
+// Gegenstück zu decodeTempBatch() in apps/backend/src/utils/telemetry.ts
+class Reader {
+public:
+    explicit Reader(const Bytes& data) : data_(data) {}
+
+    uint8_t u8() { return pos_ < data_.size() ? data_[pos_++] : (ok_ = false, 0); }
+    uint32_t varint() {
+        uint32_t v = 0;
+        for (uint8_t shift = 0; shift < 35; shift += 7) {
+            const uint8_t b = u8();
+            v |= (uint32_t)(b & 0x7F) << shift;
+            if (!(b & 0x80)) return v;
+        }
+        ok_ = false;
+        return v;
+    }
+    int32_t zigzag() {
+        const uint32_t v = varint();
+        return (int32_t)(v >> 1) ^ -(int32_t)(v & 1);
+    }
+
+    bool ok() const { return ok_; }
+    bool done() const { return pos_ == data_.size(); }
+
+private:
+    const Bytes& data_;
+    size_t pos_ = 0;
+    bool ok_ = true;
+};
+
+struct Batch {
+    uint32_t age = 0;
+    std::vector<WsTempSample> samples;   // ms relativ zum ersten Sample
+    bool ok = false;
+};
+
+Batch decodeBatch(const Bytes& frame) {
+    Batch batch;
+    Reader r(frame);
+    if (r.u8() != TelemetryCodec::VERSION || r.u8() != (uint8_t)WsMsgType::TEMP_BATCH) return batch;
+    const uint32_t count = r.varint();
+    batch.age = r.varint();
+
+    WsTempSample prev;
+    for (uint32_t i = 0; i < count && r.ok(); i++) {
+        WsTempSample s;
+        const uint8_t flags = r.u8();
+        s.isHeating = flags & TelemetryCodec::FLAG_HEATING;
+        s.zvsOn = flags & TelemetryCodec::FLAG_ZVS;
+        s.power = flags & TelemetryCodec::FLAG_POWER ? r.u8() : prev.power;
+        s.ms = prev.ms + r.varint();
+        s.rawDeci = prev.rawDeci + r.zigzag();
+        s.calDeci = s.rawDeci + r.zigzag();
+        batch.samples.push_back(s);
+        prev = s;
+    }
+    batch.ok = r.ok() && r.done();
+    return batch;
+}
+
+bool sameSamples(const std::vector<WsTempSample>& a, const std::vector<WsTempSample>& b) {
+    if (a.size() != b.size()) return false;
+    for (size_t i = 0; i < a.size(); i++) {
+        if (a[i].ms - a[0].ms != b[i].ms || a[i].rawDeci != b[i].rawDeci || a[i].calDeci != b[i].calDeci ||
+            a[i].power != b[i].power || a[i].zvsOn != b[i].zvsOn || a[i].isHeating != b[i].isHeating)
+            return false;
+    }
+    return true;
+}
+
+WsTempSample sample(uint32_t ms, int16_t raw, int16_t cal, uint8_t power, bool zvs, bool heating) {
+    WsTempSample s;
+    s.ms = ms;
+    s.rawDeci = raw;
+    s.calDeci = cal;
+    s.power = power;
+    s.zvsOn = zvs;
+    s.isHeating = heating;
+    return s;
+}
+
+}  // namespace
+
+void setUp() {}
+void tearDown() {}
+
+void test_records_match_backend_vectors() {
+    WsPendingMsg msg;
+    msg.type = WsMsgType::HEARTBEAT;
+    TEST_ASSERT_TRUE(encode(msg) == Bytes({1, 1}));
+
+    msg = WsPendingMsg();
+    msg.type = WsMsgType::STATUS_UPDATE;
+    msg.isOn = true;
+    TEST_ASSERT_TRUE(encode(msg) == Bytes({1, 2, 1}));
+
+    msg = WsPendingMsg();
+    msg.type = WsMsgType::HEAT_CYCLE_COMPLETED;
+    msg.durationSec = 300;
+    msg.cycle = 2;
+    TEST_ASSERT_TRUE(encode(msg) == Bytes({1, 3, 172, 2, 2}));
+
+    msg = WsPendingMsg();
+    msg.type = WsMsgType::SESSION_UPDATE;
+    msg.clicks = -5;
+    msg.caps = 70000;
+    TEST_ASSERT_TRUE(encode(msg) == Bytes({1, 4, 9, 224, 197, 8}));
+
+    msg = WsPendingMsg();
+    msg.type = WsMsgType::TEMP_READING;
+    msg.tempRaw = 187.4f;
+    msg.tempCalibrated = 181.1f;
+    msg.isHeating = true;
+    TEST_ASSERT_TRUE(encode(msg) == Bytes({1, 5, 2, 164, 29, 125}));
+}
+
+void test_event_meta_and_log_records_match_backend_vectors() {
+    WsPendingMsg msg;
+    msg.type = WsMsgType::HEAT_CYCLE_COMPLETED;
+    msg.durationSec = 300;
+    msg.cycle = 2;
+    msg.seq = 5;
+    TEST_ASSERT_TRUE(encode(msg) == Bytes({1, 7, 5, 0, 3, 172, 2, 2}));
+
+    msg.cycle = 1;
+    msg.seq = 6;
+    msg.at = 1700000000;
+    TEST_ASSERT_TRUE(encode(msg) == Bytes({1, 7, 6, 128, 226, 207, 170, 6, 3, 172, 2, 1}));
+
+    static const uint8_t BUILD_ID[LOG_BUILD_ID_BYTES] = {1, 2, 3, 4, 5, 6, 7, 254};
+    static const uint8_t RECORDS[] = {2, 171, 205};
+    uint8_t buf[32];
+    TelemetryCodec::Writer w(buf, sizeof(buf));
+    w.u8(TelemetryCodec::VERSION);
+    TEST_ASSERT_TRUE(TelemetryCodec::encodeLogRecords(w, BUILD_ID, RECORDS, sizeof(RECORDS)));
+    WsPendingMsg heartbeat;
+    heartbeat.type = WsMsgType::HEARTBEAT;
+    TEST_ASSERT_TRUE(TelemetryCodec::encodeRecord(w, heartbeat));
+    TEST_ASSERT_TRUE(Bytes(buf, buf + w.size()) == Bytes({1, 8, 1, 2, 3, 4, 5, 6, 7, 254, 3, 2, 171, 205, 1}));
+}
+
+void test_temp_batch_matches_backend_vector() {
+    const std::vector<WsTempSample> samples = {
+        sample(1000, 1800, 1850, 100, false, true),
+        sample(1100, 1803, 1853, 100, true, true),
+        sample(1200, 1799, 1849, 60, false, true),
+    };
+    const Bytes frame = encodeBatch(samples, 1250, 64);
+    TEST_ASSERT_TRUE(frame == Bytes({1, 6, 3, 250, 1, 10, 100, 0, 144, 28, 100, 6, 100, 6, 100, 10, 60, 100, 7, 100}));
+
+    const Batch batch = decodeBatch(frame);
+    TEST_ASSERT_TRUE(batch.ok);
+    TEST_ASSERT_EQUAL_UINT32(250, batch.age);
+    TEST_ASSERT_TRUE(sameSamples(samples, batch.samples));
+}
+
+void test_temp_batch_round_trip() {
+    srand(31);
+    std::vector<WsTempSample> samples;
+    uint32_t ms = 0xFFFFF000;   // millis()-Überlauf mitten im Batch
+    int16_t raw = 200;
+    for (uint8_t i = 0; i < 32; i++) {
+        ms += 50 + rand() % 400;
+        raw += rand() % 41 - 20;
+        samples.push_back(sample(ms, raw, raw + rand() % 101 - 50, i / 8 * 30, rand() & 1, i < 24));
+    }
+    const Bytes frame = encodeBatch(samples, ms + 10, 1 + TelemetryCodec::batchBytesMax(samples.size()));
+    TEST_ASSERT_TRUE(frame.size() > 0);
+
+    const Batch batch = decodeBatch(frame);
+    TEST_ASSERT_TRUE(batch.ok);
+    TEST_ASSERT_EQUAL_UINT32(ms + 10 - samples[0].ms, batch.age);
+    TEST_ASSERT_TRUE(sameSamples(samples, batch.samples));
+}
+
+void test_worst_case_hits_bound() {
+    // dt und age > 2^28, Deltas zwischen den int16-Extremen, Leistung wechselt bei jedem Sample
+    for (uint8_t count : {1, 2, 32, 127, 128, 255}) {
+        std::vector<WsTempSample> samples;
+        uint32_t ms = 0;
+        for (uint8_t i = 0; i < count; i++) {
+            const bool even = !(i & 1);
+            samples.push_back(sample(ms, even ? INT16_MIN : INT16_MAX, even ? INT16_MAX : INT16_MIN,
+                                     even ? 0 : 255, true, true));
+            ms += 0xF0000000;
+        }
+        const size_t bound = TelemetryCodec::batchBytesMax(count);
+        const Bytes frame = encodeBatch(samples, 0xF0000000, 1 + bound);
+        TEST_ASSERT_EQUAL_UINT32(1 + bound, frame.size());
+        const Batch batch = decodeBatch(frame);
+        TEST_ASSERT_TRUE(batch.ok);
+        TEST_ASSERT_TRUE(sameSamples(samples, batch.samples));
+
+        // Ein Byte weniger: Encode schlägt fehl statt zu schneiden
+        TEST_ASSERT_TRUE(encodeBatch(samples, 0xF0000000, bound).empty());
+    }
+}
+
+void test_encode_failures() {
+    WsPendingMsg msg;
+    msg.type = WsMsgType::TEMP_BATCH;   // nie in der Queue, kein Record-Encoder
+    uint8_t buf[32];
+    TEST_ASSERT_EQUAL_UINT32(0, TelemetryCodec::encode(msg, buf, sizeof(buf)));
+
+    msg.type = WsMsgType::SESSION_UPDATE;
+    msg.caps = 70000;
+    TEST_ASSERT_EQUAL_UINT32(0, TelemetryCodec::encode(msg, buf, 4));
+
+    TEST_ASSERT_TRUE(encodeBatch({}, 0, 64).empty());
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_records_match_backend_vectors);
+    RUN_TEST(test_event_meta_and_log_records_match_backend_vectors);
+    RUN_TEST(test_temp_batch_matches_backend_vector);
+    RUN_TEST(test_temp_batch_round_trip);
+    RUN_TEST(test_worst_case_hits_bound);
+    RUN_TEST(test_encode_failures);
+    return UNITY_END();
+}
@@ -0,0 +1,119 @@
+// Host-Simulation eines flatternden Links für WiFiManager: pio test -e native
+//
+// 24 h simulierte Zeit im 10-ms-Loop. Der AP ist abwechselnd 5-60 s erreichbar und 0-90 s weg;
+// ein Verbindungsversuch (begin/reconnect) braucht ASSOC_MS, solange der AP erreichbar ist.
+// Geprüft wird, dass der Backoff gedeckelt bleibt, die Callbacks paarweise kommen, die
+// Statistik aufgeht und nach init() keine Heap-Allokationen mehr anfallen.
+#include <unity.h>
+
+#include <new>
+
+#include "driver/net/WiFiManager.h"
+#include "../../src/driver/net/WiFiManager.cpp"
+
+static uint32_t heapAllocs = 0;
+
+void* operator new(size_t size) {
+    heapAllocs++;
+    if (void* p = malloc(size ? size : 1)) return p;
+    throw std::bad_alloc();
+}
+void operator delete(void* p) noexcept { free(p); }
+void operator delete(void* p, size_t) noexcept { free(p); }
+
+namespace {
+
+constexpr uint32_t LOOP_MS = 10;
+constexpr uint32_t SIM_MS = 24u * 3600 * 1000;
+constexpr uint32_t ASSOC_MS = 2000;
+// BACKOFF_MAX_MS plus 25 % Jitter
+constexpr uint32_t BACKOFF_LIMIT_MS = 75000;
+
+struct Run {
+    uint32_t ups = 0;
+    uint32_t downs = 0;
+    uint32_t drops = 0;
+    uint32_t maxBackoffMs = 0;
+    uint32_t allocsAfterInit = 0;
+};
+
+Run simulateFlapping(WiFiManager& wifi, uint32_t seed) {
+    srand(seed);
+    WiFi = MockWiFi();
+    mock::nowMs = 1;
+
+    Run run;
+    wifi.onConnectionChange([&run](bool up) { up ? run.ups++ : run.downs++; });
+    wifi.init("heizbox", "secret", "heizbox");
+    const uint32_t allocsAtInit = heapAllocs;
+
+    bool apUp = true;
+    uint32_t nextFlip = 3000;
+    for (mock::nowMs = 1; mock::nowMs < SIM_MS; mock::nowMs += LOOP_MS) {
+        const uint32_t now = mock::nowMs;
+        if (now >= nextFlip) {
+            apUp = !apUp;
+            nextFlip = now + (apUp ? 5000 + rand() % 55000 : rand() % 90000);
+            if (!apUp && WiFi.up) {
+                WiFi.drop(200 + rand() % 5);  // BEACON_TIMEOUT .. ASSOC_FAIL
+                run.drops++;
+            }
+        }
+        if (apUp && !WiFi.up && wifi.linkState() == WiFiLinkState::CONNECTING &&
+            now - WiFi.lastAttemptMs >= ASSOC_MS) {
+            WiFi.up = true;
+        }
+
+        wifi.update();
+        if (wifi.stats().backoffMs > run.maxBackoffMs) run.maxBackoffMs = wifi.stats().backoffMs;
+    }
+
+    run.allocsAfterInit = heapAllocs - allocsAtInit;
+    return run;
+}
+
+}  // namespace
+
+void setUp() {}
+void tearDown() {}
+
+void test_backoff_stays_capped() {
+    WiFiManager wifi;
+    const Run run = simulateFlapping(wifi, 1);
+    TEST_ASSERT_GREATER_THAN_UINT32(0, run.maxBackoffMs);
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(BACKOFF_LIMIT_MS, run.maxBackoffMs);
+}
+
+void test_callbacks_pair_up() {
+    WiFiManager wifi;
+    const Run run = simulateFlapping(wifi, 2);
+    TEST_ASSERT_GREATER_THAN_UINT32(100, run.ups);
+    TEST_ASSERT_EQUAL_UINT32(run.downs + (wifi.isConnected() ? 1 : 0), run.ups);
+}
+
+void test_stats_add_up() {
+    WiFiManager wifi;
+    const Run run = simulateFlapping(wifi, 3);
+    const WiFiStats& s = wifi.stats();
+    TEST_ASSERT_EQUAL_UINT32(run.drops, s.disconnects);
+    TEST_ASSERT_EQUAL_UINT32(s.disconnects + (wifi.isConnected() ? 1 : 0), s.connects);
+    TEST_ASSERT_EQUAL_UINT32(WiFi.begins + WiFi.reconnects - 1, s.attempts);  // begin() aus init() zählt nicht
+    TEST_ASSERT_LESS_THAN_UINT32(SIM_MS, s.totalDownMs);
+    TEST_ASSERT_GREATER_THAN_UINT32(0, s.longestUpMs);
+}
+
+void test_no_heap_growth_while_flapping() {
+    WiFiManager wifi;
+    const Run run = simulateFlapping(wifi, 4);
+    TEST_ASSERT_GREATER_THAN_UINT32(100, run.drops);
+    TEST_ASSERT_EQUAL_UINT32(0, run.allocsAfterInit);
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_backoff_stays_capped);
+    RUN_TEST(test_callbacks_pair_up);
+    RUN_TEST(test_stats_add_up);
+    RUN_TEST(test_no_heap_growth_while_flapping);
+    return UNITY_END();
+}
@@ -76,6 +76,17 @@ export interface DeviceStatusPayload {
 
 export interface HeatCyclePayload extends HeatCycleRow {}
 
+/**
+ * Befehl an das Gerät (über /send-message), quittiert mit cmdAck gleicher id.
+ */
+export type DeviceCommand =
+	| { cmd: 'setTemp'; temp: number }
+	| { cmd: 'setPreset'; preset: number }
+	| { cmd: 'start' }
+	| { cmd: 'stop' }
+	| { cmd: 'calibrate'; points: { ir: number; temp: number }[] }
+	| { cmd: 'burst'; ms: number }
+
 /**
  * Eine diskriminierte Union für alle möglichen Events, die vom Server gesendet werden.
  */
@@ -86,6 +97,8 @@ export type ServerWebSocketMessage =
 	| { type: 'sessionCreated' }
 	| { type: 'sessionData'; payload: RunningSession }
 	| { type: 'error'; payload: { message: string } }
+	| ({ type: 'cmd'; id: string | number } & DeviceCommand)
+	| { type: 'cmdAck'; id: string | number; ok: boolean; error?: string }
 
 /**
  * Eine diskriminierte Union für alle möglichen Events, die vom Client gesendet werden.